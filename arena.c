@@ -0,0 +1,244 @@
+#include "arena.h"
+#include "tree_sitter/api.h"
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN 16
+#define ARENA_BLOCK_SIZE (1024 * 1024)
+
+struct ArenaBlock {
+  ArenaBlock *next;
+  size_t capacity;
+  size_t used;
+  _Alignas(ARENA_ALIGN) char data[];
+};
+
+static size_t align_up(size_t n) {
+  return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static ArenaBlock *block_new(size_t capacity) {
+  ArenaBlock *b = malloc(sizeof(ArenaBlock) + capacity);
+  if (!b) {
+    fprintf(stderr, "arena failed to allocate %zu bytes\n", capacity);
+    abort();
+  }
+  b->next = NULL;
+  b->capacity = capacity;
+  b->used = 0;
+  return b;
+}
+
+void *arena_alloc(Arena *a, size_t size) {
+  size = align_up(size ? size : 1);
+  ArenaBlock *b = a->current;
+  // after a reset the chain is walked again before growing it
+  while (b && b->capacity - b->used < size)
+    b = b->next;
+  if (!b) {
+    b = block_new(size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE);
+    if (a->current) {
+      b->next = a->current->next;
+      a->current->next = b;
+    } else {
+      a->first = b;
+    }
+  }
+  a->current = b;
+  void *p = b->data + b->used;
+  b->used += size;
+  return p;
+}
+
+void *arena_calloc(Arena *a, size_t count, size_t size) {
+  void *p = arena_alloc(a, count * size);
+  memset(p, 0, count * size);
+  return p;
+}
+
+char *arena_strdup(Arena *a, const char *s) {
+  size_t n = strlen(s) + 1;
+  return memcpy(arena_alloc(a, n), s, n);
+}
+
+char *arena_sprintf(Arena *a, const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(NULL, 0, fmt, args);
+  va_end(args);
+  assert(n >= 0);
+
+  char *result = arena_alloc(a, (size_t)n + 1);
+  va_start(args, fmt);
+  vsnprintf(result, (size_t)n + 1, fmt, args);
+  va_end(args);
+  return result;
+}
+
+void arena_reset(Arena *a) {
+  for (ArenaBlock *b = a->first; b; b = b->next)
+    b->used = 0;
+  a->current = a->first;
+  memset(a->freed, 0, sizeof(a->freed));
+}
+
+void arena_free(Arena *a) {
+  ArenaBlock *b = a->first;
+  while (b) {
+    ArenaBlock *next = b->next;
+    free(b);
+    b = next;
+  }
+  *a = (Arena){0};
+}
+
+size_t arena_used(const Arena *a) {
+  size_t used = 0;
+  for (ArenaBlock *b = a->first; b; b = b->next)
+    used += b->used;
+  return used;
+}
+
+// tree-sitter reallocs and frees, so each of its allocations carries its
+// size and owner, and gets a capacity of its size class: 16-byte steps up to
+// 1 KB, powers of two above. Freed blocks go to the free list of their class
+// (parsing churns through subtrees and stack nodes) and growing or freeing
+// the newest block of the arena works in place, so an arena behind a
+// long-lived parser stays about as large as the biggest file it parsed. With
+// no arena on the thread the hooks fall through to malloc.
+
+#define TS_SMALL_MAX 1024
+
+typedef struct {
+  size_t size;
+  Arena *owner;
+} TsHeader;
+
+_Static_assert(sizeof(TsHeader) % ARENA_ALIGN == 0,
+               "TsHeader breaks alignment");
+
+static _Thread_local Arena *ts_arena;
+
+static TsHeader *ts_header(void *ptr) { return (TsHeader *)ptr - 1; }
+
+static size_t ts_capacity(size_t size) {
+  if (size <= TS_SMALL_MAX)
+    return align_up(size);
+  size_t cap = TS_SMALL_MAX * 2;
+  while (cap < size)
+    cap *= 2;
+  return cap;
+}
+
+static size_t ts_class(size_t capacity) {
+  if (capacity <= TS_SMALL_MAX)
+    return capacity / ARENA_ALIGN;
+  size_t class = TS_SMALL_MAX / ARENA_ALIGN;
+  for (size_t cap = TS_SMALL_MAX; cap < capacity; cap *= 2)
+    class++;
+  assert(class <= ARENA_FREE_CLASSES);
+  return class;
+}
+
+static bool ts_is_last(TsHeader *h) {
+  ArenaBlock *b = h->owner->current;
+  char *end = (char *)(h + 1) + ts_capacity(h->size);
+  return (char *)h >= b->data && end == b->data + b->used;
+}
+
+static void *ts_hook_malloc(size_t size) {
+  TsHeader *h;
+  size = size ? size : 1; // every block can hold a free-list link
+  if (ts_arena) {
+    size_t cap = ts_capacity(size);
+    void **freed = &ts_arena->freed[ts_class(cap)];
+    if (*freed) {
+      h = *freed;
+      *freed = *(void **)(h + 1);
+    } else {
+      h = arena_alloc(ts_arena, sizeof(TsHeader) + cap);
+    }
+  } else {
+    h = malloc(sizeof(TsHeader) + size);
+    if (!h) {
+      fprintf(stderr, "tree-sitter failed to allocate %zu bytes\n", size);
+      abort();
+    }
+  }
+  h->size = size;
+  h->owner = ts_arena;
+  return h + 1;
+}
+
+static void *ts_hook_calloc(size_t count, size_t size) {
+  void *p = ts_hook_malloc(count * size);
+  memset(p, 0, count * size);
+  return p;
+}
+
+static void ts_hook_free(void *ptr) {
+  if (!ptr)
+    return;
+  TsHeader *h = ts_header(ptr);
+  if (!h->owner) {
+    free(h);
+    return;
+  }
+  size_t cap = ts_capacity(h->size);
+  if (ts_is_last(h)) {
+    h->owner->current->used -= sizeof(TsHeader) + cap;
+  } else {
+    void **freed = &h->owner->freed[ts_class(cap)];
+    *(void **)ptr = *freed;
+    *freed = h;
+  }
+}
+
+static void *ts_hook_realloc(void *ptr, size_t size) {
+  if (!ptr)
+    return ts_hook_malloc(size);
+  size = size ? size : 1;
+  TsHeader *h = ts_header(ptr);
+  if (!h->owner) {
+    h = realloc(h, sizeof(TsHeader) + size);
+    if (!h) {
+      fprintf(stderr, "tree-sitter failed to reallocate %zu bytes\n", size);
+      abort();
+    }
+    h->size = size;
+    return h + 1;
+  }
+
+  size_t old_cap = ts_capacity(h->size), cap = ts_capacity(size);
+  if (cap == old_cap) {
+    h->size = size;
+    return ptr;
+  }
+  ArenaBlock *b = h->owner->current;
+  if (cap > old_cap && ts_is_last(h) &&
+      b->capacity - b->used >= cap - old_cap) {
+    b->used += cap - old_cap;
+    h->size = size;
+    return ptr;
+  }
+  void *moved = ts_hook_malloc(size);
+  memcpy(moved, ptr, size < h->size ? size : h->size);
+  ts_hook_free(ptr);
+  return moved;
+}
+
+void arena_use_for_tree_sitter(Arena *a) {
+  static bool installed;
+  if (!installed) {
+    ts_set_allocator(ts_hook_malloc, ts_hook_calloc, ts_hook_realloc,
+                     ts_hook_free);
+    installed = true;
+  }
+  ts_arena = a;
+}
@@ -0,0 +1,37 @@
+#ifndef CCOMPTIME_ARENA_H
+#define CCOMPTIME_ARENA_H
+
+#include <stddef.h>
+
+// Bump allocator made of chained blocks. Everything allocated from an arena
+// is released at once by arena_reset (which keeps the blocks for the next
+// use) or arena_free. A zeroed arena is empty.
+
+typedef struct ArenaBlock ArenaBlock;
+
+#define ARENA_FREE_CLASSES 112
+
+typedef struct {
+  ArenaBlock *first;
+  ArenaBlock *current;
+  void *freed[ARENA_FREE_CLASSES + 1]; // tree-sitter blocks, by size class
+} Arena;
+
+void *arena_alloc(Arena *a, size_t size);
+void *arena_calloc(Arena *a, size_t count, size_t size);
+char *arena_strdup(Arena *a, const char *s);
+char *arena_sprintf(Arena *a, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+void arena_reset(Arena *a);
+void arena_free(Arena *a);
+// Bytes handed out since the last reset.
+size_t arena_used(const Arena *a);
+
+// Route tree-sitter's allocations on this thread to `a` (NULL goes back to
+// malloc). What tree-sitter frees is reused, so `a` can back a parser that
+// outlives many files; every tree-sitter object allocated from it has to be
+// gone before `a` is reset. The first call must happen before other threads
+// use tree-sitter.
+void arena_use_for_tree_sitter(Arena *a);
+
+#endif // CCOMPTIME_ARENA_H
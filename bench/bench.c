@@ -0,0 +1,720 @@
+// Benchmarks the ccomptime pipeline on generated sources.
+//
+//   ./nob bench [pattern] [-reps=N] [-scale=F] [-out=results.json]
+//               [-baseline=results.json]
+//   ./nob bench -scaling [pattern] [-reps=N] [-scale=F]
+//   ./nob bench -maps [-reps=N] [-scale=F]
+//
+// Every corpus is built cold (-comptime-no-cache), warm (cached runner and
+// results) and with the plain compiler on the same source and generated
+// header. Stage times come from -comptime-stats of the cold builds. Results
+// are printed as a table and written as JSON, one record per line, which is
+// also the format -baseline compares against.
+//
+// -scaling instead builds every corpus at N, 2N, 4N and 8N (N being a quarter
+// of its -scale size) and fails when a front-end stage grows clearly faster
+// than linearly.
+//
+// -maps times SliceMap against the chibicc HashMap it replaced on
+// identifier-shaped keys.
+#define NOB_IMPLEMENTATION
+#include "../nob.h"
+
+#define HASHMAP_IMPLEMENTATION
+#include "../deps/hashmap/hashmap.h"
+// built in, so the runner still rebuilds itself from this file alone
+#include "../slice_map.c"
+
+#include "../ansi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CCOMPTIME_BIN "./build/ccomptime"
+#define COMPILER "clang"
+#define CORPORA_DIR "build/bench-corpora"
+#define BENCH_CACHE_DIR "build/bench-cache"
+
+typedef struct {
+  const char *name;
+  const char *description;
+  void (*generate)(String_Builder *out, int n);
+  int n; // size at -scale=1
+} Corpus;
+
+#define PRELUDE                                                                \
+  "#include <stdio.h>\n\n#include \"../../../ccomptime.h\"\n"                  \
+  "#include \"main.c.h\"\n\n"
+
+// N inline blocks in one function.
+static void gen_blocks(String_Builder *out, int n) {
+  sb_append_cstr(out, PRELUDE "int main(void) {\n  long sum = 0;\n");
+  for (int i = 0; i < n; i++) {
+    sb_appendf(out,
+               "  sum += _Comptime({ _ComptimeCtx.Inline.appendf(\"%%d\", "
+               "%d * %d); });\n",
+               i, i);
+  }
+  sb_append_cstr(out, "  printf(\"%ld\\n\", sum);\n  return 0;\n}\n");
+}
+
+// N plain macros, every tenth one expanding to a comptime block.
+static void gen_macros(String_Builder *out, int n) {
+  sb_append_cstr(out, PRELUDE);
+  for (int i = 0; i < n; i++) {
+    if (i % 10 == 0)
+      sb_appendf(out,
+                 "#define MACRO_%d(x) _Comptime({ "
+                 "_ComptimeCtx.Inline.appendf(\"%%d\", (x) + %d); })\n",
+                 i, i);
+    else
+      sb_appendf(out, "#define MACRO_%d(x) ((x) * %d + 1)\n", i, i);
+  }
+  sb_append_cstr(out, "\nint main(void) {\n  long sum = 0;\n");
+  for (int i = 0; i < n; i++) {
+    sb_appendf(out, "  sum += MACRO_%d(%d);\n", i, i);
+  }
+  sb_append_cstr(out, "  printf(\"%ld\\n\", sum);\n  return 0;\n}\n");
+}
+
+// A header's worth of definitions: N object-like and function-like macros,
+// one in a hundred expanding to a comptime block.
+static void gen_defines(String_Builder *out, int n) {
+  sb_append_cstr(out, PRELUDE);
+  for (int i = 0; i < n; i++) {
+    if (i % 100 == 0)
+      sb_appendf(out,
+                 "#define DEF_%d(x) _Comptime({ "
+                 "_ComptimeCtx.Inline.appendf(\"%%d\", (x) + %d); })\n",
+                 i, i);
+    else if (i % 2)
+      sb_appendf(out, "#define DEF_%d 0x%xu /* flag %d */\n", i, i, i);
+    else
+      sb_appendf(out, "#define DEF_%d(a, b) (((a) << %d) | ((b) & 0x%x))\n",
+                 i, i % 31, i);
+  }
+  sb_append_cstr(out, "\nint main(void) {\n  long sum = 0;\n");
+  for (int i = 0; i < n; i += 100) {
+    sb_appendf(out, "  sum += DEF_%d(%d);\n", i, i);
+  }
+  sb_append_cstr(out, "  printf(\"%ld\\n\", sum);\n  return 0;\n}\n");
+}
+
+// A block at the bottom of N nested scopes and expressions.
+static void gen_nesting(String_Builder *out, int n) {
+  sb_append_cstr(out, PRELUDE "int main(int argc, char **argv) {\n"
+                          "  (void)argv;\n  long sum = 0;\n");
+  for (int i = 0; i < n; i++) {
+    sb_appendf(out, "%*sif (argc > %d - %d) {\n", 2 + i, "", i, n);
+  }
+  sb_appendf(out, "%*ssum += ", 2 + n, "");
+  for (int i = 0; i < n; i++) {
+    sb_append_cstr(out, "(1 + ");
+  }
+  sb_append_cstr(out, "_Comptime({ _ComptimeCtx.Inline.appendf(\"42\"); })");
+  for (int i = 0; i < n; i++) {
+    da_append(out, ')');
+  }
+  sb_append_cstr(out, ";\n");
+  for (int i = n - 1; i >= 0; i--) {
+    sb_appendf(out, "%*s}\n", 2 + i, "");
+  }
+  sb_append_cstr(out, "  printf(\"%ld\\n\", sum);\n  return 0;\n}\n");
+}
+
+// N functions whose return type is computed at compile time.
+static void gen_comptime_types(String_Builder *out, int n) {
+  sb_append_cstr(out, PRELUDE "void gen_type(_ComptimeCtx _ComptimeCtx) {\n"
+                              "  _ComptimeCtx.Inline.appendf(\"long\");\n"
+                              "}\n\n");
+  for (int i = 0; i < n; i++) {
+    sb_appendf(out,
+               "_ComptimeType(gen_type(_ComptimeCtx)) value_%d(void) { "
+               "return %d; }\n",
+               i, i);
+  }
+  sb_append_cstr(out, "\nint main(void) {\n  long sum = 0;\n");
+  for (int i = 0; i < n; i++) {
+    sb_appendf(out, "  sum += value_%d();\n", i);
+  }
+  sb_append_cstr(out, "  printf(\"%ld\\n\", sum);\n  return 0;\n}\n");
+}
+
+// Megabytes of ordinary code around a single block.
+static void gen_runtime(String_Builder *out, int n) {
+  sb_append_cstr(out, PRELUDE);
+  for (int i = 0; i < n; i++) {
+    sb_appendf(out,
+               "static long runtime_fn_%d(long x) {\n"
+               "  long acc = x * %d;\n"
+               "  for (int i = 0; i < 3; i++) acc = (acc ^ (x >> i)) + %d;\n"
+               "  return acc;\n"
+               "}\n",
+               i, i, i);
+  }
+  sb_append_cstr(out, "\nint main(void) {\n  long sum = _Comptime({ "
+                      "_ComptimeCtx.Inline.appendf(\"1\"); });\n");
+  for (int i = 0; i < n; i++) {
+    sb_appendf(out, "  sum += runtime_fn_%d(sum);\n", i);
+  }
+  sb_append_cstr(out, "  printf(\"%ld\\n\", sum);\n  return 0;\n}\n");
+}
+
+static Corpus corpora[] = {
+    {"blocks", "inline comptime blocks", gen_blocks, 200},
+    {"macros", "macros, some expanding to blocks", gen_macros, 1000},
+    {"defines", "thousands of defines, few comptime", gen_defines, 5000},
+    {"nesting", "deeply nested scopes around a block", gen_nesting, 150},
+    {"comptime_types", "_ComptimeType placeholders", gen_comptime_types, 200},
+    {"runtime", "multi-MB runtime code, one block", gen_runtime, 12000},
+};
+
+typedef struct {
+  const char *corpus;
+  const char *metric;
+  double ms;
+} Result;
+
+typedef struct {
+  Result *items;
+  size_t count;
+  size_t capacity;
+} Results;
+
+typedef struct {
+  double *items;
+  size_t count;
+  size_t capacity;
+} Samples;
+
+typedef struct {
+  const char *name;
+  Samples samples;
+} Metric;
+
+typedef struct {
+  Metric *items;
+  size_t count;
+  size_t capacity;
+} Metrics;
+
+static Samples *metric_samples(Metrics *metrics, const char *name) {
+  da_foreach(Metric, it, metrics) {
+    if (strcmp(it->name, name) == 0)
+      return &it->samples;
+  }
+  da_append(metrics, ((Metric){.name = strdup(name)}));
+  return &metrics->items[metrics->count - 1].samples;
+}
+
+static int compare_double(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static double median(Samples *samples) {
+  if (samples->count == 0)
+    return 0;
+  qsort(samples->items, samples->count, sizeof(double), compare_double);
+  return samples->items[samples->count / 2];
+}
+
+static double now_ms(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static bool timed_run(Cmd *cmd, const char *log_path, double *ms) {
+  double start = now_ms();
+  bool ok = cmd_run(cmd, .stdout_path = log_path, .stderr_path = log_path);
+  *ms = now_ms() - start;
+  return ok;
+}
+
+// Collect the stage times of a -comptime-stats=json file, skipping the stage
+// spanning the whole input (named after the file).
+static void read_stages(const char *stats_path, const char *input,
+                        Metrics *metrics) {
+  String_Builder json = {0};
+  if (!read_entire_file(stats_path, &json))
+    return;
+  sb_append_null(&json);
+  const char *p = json.items;
+  while ((p = strstr(p, "{\"name\": \"")) != NULL) {
+    char name[128];
+    double ms;
+    if (sscanf(p, "{\"name\": \"%127[^\"]\", \"ms\": %lf}", name, &ms) == 2 &&
+        strcmp(name, input) != 0)
+      da_append(metric_samples(metrics, name), ms);
+    p++;
+  }
+  sb_free(json);
+}
+
+static bool bench_corpus(const Corpus *corpus, int reps, double scale,
+                         Results *results) {
+  const char *dir = temp_sprintf(CORPORA_DIR "/%s", corpus->name);
+  const char *input = temp_sprintf("%s/main.c", dir);
+  const char *exe = temp_sprintf("%s/out", dir);
+  const char *stats = temp_sprintf("%s/stats.json", dir);
+  const char *log = temp_sprintf("%s/log.txt", dir);
+  if (!mkdir_if_not_exists(dir))
+    return false;
+
+  int n = (int)(corpus->n * scale);
+  if (n < 1)
+    n = 1;
+  String_Builder source = {0};
+  corpus->generate(&source, n);
+  bool ok = write_entire_file(input, source.items, source.count);
+  nob_log(INFO, "%s: %s, n=%d, %.1f KiB", corpus->name, corpus->description,
+          n, source.count / 1024.0);
+  sb_free(source);
+  if (!ok)
+    return false;
+
+  Metrics metrics = {0};
+  Cmd cmd = {0};
+  double ms;
+
+  for (int rep = 0; rep < reps; rep++) {
+    cmd_append(&cmd, CCOMPTIME_BIN, COMPILER, "-comptime-no-cache",
+               temp_sprintf("-comptime-stats=json:%s", stats), input, "-o",
+               exe);
+    if (!timed_run(&cmd, log, &ms)) {
+      nob_log(ERROR, "%s: ccomptime failed, see %s", corpus->name, log);
+      return false;
+    }
+    da_append(metric_samples(&metrics, "end to end (cold)"), ms);
+    read_stages(stats, input, &metrics);
+  }
+
+  // prime the cache, then measure the warm rebuilds
+  cmd_append(&cmd, CCOMPTIME_BIN, COMPILER, input, "-o", exe);
+  if (!cmd_run(&cmd, .stdout_path = log, .stderr_path = log))
+    return false;
+  for (int rep = 0; rep < reps; rep++) {
+    cmd_append(&cmd, CCOMPTIME_BIN, COMPILER, input, "-o", exe);
+    if (!timed_run(&cmd, log, &ms))
+      return false;
+    da_append(metric_samples(&metrics, "end to end (warm)"), ms);
+  }
+
+  // the same source with its generated header, without ccomptime
+  for (int rep = 0; rep < reps; rep++) {
+    cmd_append(&cmd, COMPILER, input, "-o", exe);
+    if (!timed_run(&cmd, log, &ms)) {
+      nob_log(ERROR, "%s: %s failed, see %s", corpus->name, COMPILER, log);
+      return false;
+    }
+    da_append(metric_samples(&metrics, "plain " COMPILER), ms);
+  }
+  cmd_free(cmd);
+
+  da_foreach(Metric, it, &metrics) {
+    da_append(results, ((Result){corpus->name, it->name,
+                                 median(&it->samples)}));
+    free(it->samples.items);
+  }
+  da_free(metrics);
+  return true;
+}
+
+// The stages ccomptime itself implements; the compiler and runner stages
+// scale with whatever the blocks do.
+static const char *frontend_stages[] = {
+    "parse",
+    "cct_expand_macros",
+    "cct_correct_comptimetype_nodes",
+    "cct_collect_comptime_statements",
+    "cct_tree_shake",
+    "build runner sources",
+};
+
+#define SCALING_STEPS 4
+// 8x the input may cost at most this much more: 8 is linear, 64 quadratic.
+#define SCALING_MAX_GROWTH 32.0
+// stages faster than this at 8N are mostly noise
+#define SCALING_MIN_MS 2.0
+
+static bool scaling_corpus(const Corpus *corpus, int reps, double scale) {
+  const char *dir = temp_sprintf(CORPORA_DIR "/%s", corpus->name);
+  const char *input = temp_sprintf("%s/main.c", dir);
+  const char *exe = temp_sprintf("%s/out", dir);
+  const char *stats = temp_sprintf("%s/stats.json", dir);
+  const char *log = temp_sprintf("%s/log.txt", dir);
+  if (!mkdir_if_not_exists(dir))
+    return false;
+
+  int base = (int)(corpus->n * scale / 4);
+  if (base < 1)
+    base = 1;
+
+  enum { STAGE_COUNT = ARRAY_LEN(frontend_stages) };
+  // the last column is the sum of all front-end stages
+  double ms[SCALING_STEPS][STAGE_COUNT + 1] = {0};
+  Cmd cmd = {0};
+
+  for (int step = 0; step < SCALING_STEPS; step++) {
+    int n = base << step;
+    String_Builder source = {0};
+    corpus->generate(&source, n);
+    bool ok = write_entire_file(input, source.items, source.count);
+    nob_log(INFO, "%s: n=%d, %.1f KiB", corpus->name, n,
+            source.count / 1024.0);
+    sb_free(source);
+    if (!ok)
+      return false;
+
+    Metrics metrics = {0};
+    for (int rep = 0; rep < reps; rep++) {
+      cmd_append(&cmd, CCOMPTIME_BIN, COMPILER, "-comptime-no-cache",
+                 temp_sprintf("-comptime-stats=json:%s", stats), input, "-o",
+                 exe);
+      if (!cmd_run(&cmd, .stdout_path = log, .stderr_path = log)) {
+        nob_log(ERROR, "%s: ccomptime failed, see %s", corpus->name, log);
+        return false;
+      }
+      read_stages(stats, input, &metrics);
+    }
+    for (size_t s = 0; s < STAGE_COUNT; s++) {
+      ms[step][s] = median(metric_samples(&metrics, frontend_stages[s]));
+      ms[step][STAGE_COUNT] += ms[step][s];
+    }
+    da_foreach(Metric, it, &metrics) free(it->samples.items);
+    da_free(metrics);
+  }
+  cmd_free(cmd);
+
+  bool ok = true;
+  printf("\n" BOLD("%-34s") " %9s %9s %9s %9s %8s\n", corpus->name, "N", "2N",
+         "4N", "8N", "growth");
+  for (size_t s = 0; s <= STAGE_COUNT; s++) {
+    const char *name = s < STAGE_COUNT ? frontend_stages[s] : "front end";
+    double first = ms[0][s], last = ms[SCALING_STEPS - 1][s];
+    double growth = last / (first > 0.01 ? first : 0.01);
+    printf("  %-32s", name);
+    for (int step = 0; step < SCALING_STEPS; step++)
+      printf(" %9.2f", ms[step][s]);
+    if (last < SCALING_MIN_MS) {
+      printf(GRAY(" %7.1fx") "\n", growth);
+    } else if (growth > SCALING_MAX_GROWTH) {
+      printf(RED(" %7.1fx") "\n", growth);
+      ok = false;
+    } else {
+      printf(" %7.1fx\n", growth);
+    }
+  }
+  if (!ok)
+    nob_log(ERROR, "%s: superlinear front-end stage (more than %.0fx for 8x "
+                   "the input)",
+            corpus->name, SCALING_MAX_GROWTH);
+  return ok;
+}
+
+typedef struct {
+  Slice *items;
+  size_t count, capacity;
+} Keys;
+
+// Identifiers as they show up in C sources: short, sharing prefixes.
+static void gen_keys(Keys *keys, String_Builder *storage, int n,
+                     const char *prefix) {
+  static const char *stems[] = {"i", "len", "ctx", "node", "buffer_", "value",
+                                "_ComptimeCtx_", "runtime_fn_"};
+  for (int i = 0; i < n; i++)
+    sb_appendf(storage, "%s%s%d", prefix, stems[i % ARRAY_LEN(stems)], i);
+  // slices are taken once the buffer stopped moving
+  const char *p = storage->items;
+  for (int i = 0; i < n; i++) {
+    int len = snprintf(NULL, 0, "%s%s%d", prefix,
+                       stems[i % ARRAY_LEN(stems)], i);
+    da_append(keys, ((Slice){p, len}));
+    p += len;
+  }
+}
+
+// Lookups go in a fixed pseudo-random order: looked up in insertion order,
+// FNV puts consecutive keys in neighbouring buckets and HashMap would get a
+// cache locality real lookups never see.
+static void shuffle_keys(Keys *keys) {
+  uint64_t state = 0x2545f4914f6cdd1dull;
+  for (size_t i = keys->count; i > 1; i--) {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    size_t j = (size_t)(state >> 33) % i;
+    Slice tmp = keys->items[i - 1];
+    keys->items[i - 1] = keys->items[j];
+    keys->items[j] = tmp;
+  }
+}
+
+static volatile uintptr_t map_sink;
+
+#define MAP_OPS(X)                                                             \
+  X(insert)                                                                    \
+  X(hit)                                                                       \
+  X(miss)                                                                      \
+  X(iterate)
+
+enum {
+#define X(op) MapOp_##op,
+  MAP_OPS(X)
+#undef X
+      MapOp_Count
+};
+
+static const char *map_op_names[] = {
+#define X(op) #op,
+    MAP_OPS(X)
+#undef X
+};
+
+static void time_hashmap(Keys *keys, Keys *hits, Keys *misses, double *ms) {
+  HashMap map = {0};
+  double t = now_ms();
+  da_foreach(Slice, k, keys) hashmap_put2(&map, (char *)k->start, k->len, k);
+  ms[MapOp_insert] = now_ms() - t;
+
+  t = now_ms();
+  da_foreach(Slice, k, hits) map_sink +=
+      (uintptr_t)hashmap_get2(&map, (char *)k->start, k->len);
+  ms[MapOp_hit] = now_ms() - t;
+
+  t = now_ms();
+  da_foreach(Slice, k, misses) map_sink +=
+      (uintptr_t)hashmap_get2(&map, (char *)k->start, k->len);
+  ms[MapOp_miss] = now_ms() - t;
+
+  t = now_ms();
+  for (int i = 0; i < map.capacity; i++) {
+    HashEntry *ent = &map.buckets[i];
+    if (ent->key && ent->key != (void *)-1)
+      map_sink += (uintptr_t)ent->val;
+  }
+  ms[MapOp_iterate] = now_ms() - t;
+  free(map.buckets);
+}
+
+static void time_slice_map(Keys *keys, Keys *hits, Keys *misses, double *ms) {
+  SliceMap map = {0};
+  double t = now_ms();
+  da_foreach(Slice, k, keys) slice_map_put(&map, *k, k);
+  ms[MapOp_insert] = now_ms() - t;
+
+  t = now_ms();
+  da_foreach(Slice, k, hits) map_sink += (uintptr_t)slice_map_get(&map, *k);
+  ms[MapOp_hit] = now_ms() - t;
+
+  t = now_ms();
+  da_foreach(Slice, k, misses) map_sink += (uintptr_t)slice_map_get(&map, *k);
+  ms[MapOp_miss] = now_ms() - t;
+
+  t = now_ms();
+  SliceMapEntry *entry;
+  for (size_t it = 0; (entry = slice_map_next(&map, &it));)
+    map_sink += (uintptr_t)entry->val;
+  ms[MapOp_iterate] = now_ms() - t;
+  slice_map_free(&map);
+}
+
+static void bench_maps(int reps, double scale) {
+  static const int sizes[] = {100, 10000, 1000000};
+  printf(BOLD("%-24s") " %12s %12s %8s\n", "median ms", "HashMap", "SliceMap",
+         "speedup");
+
+  for (size_t s = 0; s < ARRAY_LEN(sizes); s++) {
+    int n = (int)(sizes[s] * scale);
+    if (n < 1)
+      n = 1;
+    // small maps are timed over many rounds to get above the clock noise
+    int rounds = 1000000 / n > 0 ? 1000000 / n : 1;
+
+    String_Builder key_storage = {0}, miss_storage = {0};
+    Keys keys = {0}, hits = {0}, misses = {0};
+    gen_keys(&keys, &key_storage, n, "");
+    gen_keys(&misses, &miss_storage, n, "missing_");
+    da_append_many(&hits, keys.items, keys.count);
+    shuffle_keys(&hits);
+    shuffle_keys(&misses);
+
+    Samples old_samples[MapOp_Count] = {0}, new_samples[MapOp_Count] = {0};
+    for (int rep = 0; rep < reps; rep++) {
+      double old_ms[MapOp_Count] = {0}, new_ms[MapOp_Count] = {0};
+      for (int r = 0; r < rounds; r++) {
+        double a[MapOp_Count], b[MapOp_Count];
+        time_hashmap(&keys, &hits, &misses, a);
+        time_slice_map(&keys, &hits, &misses, b);
+        for (int op = 0; op < MapOp_Count; op++) {
+          old_ms[op] += a[op];
+          new_ms[op] += b[op];
+        }
+      }
+      for (int op = 0; op < MapOp_Count; op++) {
+        da_append(&old_samples[op], old_ms[op]);
+        da_append(&new_samples[op], new_ms[op]);
+      }
+    }
+
+    printf("\n" BOLD("%d keys") " x %d rounds\n", n, rounds);
+    for (int op = 0; op < MapOp_Count; op++) {
+      double old_ms = median(&old_samples[op]);
+      double new_ms = median(&new_samples[op]);
+      printf("  %-22s %12.3f %12.3f %7.2fx\n", map_op_names[op], old_ms,
+             new_ms, new_ms > 0 ? old_ms / new_ms : 0);
+      free(old_samples[op].items);
+      free(new_samples[op].items);
+    }
+    da_free(keys);
+    da_free(hits);
+    da_free(misses);
+    sb_free(key_storage);
+    sb_free(miss_storage);
+  }
+}
+
+static bool read_results(const char *path, Results *out) {
+  String_Builder json = {0};
+  if (!read_entire_file(path, &json))
+    return false;
+  String_View rest = sb_to_sv(json);
+  while (rest.count > 0) {
+    const char *line = temp_sv_to_cstr(sv_chop_by_delim(&rest, '\n'));
+    char corpus[64], metric[128];
+    double ms;
+    if (sscanf(line, " {\"corpus\": \"%63[^\"]\", \"metric\": \"%127[^\"]\", "
+                     "\"ms\": %lf}",
+               corpus, metric, &ms) == 3)
+      da_append(out, ((Result){strdup(corpus), strdup(metric), ms}));
+  }
+  sb_free(json);
+  return true;
+}
+
+static const Result *find_result(const Results *results, const Result *r) {
+  da_foreach(Result, it, results) {
+    if (strcmp(it->corpus, r->corpus) == 0 &&
+        strcmp(it->metric, r->metric) == 0)
+      return it;
+  }
+  return NULL;
+}
+
+static bool write_results(const char *path, const Results *results) {
+  String_Builder json = {0};
+  sb_append_cstr(&json, "[\n");
+  for (size_t i = 0; i < results->count; i++) {
+    const Result *r = &results->items[i];
+    sb_appendf(&json, "  {\"corpus\": \"%s\", \"metric\": \"%s\", \"ms\": %.3f}%s\n",
+               r->corpus, r->metric, r->ms, i + 1 < results->count ? "," : "");
+  }
+  sb_append_cstr(&json, "]\n");
+  bool ok = write_entire_file(path, json.items, json.count);
+  sb_free(json);
+  return ok;
+}
+
+static void print_results(const Results *results, const Results *baseline) {
+  const char *corpus = NULL;
+  for (size_t i = 0; i < results->count; i++) {
+    const Result *r = &results->items[i];
+    if (!corpus || strcmp(corpus, r->corpus) != 0) {
+      corpus = r->corpus;
+      printf("\n" BOLD("%-36s") " %12s", corpus, "median ms");
+      if (baseline)
+        printf(" %12s %8s", "baseline", "change");
+      printf("\n");
+    }
+    printf("  %-34s %12.2f", r->metric, r->ms);
+    const Result *base = baseline ? find_result(baseline, r) : NULL;
+    if (base && base->ms > 0) {
+      double change = (r->ms - base->ms) / base->ms * 100.0;
+      printf(" %12.2f ", base->ms);
+      // small stages are mostly noise
+      if (change > 10 && r->ms - base->ms > 1)
+        printf(RED("%+7.1f%%"), change);
+      else if (change < -10 && base->ms - r->ms > 1)
+        printf(GREEN("%+7.1f%%"), change);
+      else
+        printf("%+7.1f%%", change);
+    }
+    printf("\n");
+  }
+}
+
+int main(int argc, char **argv) {
+  NOB_GO_REBUILD_URSELF_PLUS(argc, argv, "nob.h");
+  nob_minimal_log_level = NOB_INFO;
+
+  // argv[1] is the `bench` nob was called with
+  const char *pattern = NULL;
+  const char *out_path = "build/bench-results.json";
+  const char *baseline_path = NULL;
+  int reps = 3;
+  double scale = 1.0;
+  bool scaling = false;
+  bool maps = false;
+  for (int i = 2; i < argc; i++) {
+    if (strcmp(argv[i], "-scaling") == 0) {
+      scaling = true;
+    } else if (strcmp(argv[i], "-maps") == 0) {
+      maps = true;
+    } else if (strncmp(argv[i], "-reps=", 6) == 0) {
+      reps = atoi(argv[i] + 6);
+    } else if (strncmp(argv[i], "-scale=", 7) == 0) {
+      scale = atof(argv[i] + 7);
+    } else if (strncmp(argv[i], "-out=", 5) == 0) {
+      out_path = argv[i] + 5;
+    } else if (strncmp(argv[i], "-baseline=", 10) == 0) {
+      baseline_path = argv[i] + 10;
+    } else {
+      pattern = argv[i];
+    }
+  }
+  if (reps < 1)
+    reps = 1;
+
+  Results baseline = {0};
+  if (baseline_path && !read_results(baseline_path, &baseline)) {
+    nob_log(ERROR, "Could not read baseline %s", baseline_path);
+    return 1;
+  }
+
+  if (!mkdir_if_not_exists(CORPORA_DIR))
+    return 1;
+  setenv("CCOMPTIME_CACHE_DIR", BENCH_CACHE_DIR, 1);
+
+  if (maps) {
+    bench_maps(reps, scale);
+    return 0;
+  }
+
+  if (scaling) {
+    bool ok = true;
+    for (size_t i = 0; i < ARRAY_LEN(corpora); i++) {
+      if (pattern && !strstr(corpora[i].name, pattern))
+        continue;
+      size_t mark = temp_save();
+      ok = scaling_corpus(&corpora[i], reps, scale) && ok;
+      temp_rewind(mark);
+    }
+    return ok ? 0 : 1;
+  }
+
+  Results results = {0};
+  bool ok = true;
+  for (size_t i = 0; i < ARRAY_LEN(corpora); i++) {
+    if (pattern && !strstr(corpora[i].name, pattern))
+      continue;
+    size_t mark = temp_save();
+    ok = bench_corpus(&corpora[i], reps, scale, &results) && ok;
+    temp_rewind(mark);
+  }
+
+  print_results(&results, baseline_path ? &baseline : NULL);
+  if (!write_results(out_path, &results))
+    return 1;
+  nob_log(INFO, "Wrote %s", out_path);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) long
+#define _COMPTIMETYPE_0 long
+#define _COMPTIME_X1(...) long
+#define _COMPTIMETYPE_1 long
+#define _COMPTIME_X2(...) long
+#define _COMPTIMETYPE_2 long
+#define _COMPTIME_X3(...) long
+#define _COMPTIMETYPE_3 long
+#define _COMPTIME_X4(...) long
+#define _COMPTIMETYPE_4 long
+#define _COMPTIME_X5(...) long
+#define _COMPTIMETYPE_5 long
+#define _COMPTIME_X6(...) long
+#define _COMPTIMETYPE_6 long
+#define _COMPTIME_X7(...) long
+#define _COMPTIMETYPE_7 long
+#define _COMPTIME_X8(...) long
+#define _COMPTIMETYPE_8 long
+#define _COMPTIME_X9(...) long
+#define _COMPTIMETYPE_9 long
+#define _COMPTIME_X10(...) long
+#define _COMPTIMETYPE_10 long
+#define _COMPTIME_X11(...) long
+#define _COMPTIMETYPE_11 long
+#define _COMPTIME_X12(...) long
+#define _COMPTIMETYPE_12 long
+#define _COMPTIME_X13(...) long
+#define _COMPTIMETYPE_13 long
+#define _COMPTIME_X14(...) long
+#define _COMPTIMETYPE_14 long
+#define _COMPTIME_X15(...) long
+#define _COMPTIMETYPE_15 long
+#define _COMPTIME_X16(...) long
+#define _COMPTIMETYPE_16 long
+#define _COMPTIME_X17(...) long
+#define _COMPTIMETYPE_17 long
+#define _COMPTIME_X18(...) long
+#define _COMPTIMETYPE_18 long
+#define _COMPTIME_X19(...) long
+#define _COMPTIMETYPE_19 long
+#define _COMPTIME_X20(...) long
+#define _COMPTIMETYPE_20 long
+#define _COMPTIME_X21(...) long
+#define _COMPTIMETYPE_21 long
+#define _COMPTIME_X22(...) long
+#define _COMPTIMETYPE_22 long
+#define _COMPTIME_X23(...) long
+#define _COMPTIMETYPE_23 long
+#define _COMPTIME_X24(...) long
+#define _COMPTIMETYPE_24 long
+#define _COMPTIME_X25(...) long
+#define _COMPTIMETYPE_25 long
+#define _COMPTIME_X26(...) long
+#define _COMPTIMETYPE_26 long
+#define _COMPTIME_X27(...) long
+#define _COMPTIMETYPE_27 long
+#define _COMPTIME_X28(...) long
+#define _COMPTIMETYPE_28 long
+#define _COMPTIME_X29(...) long
+#define _COMPTIMETYPE_29 long
+#define _COMPTIME_X30(...) long
+#define _COMPTIMETYPE_30 long
+#define _COMPTIME_X31(...) long
+#define _COMPTIMETYPE_31 long
+#define _COMPTIME_X32(...) long
+#define _COMPTIMETYPE_32 long
+#define _COMPTIME_X33(...) long
+#define _COMPTIMETYPE_33 long
+#define _COMPTIME_X34(...) long
+#define _COMPTIMETYPE_34 long
+#define _COMPTIME_X35(...) long
+#define _COMPTIMETYPE_35 long
+#define _COMPTIME_X36(...) long
+#define _COMPTIMETYPE_36 long
+#define _COMPTIME_X37(...) long
+#define _COMPTIMETYPE_37 long
+#define _COMPTIME_X38(...) long
+#define _COMPTIMETYPE_38 long
+#define _COMPTIME_X39(...) long
+#define _COMPTIMETYPE_39 long
@@ -0,0 +1,43 @@
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 0
+#define _COMPTIME_X1(...) 1
+#define _COMPTIME_X2(...) 4
+#define _COMPTIME_X3(...) 9
+#define _COMPTIME_X4(...) 16
+#define _COMPTIME_X5(...) 25
+#define _COMPTIME_X6(...) 36
+#define _COMPTIME_X7(...) 49
+#define _COMPTIME_X8(...) 64
+#define _COMPTIME_X9(...) 81
+#define _COMPTIME_X10(...) 100
+#define _COMPTIME_X11(...) 121
+#define _COMPTIME_X12(...) 144
+#define _COMPTIME_X13(...) 169
+#define _COMPTIME_X14(...) 196
+#define _COMPTIME_X15(...) 225
+#define _COMPTIME_X16(...) 256
+#define _COMPTIME_X17(...) 289
+#define _COMPTIME_X18(...) 324
+#define _COMPTIME_X19(...) 361
+#define _COMPTIME_X20(...) 400
+#define _COMPTIME_X21(...) 441
+#define _COMPTIME_X22(...) 484
+#define _COMPTIME_X23(...) 529
+#define _COMPTIME_X24(...) 576
+#define _COMPTIME_X25(...) 625
+#define _COMPTIME_X26(...) 676
+#define _COMPTIME_X27(...) 729
+#define _COMPTIME_X28(...) 784
+#define _COMPTIME_X29(...) 841
+#define _COMPTIME_X30(...) 900
+#define _COMPTIME_X31(...) 961
+#define _COMPTIME_X32(...) 1024
+#define _COMPTIME_X33(...) 1089
+#define _COMPTIME_X34(...) 1156
+#define _COMPTIME_X35(...) 1225
+#define _COMPTIME_X36(...) 1296
+#define _COMPTIME_X37(...) 1369
+#define _COMPTIME_X38(...) 1444
+#define _COMPTIME_X39(...) 1521
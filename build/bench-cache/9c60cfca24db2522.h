@@ -0,0 +1,23 @@
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 0
+#define _COMPTIME_X1(...) 20
+#define _COMPTIME_X2(...) 40
+#define _COMPTIME_X3(...) 60
+#define _COMPTIME_X4(...) 80
+#define _COMPTIME_X5(...) 100
+#define _COMPTIME_X6(...) 120
+#define _COMPTIME_X7(...) 140
+#define _COMPTIME_X8(...) 160
+#define _COMPTIME_X9(...) 180
+#define _COMPTIME_X10(...) 200
+#define _COMPTIME_X11(...) 220
+#define _COMPTIME_X12(...) 240
+#define _COMPTIME_X13(...) 260
+#define _COMPTIME_X14(...) 280
+#define _COMPTIME_X15(...) 300
+#define _COMPTIME_X16(...) 320
+#define _COMPTIME_X17(...) 340
+#define _COMPTIME_X18(...) 360
+#define _COMPTIME_X19(...) 380
@@ -0,0 +1,210 @@
+#include <stdio.h>
+
+#include "../../../ccomptime.h"
+#include "main.c.h"
+
+int main(void) {
+  long sum = 0;
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 0 * 0); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 1 * 1); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 2 * 2); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 3 * 3); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 4 * 4); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 5 * 5); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 6 * 6); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 7 * 7); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 8 * 8); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 9 * 9); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 10 * 10); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 11 * 11); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 12 * 12); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 13 * 13); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 14 * 14); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 15 * 15); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 16 * 16); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 17 * 17); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 18 * 18); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 19 * 19); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 20 * 20); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 21 * 21); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 22 * 22); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 23 * 23); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 24 * 24); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 25 * 25); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 26 * 26); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 27 * 27); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 28 * 28); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 29 * 29); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 30 * 30); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 31 * 31); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 32 * 32); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 33 * 33); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 34 * 34); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 35 * 35); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 36 * 36); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 37 * 37); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 38 * 38); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 39 * 39); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 40 * 40); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 41 * 41); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 42 * 42); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 43 * 43); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 44 * 44); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 45 * 45); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 46 * 46); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 47 * 47); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 48 * 48); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 49 * 49); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 50 * 50); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 51 * 51); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 52 * 52); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 53 * 53); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 54 * 54); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 55 * 55); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 56 * 56); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 57 * 57); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 58 * 58); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 59 * 59); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 60 * 60); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 61 * 61); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 62 * 62); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 63 * 63); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 64 * 64); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 65 * 65); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 66 * 66); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 67 * 67); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 68 * 68); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 69 * 69); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 70 * 70); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 71 * 71); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 72 * 72); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 73 * 73); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 74 * 74); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 75 * 75); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 76 * 76); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 77 * 77); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 78 * 78); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 79 * 79); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 80 * 80); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 81 * 81); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 82 * 82); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 83 * 83); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 84 * 84); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 85 * 85); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 86 * 86); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 87 * 87); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 88 * 88); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 89 * 89); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 90 * 90); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 91 * 91); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 92 * 92); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 93 * 93); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 94 * 94); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 95 * 95); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 96 * 96); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 97 * 97); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 98 * 98); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 99 * 99); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 100 * 100); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 101 * 101); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 102 * 102); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 103 * 103); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 104 * 104); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 105 * 105); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 106 * 106); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 107 * 107); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 108 * 108); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 109 * 109); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 110 * 110); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 111 * 111); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 112 * 112); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 113 * 113); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 114 * 114); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 115 * 115); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 116 * 116); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 117 * 117); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 118 * 118); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 119 * 119); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 120 * 120); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 121 * 121); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 122 * 122); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 123 * 123); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 124 * 124); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 125 * 125); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 126 * 126); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 127 * 127); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 128 * 128); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 129 * 129); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 130 * 130); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 131 * 131); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 132 * 132); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 133 * 133); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 134 * 134); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 135 * 135); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 136 * 136); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 137 * 137); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 138 * 138); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 139 * 139); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 140 * 140); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 141 * 141); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 142 * 142); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 143 * 143); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 144 * 144); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 145 * 145); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 146 * 146); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 147 * 147); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 148 * 148); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 149 * 149); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 150 * 150); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 151 * 151); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 152 * 152); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 153 * 153); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 154 * 154); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 155 * 155); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 156 * 156); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 157 * 157); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 158 * 158); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 159 * 159); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 160 * 160); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 161 * 161); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 162 * 162); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 163 * 163); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 164 * 164); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 165 * 165); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 166 * 166); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 167 * 167); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 168 * 168); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 169 * 169); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 170 * 170); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 171 * 171); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 172 * 172); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 173 * 173); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 174 * 174); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 175 * 175); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 176 * 176); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 177 * 177); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 178 * 178); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 179 * 179); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 180 * 180); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 181 * 181); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 182 * 182); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 183 * 183); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 184 * 184); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 185 * 185); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 186 * 186); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 187 * 187); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 188 * 188); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 189 * 189); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 190 * 190); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 191 * 191); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 192 * 192); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 193 * 193); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 194 * 194); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 195 * 195); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 196 * 196); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 197 * 197); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 198 * 198); });
+  sum += _Comptime({ _ComptimeCtx.Inline.appendf("%d", 199 * 199); });
+  printf("%ld\n", sum);
+  return 0;
+}
@@ -0,0 +1,221 @@
+/*// @generated - ccomptime™ v0.0.1 - e38c326c4ecf4f89 \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 0
+#define _COMPTIME_X1(...) 1
+#define _COMPTIME_X2(...) 4
+#define _COMPTIME_X3(...) 9
+#define _COMPTIME_X4(...) 16
+#define _COMPTIME_X5(...) 25
+#define _COMPTIME_X6(...) 36
+#define _COMPTIME_X7(...) 49
+#define _COMPTIME_X8(...) 64
+#define _COMPTIME_X9(...) 81
+#define _COMPTIME_X10(...) 100
+#define _COMPTIME_X11(...) 121
+#define _COMPTIME_X12(...) 144
+#define _COMPTIME_X13(...) 169
+#define _COMPTIME_X14(...) 196
+#define _COMPTIME_X15(...) 225
+#define _COMPTIME_X16(...) 256
+#define _COMPTIME_X17(...) 289
+#define _COMPTIME_X18(...) 324
+#define _COMPTIME_X19(...) 361
+#define _COMPTIME_X20(...) 400
+#define _COMPTIME_X21(...) 441
+#define _COMPTIME_X22(...) 484
+#define _COMPTIME_X23(...) 529
+#define _COMPTIME_X24(...) 576
+#define _COMPTIME_X25(...) 625
+#define _COMPTIME_X26(...) 676
+#define _COMPTIME_X27(...) 729
+#define _COMPTIME_X28(...) 784
+#define _COMPTIME_X29(...) 841
+#define _COMPTIME_X30(...) 900
+#define _COMPTIME_X31(...) 961
+#define _COMPTIME_X32(...) 1024
+#define _COMPTIME_X33(...) 1089
+#define _COMPTIME_X34(...) 1156
+#define _COMPTIME_X35(...) 1225
+#define _COMPTIME_X36(...) 1296
+#define _COMPTIME_X37(...) 1369
+#define _COMPTIME_X38(...) 1444
+#define _COMPTIME_X39(...) 1521
+#define _COMPTIME_X40(...) 1600
+#define _COMPTIME_X41(...) 1681
+#define _COMPTIME_X42(...) 1764
+#define _COMPTIME_X43(...) 1849
+#define _COMPTIME_X44(...) 1936
+#define _COMPTIME_X45(...) 2025
+#define _COMPTIME_X46(...) 2116
+#define _COMPTIME_X47(...) 2209
+#define _COMPTIME_X48(...) 2304
+#define _COMPTIME_X49(...) 2401
+#define _COMPTIME_X50(...) 2500
+#define _COMPTIME_X51(...) 2601
+#define _COMPTIME_X52(...) 2704
+#define _COMPTIME_X53(...) 2809
+#define _COMPTIME_X54(...) 2916
+#define _COMPTIME_X55(...) 3025
+#define _COMPTIME_X56(...) 3136
+#define _COMPTIME_X57(...) 3249
+#define _COMPTIME_X58(...) 3364
+#define _COMPTIME_X59(...) 3481
+#define _COMPTIME_X60(...) 3600
+#define _COMPTIME_X61(...) 3721
+#define _COMPTIME_X62(...) 3844
+#define _COMPTIME_X63(...) 3969
+#define _COMPTIME_X64(...) 4096
+#define _COMPTIME_X65(...) 4225
+#define _COMPTIME_X66(...) 4356
+#define _COMPTIME_X67(...) 4489
+#define _COMPTIME_X68(...) 4624
+#define _COMPTIME_X69(...) 4761
+#define _COMPTIME_X70(...) 4900
+#define _COMPTIME_X71(...) 5041
+#define _COMPTIME_X72(...) 5184
+#define _COMPTIME_X73(...) 5329
+#define _COMPTIME_X74(...) 5476
+#define _COMPTIME_X75(...) 5625
+#define _COMPTIME_X76(...) 5776
+#define _COMPTIME_X77(...) 5929
+#define _COMPTIME_X78(...) 6084
+#define _COMPTIME_X79(...) 6241
+#define _COMPTIME_X80(...) 6400
+#define _COMPTIME_X81(...) 6561
+#define _COMPTIME_X82(...) 6724
+#define _COMPTIME_X83(...) 6889
+#define _COMPTIME_X84(...) 7056
+#define _COMPTIME_X85(...) 7225
+#define _COMPTIME_X86(...) 7396
+#define _COMPTIME_X87(...) 7569
+#define _COMPTIME_X88(...) 7744
+#define _COMPTIME_X89(...) 7921
+#define _COMPTIME_X90(...) 8100
+#define _COMPTIME_X91(...) 8281
+#define _COMPTIME_X92(...) 8464
+#define _COMPTIME_X93(...) 8649
+#define _COMPTIME_X94(...) 8836
+#define _COMPTIME_X95(...) 9025
+#define _COMPTIME_X96(...) 9216
+#define _COMPTIME_X97(...) 9409
+#define _COMPTIME_X98(...) 9604
+#define _COMPTIME_X99(...) 9801
+#define _COMPTIME_X100(...) 10000
+#define _COMPTIME_X101(...) 10201
+#define _COMPTIME_X102(...) 10404
+#define _COMPTIME_X103(...) 10609
+#define _COMPTIME_X104(...) 10816
+#define _COMPTIME_X105(...) 11025
+#define _COMPTIME_X106(...) 11236
+#define _COMPTIME_X107(...) 11449
+#define _COMPTIME_X108(...) 11664
+#define _COMPTIME_X109(...) 11881
+#define _COMPTIME_X110(...) 12100
+#define _COMPTIME_X111(...) 12321
+#define _COMPTIME_X112(...) 12544
+#define _COMPTIME_X113(...) 12769
+#define _COMPTIME_X114(...) 12996
+#define _COMPTIME_X115(...) 13225
+#define _COMPTIME_X116(...) 13456
+#define _COMPTIME_X117(...) 13689
+#define _COMPTIME_X118(...) 13924
+#define _COMPTIME_X119(...) 14161
+#define _COMPTIME_X120(...) 14400
+#define _COMPTIME_X121(...) 14641
+#define _COMPTIME_X122(...) 14884
+#define _COMPTIME_X123(...) 15129
+#define _COMPTIME_X124(...) 15376
+#define _COMPTIME_X125(...) 15625
+#define _COMPTIME_X126(...) 15876
+#define _COMPTIME_X127(...) 16129
+#define _COMPTIME_X128(...) 16384
+#define _COMPTIME_X129(...) 16641
+#define _COMPTIME_X130(...) 16900
+#define _COMPTIME_X131(...) 17161
+#define _COMPTIME_X132(...) 17424
+#define _COMPTIME_X133(...) 17689
+#define _COMPTIME_X134(...) 17956
+#define _COMPTIME_X135(...) 18225
+#define _COMPTIME_X136(...) 18496
+#define _COMPTIME_X137(...) 18769
+#define _COMPTIME_X138(...) 19044
+#define _COMPTIME_X139(...) 19321
+#define _COMPTIME_X140(...) 19600
+#define _COMPTIME_X141(...) 19881
+#define _COMPTIME_X142(...) 20164
+#define _COMPTIME_X143(...) 20449
+#define _COMPTIME_X144(...) 20736
+#define _COMPTIME_X145(...) 21025
+#define _COMPTIME_X146(...) 21316
+#define _COMPTIME_X147(...) 21609
+#define _COMPTIME_X148(...) 21904
+#define _COMPTIME_X149(...) 22201
+#define _COMPTIME_X150(...) 22500
+#define _COMPTIME_X151(...) 22801
+#define _COMPTIME_X152(...) 23104
+#define _COMPTIME_X153(...) 23409
+#define _COMPTIME_X154(...) 23716
+#define _COMPTIME_X155(...) 24025
+#define _COMPTIME_X156(...) 24336
+#define _COMPTIME_X157(...) 24649
+#define _COMPTIME_X158(...) 24964
+#define _COMPTIME_X159(...) 25281
+#define _COMPTIME_X160(...) 25600
+#define _COMPTIME_X161(...) 25921
+#define _COMPTIME_X162(...) 26244
+#define _COMPTIME_X163(...) 26569
+#define _COMPTIME_X164(...) 26896
+#define _COMPTIME_X165(...) 27225
+#define _COMPTIME_X166(...) 27556
+#define _COMPTIME_X167(...) 27889
+#define _COMPTIME_X168(...) 28224
+#define _COMPTIME_X169(...) 28561
+#define _COMPTIME_X170(...) 28900
+#define _COMPTIME_X171(...) 29241
+#define _COMPTIME_X172(...) 29584
+#define _COMPTIME_X173(...) 29929
+#define _COMPTIME_X174(...) 30276
+#define _COMPTIME_X175(...) 30625
+#define _COMPTIME_X176(...) 30976
+#define _COMPTIME_X177(...) 31329
+#define _COMPTIME_X178(...) 31684
+#define _COMPTIME_X179(...) 32041
+#define _COMPTIME_X180(...) 32400
+#define _COMPTIME_X181(...) 32761
+#define _COMPTIME_X182(...) 33124
+#define _COMPTIME_X183(...) 33489
+#define _COMPTIME_X184(...) 33856
+#define _COMPTIME_X185(...) 34225
+#define _COMPTIME_X186(...) 34596
+#define _COMPTIME_X187(...) 34969
+#define _COMPTIME_X188(...) 35344
+#define _COMPTIME_X189(...) 35721
+#define _COMPTIME_X190(...) 36100
+#define _COMPTIME_X191(...) 36481
+#define _COMPTIME_X192(...) 36864
+#define _COMPTIME_X193(...) 37249
+#define _COMPTIME_X194(...) 37636
+#define _COMPTIME_X195(...) 38025
+#define _COMPTIME_X196(...) 38416
+#define _COMPTIME_X197(...) 38809
+#define _COMPTIME_X198(...) 39204
+#define _COMPTIME_X199(...) 39601
+#endif // _COMPILING
@@ -0,0 +1,400 @@
+
+__Comptime_Statement_Fn(0, _ComptimeCtx.Inline.appendf("%d", 0 * 0))
+
+__Comptime_Statement_Fn(1, _ComptimeCtx.Inline.appendf("%d", 1 * 1))
+
+__Comptime_Statement_Fn(2, _ComptimeCtx.Inline.appendf("%d", 2 * 2))
+
+__Comptime_Statement_Fn(3, _ComptimeCtx.Inline.appendf("%d", 3 * 3))
+
+__Comptime_Statement_Fn(4, _ComptimeCtx.Inline.appendf("%d", 4 * 4))
+
+__Comptime_Statement_Fn(5, _ComptimeCtx.Inline.appendf("%d", 5 * 5))
+
+__Comptime_Statement_Fn(6, _ComptimeCtx.Inline.appendf("%d", 6 * 6))
+
+__Comptime_Statement_Fn(7, _ComptimeCtx.Inline.appendf("%d", 7 * 7))
+
+__Comptime_Statement_Fn(8, _ComptimeCtx.Inline.appendf("%d", 8 * 8))
+
+__Comptime_Statement_Fn(9, _ComptimeCtx.Inline.appendf("%d", 9 * 9))
+
+__Comptime_Statement_Fn(10, _ComptimeCtx.Inline.appendf("%d", 10 * 10))
+
+__Comptime_Statement_Fn(11, _ComptimeCtx.Inline.appendf("%d", 11 * 11))
+
+__Comptime_Statement_Fn(12, _ComptimeCtx.Inline.appendf("%d", 12 * 12))
+
+__Comptime_Statement_Fn(13, _ComptimeCtx.Inline.appendf("%d", 13 * 13))
+
+__Comptime_Statement_Fn(14, _ComptimeCtx.Inline.appendf("%d", 14 * 14))
+
+__Comptime_Statement_Fn(15, _ComptimeCtx.Inline.appendf("%d", 15 * 15))
+
+__Comptime_Statement_Fn(16, _ComptimeCtx.Inline.appendf("%d", 16 * 16))
+
+__Comptime_Statement_Fn(17, _ComptimeCtx.Inline.appendf("%d", 17 * 17))
+
+__Comptime_Statement_Fn(18, _ComptimeCtx.Inline.appendf("%d", 18 * 18))
+
+__Comptime_Statement_Fn(19, _ComptimeCtx.Inline.appendf("%d", 19 * 19))
+
+__Comptime_Statement_Fn(20, _ComptimeCtx.Inline.appendf("%d", 20 * 20))
+
+__Comptime_Statement_Fn(21, _ComptimeCtx.Inline.appendf("%d", 21 * 21))
+
+__Comptime_Statement_Fn(22, _ComptimeCtx.Inline.appendf("%d", 22 * 22))
+
+__Comptime_Statement_Fn(23, _ComptimeCtx.Inline.appendf("%d", 23 * 23))
+
+__Comptime_Statement_Fn(24, _ComptimeCtx.Inline.appendf("%d", 24 * 24))
+
+__Comptime_Statement_Fn(25, _ComptimeCtx.Inline.appendf("%d", 25 * 25))
+
+__Comptime_Statement_Fn(26, _ComptimeCtx.Inline.appendf("%d", 26 * 26))
+
+__Comptime_Statement_Fn(27, _ComptimeCtx.Inline.appendf("%d", 27 * 27))
+
+__Comptime_Statement_Fn(28, _ComptimeCtx.Inline.appendf("%d", 28 * 28))
+
+__Comptime_Statement_Fn(29, _ComptimeCtx.Inline.appendf("%d", 29 * 29))
+
+__Comptime_Statement_Fn(30, _ComptimeCtx.Inline.appendf("%d", 30 * 30))
+
+__Comptime_Statement_Fn(31, _ComptimeCtx.Inline.appendf("%d", 31 * 31))
+
+__Comptime_Statement_Fn(32, _ComptimeCtx.Inline.appendf("%d", 32 * 32))
+
+__Comptime_Statement_Fn(33, _ComptimeCtx.Inline.appendf("%d", 33 * 33))
+
+__Comptime_Statement_Fn(34, _ComptimeCtx.Inline.appendf("%d", 34 * 34))
+
+__Comptime_Statement_Fn(35, _ComptimeCtx.Inline.appendf("%d", 35 * 35))
+
+__Comptime_Statement_Fn(36, _ComptimeCtx.Inline.appendf("%d", 36 * 36))
+
+__Comptime_Statement_Fn(37, _ComptimeCtx.Inline.appendf("%d", 37 * 37))
+
+__Comptime_Statement_Fn(38, _ComptimeCtx.Inline.appendf("%d", 38 * 38))
+
+__Comptime_Statement_Fn(39, _ComptimeCtx.Inline.appendf("%d", 39 * 39))
+
+__Comptime_Statement_Fn(40, _ComptimeCtx.Inline.appendf("%d", 40 * 40))
+
+__Comptime_Statement_Fn(41, _ComptimeCtx.Inline.appendf("%d", 41 * 41))
+
+__Comptime_Statement_Fn(42, _ComptimeCtx.Inline.appendf("%d", 42 * 42))
+
+__Comptime_Statement_Fn(43, _ComptimeCtx.Inline.appendf("%d", 43 * 43))
+
+__Comptime_Statement_Fn(44, _ComptimeCtx.Inline.appendf("%d", 44 * 44))
+
+__Comptime_Statement_Fn(45, _ComptimeCtx.Inline.appendf("%d", 45 * 45))
+
+__Comptime_Statement_Fn(46, _ComptimeCtx.Inline.appendf("%d", 46 * 46))
+
+__Comptime_Statement_Fn(47, _ComptimeCtx.Inline.appendf("%d", 47 * 47))
+
+__Comptime_Statement_Fn(48, _ComptimeCtx.Inline.appendf("%d", 48 * 48))
+
+__Comptime_Statement_Fn(49, _ComptimeCtx.Inline.appendf("%d", 49 * 49))
+
+__Comptime_Statement_Fn(50, _ComptimeCtx.Inline.appendf("%d", 50 * 50))
+
+__Comptime_Statement_Fn(51, _ComptimeCtx.Inline.appendf("%d", 51 * 51))
+
+__Comptime_Statement_Fn(52, _ComptimeCtx.Inline.appendf("%d", 52 * 52))
+
+__Comptime_Statement_Fn(53, _ComptimeCtx.Inline.appendf("%d", 53 * 53))
+
+__Comptime_Statement_Fn(54, _ComptimeCtx.Inline.appendf("%d", 54 * 54))
+
+__Comptime_Statement_Fn(55, _ComptimeCtx.Inline.appendf("%d", 55 * 55))
+
+__Comptime_Statement_Fn(56, _ComptimeCtx.Inline.appendf("%d", 56 * 56))
+
+__Comptime_Statement_Fn(57, _ComptimeCtx.Inline.appendf("%d", 57 * 57))
+
+__Comptime_Statement_Fn(58, _ComptimeCtx.Inline.appendf("%d", 58 * 58))
+
+__Comptime_Statement_Fn(59, _ComptimeCtx.Inline.appendf("%d", 59 * 59))
+
+__Comptime_Statement_Fn(60, _ComptimeCtx.Inline.appendf("%d", 60 * 60))
+
+__Comptime_Statement_Fn(61, _ComptimeCtx.Inline.appendf("%d", 61 * 61))
+
+__Comptime_Statement_Fn(62, _ComptimeCtx.Inline.appendf("%d", 62 * 62))
+
+__Comptime_Statement_Fn(63, _ComptimeCtx.Inline.appendf("%d", 63 * 63))
+
+__Comptime_Statement_Fn(64, _ComptimeCtx.Inline.appendf("%d", 64 * 64))
+
+__Comptime_Statement_Fn(65, _ComptimeCtx.Inline.appendf("%d", 65 * 65))
+
+__Comptime_Statement_Fn(66, _ComptimeCtx.Inline.appendf("%d", 66 * 66))
+
+__Comptime_Statement_Fn(67, _ComptimeCtx.Inline.appendf("%d", 67 * 67))
+
+__Comptime_Statement_Fn(68, _ComptimeCtx.Inline.appendf("%d", 68 * 68))
+
+__Comptime_Statement_Fn(69, _ComptimeCtx.Inline.appendf("%d", 69 * 69))
+
+__Comptime_Statement_Fn(70, _ComptimeCtx.Inline.appendf("%d", 70 * 70))
+
+__Comptime_Statement_Fn(71, _ComptimeCtx.Inline.appendf("%d", 71 * 71))
+
+__Comptime_Statement_Fn(72, _ComptimeCtx.Inline.appendf("%d", 72 * 72))
+
+__Comptime_Statement_Fn(73, _ComptimeCtx.Inline.appendf("%d", 73 * 73))
+
+__Comptime_Statement_Fn(74, _ComptimeCtx.Inline.appendf("%d", 74 * 74))
+
+__Comptime_Statement_Fn(75, _ComptimeCtx.Inline.appendf("%d", 75 * 75))
+
+__Comptime_Statement_Fn(76, _ComptimeCtx.Inline.appendf("%d", 76 * 76))
+
+__Comptime_Statement_Fn(77, _ComptimeCtx.Inline.appendf("%d", 77 * 77))
+
+__Comptime_Statement_Fn(78, _ComptimeCtx.Inline.appendf("%d", 78 * 78))
+
+__Comptime_Statement_Fn(79, _ComptimeCtx.Inline.appendf("%d", 79 * 79))
+
+__Comptime_Statement_Fn(80, _ComptimeCtx.Inline.appendf("%d", 80 * 80))
+
+__Comptime_Statement_Fn(81, _ComptimeCtx.Inline.appendf("%d", 81 * 81))
+
+__Comptime_Statement_Fn(82, _ComptimeCtx.Inline.appendf("%d", 82 * 82))
+
+__Comptime_Statement_Fn(83, _ComptimeCtx.Inline.appendf("%d", 83 * 83))
+
+__Comptime_Statement_Fn(84, _ComptimeCtx.Inline.appendf("%d", 84 * 84))
+
+__Comptime_Statement_Fn(85, _ComptimeCtx.Inline.appendf("%d", 85 * 85))
+
+__Comptime_Statement_Fn(86, _ComptimeCtx.Inline.appendf("%d", 86 * 86))
+
+__Comptime_Statement_Fn(87, _ComptimeCtx.Inline.appendf("%d", 87 * 87))
+
+__Comptime_Statement_Fn(88, _ComptimeCtx.Inline.appendf("%d", 88 * 88))
+
+__Comptime_Statement_Fn(89, _ComptimeCtx.Inline.appendf("%d", 89 * 89))
+
+__Comptime_Statement_Fn(90, _ComptimeCtx.Inline.appendf("%d", 90 * 90))
+
+__Comptime_Statement_Fn(91, _ComptimeCtx.Inline.appendf("%d", 91 * 91))
+
+__Comptime_Statement_Fn(92, _ComptimeCtx.Inline.appendf("%d", 92 * 92))
+
+__Comptime_Statement_Fn(93, _ComptimeCtx.Inline.appendf("%d", 93 * 93))
+
+__Comptime_Statement_Fn(94, _ComptimeCtx.Inline.appendf("%d", 94 * 94))
+
+__Comptime_Statement_Fn(95, _ComptimeCtx.Inline.appendf("%d", 95 * 95))
+
+__Comptime_Statement_Fn(96, _ComptimeCtx.Inline.appendf("%d", 96 * 96))
+
+__Comptime_Statement_Fn(97, _ComptimeCtx.Inline.appendf("%d", 97 * 97))
+
+__Comptime_Statement_Fn(98, _ComptimeCtx.Inline.appendf("%d", 98 * 98))
+
+__Comptime_Statement_Fn(99, _ComptimeCtx.Inline.appendf("%d", 99 * 99))
+
+__Comptime_Statement_Fn(100, _ComptimeCtx.Inline.appendf("%d", 100 * 100))
+
+__Comptime_Statement_Fn(101, _ComptimeCtx.Inline.appendf("%d", 101 * 101))
+
+__Comptime_Statement_Fn(102, _ComptimeCtx.Inline.appendf("%d", 102 * 102))
+
+__Comptime_Statement_Fn(103, _ComptimeCtx.Inline.appendf("%d", 103 * 103))
+
+__Comptime_Statement_Fn(104, _ComptimeCtx.Inline.appendf("%d", 104 * 104))
+
+__Comptime_Statement_Fn(105, _ComptimeCtx.Inline.appendf("%d", 105 * 105))
+
+__Comptime_Statement_Fn(106, _ComptimeCtx.Inline.appendf("%d", 106 * 106))
+
+__Comptime_Statement_Fn(107, _ComptimeCtx.Inline.appendf("%d", 107 * 107))
+
+__Comptime_Statement_Fn(108, _ComptimeCtx.Inline.appendf("%d", 108 * 108))
+
+__Comptime_Statement_Fn(109, _ComptimeCtx.Inline.appendf("%d", 109 * 109))
+
+__Comptime_Statement_Fn(110, _ComptimeCtx.Inline.appendf("%d", 110 * 110))
+
+__Comptime_Statement_Fn(111, _ComptimeCtx.Inline.appendf("%d", 111 * 111))
+
+__Comptime_Statement_Fn(112, _ComptimeCtx.Inline.appendf("%d", 112 * 112))
+
+__Comptime_Statement_Fn(113, _ComptimeCtx.Inline.appendf("%d", 113 * 113))
+
+__Comptime_Statement_Fn(114, _ComptimeCtx.Inline.appendf("%d", 114 * 114))
+
+__Comptime_Statement_Fn(115, _ComptimeCtx.Inline.appendf("%d", 115 * 115))
+
+__Comptime_Statement_Fn(116, _ComptimeCtx.Inline.appendf("%d", 116 * 116))
+
+__Comptime_Statement_Fn(117, _ComptimeCtx.Inline.appendf("%d", 117 * 117))
+
+__Comptime_Statement_Fn(118, _ComptimeCtx.Inline.appendf("%d", 118 * 118))
+
+__Comptime_Statement_Fn(119, _ComptimeCtx.Inline.appendf("%d", 119 * 119))
+
+__Comptime_Statement_Fn(120, _ComptimeCtx.Inline.appendf("%d", 120 * 120))
+
+__Comptime_Statement_Fn(121, _ComptimeCtx.Inline.appendf("%d", 121 * 121))
+
+__Comptime_Statement_Fn(122, _ComptimeCtx.Inline.appendf("%d", 122 * 122))
+
+__Comptime_Statement_Fn(123, _ComptimeCtx.Inline.appendf("%d", 123 * 123))
+
+__Comptime_Statement_Fn(124, _ComptimeCtx.Inline.appendf("%d", 124 * 124))
+
+__Comptime_Statement_Fn(125, _ComptimeCtx.Inline.appendf("%d", 125 * 125))
+
+__Comptime_Statement_Fn(126, _ComptimeCtx.Inline.appendf("%d", 126 * 126))
+
+__Comptime_Statement_Fn(127, _ComptimeCtx.Inline.appendf("%d", 127 * 127))
+
+__Comptime_Statement_Fn(128, _ComptimeCtx.Inline.appendf("%d", 128 * 128))
+
+__Comptime_Statement_Fn(129, _ComptimeCtx.Inline.appendf("%d", 129 * 129))
+
+__Comptime_Statement_Fn(130, _ComptimeCtx.Inline.appendf("%d", 130 * 130))
+
+__Comptime_Statement_Fn(131, _ComptimeCtx.Inline.appendf("%d", 131 * 131))
+
+__Comptime_Statement_Fn(132, _ComptimeCtx.Inline.appendf("%d", 132 * 132))
+
+__Comptime_Statement_Fn(133, _ComptimeCtx.Inline.appendf("%d", 133 * 133))
+
+__Comptime_Statement_Fn(134, _ComptimeCtx.Inline.appendf("%d", 134 * 134))
+
+__Comptime_Statement_Fn(135, _ComptimeCtx.Inline.appendf("%d", 135 * 135))
+
+__Comptime_Statement_Fn(136, _ComptimeCtx.Inline.appendf("%d", 136 * 136))
+
+__Comptime_Statement_Fn(137, _ComptimeCtx.Inline.appendf("%d", 137 * 137))
+
+__Comptime_Statement_Fn(138, _ComptimeCtx.Inline.appendf("%d", 138 * 138))
+
+__Comptime_Statement_Fn(139, _ComptimeCtx.Inline.appendf("%d", 139 * 139))
+
+__Comptime_Statement_Fn(140, _ComptimeCtx.Inline.appendf("%d", 140 * 140))
+
+__Comptime_Statement_Fn(141, _ComptimeCtx.Inline.appendf("%d", 141 * 141))
+
+__Comptime_Statement_Fn(142, _ComptimeCtx.Inline.appendf("%d", 142 * 142))
+
+__Comptime_Statement_Fn(143, _ComptimeCtx.Inline.appendf("%d", 143 * 143))
+
+__Comptime_Statement_Fn(144, _ComptimeCtx.Inline.appendf("%d", 144 * 144))
+
+__Comptime_Statement_Fn(145, _ComptimeCtx.Inline.appendf("%d", 145 * 145))
+
+__Comptime_Statement_Fn(146, _ComptimeCtx.Inline.appendf("%d", 146 * 146))
+
+__Comptime_Statement_Fn(147, _ComptimeCtx.Inline.appendf("%d", 147 * 147))
+
+__Comptime_Statement_Fn(148, _ComptimeCtx.Inline.appendf("%d", 148 * 148))
+
+__Comptime_Statement_Fn(149, _ComptimeCtx.Inline.appendf("%d", 149 * 149))
+
+__Comptime_Statement_Fn(150, _ComptimeCtx.Inline.appendf("%d", 150 * 150))
+
+__Comptime_Statement_Fn(151, _ComptimeCtx.Inline.appendf("%d", 151 * 151))
+
+__Comptime_Statement_Fn(152, _ComptimeCtx.Inline.appendf("%d", 152 * 152))
+
+__Comptime_Statement_Fn(153, _ComptimeCtx.Inline.appendf("%d", 153 * 153))
+
+__Comptime_Statement_Fn(154, _ComptimeCtx.Inline.appendf("%d", 154 * 154))
+
+__Comptime_Statement_Fn(155, _ComptimeCtx.Inline.appendf("%d", 155 * 155))
+
+__Comptime_Statement_Fn(156, _ComptimeCtx.Inline.appendf("%d", 156 * 156))
+
+__Comptime_Statement_Fn(157, _ComptimeCtx.Inline.appendf("%d", 157 * 157))
+
+__Comptime_Statement_Fn(158, _ComptimeCtx.Inline.appendf("%d", 158 * 158))
+
+__Comptime_Statement_Fn(159, _ComptimeCtx.Inline.appendf("%d", 159 * 159))
+
+__Comptime_Statement_Fn(160, _ComptimeCtx.Inline.appendf("%d", 160 * 160))
+
+__Comptime_Statement_Fn(161, _ComptimeCtx.Inline.appendf("%d", 161 * 161))
+
+__Comptime_Statement_Fn(162, _ComptimeCtx.Inline.appendf("%d", 162 * 162))
+
+__Comptime_Statement_Fn(163, _ComptimeCtx.Inline.appendf("%d", 163 * 163))
+
+__Comptime_Statement_Fn(164, _ComptimeCtx.Inline.appendf("%d", 164 * 164))
+
+__Comptime_Statement_Fn(165, _ComptimeCtx.Inline.appendf("%d", 165 * 165))
+
+__Comptime_Statement_Fn(166, _ComptimeCtx.Inline.appendf("%d", 166 * 166))
+
+__Comptime_Statement_Fn(167, _ComptimeCtx.Inline.appendf("%d", 167 * 167))
+
+__Comptime_Statement_Fn(168, _ComptimeCtx.Inline.appendf("%d", 168 * 168))
+
+__Comptime_Statement_Fn(169, _ComptimeCtx.Inline.appendf("%d", 169 * 169))
+
+__Comptime_Statement_Fn(170, _ComptimeCtx.Inline.appendf("%d", 170 * 170))
+
+__Comptime_Statement_Fn(171, _ComptimeCtx.Inline.appendf("%d", 171 * 171))
+
+__Comptime_Statement_Fn(172, _ComptimeCtx.Inline.appendf("%d", 172 * 172))
+
+__Comptime_Statement_Fn(173, _ComptimeCtx.Inline.appendf("%d", 173 * 173))
+
+__Comptime_Statement_Fn(174, _ComptimeCtx.Inline.appendf("%d", 174 * 174))
+
+__Comptime_Statement_Fn(175, _ComptimeCtx.Inline.appendf("%d", 175 * 175))
+
+__Comptime_Statement_Fn(176, _ComptimeCtx.Inline.appendf("%d", 176 * 176))
+
+__Comptime_Statement_Fn(177, _ComptimeCtx.Inline.appendf("%d", 177 * 177))
+
+__Comptime_Statement_Fn(178, _ComptimeCtx.Inline.appendf("%d", 178 * 178))
+
+__Comptime_Statement_Fn(179, _ComptimeCtx.Inline.appendf("%d", 179 * 179))
+
+__Comptime_Statement_Fn(180, _ComptimeCtx.Inline.appendf("%d", 180 * 180))
+
+__Comptime_Statement_Fn(181, _ComptimeCtx.Inline.appendf("%d", 181 * 181))
+
+__Comptime_Statement_Fn(182, _ComptimeCtx.Inline.appendf("%d", 182 * 182))
+
+__Comptime_Statement_Fn(183, _ComptimeCtx.Inline.appendf("%d", 183 * 183))
+
+__Comptime_Statement_Fn(184, _ComptimeCtx.Inline.appendf("%d", 184 * 184))
+
+__Comptime_Statement_Fn(185, _ComptimeCtx.Inline.appendf("%d", 185 * 185))
+
+__Comptime_Statement_Fn(186, _ComptimeCtx.Inline.appendf("%d", 186 * 186))
+
+__Comptime_Statement_Fn(187, _ComptimeCtx.Inline.appendf("%d", 187 * 187))
+
+__Comptime_Statement_Fn(188, _ComptimeCtx.Inline.appendf("%d", 188 * 188))
+
+__Comptime_Statement_Fn(189, _ComptimeCtx.Inline.appendf("%d", 189 * 189))
+
+__Comptime_Statement_Fn(190, _ComptimeCtx.Inline.appendf("%d", 190 * 190))
+
+__Comptime_Statement_Fn(191, _ComptimeCtx.Inline.appendf("%d", 191 * 191))
+
+__Comptime_Statement_Fn(192, _ComptimeCtx.Inline.appendf("%d", 192 * 192))
+
+__Comptime_Statement_Fn(193, _ComptimeCtx.Inline.appendf("%d", 193 * 193))
+
+__Comptime_Statement_Fn(194, _ComptimeCtx.Inline.appendf("%d", 194 * 194))
+
+__Comptime_Statement_Fn(195, _ComptimeCtx.Inline.appendf("%d", 195 * 195))
+
+__Comptime_Statement_Fn(196, _ComptimeCtx.Inline.appendf("%d", 196 * 196))
+
+__Comptime_Statement_Fn(197, _ComptimeCtx.Inline.appendf("%d", 197 * 197))
+
+__Comptime_Statement_Fn(198, _ComptimeCtx.Inline.appendf("%d", 198 * 198))
+
+__Comptime_Statement_Fn(199, _ComptimeCtx.Inline.appendf("%d", 199 * 199))
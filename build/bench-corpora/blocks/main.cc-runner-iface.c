@@ -0,0 +1,8 @@
+
+#define _COMPILING
+#include <stdio.h>
+
+#include "../../../ccomptime.h"
+#include "main.c.h"
+
+
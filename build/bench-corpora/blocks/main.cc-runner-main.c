@@ -0,0 +1,200 @@
+__Comptime_Register_Main_Exec(0, -1); // execute comptime statement #0
+__Comptime_Register_Main_Exec(1, -1); // execute comptime statement #1
+__Comptime_Register_Main_Exec(2, -1); // execute comptime statement #2
+__Comptime_Register_Main_Exec(3, -1); // execute comptime statement #3
+__Comptime_Register_Main_Exec(4, -1); // execute comptime statement #4
+__Comptime_Register_Main_Exec(5, -1); // execute comptime statement #5
+__Comptime_Register_Main_Exec(6, -1); // execute comptime statement #6
+__Comptime_Register_Main_Exec(7, -1); // execute comptime statement #7
+__Comptime_Register_Main_Exec(8, -1); // execute comptime statement #8
+__Comptime_Register_Main_Exec(9, -1); // execute comptime statement #9
+__Comptime_Register_Main_Exec(10, -1); // execute comptime statement #10
+__Comptime_Register_Main_Exec(11, -1); // execute comptime statement #11
+__Comptime_Register_Main_Exec(12, -1); // execute comptime statement #12
+__Comptime_Register_Main_Exec(13, -1); // execute comptime statement #13
+__Comptime_Register_Main_Exec(14, -1); // execute comptime statement #14
+__Comptime_Register_Main_Exec(15, -1); // execute comptime statement #15
+__Comptime_Register_Main_Exec(16, -1); // execute comptime statement #16
+__Comptime_Register_Main_Exec(17, -1); // execute comptime statement #17
+__Comptime_Register_Main_Exec(18, -1); // execute comptime statement #18
+__Comptime_Register_Main_Exec(19, -1); // execute comptime statement #19
+__Comptime_Register_Main_Exec(20, -1); // execute comptime statement #20
+__Comptime_Register_Main_Exec(21, -1); // execute comptime statement #21
+__Comptime_Register_Main_Exec(22, -1); // execute comptime statement #22
+__Comptime_Register_Main_Exec(23, -1); // execute comptime statement #23
+__Comptime_Register_Main_Exec(24, -1); // execute comptime statement #24
+__Comptime_Register_Main_Exec(25, -1); // execute comptime statement #25
+__Comptime_Register_Main_Exec(26, -1); // execute comptime statement #26
+__Comptime_Register_Main_Exec(27, -1); // execute comptime statement #27
+__Comptime_Register_Main_Exec(28, -1); // execute comptime statement #28
+__Comptime_Register_Main_Exec(29, -1); // execute comptime statement #29
+__Comptime_Register_Main_Exec(30, -1); // execute comptime statement #30
+__Comptime_Register_Main_Exec(31, -1); // execute comptime statement #31
+__Comptime_Register_Main_Exec(32, -1); // execute comptime statement #32
+__Comptime_Register_Main_Exec(33, -1); // execute comptime statement #33
+__Comptime_Register_Main_Exec(34, -1); // execute comptime statement #34
+__Comptime_Register_Main_Exec(35, -1); // execute comptime statement #35
+__Comptime_Register_Main_Exec(36, -1); // execute comptime statement #36
+__Comptime_Register_Main_Exec(37, -1); // execute comptime statement #37
+__Comptime_Register_Main_Exec(38, -1); // execute comptime statement #38
+__Comptime_Register_Main_Exec(39, -1); // execute comptime statement #39
+__Comptime_Register_Main_Exec(40, -1); // execute comptime statement #40
+__Comptime_Register_Main_Exec(41, -1); // execute comptime statement #41
+__Comptime_Register_Main_Exec(42, -1); // execute comptime statement #42
+__Comptime_Register_Main_Exec(43, -1); // execute comptime statement #43
+__Comptime_Register_Main_Exec(44, -1); // execute comptime statement #44
+__Comptime_Register_Main_Exec(45, -1); // execute comptime statement #45
+__Comptime_Register_Main_Exec(46, -1); // execute comptime statement #46
+__Comptime_Register_Main_Exec(47, -1); // execute comptime statement #47
+__Comptime_Register_Main_Exec(48, -1); // execute comptime statement #48
+__Comptime_Register_Main_Exec(49, -1); // execute comptime statement #49
+__Comptime_Register_Main_Exec(50, -1); // execute comptime statement #50
+__Comptime_Register_Main_Exec(51, -1); // execute comptime statement #51
+__Comptime_Register_Main_Exec(52, -1); // execute comptime statement #52
+__Comptime_Register_Main_Exec(53, -1); // execute comptime statement #53
+__Comptime_Register_Main_Exec(54, -1); // execute comptime statement #54
+__Comptime_Register_Main_Exec(55, -1); // execute comptime statement #55
+__Comptime_Register_Main_Exec(56, -1); // execute comptime statement #56
+__Comptime_Register_Main_Exec(57, -1); // execute comptime statement #57
+__Comptime_Register_Main_Exec(58, -1); // execute comptime statement #58
+__Comptime_Register_Main_Exec(59, -1); // execute comptime statement #59
+__Comptime_Register_Main_Exec(60, -1); // execute comptime statement #60
+__Comptime_Register_Main_Exec(61, -1); // execute comptime statement #61
+__Comptime_Register_Main_Exec(62, -1); // execute comptime statement #62
+__Comptime_Register_Main_Exec(63, -1); // execute comptime statement #63
+__Comptime_Register_Main_Exec(64, -1); // execute comptime statement #64
+__Comptime_Register_Main_Exec(65, -1); // execute comptime statement #65
+__Comptime_Register_Main_Exec(66, -1); // execute comptime statement #66
+__Comptime_Register_Main_Exec(67, -1); // execute comptime statement #67
+__Comptime_Register_Main_Exec(68, -1); // execute comptime statement #68
+__Comptime_Register_Main_Exec(69, -1); // execute comptime statement #69
+__Comptime_Register_Main_Exec(70, -1); // execute comptime statement #70
+__Comptime_Register_Main_Exec(71, -1); // execute comptime statement #71
+__Comptime_Register_Main_Exec(72, -1); // execute comptime statement #72
+__Comptime_Register_Main_Exec(73, -1); // execute comptime statement #73
+__Comptime_Register_Main_Exec(74, -1); // execute comptime statement #74
+__Comptime_Register_Main_Exec(75, -1); // execute comptime statement #75
+__Comptime_Register_Main_Exec(76, -1); // execute comptime statement #76
+__Comptime_Register_Main_Exec(77, -1); // execute comptime statement #77
+__Comptime_Register_Main_Exec(78, -1); // execute comptime statement #78
+__Comptime_Register_Main_Exec(79, -1); // execute comptime statement #79
+__Comptime_Register_Main_Exec(80, -1); // execute comptime statement #80
+__Comptime_Register_Main_Exec(81, -1); // execute comptime statement #81
+__Comptime_Register_Main_Exec(82, -1); // execute comptime statement #82
+__Comptime_Register_Main_Exec(83, -1); // execute comptime statement #83
+__Comptime_Register_Main_Exec(84, -1); // execute comptime statement #84
+__Comptime_Register_Main_Exec(85, -1); // execute comptime statement #85
+__Comptime_Register_Main_Exec(86, -1); // execute comptime statement #86
+__Comptime_Register_Main_Exec(87, -1); // execute comptime statement #87
+__Comptime_Register_Main_Exec(88, -1); // execute comptime statement #88
+__Comptime_Register_Main_Exec(89, -1); // execute comptime statement #89
+__Comptime_Register_Main_Exec(90, -1); // execute comptime statement #90
+__Comptime_Register_Main_Exec(91, -1); // execute comptime statement #91
+__Comptime_Register_Main_Exec(92, -1); // execute comptime statement #92
+__Comptime_Register_Main_Exec(93, -1); // execute comptime statement #93
+__Comptime_Register_Main_Exec(94, -1); // execute comptime statement #94
+__Comptime_Register_Main_Exec(95, -1); // execute comptime statement #95
+__Comptime_Register_Main_Exec(96, -1); // execute comptime statement #96
+__Comptime_Register_Main_Exec(97, -1); // execute comptime statement #97
+__Comptime_Register_Main_Exec(98, -1); // execute comptime statement #98
+__Comptime_Register_Main_Exec(99, -1); // execute comptime statement #99
+__Comptime_Register_Main_Exec(100, -1); // execute comptime statement #100
+__Comptime_Register_Main_Exec(101, -1); // execute comptime statement #101
+__Comptime_Register_Main_Exec(102, -1); // execute comptime statement #102
+__Comptime_Register_Main_Exec(103, -1); // execute comptime statement #103
+__Comptime_Register_Main_Exec(104, -1); // execute comptime statement #104
+__Comptime_Register_Main_Exec(105, -1); // execute comptime statement #105
+__Comptime_Register_Main_Exec(106, -1); // execute comptime statement #106
+__Comptime_Register_Main_Exec(107, -1); // execute comptime statement #107
+__Comptime_Register_Main_Exec(108, -1); // execute comptime statement #108
+__Comptime_Register_Main_Exec(109, -1); // execute comptime statement #109
+__Comptime_Register_Main_Exec(110, -1); // execute comptime statement #110
+__Comptime_Register_Main_Exec(111, -1); // execute comptime statement #111
+__Comptime_Register_Main_Exec(112, -1); // execute comptime statement #112
+__Comptime_Register_Main_Exec(113, -1); // execute comptime statement #113
+__Comptime_Register_Main_Exec(114, -1); // execute comptime statement #114
+__Comptime_Register_Main_Exec(115, -1); // execute comptime statement #115
+__Comptime_Register_Main_Exec(116, -1); // execute comptime statement #116
+__Comptime_Register_Main_Exec(117, -1); // execute comptime statement #117
+__Comptime_Register_Main_Exec(118, -1); // execute comptime statement #118
+__Comptime_Register_Main_Exec(119, -1); // execute comptime statement #119
+__Comptime_Register_Main_Exec(120, -1); // execute comptime statement #120
+__Comptime_Register_Main_Exec(121, -1); // execute comptime statement #121
+__Comptime_Register_Main_Exec(122, -1); // execute comptime statement #122
+__Comptime_Register_Main_Exec(123, -1); // execute comptime statement #123
+__Comptime_Register_Main_Exec(124, -1); // execute comptime statement #124
+__Comptime_Register_Main_Exec(125, -1); // execute comptime statement #125
+__Comptime_Register_Main_Exec(126, -1); // execute comptime statement #126
+__Comptime_Register_Main_Exec(127, -1); // execute comptime statement #127
+__Comptime_Register_Main_Exec(128, -1); // execute comptime statement #128
+__Comptime_Register_Main_Exec(129, -1); // execute comptime statement #129
+__Comptime_Register_Main_Exec(130, -1); // execute comptime statement #130
+__Comptime_Register_Main_Exec(131, -1); // execute comptime statement #131
+__Comptime_Register_Main_Exec(132, -1); // execute comptime statement #132
+__Comptime_Register_Main_Exec(133, -1); // execute comptime statement #133
+__Comptime_Register_Main_Exec(134, -1); // execute comptime statement #134
+__Comptime_Register_Main_Exec(135, -1); // execute comptime statement #135
+__Comptime_Register_Main_Exec(136, -1); // execute comptime statement #136
+__Comptime_Register_Main_Exec(137, -1); // execute comptime statement #137
+__Comptime_Register_Main_Exec(138, -1); // execute comptime statement #138
+__Comptime_Register_Main_Exec(139, -1); // execute comptime statement #139
+__Comptime_Register_Main_Exec(140, -1); // execute comptime statement #140
+__Comptime_Register_Main_Exec(141, -1); // execute comptime statement #141
+__Comptime_Register_Main_Exec(142, -1); // execute comptime statement #142
+__Comptime_Register_Main_Exec(143, -1); // execute comptime statement #143
+__Comptime_Register_Main_Exec(144, -1); // execute comptime statement #144
+__Comptime_Register_Main_Exec(145, -1); // execute comptime statement #145
+__Comptime_Register_Main_Exec(146, -1); // execute comptime statement #146
+__Comptime_Register_Main_Exec(147, -1); // execute comptime statement #147
+__Comptime_Register_Main_Exec(148, -1); // execute comptime statement #148
+__Comptime_Register_Main_Exec(149, -1); // execute comptime statement #149
+__Comptime_Register_Main_Exec(150, -1); // execute comptime statement #150
+__Comptime_Register_Main_Exec(151, -1); // execute comptime statement #151
+__Comptime_Register_Main_Exec(152, -1); // execute comptime statement #152
+__Comptime_Register_Main_Exec(153, -1); // execute comptime statement #153
+__Comptime_Register_Main_Exec(154, -1); // execute comptime statement #154
+__Comptime_Register_Main_Exec(155, -1); // execute comptime statement #155
+__Comptime_Register_Main_Exec(156, -1); // execute comptime statement #156
+__Comptime_Register_Main_Exec(157, -1); // execute comptime statement #157
+__Comptime_Register_Main_Exec(158, -1); // execute comptime statement #158
+__Comptime_Register_Main_Exec(159, -1); // execute comptime statement #159
+__Comptime_Register_Main_Exec(160, -1); // execute comptime statement #160
+__Comptime_Register_Main_Exec(161, -1); // execute comptime statement #161
+__Comptime_Register_Main_Exec(162, -1); // execute comptime statement #162
+__Comptime_Register_Main_Exec(163, -1); // execute comptime statement #163
+__Comptime_Register_Main_Exec(164, -1); // execute comptime statement #164
+__Comptime_Register_Main_Exec(165, -1); // execute comptime statement #165
+__Comptime_Register_Main_Exec(166, -1); // execute comptime statement #166
+__Comptime_Register_Main_Exec(167, -1); // execute comptime statement #167
+__Comptime_Register_Main_Exec(168, -1); // execute comptime statement #168
+__Comptime_Register_Main_Exec(169, -1); // execute comptime statement #169
+__Comptime_Register_Main_Exec(170, -1); // execute comptime statement #170
+__Comptime_Register_Main_Exec(171, -1); // execute comptime statement #171
+__Comptime_Register_Main_Exec(172, -1); // execute comptime statement #172
+__Comptime_Register_Main_Exec(173, -1); // execute comptime statement #173
+__Comptime_Register_Main_Exec(174, -1); // execute comptime statement #174
+__Comptime_Register_Main_Exec(175, -1); // execute comptime statement #175
+__Comptime_Register_Main_Exec(176, -1); // execute comptime statement #176
+__Comptime_Register_Main_Exec(177, -1); // execute comptime statement #177
+__Comptime_Register_Main_Exec(178, -1); // execute comptime statement #178
+__Comptime_Register_Main_Exec(179, -1); // execute comptime statement #179
+__Comptime_Register_Main_Exec(180, -1); // execute comptime statement #180
+__Comptime_Register_Main_Exec(181, -1); // execute comptime statement #181
+__Comptime_Register_Main_Exec(182, -1); // execute comptime statement #182
+__Comptime_Register_Main_Exec(183, -1); // execute comptime statement #183
+__Comptime_Register_Main_Exec(184, -1); // execute comptime statement #184
+__Comptime_Register_Main_Exec(185, -1); // execute comptime statement #185
+__Comptime_Register_Main_Exec(186, -1); // execute comptime statement #186
+__Comptime_Register_Main_Exec(187, -1); // execute comptime statement #187
+__Comptime_Register_Main_Exec(188, -1); // execute comptime statement #188
+__Comptime_Register_Main_Exec(189, -1); // execute comptime statement #189
+__Comptime_Register_Main_Exec(190, -1); // execute comptime statement #190
+__Comptime_Register_Main_Exec(191, -1); // execute comptime statement #191
+__Comptime_Register_Main_Exec(192, -1); // execute comptime statement #192
+__Comptime_Register_Main_Exec(193, -1); // execute comptime statement #193
+__Comptime_Register_Main_Exec(194, -1); // execute comptime statement #194
+__Comptime_Register_Main_Exec(195, -1); // execute comptime statement #195
+__Comptime_Register_Main_Exec(196, -1); // execute comptime statement #196
+__Comptime_Register_Main_Exec(197, -1); // execute comptime statement #197
+__Comptime_Register_Main_Exec(198, -1); // execute comptime statement #198
+__Comptime_Register_Main_Exec(199, -1); // execute comptime statement #199
@@ -0,0 +1,415 @@
+#include <stdio.h>
+
+#include "../../../ccomptime.h"
+#include "main.c.h"
+
+void gen_type(_ComptimeCtx _ComptimeCtx) {
+  _ComptimeCtx.Inline.appendf("long");
+}
+
+_ComptimeType(gen_type(_ComptimeCtx)) value_0(void) { return 0; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_1(void) { return 1; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_2(void) { return 2; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_3(void) { return 3; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_4(void) { return 4; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_5(void) { return 5; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_6(void) { return 6; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_7(void) { return 7; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_8(void) { return 8; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_9(void) { return 9; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_10(void) { return 10; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_11(void) { return 11; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_12(void) { return 12; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_13(void) { return 13; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_14(void) { return 14; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_15(void) { return 15; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_16(void) { return 16; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_17(void) { return 17; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_18(void) { return 18; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_19(void) { return 19; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_20(void) { return 20; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_21(void) { return 21; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_22(void) { return 22; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_23(void) { return 23; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_24(void) { return 24; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_25(void) { return 25; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_26(void) { return 26; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_27(void) { return 27; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_28(void) { return 28; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_29(void) { return 29; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_30(void) { return 30; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_31(void) { return 31; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_32(void) { return 32; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_33(void) { return 33; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_34(void) { return 34; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_35(void) { return 35; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_36(void) { return 36; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_37(void) { return 37; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_38(void) { return 38; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_39(void) { return 39; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_40(void) { return 40; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_41(void) { return 41; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_42(void) { return 42; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_43(void) { return 43; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_44(void) { return 44; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_45(void) { return 45; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_46(void) { return 46; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_47(void) { return 47; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_48(void) { return 48; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_49(void) { return 49; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_50(void) { return 50; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_51(void) { return 51; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_52(void) { return 52; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_53(void) { return 53; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_54(void) { return 54; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_55(void) { return 55; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_56(void) { return 56; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_57(void) { return 57; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_58(void) { return 58; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_59(void) { return 59; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_60(void) { return 60; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_61(void) { return 61; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_62(void) { return 62; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_63(void) { return 63; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_64(void) { return 64; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_65(void) { return 65; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_66(void) { return 66; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_67(void) { return 67; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_68(void) { return 68; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_69(void) { return 69; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_70(void) { return 70; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_71(void) { return 71; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_72(void) { return 72; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_73(void) { return 73; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_74(void) { return 74; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_75(void) { return 75; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_76(void) { return 76; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_77(void) { return 77; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_78(void) { return 78; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_79(void) { return 79; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_80(void) { return 80; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_81(void) { return 81; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_82(void) { return 82; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_83(void) { return 83; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_84(void) { return 84; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_85(void) { return 85; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_86(void) { return 86; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_87(void) { return 87; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_88(void) { return 88; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_89(void) { return 89; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_90(void) { return 90; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_91(void) { return 91; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_92(void) { return 92; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_93(void) { return 93; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_94(void) { return 94; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_95(void) { return 95; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_96(void) { return 96; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_97(void) { return 97; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_98(void) { return 98; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_99(void) { return 99; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_100(void) { return 100; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_101(void) { return 101; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_102(void) { return 102; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_103(void) { return 103; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_104(void) { return 104; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_105(void) { return 105; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_106(void) { return 106; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_107(void) { return 107; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_108(void) { return 108; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_109(void) { return 109; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_110(void) { return 110; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_111(void) { return 111; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_112(void) { return 112; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_113(void) { return 113; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_114(void) { return 114; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_115(void) { return 115; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_116(void) { return 116; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_117(void) { return 117; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_118(void) { return 118; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_119(void) { return 119; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_120(void) { return 120; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_121(void) { return 121; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_122(void) { return 122; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_123(void) { return 123; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_124(void) { return 124; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_125(void) { return 125; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_126(void) { return 126; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_127(void) { return 127; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_128(void) { return 128; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_129(void) { return 129; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_130(void) { return 130; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_131(void) { return 131; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_132(void) { return 132; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_133(void) { return 133; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_134(void) { return 134; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_135(void) { return 135; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_136(void) { return 136; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_137(void) { return 137; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_138(void) { return 138; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_139(void) { return 139; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_140(void) { return 140; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_141(void) { return 141; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_142(void) { return 142; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_143(void) { return 143; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_144(void) { return 144; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_145(void) { return 145; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_146(void) { return 146; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_147(void) { return 147; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_148(void) { return 148; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_149(void) { return 149; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_150(void) { return 150; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_151(void) { return 151; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_152(void) { return 152; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_153(void) { return 153; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_154(void) { return 154; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_155(void) { return 155; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_156(void) { return 156; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_157(void) { return 157; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_158(void) { return 158; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_159(void) { return 159; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_160(void) { return 160; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_161(void) { return 161; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_162(void) { return 162; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_163(void) { return 163; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_164(void) { return 164; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_165(void) { return 165; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_166(void) { return 166; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_167(void) { return 167; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_168(void) { return 168; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_169(void) { return 169; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_170(void) { return 170; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_171(void) { return 171; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_172(void) { return 172; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_173(void) { return 173; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_174(void) { return 174; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_175(void) { return 175; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_176(void) { return 176; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_177(void) { return 177; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_178(void) { return 178; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_179(void) { return 179; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_180(void) { return 180; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_181(void) { return 181; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_182(void) { return 182; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_183(void) { return 183; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_184(void) { return 184; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_185(void) { return 185; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_186(void) { return 186; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_187(void) { return 187; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_188(void) { return 188; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_189(void) { return 189; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_190(void) { return 190; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_191(void) { return 191; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_192(void) { return 192; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_193(void) { return 193; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_194(void) { return 194; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_195(void) { return 195; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_196(void) { return 196; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_197(void) { return 197; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_198(void) { return 198; }
+_ComptimeType(gen_type(_ComptimeCtx)) value_199(void) { return 199; }
+
+int main(void) {
+  long sum = 0;
+  sum += value_0();
+  sum += value_1();
+  sum += value_2();
+  sum += value_3();
+  sum += value_4();
+  sum += value_5();
+  sum += value_6();
+  sum += value_7();
+  sum += value_8();
+  sum += value_9();
+  sum += value_10();
+  sum += value_11();
+  sum += value_12();
+  sum += value_13();
+  sum += value_14();
+  sum += value_15();
+  sum += value_16();
+  sum += value_17();
+  sum += value_18();
+  sum += value_19();
+  sum += value_20();
+  sum += value_21();
+  sum += value_22();
+  sum += value_23();
+  sum += value_24();
+  sum += value_25();
+  sum += value_26();
+  sum += value_27();
+  sum += value_28();
+  sum += value_29();
+  sum += value_30();
+  sum += value_31();
+  sum += value_32();
+  sum += value_33();
+  sum += value_34();
+  sum += value_35();
+  sum += value_36();
+  sum += value_37();
+  sum += value_38();
+  sum += value_39();
+  sum += value_40();
+  sum += value_41();
+  sum += value_42();
+  sum += value_43();
+  sum += value_44();
+  sum += value_45();
+  sum += value_46();
+  sum += value_47();
+  sum += value_48();
+  sum += value_49();
+  sum += value_50();
+  sum += value_51();
+  sum += value_52();
+  sum += value_53();
+  sum += value_54();
+  sum += value_55();
+  sum += value_56();
+  sum += value_57();
+  sum += value_58();
+  sum += value_59();
+  sum += value_60();
+  sum += value_61();
+  sum += value_62();
+  sum += value_63();
+  sum += value_64();
+  sum += value_65();
+  sum += value_66();
+  sum += value_67();
+  sum += value_68();
+  sum += value_69();
+  sum += value_70();
+  sum += value_71();
+  sum += value_72();
+  sum += value_73();
+  sum += value_74();
+  sum += value_75();
+  sum += value_76();
+  sum += value_77();
+  sum += value_78();
+  sum += value_79();
+  sum += value_80();
+  sum += value_81();
+  sum += value_82();
+  sum += value_83();
+  sum += value_84();
+  sum += value_85();
+  sum += value_86();
+  sum += value_87();
+  sum += value_88();
+  sum += value_89();
+  sum += value_90();
+  sum += value_91();
+  sum += value_92();
+  sum += value_93();
+  sum += value_94();
+  sum += value_95();
+  sum += value_96();
+  sum += value_97();
+  sum += value_98();
+  sum += value_99();
+  sum += value_100();
+  sum += value_101();
+  sum += value_102();
+  sum += value_103();
+  sum += value_104();
+  sum += value_105();
+  sum += value_106();
+  sum += value_107();
+  sum += value_108();
+  sum += value_109();
+  sum += value_110();
+  sum += value_111();
+  sum += value_112();
+  sum += value_113();
+  sum += value_114();
+  sum += value_115();
+  sum += value_116();
+  sum += value_117();
+  sum += value_118();
+  sum += value_119();
+  sum += value_120();
+  sum += value_121();
+  sum += value_122();
+  sum += value_123();
+  sum += value_124();
+  sum += value_125();
+  sum += value_126();
+  sum += value_127();
+  sum += value_128();
+  sum += value_129();
+  sum += value_130();
+  sum += value_131();
+  sum += value_132();
+  sum += value_133();
+  sum += value_134();
+  sum += value_135();
+  sum += value_136();
+  sum += value_137();
+  sum += value_138();
+  sum += value_139();
+  sum += value_140();
+  sum += value_141();
+  sum += value_142();
+  sum += value_143();
+  sum += value_144();
+  sum += value_145();
+  sum += value_146();
+  sum += value_147();
+  sum += value_148();
+  sum += value_149();
+  sum += value_150();
+  sum += value_151();
+  sum += value_152();
+  sum += value_153();
+  sum += value_154();
+  sum += value_155();
+  sum += value_156();
+  sum += value_157();
+  sum += value_158();
+  sum += value_159();
+  sum += value_160();
+  sum += value_161();
+  sum += value_162();
+  sum += value_163();
+  sum += value_164();
+  sum += value_165();
+  sum += value_166();
+  sum += value_167();
+  sum += value_168();
+  sum += value_169();
+  sum += value_170();
+  sum += value_171();
+  sum += value_172();
+  sum += value_173();
+  sum += value_174();
+  sum += value_175();
+  sum += value_176();
+  sum += value_177();
+  sum += value_178();
+  sum += value_179();
+  sum += value_180();
+  sum += value_181();
+  sum += value_182();
+  sum += value_183();
+  sum += value_184();
+  sum += value_185();
+  sum += value_186();
+  sum += value_187();
+  sum += value_188();
+  sum += value_189();
+  sum += value_190();
+  sum += value_191();
+  sum += value_192();
+  sum += value_193();
+  sum += value_194();
+  sum += value_195();
+  sum += value_196();
+  sum += value_197();
+  sum += value_198();
+  sum += value_199();
+  printf("%ld\n", sum);
+  return 0;
+}
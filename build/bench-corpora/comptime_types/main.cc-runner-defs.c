@@ -0,0 +1,400 @@
+
+__Comptime_Statement_Fn(0, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(1, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(2, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(3, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(4, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(5, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(6, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(7, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(8, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(9, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(10, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(11, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(12, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(13, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(14, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(15, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(16, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(17, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(18, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(19, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(20, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(21, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(22, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(23, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(24, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(25, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(26, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(27, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(28, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(29, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(30, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(31, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(32, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(33, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(34, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(35, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(36, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(37, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(38, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(39, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(40, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(41, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(42, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(43, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(44, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(45, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(46, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(47, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(48, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(49, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(50, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(51, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(52, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(53, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(54, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(55, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(56, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(57, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(58, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(59, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(60, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(61, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(62, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(63, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(64, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(65, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(66, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(67, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(68, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(69, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(70, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(71, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(72, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(73, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(74, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(75, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(76, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(77, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(78, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(79, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(80, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(81, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(82, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(83, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(84, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(85, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(86, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(87, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(88, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(89, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(90, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(91, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(92, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(93, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(94, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(95, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(96, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(97, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(98, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(99, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(100, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(101, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(102, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(103, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(104, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(105, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(106, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(107, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(108, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(109, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(110, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(111, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(112, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(113, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(114, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(115, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(116, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(117, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(118, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(119, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(120, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(121, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(122, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(123, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(124, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(125, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(126, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(127, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(128, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(129, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(130, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(131, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(132, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(133, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(134, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(135, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(136, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(137, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(138, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(139, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(140, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(141, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(142, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(143, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(144, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(145, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(146, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(147, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(148, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(149, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(150, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(151, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(152, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(153, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(154, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(155, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(156, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(157, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(158, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(159, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(160, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(161, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(162, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(163, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(164, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(165, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(166, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(167, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(168, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(169, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(170, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(171, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(172, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(173, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(174, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(175, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(176, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(177, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(178, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(179, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(180, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(181, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(182, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(183, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(184, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(185, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(186, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(187, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(188, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(189, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(190, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(191, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(192, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(193, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(194, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(195, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(196, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(197, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(198, _ComptimeType(gen_type(_ComptimeCtx)))
+
+__Comptime_Statement_Fn(199, _ComptimeType(gen_type(_ComptimeCtx)))
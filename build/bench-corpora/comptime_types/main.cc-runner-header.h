@@ -0,0 +1,403 @@
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) long
+#define _COMPTIMETYPE_0 long
+#define _COMPTIME_X1(...) long
+#define _COMPTIMETYPE_1 long
+#define _COMPTIME_X2(...) long
+#define _COMPTIMETYPE_2 long
+#define _COMPTIME_X3(...) long
+#define _COMPTIMETYPE_3 long
+#define _COMPTIME_X4(...) long
+#define _COMPTIMETYPE_4 long
+#define _COMPTIME_X5(...) long
+#define _COMPTIMETYPE_5 long
+#define _COMPTIME_X6(...) long
+#define _COMPTIMETYPE_6 long
+#define _COMPTIME_X7(...) long
+#define _COMPTIMETYPE_7 long
+#define _COMPTIME_X8(...) long
+#define _COMPTIMETYPE_8 long
+#define _COMPTIME_X9(...) long
+#define _COMPTIMETYPE_9 long
+#define _COMPTIME_X10(...) long
+#define _COMPTIMETYPE_10 long
+#define _COMPTIME_X11(...) long
+#define _COMPTIMETYPE_11 long
+#define _COMPTIME_X12(...) long
+#define _COMPTIMETYPE_12 long
+#define _COMPTIME_X13(...) long
+#define _COMPTIMETYPE_13 long
+#define _COMPTIME_X14(...) long
+#define _COMPTIMETYPE_14 long
+#define _COMPTIME_X15(...) long
+#define _COMPTIMETYPE_15 long
+#define _COMPTIME_X16(...) long
+#define _COMPTIMETYPE_16 long
+#define _COMPTIME_X17(...) long
+#define _COMPTIMETYPE_17 long
+#define _COMPTIME_X18(...) long
+#define _COMPTIMETYPE_18 long
+#define _COMPTIME_X19(...) long
+#define _COMPTIMETYPE_19 long
+#define _COMPTIME_X20(...) long
+#define _COMPTIMETYPE_20 long
+#define _COMPTIME_X21(...) long
+#define _COMPTIMETYPE_21 long
+#define _COMPTIME_X22(...) long
+#define _COMPTIMETYPE_22 long
+#define _COMPTIME_X23(...) long
+#define _COMPTIMETYPE_23 long
+#define _COMPTIME_X24(...) long
+#define _COMPTIMETYPE_24 long
+#define _COMPTIME_X25(...) long
+#define _COMPTIMETYPE_25 long
+#define _COMPTIME_X26(...) long
+#define _COMPTIMETYPE_26 long
+#define _COMPTIME_X27(...) long
+#define _COMPTIMETYPE_27 long
+#define _COMPTIME_X28(...) long
+#define _COMPTIMETYPE_28 long
+#define _COMPTIME_X29(...) long
+#define _COMPTIMETYPE_29 long
+#define _COMPTIME_X30(...) long
+#define _COMPTIMETYPE_30 long
+#define _COMPTIME_X31(...) long
+#define _COMPTIMETYPE_31 long
+#define _COMPTIME_X32(...) long
+#define _COMPTIMETYPE_32 long
+#define _COMPTIME_X33(...) long
+#define _COMPTIMETYPE_33 long
+#define _COMPTIME_X34(...) long
+#define _COMPTIMETYPE_34 long
+#define _COMPTIME_X35(...) long
+#define _COMPTIMETYPE_35 long
+#define _COMPTIME_X36(...) long
+#define _COMPTIMETYPE_36 long
+#define _COMPTIME_X37(...) long
+#define _COMPTIMETYPE_37 long
+#define _COMPTIME_X38(...) long
+#define _COMPTIMETYPE_38 long
+#define _COMPTIME_X39(...) long
+#define _COMPTIMETYPE_39 long
+#define _COMPTIME_X40(...) long
+#define _COMPTIMETYPE_40 long
+#define _COMPTIME_X41(...) long
+#define _COMPTIMETYPE_41 long
+#define _COMPTIME_X42(...) long
+#define _COMPTIMETYPE_42 long
+#define _COMPTIME_X43(...) long
+#define _COMPTIMETYPE_43 long
+#define _COMPTIME_X44(...) long
+#define _COMPTIMETYPE_44 long
+#define _COMPTIME_X45(...) long
+#define _COMPTIMETYPE_45 long
+#define _COMPTIME_X46(...) long
+#define _COMPTIMETYPE_46 long
+#define _COMPTIME_X47(...) long
+#define _COMPTIMETYPE_47 long
+#define _COMPTIME_X48(...) long
+#define _COMPTIMETYPE_48 long
+#define _COMPTIME_X49(...) long
+#define _COMPTIMETYPE_49 long
+#define _COMPTIME_X50(...) long
+#define _COMPTIMETYPE_50 long
+#define _COMPTIME_X51(...) long
+#define _COMPTIMETYPE_51 long
+#define _COMPTIME_X52(...) long
+#define _COMPTIMETYPE_52 long
+#define _COMPTIME_X53(...) long
+#define _COMPTIMETYPE_53 long
+#define _COMPTIME_X54(...) long
+#define _COMPTIMETYPE_54 long
+#define _COMPTIME_X55(...) long
+#define _COMPTIMETYPE_55 long
+#define _COMPTIME_X56(...) long
+#define _COMPTIMETYPE_56 long
+#define _COMPTIME_X57(...) long
+#define _COMPTIMETYPE_57 long
+#define _COMPTIME_X58(...) long
+#define _COMPTIMETYPE_58 long
+#define _COMPTIME_X59(...) long
+#define _COMPTIMETYPE_59 long
+#define _COMPTIME_X60(...) long
+#define _COMPTIMETYPE_60 long
+#define _COMPTIME_X61(...) long
+#define _COMPTIMETYPE_61 long
+#define _COMPTIME_X62(...) long
+#define _COMPTIMETYPE_62 long
+#define _COMPTIME_X63(...) long
+#define _COMPTIMETYPE_63 long
+#define _COMPTIME_X64(...) long
+#define _COMPTIMETYPE_64 long
+#define _COMPTIME_X65(...) long
+#define _COMPTIMETYPE_65 long
+#define _COMPTIME_X66(...) long
+#define _COMPTIMETYPE_66 long
+#define _COMPTIME_X67(...) long
+#define _COMPTIMETYPE_67 long
+#define _COMPTIME_X68(...) long
+#define _COMPTIMETYPE_68 long
+#define _COMPTIME_X69(...) long
+#define _COMPTIMETYPE_69 long
+#define _COMPTIME_X70(...) long
+#define _COMPTIMETYPE_70 long
+#define _COMPTIME_X71(...) long
+#define _COMPTIMETYPE_71 long
+#define _COMPTIME_X72(...) long
+#define _COMPTIMETYPE_72 long
+#define _COMPTIME_X73(...) long
+#define _COMPTIMETYPE_73 long
+#define _COMPTIME_X74(...) long
+#define _COMPTIMETYPE_74 long
+#define _COMPTIME_X75(...) long
+#define _COMPTIMETYPE_75 long
+#define _COMPTIME_X76(...) long
+#define _COMPTIMETYPE_76 long
+#define _COMPTIME_X77(...) long
+#define _COMPTIMETYPE_77 long
+#define _COMPTIME_X78(...) long
+#define _COMPTIMETYPE_78 long
+#define _COMPTIME_X79(...) long
+#define _COMPTIMETYPE_79 long
+#define _COMPTIME_X80(...) long
+#define _COMPTIMETYPE_80 long
+#define _COMPTIME_X81(...) long
+#define _COMPTIMETYPE_81 long
+#define _COMPTIME_X82(...) long
+#define _COMPTIMETYPE_82 long
+#define _COMPTIME_X83(...) long
+#define _COMPTIMETYPE_83 long
+#define _COMPTIME_X84(...) long
+#define _COMPTIMETYPE_84 long
+#define _COMPTIME_X85(...) long
+#define _COMPTIMETYPE_85 long
+#define _COMPTIME_X86(...) long
+#define _COMPTIMETYPE_86 long
+#define _COMPTIME_X87(...) long
+#define _COMPTIMETYPE_87 long
+#define _COMPTIME_X88(...) long
+#define _COMPTIMETYPE_88 long
+#define _COMPTIME_X89(...) long
+#define _COMPTIMETYPE_89 long
+#define _COMPTIME_X90(...) long
+#define _COMPTIMETYPE_90 long
+#define _COMPTIME_X91(...) long
+#define _COMPTIMETYPE_91 long
+#define _COMPTIME_X92(...) long
+#define _COMPTIMETYPE_92 long
+#define _COMPTIME_X93(...) long
+#define _COMPTIMETYPE_93 long
+#define _COMPTIME_X94(...) long
+#define _COMPTIMETYPE_94 long
+#define _COMPTIME_X95(...) long
+#define _COMPTIMETYPE_95 long
+#define _COMPTIME_X96(...) long
+#define _COMPTIMETYPE_96 long
+#define _COMPTIME_X97(...) long
+#define _COMPTIMETYPE_97 long
+#define _COMPTIME_X98(...) long
+#define _COMPTIMETYPE_98 long
+#define _COMPTIME_X99(...) long
+#define _COMPTIMETYPE_99 long
+#define _COMPTIME_X100(...) long
+#define _COMPTIMETYPE_100 long
+#define _COMPTIME_X101(...) long
+#define _COMPTIMETYPE_101 long
+#define _COMPTIME_X102(...) long
+#define _COMPTIMETYPE_102 long
+#define _COMPTIME_X103(...) long
+#define _COMPTIMETYPE_103 long
+#define _COMPTIME_X104(...) long
+#define _COMPTIMETYPE_104 long
+#define _COMPTIME_X105(...) long
+#define _COMPTIMETYPE_105 long
+#define _COMPTIME_X106(...) long
+#define _COMPTIMETYPE_106 long
+#define _COMPTIME_X107(...) long
+#define _COMPTIMETYPE_107 long
+#define _COMPTIME_X108(...) long
+#define _COMPTIMETYPE_108 long
+#define _COMPTIME_X109(...) long
+#define _COMPTIMETYPE_109 long
+#define _COMPTIME_X110(...) long
+#define _COMPTIMETYPE_110 long
+#define _COMPTIME_X111(...) long
+#define _COMPTIMETYPE_111 long
+#define _COMPTIME_X112(...) long
+#define _COMPTIMETYPE_112 long
+#define _COMPTIME_X113(...) long
+#define _COMPTIMETYPE_113 long
+#define _COMPTIME_X114(...) long
+#define _COMPTIMETYPE_114 long
+#define _COMPTIME_X115(...) long
+#define _COMPTIMETYPE_115 long
+#define _COMPTIME_X116(...) long
+#define _COMPTIMETYPE_116 long
+#define _COMPTIME_X117(...) long
+#define _COMPTIMETYPE_117 long
+#define _COMPTIME_X118(...) long
+#define _COMPTIMETYPE_118 long
+#define _COMPTIME_X119(...) long
+#define _COMPTIMETYPE_119 long
+#define _COMPTIME_X120(...) long
+#define _COMPTIMETYPE_120 long
+#define _COMPTIME_X121(...) long
+#define _COMPTIMETYPE_121 long
+#define _COMPTIME_X122(...) long
+#define _COMPTIMETYPE_122 long
+#define _COMPTIME_X123(...) long
+#define _COMPTIMETYPE_123 long
+#define _COMPTIME_X124(...) long
+#define _COMPTIMETYPE_124 long
+#define _COMPTIME_X125(...) long
+#define _COMPTIMETYPE_125 long
+#define _COMPTIME_X126(...) long
+#define _COMPTIMETYPE_126 long
+#define _COMPTIME_X127(...) long
+#define _COMPTIMETYPE_127 long
+#define _COMPTIME_X128(...) long
+#define _COMPTIMETYPE_128 long
+#define _COMPTIME_X129(...) long
+#define _COMPTIMETYPE_129 long
+#define _COMPTIME_X130(...) long
+#define _COMPTIMETYPE_130 long
+#define _COMPTIME_X131(...) long
+#define _COMPTIMETYPE_131 long
+#define _COMPTIME_X132(...) long
+#define _COMPTIMETYPE_132 long
+#define _COMPTIME_X133(...) long
+#define _COMPTIMETYPE_133 long
+#define _COMPTIME_X134(...) long
+#define _COMPTIMETYPE_134 long
+#define _COMPTIME_X135(...) long
+#define _COMPTIMETYPE_135 long
+#define _COMPTIME_X136(...) long
+#define _COMPTIMETYPE_136 long
+#define _COMPTIME_X137(...) long
+#define _COMPTIMETYPE_137 long
+#define _COMPTIME_X138(...) long
+#define _COMPTIMETYPE_138 long
+#define _COMPTIME_X139(...) long
+#define _COMPTIMETYPE_139 long
+#define _COMPTIME_X140(...) long
+#define _COMPTIMETYPE_140 long
+#define _COMPTIME_X141(...) long
+#define _COMPTIMETYPE_141 long
+#define _COMPTIME_X142(...) long
+#define _COMPTIMETYPE_142 long
+#define _COMPTIME_X143(...) long
+#define _COMPTIMETYPE_143 long
+#define _COMPTIME_X144(...) long
+#define _COMPTIMETYPE_144 long
+#define _COMPTIME_X145(...) long
+#define _COMPTIMETYPE_145 long
+#define _COMPTIME_X146(...) long
+#define _COMPTIMETYPE_146 long
+#define _COMPTIME_X147(...) long
+#define _COMPTIMETYPE_147 long
+#define _COMPTIME_X148(...) long
+#define _COMPTIMETYPE_148 long
+#define _COMPTIME_X149(...) long
+#define _COMPTIMETYPE_149 long
+#define _COMPTIME_X150(...) long
+#define _COMPTIMETYPE_150 long
+#define _COMPTIME_X151(...) long
+#define _COMPTIMETYPE_151 long
+#define _COMPTIME_X152(...) long
+#define _COMPTIMETYPE_152 long
+#define _COMPTIME_X153(...) long
+#define _COMPTIMETYPE_153 long
+#define _COMPTIME_X154(...) long
+#define _COMPTIMETYPE_154 long
+#define _COMPTIME_X155(...) long
+#define _COMPTIMETYPE_155 long
+#define _COMPTIME_X156(...) long
+#define _COMPTIMETYPE_156 long
+#define _COMPTIME_X157(...) long
+#define _COMPTIMETYPE_157 long
+#define _COMPTIME_X158(...) long
+#define _COMPTIMETYPE_158 long
+#define _COMPTIME_X159(...) long
+#define _COMPTIMETYPE_159 long
+#define _COMPTIME_X160(...) long
+#define _COMPTIMETYPE_160 long
+#define _COMPTIME_X161(...) long
+#define _COMPTIMETYPE_161 long
+#define _COMPTIME_X162(...) long
+#define _COMPTIMETYPE_162 long
+#define _COMPTIME_X163(...) long
+#define _COMPTIMETYPE_163 long
+#define _COMPTIME_X164(...) long
+#define _COMPTIMETYPE_164 long
+#define _COMPTIME_X165(...) long
+#define _COMPTIMETYPE_165 long
+#define _COMPTIME_X166(...) long
+#define _COMPTIMETYPE_166 long
+#define _COMPTIME_X167(...) long
+#define _COMPTIMETYPE_167 long
+#define _COMPTIME_X168(...) long
+#define _COMPTIMETYPE_168 long
+#define _COMPTIME_X169(...) long
+#define _COMPTIMETYPE_169 long
+#define _COMPTIME_X170(...) long
+#define _COMPTIMETYPE_170 long
+#define _COMPTIME_X171(...) long
+#define _COMPTIMETYPE_171 long
+#define _COMPTIME_X172(...) long
+#define _COMPTIMETYPE_172 long
+#define _COMPTIME_X173(...) long
+#define _COMPTIMETYPE_173 long
+#define _COMPTIME_X174(...) long
+#define _COMPTIMETYPE_174 long
+#define _COMPTIME_X175(...) long
+#define _COMPTIMETYPE_175 long
+#define _COMPTIME_X176(...) long
+#define _COMPTIMETYPE_176 long
+#define _COMPTIME_X177(...) long
+#define _COMPTIMETYPE_177 long
+#define _COMPTIME_X178(...) long
+#define _COMPTIMETYPE_178 long
+#define _COMPTIME_X179(...) long
+#define _COMPTIMETYPE_179 long
+#define _COMPTIME_X180(...) long
+#define _COMPTIMETYPE_180 long
+#define _COMPTIME_X181(...) long
+#define _COMPTIMETYPE_181 long
+#define _COMPTIME_X182(...) long
+#define _COMPTIMETYPE_182 long
+#define _COMPTIME_X183(...) long
+#define _COMPTIMETYPE_183 long
+#define _COMPTIME_X184(...) long
+#define _COMPTIMETYPE_184 long
+#define _COMPTIME_X185(...) long
+#define _COMPTIMETYPE_185 long
+#define _COMPTIME_X186(...) long
+#define _COMPTIMETYPE_186 long
+#define _COMPTIME_X187(...) long
+#define _COMPTIMETYPE_187 long
+#define _COMPTIME_X188(...) long
+#define _COMPTIMETYPE_188 long
+#define _COMPTIME_X189(...) long
+#define _COMPTIMETYPE_189 long
+#define _COMPTIME_X190(...) long
+#define _COMPTIMETYPE_190 long
+#define _COMPTIME_X191(...) long
+#define _COMPTIMETYPE_191 long
+#define _COMPTIME_X192(...) long
+#define _COMPTIMETYPE_192 long
+#define _COMPTIME_X193(...) long
+#define _COMPTIMETYPE_193 long
+#define _COMPTIME_X194(...) long
+#define _COMPTIMETYPE_194 long
+#define _COMPTIME_X195(...) long
+#define _COMPTIMETYPE_195 long
+#define _COMPTIME_X196(...) long
+#define _COMPTIMETYPE_196 long
+#define _COMPTIME_X197(...) long
+#define _COMPTIMETYPE_197 long
+#define _COMPTIME_X198(...) long
+#define _COMPTIMETYPE_198 long
+#define _COMPTIME_X199(...) long
+#define _COMPTIMETYPE_199 long
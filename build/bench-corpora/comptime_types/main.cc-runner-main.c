@@ -0,0 +1,200 @@
+__Comptime_Register_Type_Exec(0, 0, -1); // execute comptime statement #0
+__Comptime_Register_Type_Exec(1, 1, -1); // execute comptime statement #1
+__Comptime_Register_Type_Exec(2, 2, -1); // execute comptime statement #2
+__Comptime_Register_Type_Exec(3, 3, -1); // execute comptime statement #3
+__Comptime_Register_Type_Exec(4, 4, -1); // execute comptime statement #4
+__Comptime_Register_Type_Exec(5, 5, -1); // execute comptime statement #5
+__Comptime_Register_Type_Exec(6, 6, -1); // execute comptime statement #6
+__Comptime_Register_Type_Exec(7, 7, -1); // execute comptime statement #7
+__Comptime_Register_Type_Exec(8, 8, -1); // execute comptime statement #8
+__Comptime_Register_Type_Exec(9, 9, -1); // execute comptime statement #9
+__Comptime_Register_Type_Exec(10, 10, -1); // execute comptime statement #10
+__Comptime_Register_Type_Exec(11, 11, -1); // execute comptime statement #11
+__Comptime_Register_Type_Exec(12, 12, -1); // execute comptime statement #12
+__Comptime_Register_Type_Exec(13, 13, -1); // execute comptime statement #13
+__Comptime_Register_Type_Exec(14, 14, -1); // execute comptime statement #14
+__Comptime_Register_Type_Exec(15, 15, -1); // execute comptime statement #15
+__Comptime_Register_Type_Exec(16, 16, -1); // execute comptime statement #16
+__Comptime_Register_Type_Exec(17, 17, -1); // execute comptime statement #17
+__Comptime_Register_Type_Exec(18, 18, -1); // execute comptime statement #18
+__Comptime_Register_Type_Exec(19, 19, -1); // execute comptime statement #19
+__Comptime_Register_Type_Exec(20, 20, -1); // execute comptime statement #20
+__Comptime_Register_Type_Exec(21, 21, -1); // execute comptime statement #21
+__Comptime_Register_Type_Exec(22, 22, -1); // execute comptime statement #22
+__Comptime_Register_Type_Exec(23, 23, -1); // execute comptime statement #23
+__Comptime_Register_Type_Exec(24, 24, -1); // execute comptime statement #24
+__Comptime_Register_Type_Exec(25, 25, -1); // execute comptime statement #25
+__Comptime_Register_Type_Exec(26, 26, -1); // execute comptime statement #26
+__Comptime_Register_Type_Exec(27, 27, -1); // execute comptime statement #27
+__Comptime_Register_Type_Exec(28, 28, -1); // execute comptime statement #28
+__Comptime_Register_Type_Exec(29, 29, -1); // execute comptime statement #29
+__Comptime_Register_Type_Exec(30, 30, -1); // execute comptime statement #30
+__Comptime_Register_Type_Exec(31, 31, -1); // execute comptime statement #31
+__Comptime_Register_Type_Exec(32, 32, -1); // execute comptime statement #32
+__Comptime_Register_Type_Exec(33, 33, -1); // execute comptime statement #33
+__Comptime_Register_Type_Exec(34, 34, -1); // execute comptime statement #34
+__Comptime_Register_Type_Exec(35, 35, -1); // execute comptime statement #35
+__Comptime_Register_Type_Exec(36, 36, -1); // execute comptime statement #36
+__Comptime_Register_Type_Exec(37, 37, -1); // execute comptime statement #37
+__Comptime_Register_Type_Exec(38, 38, -1); // execute comptime statement #38
+__Comptime_Register_Type_Exec(39, 39, -1); // execute comptime statement #39
+__Comptime_Register_Type_Exec(40, 40, -1); // execute comptime statement #40
+__Comptime_Register_Type_Exec(41, 41, -1); // execute comptime statement #41
+__Comptime_Register_Type_Exec(42, 42, -1); // execute comptime statement #42
+__Comptime_Register_Type_Exec(43, 43, -1); // execute comptime statement #43
+__Comptime_Register_Type_Exec(44, 44, -1); // execute comptime statement #44
+__Comptime_Register_Type_Exec(45, 45, -1); // execute comptime statement #45
+__Comptime_Register_Type_Exec(46, 46, -1); // execute comptime statement #46
+__Comptime_Register_Type_Exec(47, 47, -1); // execute comptime statement #47
+__Comptime_Register_Type_Exec(48, 48, -1); // execute comptime statement #48
+__Comptime_Register_Type_Exec(49, 49, -1); // execute comptime statement #49
+__Comptime_Register_Type_Exec(50, 50, -1); // execute comptime statement #50
+__Comptime_Register_Type_Exec(51, 51, -1); // execute comptime statement #51
+__Comptime_Register_Type_Exec(52, 52, -1); // execute comptime statement #52
+__Comptime_Register_Type_Exec(53, 53, -1); // execute comptime statement #53
+__Comptime_Register_Type_Exec(54, 54, -1); // execute comptime statement #54
+__Comptime_Register_Type_Exec(55, 55, -1); // execute comptime statement #55
+__Comptime_Register_Type_Exec(56, 56, -1); // execute comptime statement #56
+__Comptime_Register_Type_Exec(57, 57, -1); // execute comptime statement #57
+__Comptime_Register_Type_Exec(58, 58, -1); // execute comptime statement #58
+__Comptime_Register_Type_Exec(59, 59, -1); // execute comptime statement #59
+__Comptime_Register_Type_Exec(60, 60, -1); // execute comptime statement #60
+__Comptime_Register_Type_Exec(61, 61, -1); // execute comptime statement #61
+__Comptime_Register_Type_Exec(62, 62, -1); // execute comptime statement #62
+__Comptime_Register_Type_Exec(63, 63, -1); // execute comptime statement #63
+__Comptime_Register_Type_Exec(64, 64, -1); // execute comptime statement #64
+__Comptime_Register_Type_Exec(65, 65, -1); // execute comptime statement #65
+__Comptime_Register_Type_Exec(66, 66, -1); // execute comptime statement #66
+__Comptime_Register_Type_Exec(67, 67, -1); // execute comptime statement #67
+__Comptime_Register_Type_Exec(68, 68, -1); // execute comptime statement #68
+__Comptime_Register_Type_Exec(69, 69, -1); // execute comptime statement #69
+__Comptime_Register_Type_Exec(70, 70, -1); // execute comptime statement #70
+__Comptime_Register_Type_Exec(71, 71, -1); // execute comptime statement #71
+__Comptime_Register_Type_Exec(72, 72, -1); // execute comptime statement #72
+__Comptime_Register_Type_Exec(73, 73, -1); // execute comptime statement #73
+__Comptime_Register_Type_Exec(74, 74, -1); // execute comptime statement #74
+__Comptime_Register_Type_Exec(75, 75, -1); // execute comptime statement #75
+__Comptime_Register_Type_Exec(76, 76, -1); // execute comptime statement #76
+__Comptime_Register_Type_Exec(77, 77, -1); // execute comptime statement #77
+__Comptime_Register_Type_Exec(78, 78, -1); // execute comptime statement #78
+__Comptime_Register_Type_Exec(79, 79, -1); // execute comptime statement #79
+__Comptime_Register_Type_Exec(80, 80, -1); // execute comptime statement #80
+__Comptime_Register_Type_Exec(81, 81, -1); // execute comptime statement #81
+__Comptime_Register_Type_Exec(82, 82, -1); // execute comptime statement #82
+__Comptime_Register_Type_Exec(83, 83, -1); // execute comptime statement #83
+__Comptime_Register_Type_Exec(84, 84, -1); // execute comptime statement #84
+__Comptime_Register_Type_Exec(85, 85, -1); // execute comptime statement #85
+__Comptime_Register_Type_Exec(86, 86, -1); // execute comptime statement #86
+__Comptime_Register_Type_Exec(87, 87, -1); // execute comptime statement #87
+__Comptime_Register_Type_Exec(88, 88, -1); // execute comptime statement #88
+__Comptime_Register_Type_Exec(89, 89, -1); // execute comptime statement #89
+__Comptime_Register_Type_Exec(90, 90, -1); // execute comptime statement #90
+__Comptime_Register_Type_Exec(91, 91, -1); // execute comptime statement #91
+__Comptime_Register_Type_Exec(92, 92, -1); // execute comptime statement #92
+__Comptime_Register_Type_Exec(93, 93, -1); // execute comptime statement #93
+__Comptime_Register_Type_Exec(94, 94, -1); // execute comptime statement #94
+__Comptime_Register_Type_Exec(95, 95, -1); // execute comptime statement #95
+__Comptime_Register_Type_Exec(96, 96, -1); // execute comptime statement #96
+__Comptime_Register_Type_Exec(97, 97, -1); // execute comptime statement #97
+__Comptime_Register_Type_Exec(98, 98, -1); // execute comptime statement #98
+__Comptime_Register_Type_Exec(99, 99, -1); // execute comptime statement #99
+__Comptime_Register_Type_Exec(100, 100, -1); // execute comptime statement #100
+__Comptime_Register_Type_Exec(101, 101, -1); // execute comptime statement #101
+__Comptime_Register_Type_Exec(102, 102, -1); // execute comptime statement #102
+__Comptime_Register_Type_Exec(103, 103, -1); // execute comptime statement #103
+__Comptime_Register_Type_Exec(104, 104, -1); // execute comptime statement #104
+__Comptime_Register_Type_Exec(105, 105, -1); // execute comptime statement #105
+__Comptime_Register_Type_Exec(106, 106, -1); // execute comptime statement #106
+__Comptime_Register_Type_Exec(107, 107, -1); // execute comptime statement #107
+__Comptime_Register_Type_Exec(108, 108, -1); // execute comptime statement #108
+__Comptime_Register_Type_Exec(109, 109, -1); // execute comptime statement #109
+__Comptime_Register_Type_Exec(110, 110, -1); // execute comptime statement #110
+__Comptime_Register_Type_Exec(111, 111, -1); // execute comptime statement #111
+__Comptime_Register_Type_Exec(112, 112, -1); // execute comptime statement #112
+__Comptime_Register_Type_Exec(113, 113, -1); // execute comptime statement #113
+__Comptime_Register_Type_Exec(114, 114, -1); // execute comptime statement #114
+__Comptime_Register_Type_Exec(115, 115, -1); // execute comptime statement #115
+__Comptime_Register_Type_Exec(116, 116, -1); // execute comptime statement #116
+__Comptime_Register_Type_Exec(117, 117, -1); // execute comptime statement #117
+__Comptime_Register_Type_Exec(118, 118, -1); // execute comptime statement #118
+__Comptime_Register_Type_Exec(119, 119, -1); // execute comptime statement #119
+__Comptime_Register_Type_Exec(120, 120, -1); // execute comptime statement #120
+__Comptime_Register_Type_Exec(121, 121, -1); // execute comptime statement #121
+__Comptime_Register_Type_Exec(122, 122, -1); // execute comptime statement #122
+__Comptime_Register_Type_Exec(123, 123, -1); // execute comptime statement #123
+__Comptime_Register_Type_Exec(124, 124, -1); // execute comptime statement #124
+__Comptime_Register_Type_Exec(125, 125, -1); // execute comptime statement #125
+__Comptime_Register_Type_Exec(126, 126, -1); // execute comptime statement #126
+__Comptime_Register_Type_Exec(127, 127, -1); // execute comptime statement #127
+__Comptime_Register_Type_Exec(128, 128, -1); // execute comptime statement #128
+__Comptime_Register_Type_Exec(129, 129, -1); // execute comptime statement #129
+__Comptime_Register_Type_Exec(130, 130, -1); // execute comptime statement #130
+__Comptime_Register_Type_Exec(131, 131, -1); // execute comptime statement #131
+__Comptime_Register_Type_Exec(132, 132, -1); // execute comptime statement #132
+__Comptime_Register_Type_Exec(133, 133, -1); // execute comptime statement #133
+__Comptime_Register_Type_Exec(134, 134, -1); // execute comptime statement #134
+__Comptime_Register_Type_Exec(135, 135, -1); // execute comptime statement #135
+__Comptime_Register_Type_Exec(136, 136, -1); // execute comptime statement #136
+__Comptime_Register_Type_Exec(137, 137, -1); // execute comptime statement #137
+__Comptime_Register_Type_Exec(138, 138, -1); // execute comptime statement #138
+__Comptime_Register_Type_Exec(139, 139, -1); // execute comptime statement #139
+__Comptime_Register_Type_Exec(140, 140, -1); // execute comptime statement #140
+__Comptime_Register_Type_Exec(141, 141, -1); // execute comptime statement #141
+__Comptime_Register_Type_Exec(142, 142, -1); // execute comptime statement #142
+__Comptime_Register_Type_Exec(143, 143, -1); // execute comptime statement #143
+__Comptime_Register_Type_Exec(144, 144, -1); // execute comptime statement #144
+__Comptime_Register_Type_Exec(145, 145, -1); // execute comptime statement #145
+__Comptime_Register_Type_Exec(146, 146, -1); // execute comptime statement #146
+__Comptime_Register_Type_Exec(147, 147, -1); // execute comptime statement #147
+__Comptime_Register_Type_Exec(148, 148, -1); // execute comptime statement #148
+__Comptime_Register_Type_Exec(149, 149, -1); // execute comptime statement #149
+__Comptime_Register_Type_Exec(150, 150, -1); // execute comptime statement #150
+__Comptime_Register_Type_Exec(151, 151, -1); // execute comptime statement #151
+__Comptime_Register_Type_Exec(152, 152, -1); // execute comptime statement #152
+__Comptime_Register_Type_Exec(153, 153, -1); // execute comptime statement #153
+__Comptime_Register_Type_Exec(154, 154, -1); // execute comptime statement #154
+__Comptime_Register_Type_Exec(155, 155, -1); // execute comptime statement #155
+__Comptime_Register_Type_Exec(156, 156, -1); // execute comptime statement #156
+__Comptime_Register_Type_Exec(157, 157, -1); // execute comptime statement #157
+__Comptime_Register_Type_Exec(158, 158, -1); // execute comptime statement #158
+__Comptime_Register_Type_Exec(159, 159, -1); // execute comptime statement #159
+__Comptime_Register_Type_Exec(160, 160, -1); // execute comptime statement #160
+__Comptime_Register_Type_Exec(161, 161, -1); // execute comptime statement #161
+__Comptime_Register_Type_Exec(162, 162, -1); // execute comptime statement #162
+__Comptime_Register_Type_Exec(163, 163, -1); // execute comptime statement #163
+__Comptime_Register_Type_Exec(164, 164, -1); // execute comptime statement #164
+__Comptime_Register_Type_Exec(165, 165, -1); // execute comptime statement #165
+__Comptime_Register_Type_Exec(166, 166, -1); // execute comptime statement #166
+__Comptime_Register_Type_Exec(167, 167, -1); // execute comptime statement #167
+__Comptime_Register_Type_Exec(168, 168, -1); // execute comptime statement #168
+__Comptime_Register_Type_Exec(169, 169, -1); // execute comptime statement #169
+__Comptime_Register_Type_Exec(170, 170, -1); // execute comptime statement #170
+__Comptime_Register_Type_Exec(171, 171, -1); // execute comptime statement #171
+__Comptime_Register_Type_Exec(172, 172, -1); // execute comptime statement #172
+__Comptime_Register_Type_Exec(173, 173, -1); // execute comptime statement #173
+__Comptime_Register_Type_Exec(174, 174, -1); // execute comptime statement #174
+__Comptime_Register_Type_Exec(175, 175, -1); // execute comptime statement #175
+__Comptime_Register_Type_Exec(176, 176, -1); // execute comptime statement #176
+__Comptime_Register_Type_Exec(177, 177, -1); // execute comptime statement #177
+__Comptime_Register_Type_Exec(178, 178, -1); // execute comptime statement #178
+__Comptime_Register_Type_Exec(179, 179, -1); // execute comptime statement #179
+__Comptime_Register_Type_Exec(180, 180, -1); // execute comptime statement #180
+__Comptime_Register_Type_Exec(181, 181, -1); // execute comptime statement #181
+__Comptime_Register_Type_Exec(182, 182, -1); // execute comptime statement #182
+__Comptime_Register_Type_Exec(183, 183, -1); // execute comptime statement #183
+__Comptime_Register_Type_Exec(184, 184, -1); // execute comptime statement #184
+__Comptime_Register_Type_Exec(185, 185, -1); // execute comptime statement #185
+__Comptime_Register_Type_Exec(186, 186, -1); // execute comptime statement #186
+__Comptime_Register_Type_Exec(187, 187, -1); // execute comptime statement #187
+__Comptime_Register_Type_Exec(188, 188, -1); // execute comptime statement #188
+__Comptime_Register_Type_Exec(189, 189, -1); // execute comptime statement #189
+__Comptime_Register_Type_Exec(190, 190, -1); // execute comptime statement #190
+__Comptime_Register_Type_Exec(191, 191, -1); // execute comptime statement #191
+__Comptime_Register_Type_Exec(192, 192, -1); // execute comptime statement #192
+__Comptime_Register_Type_Exec(193, 193, -1); // execute comptime statement #193
+__Comptime_Register_Type_Exec(194, 194, -1); // execute comptime statement #194
+__Comptime_Register_Type_Exec(195, 195, -1); // execute comptime statement #195
+__Comptime_Register_Type_Exec(196, 196, -1); // execute comptime statement #196
+__Comptime_Register_Type_Exec(197, 197, -1); // execute comptime statement #197
+__Comptime_Register_Type_Exec(198, 198, -1); // execute comptime statement #198
+__Comptime_Register_Type_Exec(199, 199, -1); // execute comptime statement #199
@@ -0,0 +1,5061 @@
+#include <stdio.h>
+
+#include "../../../ccomptime.h"
+#include "main.c.h"
+
+#define DEF_0(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 0); })
+#define DEF_1 0x1u /* flag 1 */
+#define DEF_2(a, b) (((a) << 2) | ((b) & 0x2))
+#define DEF_3 0x3u /* flag 3 */
+#define DEF_4(a, b) (((a) << 4) | ((b) & 0x4))
+#define DEF_5 0x5u /* flag 5 */
+#define DEF_6(a, b) (((a) << 6) | ((b) & 0x6))
+#define DEF_7 0x7u /* flag 7 */
+#define DEF_8(a, b) (((a) << 8) | ((b) & 0x8))
+#define DEF_9 0x9u /* flag 9 */
+#define DEF_10(a, b) (((a) << 10) | ((b) & 0xa))
+#define DEF_11 0xbu /* flag 11 */
+#define DEF_12(a, b) (((a) << 12) | ((b) & 0xc))
+#define DEF_13 0xdu /* flag 13 */
+#define DEF_14(a, b) (((a) << 14) | ((b) & 0xe))
+#define DEF_15 0xfu /* flag 15 */
+#define DEF_16(a, b) (((a) << 16) | ((b) & 0x10))
+#define DEF_17 0x11u /* flag 17 */
+#define DEF_18(a, b) (((a) << 18) | ((b) & 0x12))
+#define DEF_19 0x13u /* flag 19 */
+#define DEF_20(a, b) (((a) << 20) | ((b) & 0x14))
+#define DEF_21 0x15u /* flag 21 */
+#define DEF_22(a, b) (((a) << 22) | ((b) & 0x16))
+#define DEF_23 0x17u /* flag 23 */
+#define DEF_24(a, b) (((a) << 24) | ((b) & 0x18))
+#define DEF_25 0x19u /* flag 25 */
+#define DEF_26(a, b) (((a) << 26) | ((b) & 0x1a))
+#define DEF_27 0x1bu /* flag 27 */
+#define DEF_28(a, b) (((a) << 28) | ((b) & 0x1c))
+#define DEF_29 0x1du /* flag 29 */
+#define DEF_30(a, b) (((a) << 30) | ((b) & 0x1e))
+#define DEF_31 0x1fu /* flag 31 */
+#define DEF_32(a, b) (((a) << 1) | ((b) & 0x20))
+#define DEF_33 0x21u /* flag 33 */
+#define DEF_34(a, b) (((a) << 3) | ((b) & 0x22))
+#define DEF_35 0x23u /* flag 35 */
+#define DEF_36(a, b) (((a) << 5) | ((b) & 0x24))
+#define DEF_37 0x25u /* flag 37 */
+#define DEF_38(a, b) (((a) << 7) | ((b) & 0x26))
+#define DEF_39 0x27u /* flag 39 */
+#define DEF_40(a, b) (((a) << 9) | ((b) & 0x28))
+#define DEF_41 0x29u /* flag 41 */
+#define DEF_42(a, b) (((a) << 11) | ((b) & 0x2a))
+#define DEF_43 0x2bu /* flag 43 */
+#define DEF_44(a, b) (((a) << 13) | ((b) & 0x2c))
+#define DEF_45 0x2du /* flag 45 */
+#define DEF_46(a, b) (((a) << 15) | ((b) & 0x2e))
+#define DEF_47 0x2fu /* flag 47 */
+#define DEF_48(a, b) (((a) << 17) | ((b) & 0x30))
+#define DEF_49 0x31u /* flag 49 */
+#define DEF_50(a, b) (((a) << 19) | ((b) & 0x32))
+#define DEF_51 0x33u /* flag 51 */
+#define DEF_52(a, b) (((a) << 21) | ((b) & 0x34))
+#define DEF_53 0x35u /* flag 53 */
+#define DEF_54(a, b) (((a) << 23) | ((b) & 0x36))
+#define DEF_55 0x37u /* flag 55 */
+#define DEF_56(a, b) (((a) << 25) | ((b) & 0x38))
+#define DEF_57 0x39u /* flag 57 */
+#define DEF_58(a, b) (((a) << 27) | ((b) & 0x3a))
+#define DEF_59 0x3bu /* flag 59 */
+#define DEF_60(a, b) (((a) << 29) | ((b) & 0x3c))
+#define DEF_61 0x3du /* flag 61 */
+#define DEF_62(a, b) (((a) << 0) | ((b) & 0x3e))
+#define DEF_63 0x3fu /* flag 63 */
+#define DEF_64(a, b) (((a) << 2) | ((b) & 0x40))
+#define DEF_65 0x41u /* flag 65 */
+#define DEF_66(a, b) (((a) << 4) | ((b) & 0x42))
+#define DEF_67 0x43u /* flag 67 */
+#define DEF_68(a, b) (((a) << 6) | ((b) & 0x44))
+#define DEF_69 0x45u /* flag 69 */
+#define DEF_70(a, b) (((a) << 8) | ((b) & 0x46))
+#define DEF_71 0x47u /* flag 71 */
+#define DEF_72(a, b) (((a) << 10) | ((b) & 0x48))
+#define DEF_73 0x49u /* flag 73 */
+#define DEF_74(a, b) (((a) << 12) | ((b) & 0x4a))
+#define DEF_75 0x4bu /* flag 75 */
+#define DEF_76(a, b) (((a) << 14) | ((b) & 0x4c))
+#define DEF_77 0x4du /* flag 77 */
+#define DEF_78(a, b) (((a) << 16) | ((b) & 0x4e))
+#define DEF_79 0x4fu /* flag 79 */
+#define DEF_80(a, b) (((a) << 18) | ((b) & 0x50))
+#define DEF_81 0x51u /* flag 81 */
+#define DEF_82(a, b) (((a) << 20) | ((b) & 0x52))
+#define DEF_83 0x53u /* flag 83 */
+#define DEF_84(a, b) (((a) << 22) | ((b) & 0x54))
+#define DEF_85 0x55u /* flag 85 */
+#define DEF_86(a, b) (((a) << 24) | ((b) & 0x56))
+#define DEF_87 0x57u /* flag 87 */
+#define DEF_88(a, b) (((a) << 26) | ((b) & 0x58))
+#define DEF_89 0x59u /* flag 89 */
+#define DEF_90(a, b) (((a) << 28) | ((b) & 0x5a))
+#define DEF_91 0x5bu /* flag 91 */
+#define DEF_92(a, b) (((a) << 30) | ((b) & 0x5c))
+#define DEF_93 0x5du /* flag 93 */
+#define DEF_94(a, b) (((a) << 1) | ((b) & 0x5e))
+#define DEF_95 0x5fu /* flag 95 */
+#define DEF_96(a, b) (((a) << 3) | ((b) & 0x60))
+#define DEF_97 0x61u /* flag 97 */
+#define DEF_98(a, b) (((a) << 5) | ((b) & 0x62))
+#define DEF_99 0x63u /* flag 99 */
+#define DEF_100(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 100); })
+#define DEF_101 0x65u /* flag 101 */
+#define DEF_102(a, b) (((a) << 9) | ((b) & 0x66))
+#define DEF_103 0x67u /* flag 103 */
+#define DEF_104(a, b) (((a) << 11) | ((b) & 0x68))
+#define DEF_105 0x69u /* flag 105 */
+#define DEF_106(a, b) (((a) << 13) | ((b) & 0x6a))
+#define DEF_107 0x6bu /* flag 107 */
+#define DEF_108(a, b) (((a) << 15) | ((b) & 0x6c))
+#define DEF_109 0x6du /* flag 109 */
+#define DEF_110(a, b) (((a) << 17) | ((b) & 0x6e))
+#define DEF_111 0x6fu /* flag 111 */
+#define DEF_112(a, b) (((a) << 19) | ((b) & 0x70))
+#define DEF_113 0x71u /* flag 113 */
+#define DEF_114(a, b) (((a) << 21) | ((b) & 0x72))
+#define DEF_115 0x73u /* flag 115 */
+#define DEF_116(a, b) (((a) << 23) | ((b) & 0x74))
+#define DEF_117 0x75u /* flag 117 */
+#define DEF_118(a, b) (((a) << 25) | ((b) & 0x76))
+#define DEF_119 0x77u /* flag 119 */
+#define DEF_120(a, b) (((a) << 27) | ((b) & 0x78))
+#define DEF_121 0x79u /* flag 121 */
+#define DEF_122(a, b) (((a) << 29) | ((b) & 0x7a))
+#define DEF_123 0x7bu /* flag 123 */
+#define DEF_124(a, b) (((a) << 0) | ((b) & 0x7c))
+#define DEF_125 0x7du /* flag 125 */
+#define DEF_126(a, b) (((a) << 2) | ((b) & 0x7e))
+#define DEF_127 0x7fu /* flag 127 */
+#define DEF_128(a, b) (((a) << 4) | ((b) & 0x80))
+#define DEF_129 0x81u /* flag 129 */
+#define DEF_130(a, b) (((a) << 6) | ((b) & 0x82))
+#define DEF_131 0x83u /* flag 131 */
+#define DEF_132(a, b) (((a) << 8) | ((b) & 0x84))
+#define DEF_133 0x85u /* flag 133 */
+#define DEF_134(a, b) (((a) << 10) | ((b) & 0x86))
+#define DEF_135 0x87u /* flag 135 */
+#define DEF_136(a, b) (((a) << 12) | ((b) & 0x88))
+#define DEF_137 0x89u /* flag 137 */
+#define DEF_138(a, b) (((a) << 14) | ((b) & 0x8a))
+#define DEF_139 0x8bu /* flag 139 */
+#define DEF_140(a, b) (((a) << 16) | ((b) & 0x8c))
+#define DEF_141 0x8du /* flag 141 */
+#define DEF_142(a, b) (((a) << 18) | ((b) & 0x8e))
+#define DEF_143 0x8fu /* flag 143 */
+#define DEF_144(a, b) (((a) << 20) | ((b) & 0x90))
+#define DEF_145 0x91u /* flag 145 */
+#define DEF_146(a, b) (((a) << 22) | ((b) & 0x92))
+#define DEF_147 0x93u /* flag 147 */
+#define DEF_148(a, b) (((a) << 24) | ((b) & 0x94))
+#define DEF_149 0x95u /* flag 149 */
+#define DEF_150(a, b) (((a) << 26) | ((b) & 0x96))
+#define DEF_151 0x97u /* flag 151 */
+#define DEF_152(a, b) (((a) << 28) | ((b) & 0x98))
+#define DEF_153 0x99u /* flag 153 */
+#define DEF_154(a, b) (((a) << 30) | ((b) & 0x9a))
+#define DEF_155 0x9bu /* flag 155 */
+#define DEF_156(a, b) (((a) << 1) | ((b) & 0x9c))
+#define DEF_157 0x9du /* flag 157 */
+#define DEF_158(a, b) (((a) << 3) | ((b) & 0x9e))
+#define DEF_159 0x9fu /* flag 159 */
+#define DEF_160(a, b) (((a) << 5) | ((b) & 0xa0))
+#define DEF_161 0xa1u /* flag 161 */
+#define DEF_162(a, b) (((a) << 7) | ((b) & 0xa2))
+#define DEF_163 0xa3u /* flag 163 */
+#define DEF_164(a, b) (((a) << 9) | ((b) & 0xa4))
+#define DEF_165 0xa5u /* flag 165 */
+#define DEF_166(a, b) (((a) << 11) | ((b) & 0xa6))
+#define DEF_167 0xa7u /* flag 167 */
+#define DEF_168(a, b) (((a) << 13) | ((b) & 0xa8))
+#define DEF_169 0xa9u /* flag 169 */
+#define DEF_170(a, b) (((a) << 15) | ((b) & 0xaa))
+#define DEF_171 0xabu /* flag 171 */
+#define DEF_172(a, b) (((a) << 17) | ((b) & 0xac))
+#define DEF_173 0xadu /* flag 173 */
+#define DEF_174(a, b) (((a) << 19) | ((b) & 0xae))
+#define DEF_175 0xafu /* flag 175 */
+#define DEF_176(a, b) (((a) << 21) | ((b) & 0xb0))
+#define DEF_177 0xb1u /* flag 177 */
+#define DEF_178(a, b) (((a) << 23) | ((b) & 0xb2))
+#define DEF_179 0xb3u /* flag 179 */
+#define DEF_180(a, b) (((a) << 25) | ((b) & 0xb4))
+#define DEF_181 0xb5u /* flag 181 */
+#define DEF_182(a, b) (((a) << 27) | ((b) & 0xb6))
+#define DEF_183 0xb7u /* flag 183 */
+#define DEF_184(a, b) (((a) << 29) | ((b) & 0xb8))
+#define DEF_185 0xb9u /* flag 185 */
+#define DEF_186(a, b) (((a) << 0) | ((b) & 0xba))
+#define DEF_187 0xbbu /* flag 187 */
+#define DEF_188(a, b) (((a) << 2) | ((b) & 0xbc))
+#define DEF_189 0xbdu /* flag 189 */
+#define DEF_190(a, b) (((a) << 4) | ((b) & 0xbe))
+#define DEF_191 0xbfu /* flag 191 */
+#define DEF_192(a, b) (((a) << 6) | ((b) & 0xc0))
+#define DEF_193 0xc1u /* flag 193 */
+#define DEF_194(a, b) (((a) << 8) | ((b) & 0xc2))
+#define DEF_195 0xc3u /* flag 195 */
+#define DEF_196(a, b) (((a) << 10) | ((b) & 0xc4))
+#define DEF_197 0xc5u /* flag 197 */
+#define DEF_198(a, b) (((a) << 12) | ((b) & 0xc6))
+#define DEF_199 0xc7u /* flag 199 */
+#define DEF_200(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 200); })
+#define DEF_201 0xc9u /* flag 201 */
+#define DEF_202(a, b) (((a) << 16) | ((b) & 0xca))
+#define DEF_203 0xcbu /* flag 203 */
+#define DEF_204(a, b) (((a) << 18) | ((b) & 0xcc))
+#define DEF_205 0xcdu /* flag 205 */
+#define DEF_206(a, b) (((a) << 20) | ((b) & 0xce))
+#define DEF_207 0xcfu /* flag 207 */
+#define DEF_208(a, b) (((a) << 22) | ((b) & 0xd0))
+#define DEF_209 0xd1u /* flag 209 */
+#define DEF_210(a, b) (((a) << 24) | ((b) & 0xd2))
+#define DEF_211 0xd3u /* flag 211 */
+#define DEF_212(a, b) (((a) << 26) | ((b) & 0xd4))
+#define DEF_213 0xd5u /* flag 213 */
+#define DEF_214(a, b) (((a) << 28) | ((b) & 0xd6))
+#define DEF_215 0xd7u /* flag 215 */
+#define DEF_216(a, b) (((a) << 30) | ((b) & 0xd8))
+#define DEF_217 0xd9u /* flag 217 */
+#define DEF_218(a, b) (((a) << 1) | ((b) & 0xda))
+#define DEF_219 0xdbu /* flag 219 */
+#define DEF_220(a, b) (((a) << 3) | ((b) & 0xdc))
+#define DEF_221 0xddu /* flag 221 */
+#define DEF_222(a, b) (((a) << 5) | ((b) & 0xde))
+#define DEF_223 0xdfu /* flag 223 */
+#define DEF_224(a, b) (((a) << 7) | ((b) & 0xe0))
+#define DEF_225 0xe1u /* flag 225 */
+#define DEF_226(a, b) (((a) << 9) | ((b) & 0xe2))
+#define DEF_227 0xe3u /* flag 227 */
+#define DEF_228(a, b) (((a) << 11) | ((b) & 0xe4))
+#define DEF_229 0xe5u /* flag 229 */
+#define DEF_230(a, b) (((a) << 13) | ((b) & 0xe6))
+#define DEF_231 0xe7u /* flag 231 */
+#define DEF_232(a, b) (((a) << 15) | ((b) & 0xe8))
+#define DEF_233 0xe9u /* flag 233 */
+#define DEF_234(a, b) (((a) << 17) | ((b) & 0xea))
+#define DEF_235 0xebu /* flag 235 */
+#define DEF_236(a, b) (((a) << 19) | ((b) & 0xec))
+#define DEF_237 0xedu /* flag 237 */
+#define DEF_238(a, b) (((a) << 21) | ((b) & 0xee))
+#define DEF_239 0xefu /* flag 239 */
+#define DEF_240(a, b) (((a) << 23) | ((b) & 0xf0))
+#define DEF_241 0xf1u /* flag 241 */
+#define DEF_242(a, b) (((a) << 25) | ((b) & 0xf2))
+#define DEF_243 0xf3u /* flag 243 */
+#define DEF_244(a, b) (((a) << 27) | ((b) & 0xf4))
+#define DEF_245 0xf5u /* flag 245 */
+#define DEF_246(a, b) (((a) << 29) | ((b) & 0xf6))
+#define DEF_247 0xf7u /* flag 247 */
+#define DEF_248(a, b) (((a) << 0) | ((b) & 0xf8))
+#define DEF_249 0xf9u /* flag 249 */
+#define DEF_250(a, b) (((a) << 2) | ((b) & 0xfa))
+#define DEF_251 0xfbu /* flag 251 */
+#define DEF_252(a, b) (((a) << 4) | ((b) & 0xfc))
+#define DEF_253 0xfdu /* flag 253 */
+#define DEF_254(a, b) (((a) << 6) | ((b) & 0xfe))
+#define DEF_255 0xffu /* flag 255 */
+#define DEF_256(a, b) (((a) << 8) | ((b) & 0x100))
+#define DEF_257 0x101u /* flag 257 */
+#define DEF_258(a, b) (((a) << 10) | ((b) & 0x102))
+#define DEF_259 0x103u /* flag 259 */
+#define DEF_260(a, b) (((a) << 12) | ((b) & 0x104))
+#define DEF_261 0x105u /* flag 261 */
+#define DEF_262(a, b) (((a) << 14) | ((b) & 0x106))
+#define DEF_263 0x107u /* flag 263 */
+#define DEF_264(a, b) (((a) << 16) | ((b) & 0x108))
+#define DEF_265 0x109u /* flag 265 */
+#define DEF_266(a, b) (((a) << 18) | ((b) & 0x10a))
+#define DEF_267 0x10bu /* flag 267 */
+#define DEF_268(a, b) (((a) << 20) | ((b) & 0x10c))
+#define DEF_269 0x10du /* flag 269 */
+#define DEF_270(a, b) (((a) << 22) | ((b) & 0x10e))
+#define DEF_271 0x10fu /* flag 271 */
+#define DEF_272(a, b) (((a) << 24) | ((b) & 0x110))
+#define DEF_273 0x111u /* flag 273 */
+#define DEF_274(a, b) (((a) << 26) | ((b) & 0x112))
+#define DEF_275 0x113u /* flag 275 */
+#define DEF_276(a, b) (((a) << 28) | ((b) & 0x114))
+#define DEF_277 0x115u /* flag 277 */
+#define DEF_278(a, b) (((a) << 30) | ((b) & 0x116))
+#define DEF_279 0x117u /* flag 279 */
+#define DEF_280(a, b) (((a) << 1) | ((b) & 0x118))
+#define DEF_281 0x119u /* flag 281 */
+#define DEF_282(a, b) (((a) << 3) | ((b) & 0x11a))
+#define DEF_283 0x11bu /* flag 283 */
+#define DEF_284(a, b) (((a) << 5) | ((b) & 0x11c))
+#define DEF_285 0x11du /* flag 285 */
+#define DEF_286(a, b) (((a) << 7) | ((b) & 0x11e))
+#define DEF_287 0x11fu /* flag 287 */
+#define DEF_288(a, b) (((a) << 9) | ((b) & 0x120))
+#define DEF_289 0x121u /* flag 289 */
+#define DEF_290(a, b) (((a) << 11) | ((b) & 0x122))
+#define DEF_291 0x123u /* flag 291 */
+#define DEF_292(a, b) (((a) << 13) | ((b) & 0x124))
+#define DEF_293 0x125u /* flag 293 */
+#define DEF_294(a, b) (((a) << 15) | ((b) & 0x126))
+#define DEF_295 0x127u /* flag 295 */
+#define DEF_296(a, b) (((a) << 17) | ((b) & 0x128))
+#define DEF_297 0x129u /* flag 297 */
+#define DEF_298(a, b) (((a) << 19) | ((b) & 0x12a))
+#define DEF_299 0x12bu /* flag 299 */
+#define DEF_300(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 300); })
+#define DEF_301 0x12du /* flag 301 */
+#define DEF_302(a, b) (((a) << 23) | ((b) & 0x12e))
+#define DEF_303 0x12fu /* flag 303 */
+#define DEF_304(a, b) (((a) << 25) | ((b) & 0x130))
+#define DEF_305 0x131u /* flag 305 */
+#define DEF_306(a, b) (((a) << 27) | ((b) & 0x132))
+#define DEF_307 0x133u /* flag 307 */
+#define DEF_308(a, b) (((a) << 29) | ((b) & 0x134))
+#define DEF_309 0x135u /* flag 309 */
+#define DEF_310(a, b) (((a) << 0) | ((b) & 0x136))
+#define DEF_311 0x137u /* flag 311 */
+#define DEF_312(a, b) (((a) << 2) | ((b) & 0x138))
+#define DEF_313 0x139u /* flag 313 */
+#define DEF_314(a, b) (((a) << 4) | ((b) & 0x13a))
+#define DEF_315 0x13bu /* flag 315 */
+#define DEF_316(a, b) (((a) << 6) | ((b) & 0x13c))
+#define DEF_317 0x13du /* flag 317 */
+#define DEF_318(a, b) (((a) << 8) | ((b) & 0x13e))
+#define DEF_319 0x13fu /* flag 319 */
+#define DEF_320(a, b) (((a) << 10) | ((b) & 0x140))
+#define DEF_321 0x141u /* flag 321 */
+#define DEF_322(a, b) (((a) << 12) | ((b) & 0x142))
+#define DEF_323 0x143u /* flag 323 */
+#define DEF_324(a, b) (((a) << 14) | ((b) & 0x144))
+#define DEF_325 0x145u /* flag 325 */
+#define DEF_326(a, b) (((a) << 16) | ((b) & 0x146))
+#define DEF_327 0x147u /* flag 327 */
+#define DEF_328(a, b) (((a) << 18) | ((b) & 0x148))
+#define DEF_329 0x149u /* flag 329 */
+#define DEF_330(a, b) (((a) << 20) | ((b) & 0x14a))
+#define DEF_331 0x14bu /* flag 331 */
+#define DEF_332(a, b) (((a) << 22) | ((b) & 0x14c))
+#define DEF_333 0x14du /* flag 333 */
+#define DEF_334(a, b) (((a) << 24) | ((b) & 0x14e))
+#define DEF_335 0x14fu /* flag 335 */
+#define DEF_336(a, b) (((a) << 26) | ((b) & 0x150))
+#define DEF_337 0x151u /* flag 337 */
+#define DEF_338(a, b) (((a) << 28) | ((b) & 0x152))
+#define DEF_339 0x153u /* flag 339 */
+#define DEF_340(a, b) (((a) << 30) | ((b) & 0x154))
+#define DEF_341 0x155u /* flag 341 */
+#define DEF_342(a, b) (((a) << 1) | ((b) & 0x156))
+#define DEF_343 0x157u /* flag 343 */
+#define DEF_344(a, b) (((a) << 3) | ((b) & 0x158))
+#define DEF_345 0x159u /* flag 345 */
+#define DEF_346(a, b) (((a) << 5) | ((b) & 0x15a))
+#define DEF_347 0x15bu /* flag 347 */
+#define DEF_348(a, b) (((a) << 7) | ((b) & 0x15c))
+#define DEF_349 0x15du /* flag 349 */
+#define DEF_350(a, b) (((a) << 9) | ((b) & 0x15e))
+#define DEF_351 0x15fu /* flag 351 */
+#define DEF_352(a, b) (((a) << 11) | ((b) & 0x160))
+#define DEF_353 0x161u /* flag 353 */
+#define DEF_354(a, b) (((a) << 13) | ((b) & 0x162))
+#define DEF_355 0x163u /* flag 355 */
+#define DEF_356(a, b) (((a) << 15) | ((b) & 0x164))
+#define DEF_357 0x165u /* flag 357 */
+#define DEF_358(a, b) (((a) << 17) | ((b) & 0x166))
+#define DEF_359 0x167u /* flag 359 */
+#define DEF_360(a, b) (((a) << 19) | ((b) & 0x168))
+#define DEF_361 0x169u /* flag 361 */
+#define DEF_362(a, b) (((a) << 21) | ((b) & 0x16a))
+#define DEF_363 0x16bu /* flag 363 */
+#define DEF_364(a, b) (((a) << 23) | ((b) & 0x16c))
+#define DEF_365 0x16du /* flag 365 */
+#define DEF_366(a, b) (((a) << 25) | ((b) & 0x16e))
+#define DEF_367 0x16fu /* flag 367 */
+#define DEF_368(a, b) (((a) << 27) | ((b) & 0x170))
+#define DEF_369 0x171u /* flag 369 */
+#define DEF_370(a, b) (((a) << 29) | ((b) & 0x172))
+#define DEF_371 0x173u /* flag 371 */
+#define DEF_372(a, b) (((a) << 0) | ((b) & 0x174))
+#define DEF_373 0x175u /* flag 373 */
+#define DEF_374(a, b) (((a) << 2) | ((b) & 0x176))
+#define DEF_375 0x177u /* flag 375 */
+#define DEF_376(a, b) (((a) << 4) | ((b) & 0x178))
+#define DEF_377 0x179u /* flag 377 */
+#define DEF_378(a, b) (((a) << 6) | ((b) & 0x17a))
+#define DEF_379 0x17bu /* flag 379 */
+#define DEF_380(a, b) (((a) << 8) | ((b) & 0x17c))
+#define DEF_381 0x17du /* flag 381 */
+#define DEF_382(a, b) (((a) << 10) | ((b) & 0x17e))
+#define DEF_383 0x17fu /* flag 383 */
+#define DEF_384(a, b) (((a) << 12) | ((b) & 0x180))
+#define DEF_385 0x181u /* flag 385 */
+#define DEF_386(a, b) (((a) << 14) | ((b) & 0x182))
+#define DEF_387 0x183u /* flag 387 */
+#define DEF_388(a, b) (((a) << 16) | ((b) & 0x184))
+#define DEF_389 0x185u /* flag 389 */
+#define DEF_390(a, b) (((a) << 18) | ((b) & 0x186))
+#define DEF_391 0x187u /* flag 391 */
+#define DEF_392(a, b) (((a) << 20) | ((b) & 0x188))
+#define DEF_393 0x189u /* flag 393 */
+#define DEF_394(a, b) (((a) << 22) | ((b) & 0x18a))
+#define DEF_395 0x18bu /* flag 395 */
+#define DEF_396(a, b) (((a) << 24) | ((b) & 0x18c))
+#define DEF_397 0x18du /* flag 397 */
+#define DEF_398(a, b) (((a) << 26) | ((b) & 0x18e))
+#define DEF_399 0x18fu /* flag 399 */
+#define DEF_400(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 400); })
+#define DEF_401 0x191u /* flag 401 */
+#define DEF_402(a, b) (((a) << 30) | ((b) & 0x192))
+#define DEF_403 0x193u /* flag 403 */
+#define DEF_404(a, b) (((a) << 1) | ((b) & 0x194))
+#define DEF_405 0x195u /* flag 405 */
+#define DEF_406(a, b) (((a) << 3) | ((b) & 0x196))
+#define DEF_407 0x197u /* flag 407 */
+#define DEF_408(a, b) (((a) << 5) | ((b) & 0x198))
+#define DEF_409 0x199u /* flag 409 */
+#define DEF_410(a, b) (((a) << 7) | ((b) & 0x19a))
+#define DEF_411 0x19bu /* flag 411 */
+#define DEF_412(a, b) (((a) << 9) | ((b) & 0x19c))
+#define DEF_413 0x19du /* flag 413 */
+#define DEF_414(a, b) (((a) << 11) | ((b) & 0x19e))
+#define DEF_415 0x19fu /* flag 415 */
+#define DEF_416(a, b) (((a) << 13) | ((b) & 0x1a0))
+#define DEF_417 0x1a1u /* flag 417 */
+#define DEF_418(a, b) (((a) << 15) | ((b) & 0x1a2))
+#define DEF_419 0x1a3u /* flag 419 */
+#define DEF_420(a, b) (((a) << 17) | ((b) & 0x1a4))
+#define DEF_421 0x1a5u /* flag 421 */
+#define DEF_422(a, b) (((a) << 19) | ((b) & 0x1a6))
+#define DEF_423 0x1a7u /* flag 423 */
+#define DEF_424(a, b) (((a) << 21) | ((b) & 0x1a8))
+#define DEF_425 0x1a9u /* flag 425 */
+#define DEF_426(a, b) (((a) << 23) | ((b) & 0x1aa))
+#define DEF_427 0x1abu /* flag 427 */
+#define DEF_428(a, b) (((a) << 25) | ((b) & 0x1ac))
+#define DEF_429 0x1adu /* flag 429 */
+#define DEF_430(a, b) (((a) << 27) | ((b) & 0x1ae))
+#define DEF_431 0x1afu /* flag 431 */
+#define DEF_432(a, b) (((a) << 29) | ((b) & 0x1b0))
+#define DEF_433 0x1b1u /* flag 433 */
+#define DEF_434(a, b) (((a) << 0) | ((b) & 0x1b2))
+#define DEF_435 0x1b3u /* flag 435 */
+#define DEF_436(a, b) (((a) << 2) | ((b) & 0x1b4))
+#define DEF_437 0x1b5u /* flag 437 */
+#define DEF_438(a, b) (((a) << 4) | ((b) & 0x1b6))
+#define DEF_439 0x1b7u /* flag 439 */
+#define DEF_440(a, b) (((a) << 6) | ((b) & 0x1b8))
+#define DEF_441 0x1b9u /* flag 441 */
+#define DEF_442(a, b) (((a) << 8) | ((b) & 0x1ba))
+#define DEF_443 0x1bbu /* flag 443 */
+#define DEF_444(a, b) (((a) << 10) | ((b) & 0x1bc))
+#define DEF_445 0x1bdu /* flag 445 */
+#define DEF_446(a, b) (((a) << 12) | ((b) & 0x1be))
+#define DEF_447 0x1bfu /* flag 447 */
+#define DEF_448(a, b) (((a) << 14) | ((b) & 0x1c0))
+#define DEF_449 0x1c1u /* flag 449 */
+#define DEF_450(a, b) (((a) << 16) | ((b) & 0x1c2))
+#define DEF_451 0x1c3u /* flag 451 */
+#define DEF_452(a, b) (((a) << 18) | ((b) & 0x1c4))
+#define DEF_453 0x1c5u /* flag 453 */
+#define DEF_454(a, b) (((a) << 20) | ((b) & 0x1c6))
+#define DEF_455 0x1c7u /* flag 455 */
+#define DEF_456(a, b) (((a) << 22) | ((b) & 0x1c8))
+#define DEF_457 0x1c9u /* flag 457 */
+#define DEF_458(a, b) (((a) << 24) | ((b) & 0x1ca))
+#define DEF_459 0x1cbu /* flag 459 */
+#define DEF_460(a, b) (((a) << 26) | ((b) & 0x1cc))
+#define DEF_461 0x1cdu /* flag 461 */
+#define DEF_462(a, b) (((a) << 28) | ((b) & 0x1ce))
+#define DEF_463 0x1cfu /* flag 463 */
+#define DEF_464(a, b) (((a) << 30) | ((b) & 0x1d0))
+#define DEF_465 0x1d1u /* flag 465 */
+#define DEF_466(a, b) (((a) << 1) | ((b) & 0x1d2))
+#define DEF_467 0x1d3u /* flag 467 */
+#define DEF_468(a, b) (((a) << 3) | ((b) & 0x1d4))
+#define DEF_469 0x1d5u /* flag 469 */
+#define DEF_470(a, b) (((a) << 5) | ((b) & 0x1d6))
+#define DEF_471 0x1d7u /* flag 471 */
+#define DEF_472(a, b) (((a) << 7) | ((b) & 0x1d8))
+#define DEF_473 0x1d9u /* flag 473 */
+#define DEF_474(a, b) (((a) << 9) | ((b) & 0x1da))
+#define DEF_475 0x1dbu /* flag 475 */
+#define DEF_476(a, b) (((a) << 11) | ((b) & 0x1dc))
+#define DEF_477 0x1ddu /* flag 477 */
+#define DEF_478(a, b) (((a) << 13) | ((b) & 0x1de))
+#define DEF_479 0x1dfu /* flag 479 */
+#define DEF_480(a, b) (((a) << 15) | ((b) & 0x1e0))
+#define DEF_481 0x1e1u /* flag 481 */
+#define DEF_482(a, b) (((a) << 17) | ((b) & 0x1e2))
+#define DEF_483 0x1e3u /* flag 483 */
+#define DEF_484(a, b) (((a) << 19) | ((b) & 0x1e4))
+#define DEF_485 0x1e5u /* flag 485 */
+#define DEF_486(a, b) (((a) << 21) | ((b) & 0x1e6))
+#define DEF_487 0x1e7u /* flag 487 */
+#define DEF_488(a, b) (((a) << 23) | ((b) & 0x1e8))
+#define DEF_489 0x1e9u /* flag 489 */
+#define DEF_490(a, b) (((a) << 25) | ((b) & 0x1ea))
+#define DEF_491 0x1ebu /* flag 491 */
+#define DEF_492(a, b) (((a) << 27) | ((b) & 0x1ec))
+#define DEF_493 0x1edu /* flag 493 */
+#define DEF_494(a, b) (((a) << 29) | ((b) & 0x1ee))
+#define DEF_495 0x1efu /* flag 495 */
+#define DEF_496(a, b) (((a) << 0) | ((b) & 0x1f0))
+#define DEF_497 0x1f1u /* flag 497 */
+#define DEF_498(a, b) (((a) << 2) | ((b) & 0x1f2))
+#define DEF_499 0x1f3u /* flag 499 */
+#define DEF_500(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 500); })
+#define DEF_501 0x1f5u /* flag 501 */
+#define DEF_502(a, b) (((a) << 6) | ((b) & 0x1f6))
+#define DEF_503 0x1f7u /* flag 503 */
+#define DEF_504(a, b) (((a) << 8) | ((b) & 0x1f8))
+#define DEF_505 0x1f9u /* flag 505 */
+#define DEF_506(a, b) (((a) << 10) | ((b) & 0x1fa))
+#define DEF_507 0x1fbu /* flag 507 */
+#define DEF_508(a, b) (((a) << 12) | ((b) & 0x1fc))
+#define DEF_509 0x1fdu /* flag 509 */
+#define DEF_510(a, b) (((a) << 14) | ((b) & 0x1fe))
+#define DEF_511 0x1ffu /* flag 511 */
+#define DEF_512(a, b) (((a) << 16) | ((b) & 0x200))
+#define DEF_513 0x201u /* flag 513 */
+#define DEF_514(a, b) (((a) << 18) | ((b) & 0x202))
+#define DEF_515 0x203u /* flag 515 */
+#define DEF_516(a, b) (((a) << 20) | ((b) & 0x204))
+#define DEF_517 0x205u /* flag 517 */
+#define DEF_518(a, b) (((a) << 22) | ((b) & 0x206))
+#define DEF_519 0x207u /* flag 519 */
+#define DEF_520(a, b) (((a) << 24) | ((b) & 0x208))
+#define DEF_521 0x209u /* flag 521 */
+#define DEF_522(a, b) (((a) << 26) | ((b) & 0x20a))
+#define DEF_523 0x20bu /* flag 523 */
+#define DEF_524(a, b) (((a) << 28) | ((b) & 0x20c))
+#define DEF_525 0x20du /* flag 525 */
+#define DEF_526(a, b) (((a) << 30) | ((b) & 0x20e))
+#define DEF_527 0x20fu /* flag 527 */
+#define DEF_528(a, b) (((a) << 1) | ((b) & 0x210))
+#define DEF_529 0x211u /* flag 529 */
+#define DEF_530(a, b) (((a) << 3) | ((b) & 0x212))
+#define DEF_531 0x213u /* flag 531 */
+#define DEF_532(a, b) (((a) << 5) | ((b) & 0x214))
+#define DEF_533 0x215u /* flag 533 */
+#define DEF_534(a, b) (((a) << 7) | ((b) & 0x216))
+#define DEF_535 0x217u /* flag 535 */
+#define DEF_536(a, b) (((a) << 9) | ((b) & 0x218))
+#define DEF_537 0x219u /* flag 537 */
+#define DEF_538(a, b) (((a) << 11) | ((b) & 0x21a))
+#define DEF_539 0x21bu /* flag 539 */
+#define DEF_540(a, b) (((a) << 13) | ((b) & 0x21c))
+#define DEF_541 0x21du /* flag 541 */
+#define DEF_542(a, b) (((a) << 15) | ((b) & 0x21e))
+#define DEF_543 0x21fu /* flag 543 */
+#define DEF_544(a, b) (((a) << 17) | ((b) & 0x220))
+#define DEF_545 0x221u /* flag 545 */
+#define DEF_546(a, b) (((a) << 19) | ((b) & 0x222))
+#define DEF_547 0x223u /* flag 547 */
+#define DEF_548(a, b) (((a) << 21) | ((b) & 0x224))
+#define DEF_549 0x225u /* flag 549 */
+#define DEF_550(a, b) (((a) << 23) | ((b) & 0x226))
+#define DEF_551 0x227u /* flag 551 */
+#define DEF_552(a, b) (((a) << 25) | ((b) & 0x228))
+#define DEF_553 0x229u /* flag 553 */
+#define DEF_554(a, b) (((a) << 27) | ((b) & 0x22a))
+#define DEF_555 0x22bu /* flag 555 */
+#define DEF_556(a, b) (((a) << 29) | ((b) & 0x22c))
+#define DEF_557 0x22du /* flag 557 */
+#define DEF_558(a, b) (((a) << 0) | ((b) & 0x22e))
+#define DEF_559 0x22fu /* flag 559 */
+#define DEF_560(a, b) (((a) << 2) | ((b) & 0x230))
+#define DEF_561 0x231u /* flag 561 */
+#define DEF_562(a, b) (((a) << 4) | ((b) & 0x232))
+#define DEF_563 0x233u /* flag 563 */
+#define DEF_564(a, b) (((a) << 6) | ((b) & 0x234))
+#define DEF_565 0x235u /* flag 565 */
+#define DEF_566(a, b) (((a) << 8) | ((b) & 0x236))
+#define DEF_567 0x237u /* flag 567 */
+#define DEF_568(a, b) (((a) << 10) | ((b) & 0x238))
+#define DEF_569 0x239u /* flag 569 */
+#define DEF_570(a, b) (((a) << 12) | ((b) & 0x23a))
+#define DEF_571 0x23bu /* flag 571 */
+#define DEF_572(a, b) (((a) << 14) | ((b) & 0x23c))
+#define DEF_573 0x23du /* flag 573 */
+#define DEF_574(a, b) (((a) << 16) | ((b) & 0x23e))
+#define DEF_575 0x23fu /* flag 575 */
+#define DEF_576(a, b) (((a) << 18) | ((b) & 0x240))
+#define DEF_577 0x241u /* flag 577 */
+#define DEF_578(a, b) (((a) << 20) | ((b) & 0x242))
+#define DEF_579 0x243u /* flag 579 */
+#define DEF_580(a, b) (((a) << 22) | ((b) & 0x244))
+#define DEF_581 0x245u /* flag 581 */
+#define DEF_582(a, b) (((a) << 24) | ((b) & 0x246))
+#define DEF_583 0x247u /* flag 583 */
+#define DEF_584(a, b) (((a) << 26) | ((b) & 0x248))
+#define DEF_585 0x249u /* flag 585 */
+#define DEF_586(a, b) (((a) << 28) | ((b) & 0x24a))
+#define DEF_587 0x24bu /* flag 587 */
+#define DEF_588(a, b) (((a) << 30) | ((b) & 0x24c))
+#define DEF_589 0x24du /* flag 589 */
+#define DEF_590(a, b) (((a) << 1) | ((b) & 0x24e))
+#define DEF_591 0x24fu /* flag 591 */
+#define DEF_592(a, b) (((a) << 3) | ((b) & 0x250))
+#define DEF_593 0x251u /* flag 593 */
+#define DEF_594(a, b) (((a) << 5) | ((b) & 0x252))
+#define DEF_595 0x253u /* flag 595 */
+#define DEF_596(a, b) (((a) << 7) | ((b) & 0x254))
+#define DEF_597 0x255u /* flag 597 */
+#define DEF_598(a, b) (((a) << 9) | ((b) & 0x256))
+#define DEF_599 0x257u /* flag 599 */
+#define DEF_600(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 600); })
+#define DEF_601 0x259u /* flag 601 */
+#define DEF_602(a, b) (((a) << 13) | ((b) & 0x25a))
+#define DEF_603 0x25bu /* flag 603 */
+#define DEF_604(a, b) (((a) << 15) | ((b) & 0x25c))
+#define DEF_605 0x25du /* flag 605 */
+#define DEF_606(a, b) (((a) << 17) | ((b) & 0x25e))
+#define DEF_607 0x25fu /* flag 607 */
+#define DEF_608(a, b) (((a) << 19) | ((b) & 0x260))
+#define DEF_609 0x261u /* flag 609 */
+#define DEF_610(a, b) (((a) << 21) | ((b) & 0x262))
+#define DEF_611 0x263u /* flag 611 */
+#define DEF_612(a, b) (((a) << 23) | ((b) & 0x264))
+#define DEF_613 0x265u /* flag 613 */
+#define DEF_614(a, b) (((a) << 25) | ((b) & 0x266))
+#define DEF_615 0x267u /* flag 615 */
+#define DEF_616(a, b) (((a) << 27) | ((b) & 0x268))
+#define DEF_617 0x269u /* flag 617 */
+#define DEF_618(a, b) (((a) << 29) | ((b) & 0x26a))
+#define DEF_619 0x26bu /* flag 619 */
+#define DEF_620(a, b) (((a) << 0) | ((b) & 0x26c))
+#define DEF_621 0x26du /* flag 621 */
+#define DEF_622(a, b) (((a) << 2) | ((b) & 0x26e))
+#define DEF_623 0x26fu /* flag 623 */
+#define DEF_624(a, b) (((a) << 4) | ((b) & 0x270))
+#define DEF_625 0x271u /* flag 625 */
+#define DEF_626(a, b) (((a) << 6) | ((b) & 0x272))
+#define DEF_627 0x273u /* flag 627 */
+#define DEF_628(a, b) (((a) << 8) | ((b) & 0x274))
+#define DEF_629 0x275u /* flag 629 */
+#define DEF_630(a, b) (((a) << 10) | ((b) & 0x276))
+#define DEF_631 0x277u /* flag 631 */
+#define DEF_632(a, b) (((a) << 12) | ((b) & 0x278))
+#define DEF_633 0x279u /* flag 633 */
+#define DEF_634(a, b) (((a) << 14) | ((b) & 0x27a))
+#define DEF_635 0x27bu /* flag 635 */
+#define DEF_636(a, b) (((a) << 16) | ((b) & 0x27c))
+#define DEF_637 0x27du /* flag 637 */
+#define DEF_638(a, b) (((a) << 18) | ((b) & 0x27e))
+#define DEF_639 0x27fu /* flag 639 */
+#define DEF_640(a, b) (((a) << 20) | ((b) & 0x280))
+#define DEF_641 0x281u /* flag 641 */
+#define DEF_642(a, b) (((a) << 22) | ((b) & 0x282))
+#define DEF_643 0x283u /* flag 643 */
+#define DEF_644(a, b) (((a) << 24) | ((b) & 0x284))
+#define DEF_645 0x285u /* flag 645 */
+#define DEF_646(a, b) (((a) << 26) | ((b) & 0x286))
+#define DEF_647 0x287u /* flag 647 */
+#define DEF_648(a, b) (((a) << 28) | ((b) & 0x288))
+#define DEF_649 0x289u /* flag 649 */
+#define DEF_650(a, b) (((a) << 30) | ((b) & 0x28a))
+#define DEF_651 0x28bu /* flag 651 */
+#define DEF_652(a, b) (((a) << 1) | ((b) & 0x28c))
+#define DEF_653 0x28du /* flag 653 */
+#define DEF_654(a, b) (((a) << 3) | ((b) & 0x28e))
+#define DEF_655 0x28fu /* flag 655 */
+#define DEF_656(a, b) (((a) << 5) | ((b) & 0x290))
+#define DEF_657 0x291u /* flag 657 */
+#define DEF_658(a, b) (((a) << 7) | ((b) & 0x292))
+#define DEF_659 0x293u /* flag 659 */
+#define DEF_660(a, b) (((a) << 9) | ((b) & 0x294))
+#define DEF_661 0x295u /* flag 661 */
+#define DEF_662(a, b) (((a) << 11) | ((b) & 0x296))
+#define DEF_663 0x297u /* flag 663 */
+#define DEF_664(a, b) (((a) << 13) | ((b) & 0x298))
+#define DEF_665 0x299u /* flag 665 */
+#define DEF_666(a, b) (((a) << 15) | ((b) & 0x29a))
+#define DEF_667 0x29bu /* flag 667 */
+#define DEF_668(a, b) (((a) << 17) | ((b) & 0x29c))
+#define DEF_669 0x29du /* flag 669 */
+#define DEF_670(a, b) (((a) << 19) | ((b) & 0x29e))
+#define DEF_671 0x29fu /* flag 671 */
+#define DEF_672(a, b) (((a) << 21) | ((b) & 0x2a0))
+#define DEF_673 0x2a1u /* flag 673 */
+#define DEF_674(a, b) (((a) << 23) | ((b) & 0x2a2))
+#define DEF_675 0x2a3u /* flag 675 */
+#define DEF_676(a, b) (((a) << 25) | ((b) & 0x2a4))
+#define DEF_677 0x2a5u /* flag 677 */
+#define DEF_678(a, b) (((a) << 27) | ((b) & 0x2a6))
+#define DEF_679 0x2a7u /* flag 679 */
+#define DEF_680(a, b) (((a) << 29) | ((b) & 0x2a8))
+#define DEF_681 0x2a9u /* flag 681 */
+#define DEF_682(a, b) (((a) << 0) | ((b) & 0x2aa))
+#define DEF_683 0x2abu /* flag 683 */
+#define DEF_684(a, b) (((a) << 2) | ((b) & 0x2ac))
+#define DEF_685 0x2adu /* flag 685 */
+#define DEF_686(a, b) (((a) << 4) | ((b) & 0x2ae))
+#define DEF_687 0x2afu /* flag 687 */
+#define DEF_688(a, b) (((a) << 6) | ((b) & 0x2b0))
+#define DEF_689 0x2b1u /* flag 689 */
+#define DEF_690(a, b) (((a) << 8) | ((b) & 0x2b2))
+#define DEF_691 0x2b3u /* flag 691 */
+#define DEF_692(a, b) (((a) << 10) | ((b) & 0x2b4))
+#define DEF_693 0x2b5u /* flag 693 */
+#define DEF_694(a, b) (((a) << 12) | ((b) & 0x2b6))
+#define DEF_695 0x2b7u /* flag 695 */
+#define DEF_696(a, b) (((a) << 14) | ((b) & 0x2b8))
+#define DEF_697 0x2b9u /* flag 697 */
+#define DEF_698(a, b) (((a) << 16) | ((b) & 0x2ba))
+#define DEF_699 0x2bbu /* flag 699 */
+#define DEF_700(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 700); })
+#define DEF_701 0x2bdu /* flag 701 */
+#define DEF_702(a, b) (((a) << 20) | ((b) & 0x2be))
+#define DEF_703 0x2bfu /* flag 703 */
+#define DEF_704(a, b) (((a) << 22) | ((b) & 0x2c0))
+#define DEF_705 0x2c1u /* flag 705 */
+#define DEF_706(a, b) (((a) << 24) | ((b) & 0x2c2))
+#define DEF_707 0x2c3u /* flag 707 */
+#define DEF_708(a, b) (((a) << 26) | ((b) & 0x2c4))
+#define DEF_709 0x2c5u /* flag 709 */
+#define DEF_710(a, b) (((a) << 28) | ((b) & 0x2c6))
+#define DEF_711 0x2c7u /* flag 711 */
+#define DEF_712(a, b) (((a) << 30) | ((b) & 0x2c8))
+#define DEF_713 0x2c9u /* flag 713 */
+#define DEF_714(a, b) (((a) << 1) | ((b) & 0x2ca))
+#define DEF_715 0x2cbu /* flag 715 */
+#define DEF_716(a, b) (((a) << 3) | ((b) & 0x2cc))
+#define DEF_717 0x2cdu /* flag 717 */
+#define DEF_718(a, b) (((a) << 5) | ((b) & 0x2ce))
+#define DEF_719 0x2cfu /* flag 719 */
+#define DEF_720(a, b) (((a) << 7) | ((b) & 0x2d0))
+#define DEF_721 0x2d1u /* flag 721 */
+#define DEF_722(a, b) (((a) << 9) | ((b) & 0x2d2))
+#define DEF_723 0x2d3u /* flag 723 */
+#define DEF_724(a, b) (((a) << 11) | ((b) & 0x2d4))
+#define DEF_725 0x2d5u /* flag 725 */
+#define DEF_726(a, b) (((a) << 13) | ((b) & 0x2d6))
+#define DEF_727 0x2d7u /* flag 727 */
+#define DEF_728(a, b) (((a) << 15) | ((b) & 0x2d8))
+#define DEF_729 0x2d9u /* flag 729 */
+#define DEF_730(a, b) (((a) << 17) | ((b) & 0x2da))
+#define DEF_731 0x2dbu /* flag 731 */
+#define DEF_732(a, b) (((a) << 19) | ((b) & 0x2dc))
+#define DEF_733 0x2ddu /* flag 733 */
+#define DEF_734(a, b) (((a) << 21) | ((b) & 0x2de))
+#define DEF_735 0x2dfu /* flag 735 */
+#define DEF_736(a, b) (((a) << 23) | ((b) & 0x2e0))
+#define DEF_737 0x2e1u /* flag 737 */
+#define DEF_738(a, b) (((a) << 25) | ((b) & 0x2e2))
+#define DEF_739 0x2e3u /* flag 739 */
+#define DEF_740(a, b) (((a) << 27) | ((b) & 0x2e4))
+#define DEF_741 0x2e5u /* flag 741 */
+#define DEF_742(a, b) (((a) << 29) | ((b) & 0x2e6))
+#define DEF_743 0x2e7u /* flag 743 */
+#define DEF_744(a, b) (((a) << 0) | ((b) & 0x2e8))
+#define DEF_745 0x2e9u /* flag 745 */
+#define DEF_746(a, b) (((a) << 2) | ((b) & 0x2ea))
+#define DEF_747 0x2ebu /* flag 747 */
+#define DEF_748(a, b) (((a) << 4) | ((b) & 0x2ec))
+#define DEF_749 0x2edu /* flag 749 */
+#define DEF_750(a, b) (((a) << 6) | ((b) & 0x2ee))
+#define DEF_751 0x2efu /* flag 751 */
+#define DEF_752(a, b) (((a) << 8) | ((b) & 0x2f0))
+#define DEF_753 0x2f1u /* flag 753 */
+#define DEF_754(a, b) (((a) << 10) | ((b) & 0x2f2))
+#define DEF_755 0x2f3u /* flag 755 */
+#define DEF_756(a, b) (((a) << 12) | ((b) & 0x2f4))
+#define DEF_757 0x2f5u /* flag 757 */
+#define DEF_758(a, b) (((a) << 14) | ((b) & 0x2f6))
+#define DEF_759 0x2f7u /* flag 759 */
+#define DEF_760(a, b) (((a) << 16) | ((b) & 0x2f8))
+#define DEF_761 0x2f9u /* flag 761 */
+#define DEF_762(a, b) (((a) << 18) | ((b) & 0x2fa))
+#define DEF_763 0x2fbu /* flag 763 */
+#define DEF_764(a, b) (((a) << 20) | ((b) & 0x2fc))
+#define DEF_765 0x2fdu /* flag 765 */
+#define DEF_766(a, b) (((a) << 22) | ((b) & 0x2fe))
+#define DEF_767 0x2ffu /* flag 767 */
+#define DEF_768(a, b) (((a) << 24) | ((b) & 0x300))
+#define DEF_769 0x301u /* flag 769 */
+#define DEF_770(a, b) (((a) << 26) | ((b) & 0x302))
+#define DEF_771 0x303u /* flag 771 */
+#define DEF_772(a, b) (((a) << 28) | ((b) & 0x304))
+#define DEF_773 0x305u /* flag 773 */
+#define DEF_774(a, b) (((a) << 30) | ((b) & 0x306))
+#define DEF_775 0x307u /* flag 775 */
+#define DEF_776(a, b) (((a) << 1) | ((b) & 0x308))
+#define DEF_777 0x309u /* flag 777 */
+#define DEF_778(a, b) (((a) << 3) | ((b) & 0x30a))
+#define DEF_779 0x30bu /* flag 779 */
+#define DEF_780(a, b) (((a) << 5) | ((b) & 0x30c))
+#define DEF_781 0x30du /* flag 781 */
+#define DEF_782(a, b) (((a) << 7) | ((b) & 0x30e))
+#define DEF_783 0x30fu /* flag 783 */
+#define DEF_784(a, b) (((a) << 9) | ((b) & 0x310))
+#define DEF_785 0x311u /* flag 785 */
+#define DEF_786(a, b) (((a) << 11) | ((b) & 0x312))
+#define DEF_787 0x313u /* flag 787 */
+#define DEF_788(a, b) (((a) << 13) | ((b) & 0x314))
+#define DEF_789 0x315u /* flag 789 */
+#define DEF_790(a, b) (((a) << 15) | ((b) & 0x316))
+#define DEF_791 0x317u /* flag 791 */
+#define DEF_792(a, b) (((a) << 17) | ((b) & 0x318))
+#define DEF_793 0x319u /* flag 793 */
+#define DEF_794(a, b) (((a) << 19) | ((b) & 0x31a))
+#define DEF_795 0x31bu /* flag 795 */
+#define DEF_796(a, b) (((a) << 21) | ((b) & 0x31c))
+#define DEF_797 0x31du /* flag 797 */
+#define DEF_798(a, b) (((a) << 23) | ((b) & 0x31e))
+#define DEF_799 0x31fu /* flag 799 */
+#define DEF_800(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 800); })
+#define DEF_801 0x321u /* flag 801 */
+#define DEF_802(a, b) (((a) << 27) | ((b) & 0x322))
+#define DEF_803 0x323u /* flag 803 */
+#define DEF_804(a, b) (((a) << 29) | ((b) & 0x324))
+#define DEF_805 0x325u /* flag 805 */
+#define DEF_806(a, b) (((a) << 0) | ((b) & 0x326))
+#define DEF_807 0x327u /* flag 807 */
+#define DEF_808(a, b) (((a) << 2) | ((b) & 0x328))
+#define DEF_809 0x329u /* flag 809 */
+#define DEF_810(a, b) (((a) << 4) | ((b) & 0x32a))
+#define DEF_811 0x32bu /* flag 811 */
+#define DEF_812(a, b) (((a) << 6) | ((b) & 0x32c))
+#define DEF_813 0x32du /* flag 813 */
+#define DEF_814(a, b) (((a) << 8) | ((b) & 0x32e))
+#define DEF_815 0x32fu /* flag 815 */
+#define DEF_816(a, b) (((a) << 10) | ((b) & 0x330))
+#define DEF_817 0x331u /* flag 817 */
+#define DEF_818(a, b) (((a) << 12) | ((b) & 0x332))
+#define DEF_819 0x333u /* flag 819 */
+#define DEF_820(a, b) (((a) << 14) | ((b) & 0x334))
+#define DEF_821 0x335u /* flag 821 */
+#define DEF_822(a, b) (((a) << 16) | ((b) & 0x336))
+#define DEF_823 0x337u /* flag 823 */
+#define DEF_824(a, b) (((a) << 18) | ((b) & 0x338))
+#define DEF_825 0x339u /* flag 825 */
+#define DEF_826(a, b) (((a) << 20) | ((b) & 0x33a))
+#define DEF_827 0x33bu /* flag 827 */
+#define DEF_828(a, b) (((a) << 22) | ((b) & 0x33c))
+#define DEF_829 0x33du /* flag 829 */
+#define DEF_830(a, b) (((a) << 24) | ((b) & 0x33e))
+#define DEF_831 0x33fu /* flag 831 */
+#define DEF_832(a, b) (((a) << 26) | ((b) & 0x340))
+#define DEF_833 0x341u /* flag 833 */
+#define DEF_834(a, b) (((a) << 28) | ((b) & 0x342))
+#define DEF_835 0x343u /* flag 835 */
+#define DEF_836(a, b) (((a) << 30) | ((b) & 0x344))
+#define DEF_837 0x345u /* flag 837 */
+#define DEF_838(a, b) (((a) << 1) | ((b) & 0x346))
+#define DEF_839 0x347u /* flag 839 */
+#define DEF_840(a, b) (((a) << 3) | ((b) & 0x348))
+#define DEF_841 0x349u /* flag 841 */
+#define DEF_842(a, b) (((a) << 5) | ((b) & 0x34a))
+#define DEF_843 0x34bu /* flag 843 */
+#define DEF_844(a, b) (((a) << 7) | ((b) & 0x34c))
+#define DEF_845 0x34du /* flag 845 */
+#define DEF_846(a, b) (((a) << 9) | ((b) & 0x34e))
+#define DEF_847 0x34fu /* flag 847 */
+#define DEF_848(a, b) (((a) << 11) | ((b) & 0x350))
+#define DEF_849 0x351u /* flag 849 */
+#define DEF_850(a, b) (((a) << 13) | ((b) & 0x352))
+#define DEF_851 0x353u /* flag 851 */
+#define DEF_852(a, b) (((a) << 15) | ((b) & 0x354))
+#define DEF_853 0x355u /* flag 853 */
+#define DEF_854(a, b) (((a) << 17) | ((b) & 0x356))
+#define DEF_855 0x357u /* flag 855 */
+#define DEF_856(a, b) (((a) << 19) | ((b) & 0x358))
+#define DEF_857 0x359u /* flag 857 */
+#define DEF_858(a, b) (((a) << 21) | ((b) & 0x35a))
+#define DEF_859 0x35bu /* flag 859 */
+#define DEF_860(a, b) (((a) << 23) | ((b) & 0x35c))
+#define DEF_861 0x35du /* flag 861 */
+#define DEF_862(a, b) (((a) << 25) | ((b) & 0x35e))
+#define DEF_863 0x35fu /* flag 863 */
+#define DEF_864(a, b) (((a) << 27) | ((b) & 0x360))
+#define DEF_865 0x361u /* flag 865 */
+#define DEF_866(a, b) (((a) << 29) | ((b) & 0x362))
+#define DEF_867 0x363u /* flag 867 */
+#define DEF_868(a, b) (((a) << 0) | ((b) & 0x364))
+#define DEF_869 0x365u /* flag 869 */
+#define DEF_870(a, b) (((a) << 2) | ((b) & 0x366))
+#define DEF_871 0x367u /* flag 871 */
+#define DEF_872(a, b) (((a) << 4) | ((b) & 0x368))
+#define DEF_873 0x369u /* flag 873 */
+#define DEF_874(a, b) (((a) << 6) | ((b) & 0x36a))
+#define DEF_875 0x36bu /* flag 875 */
+#define DEF_876(a, b) (((a) << 8) | ((b) & 0x36c))
+#define DEF_877 0x36du /* flag 877 */
+#define DEF_878(a, b) (((a) << 10) | ((b) & 0x36e))
+#define DEF_879 0x36fu /* flag 879 */
+#define DEF_880(a, b) (((a) << 12) | ((b) & 0x370))
+#define DEF_881 0x371u /* flag 881 */
+#define DEF_882(a, b) (((a) << 14) | ((b) & 0x372))
+#define DEF_883 0x373u /* flag 883 */
+#define DEF_884(a, b) (((a) << 16) | ((b) & 0x374))
+#define DEF_885 0x375u /* flag 885 */
+#define DEF_886(a, b) (((a) << 18) | ((b) & 0x376))
+#define DEF_887 0x377u /* flag 887 */
+#define DEF_888(a, b) (((a) << 20) | ((b) & 0x378))
+#define DEF_889 0x379u /* flag 889 */
+#define DEF_890(a, b) (((a) << 22) | ((b) & 0x37a))
+#define DEF_891 0x37bu /* flag 891 */
+#define DEF_892(a, b) (((a) << 24) | ((b) & 0x37c))
+#define DEF_893 0x37du /* flag 893 */
+#define DEF_894(a, b) (((a) << 26) | ((b) & 0x37e))
+#define DEF_895 0x37fu /* flag 895 */
+#define DEF_896(a, b) (((a) << 28) | ((b) & 0x380))
+#define DEF_897 0x381u /* flag 897 */
+#define DEF_898(a, b) (((a) << 30) | ((b) & 0x382))
+#define DEF_899 0x383u /* flag 899 */
+#define DEF_900(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 900); })
+#define DEF_901 0x385u /* flag 901 */
+#define DEF_902(a, b) (((a) << 3) | ((b) & 0x386))
+#define DEF_903 0x387u /* flag 903 */
+#define DEF_904(a, b) (((a) << 5) | ((b) & 0x388))
+#define DEF_905 0x389u /* flag 905 */
+#define DEF_906(a, b) (((a) << 7) | ((b) & 0x38a))
+#define DEF_907 0x38bu /* flag 907 */
+#define DEF_908(a, b) (((a) << 9) | ((b) & 0x38c))
+#define DEF_909 0x38du /* flag 909 */
+#define DEF_910(a, b) (((a) << 11) | ((b) & 0x38e))
+#define DEF_911 0x38fu /* flag 911 */
+#define DEF_912(a, b) (((a) << 13) | ((b) & 0x390))
+#define DEF_913 0x391u /* flag 913 */
+#define DEF_914(a, b) (((a) << 15) | ((b) & 0x392))
+#define DEF_915 0x393u /* flag 915 */
+#define DEF_916(a, b) (((a) << 17) | ((b) & 0x394))
+#define DEF_917 0x395u /* flag 917 */
+#define DEF_918(a, b) (((a) << 19) | ((b) & 0x396))
+#define DEF_919 0x397u /* flag 919 */
+#define DEF_920(a, b) (((a) << 21) | ((b) & 0x398))
+#define DEF_921 0x399u /* flag 921 */
+#define DEF_922(a, b) (((a) << 23) | ((b) & 0x39a))
+#define DEF_923 0x39bu /* flag 923 */
+#define DEF_924(a, b) (((a) << 25) | ((b) & 0x39c))
+#define DEF_925 0x39du /* flag 925 */
+#define DEF_926(a, b) (((a) << 27) | ((b) & 0x39e))
+#define DEF_927 0x39fu /* flag 927 */
+#define DEF_928(a, b) (((a) << 29) | ((b) & 0x3a0))
+#define DEF_929 0x3a1u /* flag 929 */
+#define DEF_930(a, b) (((a) << 0) | ((b) & 0x3a2))
+#define DEF_931 0x3a3u /* flag 931 */
+#define DEF_932(a, b) (((a) << 2) | ((b) & 0x3a4))
+#define DEF_933 0x3a5u /* flag 933 */
+#define DEF_934(a, b) (((a) << 4) | ((b) & 0x3a6))
+#define DEF_935 0x3a7u /* flag 935 */
+#define DEF_936(a, b) (((a) << 6) | ((b) & 0x3a8))
+#define DEF_937 0x3a9u /* flag 937 */
+#define DEF_938(a, b) (((a) << 8) | ((b) & 0x3aa))
+#define DEF_939 0x3abu /* flag 939 */
+#define DEF_940(a, b) (((a) << 10) | ((b) & 0x3ac))
+#define DEF_941 0x3adu /* flag 941 */
+#define DEF_942(a, b) (((a) << 12) | ((b) & 0x3ae))
+#define DEF_943 0x3afu /* flag 943 */
+#define DEF_944(a, b) (((a) << 14) | ((b) & 0x3b0))
+#define DEF_945 0x3b1u /* flag 945 */
+#define DEF_946(a, b) (((a) << 16) | ((b) & 0x3b2))
+#define DEF_947 0x3b3u /* flag 947 */
+#define DEF_948(a, b) (((a) << 18) | ((b) & 0x3b4))
+#define DEF_949 0x3b5u /* flag 949 */
+#define DEF_950(a, b) (((a) << 20) | ((b) & 0x3b6))
+#define DEF_951 0x3b7u /* flag 951 */
+#define DEF_952(a, b) (((a) << 22) | ((b) & 0x3b8))
+#define DEF_953 0x3b9u /* flag 953 */
+#define DEF_954(a, b) (((a) << 24) | ((b) & 0x3ba))
+#define DEF_955 0x3bbu /* flag 955 */
+#define DEF_956(a, b) (((a) << 26) | ((b) & 0x3bc))
+#define DEF_957 0x3bdu /* flag 957 */
+#define DEF_958(a, b) (((a) << 28) | ((b) & 0x3be))
+#define DEF_959 0x3bfu /* flag 959 */
+#define DEF_960(a, b) (((a) << 30) | ((b) & 0x3c0))
+#define DEF_961 0x3c1u /* flag 961 */
+#define DEF_962(a, b) (((a) << 1) | ((b) & 0x3c2))
+#define DEF_963 0x3c3u /* flag 963 */
+#define DEF_964(a, b) (((a) << 3) | ((b) & 0x3c4))
+#define DEF_965 0x3c5u /* flag 965 */
+#define DEF_966(a, b) (((a) << 5) | ((b) & 0x3c6))
+#define DEF_967 0x3c7u /* flag 967 */
+#define DEF_968(a, b) (((a) << 7) | ((b) & 0x3c8))
+#define DEF_969 0x3c9u /* flag 969 */
+#define DEF_970(a, b) (((a) << 9) | ((b) & 0x3ca))
+#define DEF_971 0x3cbu /* flag 971 */
+#define DEF_972(a, b) (((a) << 11) | ((b) & 0x3cc))
+#define DEF_973 0x3cdu /* flag 973 */
+#define DEF_974(a, b) (((a) << 13) | ((b) & 0x3ce))
+#define DEF_975 0x3cfu /* flag 975 */
+#define DEF_976(a, b) (((a) << 15) | ((b) & 0x3d0))
+#define DEF_977 0x3d1u /* flag 977 */
+#define DEF_978(a, b) (((a) << 17) | ((b) & 0x3d2))
+#define DEF_979 0x3d3u /* flag 979 */
+#define DEF_980(a, b) (((a) << 19) | ((b) & 0x3d4))
+#define DEF_981 0x3d5u /* flag 981 */
+#define DEF_982(a, b) (((a) << 21) | ((b) & 0x3d6))
+#define DEF_983 0x3d7u /* flag 983 */
+#define DEF_984(a, b) (((a) << 23) | ((b) & 0x3d8))
+#define DEF_985 0x3d9u /* flag 985 */
+#define DEF_986(a, b) (((a) << 25) | ((b) & 0x3da))
+#define DEF_987 0x3dbu /* flag 987 */
+#define DEF_988(a, b) (((a) << 27) | ((b) & 0x3dc))
+#define DEF_989 0x3ddu /* flag 989 */
+#define DEF_990(a, b) (((a) << 29) | ((b) & 0x3de))
+#define DEF_991 0x3dfu /* flag 991 */
+#define DEF_992(a, b) (((a) << 0) | ((b) & 0x3e0))
+#define DEF_993 0x3e1u /* flag 993 */
+#define DEF_994(a, b) (((a) << 2) | ((b) & 0x3e2))
+#define DEF_995 0x3e3u /* flag 995 */
+#define DEF_996(a, b) (((a) << 4) | ((b) & 0x3e4))
+#define DEF_997 0x3e5u /* flag 997 */
+#define DEF_998(a, b) (((a) << 6) | ((b) & 0x3e6))
+#define DEF_999 0x3e7u /* flag 999 */
+#define DEF_1000(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1000); })
+#define DEF_1001 0x3e9u /* flag 1001 */
+#define DEF_1002(a, b) (((a) << 10) | ((b) & 0x3ea))
+#define DEF_1003 0x3ebu /* flag 1003 */
+#define DEF_1004(a, b) (((a) << 12) | ((b) & 0x3ec))
+#define DEF_1005 0x3edu /* flag 1005 */
+#define DEF_1006(a, b) (((a) << 14) | ((b) & 0x3ee))
+#define DEF_1007 0x3efu /* flag 1007 */
+#define DEF_1008(a, b) (((a) << 16) | ((b) & 0x3f0))
+#define DEF_1009 0x3f1u /* flag 1009 */
+#define DEF_1010(a, b) (((a) << 18) | ((b) & 0x3f2))
+#define DEF_1011 0x3f3u /* flag 1011 */
+#define DEF_1012(a, b) (((a) << 20) | ((b) & 0x3f4))
+#define DEF_1013 0x3f5u /* flag 1013 */
+#define DEF_1014(a, b) (((a) << 22) | ((b) & 0x3f6))
+#define DEF_1015 0x3f7u /* flag 1015 */
+#define DEF_1016(a, b) (((a) << 24) | ((b) & 0x3f8))
+#define DEF_1017 0x3f9u /* flag 1017 */
+#define DEF_1018(a, b) (((a) << 26) | ((b) & 0x3fa))
+#define DEF_1019 0x3fbu /* flag 1019 */
+#define DEF_1020(a, b) (((a) << 28) | ((b) & 0x3fc))
+#define DEF_1021 0x3fdu /* flag 1021 */
+#define DEF_1022(a, b) (((a) << 30) | ((b) & 0x3fe))
+#define DEF_1023 0x3ffu /* flag 1023 */
+#define DEF_1024(a, b) (((a) << 1) | ((b) & 0x400))
+#define DEF_1025 0x401u /* flag 1025 */
+#define DEF_1026(a, b) (((a) << 3) | ((b) & 0x402))
+#define DEF_1027 0x403u /* flag 1027 */
+#define DEF_1028(a, b) (((a) << 5) | ((b) & 0x404))
+#define DEF_1029 0x405u /* flag 1029 */
+#define DEF_1030(a, b) (((a) << 7) | ((b) & 0x406))
+#define DEF_1031 0x407u /* flag 1031 */
+#define DEF_1032(a, b) (((a) << 9) | ((b) & 0x408))
+#define DEF_1033 0x409u /* flag 1033 */
+#define DEF_1034(a, b) (((a) << 11) | ((b) & 0x40a))
+#define DEF_1035 0x40bu /* flag 1035 */
+#define DEF_1036(a, b) (((a) << 13) | ((b) & 0x40c))
+#define DEF_1037 0x40du /* flag 1037 */
+#define DEF_1038(a, b) (((a) << 15) | ((b) & 0x40e))
+#define DEF_1039 0x40fu /* flag 1039 */
+#define DEF_1040(a, b) (((a) << 17) | ((b) & 0x410))
+#define DEF_1041 0x411u /* flag 1041 */
+#define DEF_1042(a, b) (((a) << 19) | ((b) & 0x412))
+#define DEF_1043 0x413u /* flag 1043 */
+#define DEF_1044(a, b) (((a) << 21) | ((b) & 0x414))
+#define DEF_1045 0x415u /* flag 1045 */
+#define DEF_1046(a, b) (((a) << 23) | ((b) & 0x416))
+#define DEF_1047 0x417u /* flag 1047 */
+#define DEF_1048(a, b) (((a) << 25) | ((b) & 0x418))
+#define DEF_1049 0x419u /* flag 1049 */
+#define DEF_1050(a, b) (((a) << 27) | ((b) & 0x41a))
+#define DEF_1051 0x41bu /* flag 1051 */
+#define DEF_1052(a, b) (((a) << 29) | ((b) & 0x41c))
+#define DEF_1053 0x41du /* flag 1053 */
+#define DEF_1054(a, b) (((a) << 0) | ((b) & 0x41e))
+#define DEF_1055 0x41fu /* flag 1055 */
+#define DEF_1056(a, b) (((a) << 2) | ((b) & 0x420))
+#define DEF_1057 0x421u /* flag 1057 */
+#define DEF_1058(a, b) (((a) << 4) | ((b) & 0x422))
+#define DEF_1059 0x423u /* flag 1059 */
+#define DEF_1060(a, b) (((a) << 6) | ((b) & 0x424))
+#define DEF_1061 0x425u /* flag 1061 */
+#define DEF_1062(a, b) (((a) << 8) | ((b) & 0x426))
+#define DEF_1063 0x427u /* flag 1063 */
+#define DEF_1064(a, b) (((a) << 10) | ((b) & 0x428))
+#define DEF_1065 0x429u /* flag 1065 */
+#define DEF_1066(a, b) (((a) << 12) | ((b) & 0x42a))
+#define DEF_1067 0x42bu /* flag 1067 */
+#define DEF_1068(a, b) (((a) << 14) | ((b) & 0x42c))
+#define DEF_1069 0x42du /* flag 1069 */
+#define DEF_1070(a, b) (((a) << 16) | ((b) & 0x42e))
+#define DEF_1071 0x42fu /* flag 1071 */
+#define DEF_1072(a, b) (((a) << 18) | ((b) & 0x430))
+#define DEF_1073 0x431u /* flag 1073 */
+#define DEF_1074(a, b) (((a) << 20) | ((b) & 0x432))
+#define DEF_1075 0x433u /* flag 1075 */
+#define DEF_1076(a, b) (((a) << 22) | ((b) & 0x434))
+#define DEF_1077 0x435u /* flag 1077 */
+#define DEF_1078(a, b) (((a) << 24) | ((b) & 0x436))
+#define DEF_1079 0x437u /* flag 1079 */
+#define DEF_1080(a, b) (((a) << 26) | ((b) & 0x438))
+#define DEF_1081 0x439u /* flag 1081 */
+#define DEF_1082(a, b) (((a) << 28) | ((b) & 0x43a))
+#define DEF_1083 0x43bu /* flag 1083 */
+#define DEF_1084(a, b) (((a) << 30) | ((b) & 0x43c))
+#define DEF_1085 0x43du /* flag 1085 */
+#define DEF_1086(a, b) (((a) << 1) | ((b) & 0x43e))
+#define DEF_1087 0x43fu /* flag 1087 */
+#define DEF_1088(a, b) (((a) << 3) | ((b) & 0x440))
+#define DEF_1089 0x441u /* flag 1089 */
+#define DEF_1090(a, b) (((a) << 5) | ((b) & 0x442))
+#define DEF_1091 0x443u /* flag 1091 */
+#define DEF_1092(a, b) (((a) << 7) | ((b) & 0x444))
+#define DEF_1093 0x445u /* flag 1093 */
+#define DEF_1094(a, b) (((a) << 9) | ((b) & 0x446))
+#define DEF_1095 0x447u /* flag 1095 */
+#define DEF_1096(a, b) (((a) << 11) | ((b) & 0x448))
+#define DEF_1097 0x449u /* flag 1097 */
+#define DEF_1098(a, b) (((a) << 13) | ((b) & 0x44a))
+#define DEF_1099 0x44bu /* flag 1099 */
+#define DEF_1100(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1100); })
+#define DEF_1101 0x44du /* flag 1101 */
+#define DEF_1102(a, b) (((a) << 17) | ((b) & 0x44e))
+#define DEF_1103 0x44fu /* flag 1103 */
+#define DEF_1104(a, b) (((a) << 19) | ((b) & 0x450))
+#define DEF_1105 0x451u /* flag 1105 */
+#define DEF_1106(a, b) (((a) << 21) | ((b) & 0x452))
+#define DEF_1107 0x453u /* flag 1107 */
+#define DEF_1108(a, b) (((a) << 23) | ((b) & 0x454))
+#define DEF_1109 0x455u /* flag 1109 */
+#define DEF_1110(a, b) (((a) << 25) | ((b) & 0x456))
+#define DEF_1111 0x457u /* flag 1111 */
+#define DEF_1112(a, b) (((a) << 27) | ((b) & 0x458))
+#define DEF_1113 0x459u /* flag 1113 */
+#define DEF_1114(a, b) (((a) << 29) | ((b) & 0x45a))
+#define DEF_1115 0x45bu /* flag 1115 */
+#define DEF_1116(a, b) (((a) << 0) | ((b) & 0x45c))
+#define DEF_1117 0x45du /* flag 1117 */
+#define DEF_1118(a, b) (((a) << 2) | ((b) & 0x45e))
+#define DEF_1119 0x45fu /* flag 1119 */
+#define DEF_1120(a, b) (((a) << 4) | ((b) & 0x460))
+#define DEF_1121 0x461u /* flag 1121 */
+#define DEF_1122(a, b) (((a) << 6) | ((b) & 0x462))
+#define DEF_1123 0x463u /* flag 1123 */
+#define DEF_1124(a, b) (((a) << 8) | ((b) & 0x464))
+#define DEF_1125 0x465u /* flag 1125 */
+#define DEF_1126(a, b) (((a) << 10) | ((b) & 0x466))
+#define DEF_1127 0x467u /* flag 1127 */
+#define DEF_1128(a, b) (((a) << 12) | ((b) & 0x468))
+#define DEF_1129 0x469u /* flag 1129 */
+#define DEF_1130(a, b) (((a) << 14) | ((b) & 0x46a))
+#define DEF_1131 0x46bu /* flag 1131 */
+#define DEF_1132(a, b) (((a) << 16) | ((b) & 0x46c))
+#define DEF_1133 0x46du /* flag 1133 */
+#define DEF_1134(a, b) (((a) << 18) | ((b) & 0x46e))
+#define DEF_1135 0x46fu /* flag 1135 */
+#define DEF_1136(a, b) (((a) << 20) | ((b) & 0x470))
+#define DEF_1137 0x471u /* flag 1137 */
+#define DEF_1138(a, b) (((a) << 22) | ((b) & 0x472))
+#define DEF_1139 0x473u /* flag 1139 */
+#define DEF_1140(a, b) (((a) << 24) | ((b) & 0x474))
+#define DEF_1141 0x475u /* flag 1141 */
+#define DEF_1142(a, b) (((a) << 26) | ((b) & 0x476))
+#define DEF_1143 0x477u /* flag 1143 */
+#define DEF_1144(a, b) (((a) << 28) | ((b) & 0x478))
+#define DEF_1145 0x479u /* flag 1145 */
+#define DEF_1146(a, b) (((a) << 30) | ((b) & 0x47a))
+#define DEF_1147 0x47bu /* flag 1147 */
+#define DEF_1148(a, b) (((a) << 1) | ((b) & 0x47c))
+#define DEF_1149 0x47du /* flag 1149 */
+#define DEF_1150(a, b) (((a) << 3) | ((b) & 0x47e))
+#define DEF_1151 0x47fu /* flag 1151 */
+#define DEF_1152(a, b) (((a) << 5) | ((b) & 0x480))
+#define DEF_1153 0x481u /* flag 1153 */
+#define DEF_1154(a, b) (((a) << 7) | ((b) & 0x482))
+#define DEF_1155 0x483u /* flag 1155 */
+#define DEF_1156(a, b) (((a) << 9) | ((b) & 0x484))
+#define DEF_1157 0x485u /* flag 1157 */
+#define DEF_1158(a, b) (((a) << 11) | ((b) & 0x486))
+#define DEF_1159 0x487u /* flag 1159 */
+#define DEF_1160(a, b) (((a) << 13) | ((b) & 0x488))
+#define DEF_1161 0x489u /* flag 1161 */
+#define DEF_1162(a, b) (((a) << 15) | ((b) & 0x48a))
+#define DEF_1163 0x48bu /* flag 1163 */
+#define DEF_1164(a, b) (((a) << 17) | ((b) & 0x48c))
+#define DEF_1165 0x48du /* flag 1165 */
+#define DEF_1166(a, b) (((a) << 19) | ((b) & 0x48e))
+#define DEF_1167 0x48fu /* flag 1167 */
+#define DEF_1168(a, b) (((a) << 21) | ((b) & 0x490))
+#define DEF_1169 0x491u /* flag 1169 */
+#define DEF_1170(a, b) (((a) << 23) | ((b) & 0x492))
+#define DEF_1171 0x493u /* flag 1171 */
+#define DEF_1172(a, b) (((a) << 25) | ((b) & 0x494))
+#define DEF_1173 0x495u /* flag 1173 */
+#define DEF_1174(a, b) (((a) << 27) | ((b) & 0x496))
+#define DEF_1175 0x497u /* flag 1175 */
+#define DEF_1176(a, b) (((a) << 29) | ((b) & 0x498))
+#define DEF_1177 0x499u /* flag 1177 */
+#define DEF_1178(a, b) (((a) << 0) | ((b) & 0x49a))
+#define DEF_1179 0x49bu /* flag 1179 */
+#define DEF_1180(a, b) (((a) << 2) | ((b) & 0x49c))
+#define DEF_1181 0x49du /* flag 1181 */
+#define DEF_1182(a, b) (((a) << 4) | ((b) & 0x49e))
+#define DEF_1183 0x49fu /* flag 1183 */
+#define DEF_1184(a, b) (((a) << 6) | ((b) & 0x4a0))
+#define DEF_1185 0x4a1u /* flag 1185 */
+#define DEF_1186(a, b) (((a) << 8) | ((b) & 0x4a2))
+#define DEF_1187 0x4a3u /* flag 1187 */
+#define DEF_1188(a, b) (((a) << 10) | ((b) & 0x4a4))
+#define DEF_1189 0x4a5u /* flag 1189 */
+#define DEF_1190(a, b) (((a) << 12) | ((b) & 0x4a6))
+#define DEF_1191 0x4a7u /* flag 1191 */
+#define DEF_1192(a, b) (((a) << 14) | ((b) & 0x4a8))
+#define DEF_1193 0x4a9u /* flag 1193 */
+#define DEF_1194(a, b) (((a) << 16) | ((b) & 0x4aa))
+#define DEF_1195 0x4abu /* flag 1195 */
+#define DEF_1196(a, b) (((a) << 18) | ((b) & 0x4ac))
+#define DEF_1197 0x4adu /* flag 1197 */
+#define DEF_1198(a, b) (((a) << 20) | ((b) & 0x4ae))
+#define DEF_1199 0x4afu /* flag 1199 */
+#define DEF_1200(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1200); })
+#define DEF_1201 0x4b1u /* flag 1201 */
+#define DEF_1202(a, b) (((a) << 24) | ((b) & 0x4b2))
+#define DEF_1203 0x4b3u /* flag 1203 */
+#define DEF_1204(a, b) (((a) << 26) | ((b) & 0x4b4))
+#define DEF_1205 0x4b5u /* flag 1205 */
+#define DEF_1206(a, b) (((a) << 28) | ((b) & 0x4b6))
+#define DEF_1207 0x4b7u /* flag 1207 */
+#define DEF_1208(a, b) (((a) << 30) | ((b) & 0x4b8))
+#define DEF_1209 0x4b9u /* flag 1209 */
+#define DEF_1210(a, b) (((a) << 1) | ((b) & 0x4ba))
+#define DEF_1211 0x4bbu /* flag 1211 */
+#define DEF_1212(a, b) (((a) << 3) | ((b) & 0x4bc))
+#define DEF_1213 0x4bdu /* flag 1213 */
+#define DEF_1214(a, b) (((a) << 5) | ((b) & 0x4be))
+#define DEF_1215 0x4bfu /* flag 1215 */
+#define DEF_1216(a, b) (((a) << 7) | ((b) & 0x4c0))
+#define DEF_1217 0x4c1u /* flag 1217 */
+#define DEF_1218(a, b) (((a) << 9) | ((b) & 0x4c2))
+#define DEF_1219 0x4c3u /* flag 1219 */
+#define DEF_1220(a, b) (((a) << 11) | ((b) & 0x4c4))
+#define DEF_1221 0x4c5u /* flag 1221 */
+#define DEF_1222(a, b) (((a) << 13) | ((b) & 0x4c6))
+#define DEF_1223 0x4c7u /* flag 1223 */
+#define DEF_1224(a, b) (((a) << 15) | ((b) & 0x4c8))
+#define DEF_1225 0x4c9u /* flag 1225 */
+#define DEF_1226(a, b) (((a) << 17) | ((b) & 0x4ca))
+#define DEF_1227 0x4cbu /* flag 1227 */
+#define DEF_1228(a, b) (((a) << 19) | ((b) & 0x4cc))
+#define DEF_1229 0x4cdu /* flag 1229 */
+#define DEF_1230(a, b) (((a) << 21) | ((b) & 0x4ce))
+#define DEF_1231 0x4cfu /* flag 1231 */
+#define DEF_1232(a, b) (((a) << 23) | ((b) & 0x4d0))
+#define DEF_1233 0x4d1u /* flag 1233 */
+#define DEF_1234(a, b) (((a) << 25) | ((b) & 0x4d2))
+#define DEF_1235 0x4d3u /* flag 1235 */
+#define DEF_1236(a, b) (((a) << 27) | ((b) & 0x4d4))
+#define DEF_1237 0x4d5u /* flag 1237 */
+#define DEF_1238(a, b) (((a) << 29) | ((b) & 0x4d6))
+#define DEF_1239 0x4d7u /* flag 1239 */
+#define DEF_1240(a, b) (((a) << 0) | ((b) & 0x4d8))
+#define DEF_1241 0x4d9u /* flag 1241 */
+#define DEF_1242(a, b) (((a) << 2) | ((b) & 0x4da))
+#define DEF_1243 0x4dbu /* flag 1243 */
+#define DEF_1244(a, b) (((a) << 4) | ((b) & 0x4dc))
+#define DEF_1245 0x4ddu /* flag 1245 */
+#define DEF_1246(a, b) (((a) << 6) | ((b) & 0x4de))
+#define DEF_1247 0x4dfu /* flag 1247 */
+#define DEF_1248(a, b) (((a) << 8) | ((b) & 0x4e0))
+#define DEF_1249 0x4e1u /* flag 1249 */
+#define DEF_1250(a, b) (((a) << 10) | ((b) & 0x4e2))
+#define DEF_1251 0x4e3u /* flag 1251 */
+#define DEF_1252(a, b) (((a) << 12) | ((b) & 0x4e4))
+#define DEF_1253 0x4e5u /* flag 1253 */
+#define DEF_1254(a, b) (((a) << 14) | ((b) & 0x4e6))
+#define DEF_1255 0x4e7u /* flag 1255 */
+#define DEF_1256(a, b) (((a) << 16) | ((b) & 0x4e8))
+#define DEF_1257 0x4e9u /* flag 1257 */
+#define DEF_1258(a, b) (((a) << 18) | ((b) & 0x4ea))
+#define DEF_1259 0x4ebu /* flag 1259 */
+#define DEF_1260(a, b) (((a) << 20) | ((b) & 0x4ec))
+#define DEF_1261 0x4edu /* flag 1261 */
+#define DEF_1262(a, b) (((a) << 22) | ((b) & 0x4ee))
+#define DEF_1263 0x4efu /* flag 1263 */
+#define DEF_1264(a, b) (((a) << 24) | ((b) & 0x4f0))
+#define DEF_1265 0x4f1u /* flag 1265 */
+#define DEF_1266(a, b) (((a) << 26) | ((b) & 0x4f2))
+#define DEF_1267 0x4f3u /* flag 1267 */
+#define DEF_1268(a, b) (((a) << 28) | ((b) & 0x4f4))
+#define DEF_1269 0x4f5u /* flag 1269 */
+#define DEF_1270(a, b) (((a) << 30) | ((b) & 0x4f6))
+#define DEF_1271 0x4f7u /* flag 1271 */
+#define DEF_1272(a, b) (((a) << 1) | ((b) & 0x4f8))
+#define DEF_1273 0x4f9u /* flag 1273 */
+#define DEF_1274(a, b) (((a) << 3) | ((b) & 0x4fa))
+#define DEF_1275 0x4fbu /* flag 1275 */
+#define DEF_1276(a, b) (((a) << 5) | ((b) & 0x4fc))
+#define DEF_1277 0x4fdu /* flag 1277 */
+#define DEF_1278(a, b) (((a) << 7) | ((b) & 0x4fe))
+#define DEF_1279 0x4ffu /* flag 1279 */
+#define DEF_1280(a, b) (((a) << 9) | ((b) & 0x500))
+#define DEF_1281 0x501u /* flag 1281 */
+#define DEF_1282(a, b) (((a) << 11) | ((b) & 0x502))
+#define DEF_1283 0x503u /* flag 1283 */
+#define DEF_1284(a, b) (((a) << 13) | ((b) & 0x504))
+#define DEF_1285 0x505u /* flag 1285 */
+#define DEF_1286(a, b) (((a) << 15) | ((b) & 0x506))
+#define DEF_1287 0x507u /* flag 1287 */
+#define DEF_1288(a, b) (((a) << 17) | ((b) & 0x508))
+#define DEF_1289 0x509u /* flag 1289 */
+#define DEF_1290(a, b) (((a) << 19) | ((b) & 0x50a))
+#define DEF_1291 0x50bu /* flag 1291 */
+#define DEF_1292(a, b) (((a) << 21) | ((b) & 0x50c))
+#define DEF_1293 0x50du /* flag 1293 */
+#define DEF_1294(a, b) (((a) << 23) | ((b) & 0x50e))
+#define DEF_1295 0x50fu /* flag 1295 */
+#define DEF_1296(a, b) (((a) << 25) | ((b) & 0x510))
+#define DEF_1297 0x511u /* flag 1297 */
+#define DEF_1298(a, b) (((a) << 27) | ((b) & 0x512))
+#define DEF_1299 0x513u /* flag 1299 */
+#define DEF_1300(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1300); })
+#define DEF_1301 0x515u /* flag 1301 */
+#define DEF_1302(a, b) (((a) << 0) | ((b) & 0x516))
+#define DEF_1303 0x517u /* flag 1303 */
+#define DEF_1304(a, b) (((a) << 2) | ((b) & 0x518))
+#define DEF_1305 0x519u /* flag 1305 */
+#define DEF_1306(a, b) (((a) << 4) | ((b) & 0x51a))
+#define DEF_1307 0x51bu /* flag 1307 */
+#define DEF_1308(a, b) (((a) << 6) | ((b) & 0x51c))
+#define DEF_1309 0x51du /* flag 1309 */
+#define DEF_1310(a, b) (((a) << 8) | ((b) & 0x51e))
+#define DEF_1311 0x51fu /* flag 1311 */
+#define DEF_1312(a, b) (((a) << 10) | ((b) & 0x520))
+#define DEF_1313 0x521u /* flag 1313 */
+#define DEF_1314(a, b) (((a) << 12) | ((b) & 0x522))
+#define DEF_1315 0x523u /* flag 1315 */
+#define DEF_1316(a, b) (((a) << 14) | ((b) & 0x524))
+#define DEF_1317 0x525u /* flag 1317 */
+#define DEF_1318(a, b) (((a) << 16) | ((b) & 0x526))
+#define DEF_1319 0x527u /* flag 1319 */
+#define DEF_1320(a, b) (((a) << 18) | ((b) & 0x528))
+#define DEF_1321 0x529u /* flag 1321 */
+#define DEF_1322(a, b) (((a) << 20) | ((b) & 0x52a))
+#define DEF_1323 0x52bu /* flag 1323 */
+#define DEF_1324(a, b) (((a) << 22) | ((b) & 0x52c))
+#define DEF_1325 0x52du /* flag 1325 */
+#define DEF_1326(a, b) (((a) << 24) | ((b) & 0x52e))
+#define DEF_1327 0x52fu /* flag 1327 */
+#define DEF_1328(a, b) (((a) << 26) | ((b) & 0x530))
+#define DEF_1329 0x531u /* flag 1329 */
+#define DEF_1330(a, b) (((a) << 28) | ((b) & 0x532))
+#define DEF_1331 0x533u /* flag 1331 */
+#define DEF_1332(a, b) (((a) << 30) | ((b) & 0x534))
+#define DEF_1333 0x535u /* flag 1333 */
+#define DEF_1334(a, b) (((a) << 1) | ((b) & 0x536))
+#define DEF_1335 0x537u /* flag 1335 */
+#define DEF_1336(a, b) (((a) << 3) | ((b) & 0x538))
+#define DEF_1337 0x539u /* flag 1337 */
+#define DEF_1338(a, b) (((a) << 5) | ((b) & 0x53a))
+#define DEF_1339 0x53bu /* flag 1339 */
+#define DEF_1340(a, b) (((a) << 7) | ((b) & 0x53c))
+#define DEF_1341 0x53du /* flag 1341 */
+#define DEF_1342(a, b) (((a) << 9) | ((b) & 0x53e))
+#define DEF_1343 0x53fu /* flag 1343 */
+#define DEF_1344(a, b) (((a) << 11) | ((b) & 0x540))
+#define DEF_1345 0x541u /* flag 1345 */
+#define DEF_1346(a, b) (((a) << 13) | ((b) & 0x542))
+#define DEF_1347 0x543u /* flag 1347 */
+#define DEF_1348(a, b) (((a) << 15) | ((b) & 0x544))
+#define DEF_1349 0x545u /* flag 1349 */
+#define DEF_1350(a, b) (((a) << 17) | ((b) & 0x546))
+#define DEF_1351 0x547u /* flag 1351 */
+#define DEF_1352(a, b) (((a) << 19) | ((b) & 0x548))
+#define DEF_1353 0x549u /* flag 1353 */
+#define DEF_1354(a, b) (((a) << 21) | ((b) & 0x54a))
+#define DEF_1355 0x54bu /* flag 1355 */
+#define DEF_1356(a, b) (((a) << 23) | ((b) & 0x54c))
+#define DEF_1357 0x54du /* flag 1357 */
+#define DEF_1358(a, b) (((a) << 25) | ((b) & 0x54e))
+#define DEF_1359 0x54fu /* flag 1359 */
+#define DEF_1360(a, b) (((a) << 27) | ((b) & 0x550))
+#define DEF_1361 0x551u /* flag 1361 */
+#define DEF_1362(a, b) (((a) << 29) | ((b) & 0x552))
+#define DEF_1363 0x553u /* flag 1363 */
+#define DEF_1364(a, b) (((a) << 0) | ((b) & 0x554))
+#define DEF_1365 0x555u /* flag 1365 */
+#define DEF_1366(a, b) (((a) << 2) | ((b) & 0x556))
+#define DEF_1367 0x557u /* flag 1367 */
+#define DEF_1368(a, b) (((a) << 4) | ((b) & 0x558))
+#define DEF_1369 0x559u /* flag 1369 */
+#define DEF_1370(a, b) (((a) << 6) | ((b) & 0x55a))
+#define DEF_1371 0x55bu /* flag 1371 */
+#define DEF_1372(a, b) (((a) << 8) | ((b) & 0x55c))
+#define DEF_1373 0x55du /* flag 1373 */
+#define DEF_1374(a, b) (((a) << 10) | ((b) & 0x55e))
+#define DEF_1375 0x55fu /* flag 1375 */
+#define DEF_1376(a, b) (((a) << 12) | ((b) & 0x560))
+#define DEF_1377 0x561u /* flag 1377 */
+#define DEF_1378(a, b) (((a) << 14) | ((b) & 0x562))
+#define DEF_1379 0x563u /* flag 1379 */
+#define DEF_1380(a, b) (((a) << 16) | ((b) & 0x564))
+#define DEF_1381 0x565u /* flag 1381 */
+#define DEF_1382(a, b) (((a) << 18) | ((b) & 0x566))
+#define DEF_1383 0x567u /* flag 1383 */
+#define DEF_1384(a, b) (((a) << 20) | ((b) & 0x568))
+#define DEF_1385 0x569u /* flag 1385 */
+#define DEF_1386(a, b) (((a) << 22) | ((b) & 0x56a))
+#define DEF_1387 0x56bu /* flag 1387 */
+#define DEF_1388(a, b) (((a) << 24) | ((b) & 0x56c))
+#define DEF_1389 0x56du /* flag 1389 */
+#define DEF_1390(a, b) (((a) << 26) | ((b) & 0x56e))
+#define DEF_1391 0x56fu /* flag 1391 */
+#define DEF_1392(a, b) (((a) << 28) | ((b) & 0x570))
+#define DEF_1393 0x571u /* flag 1393 */
+#define DEF_1394(a, b) (((a) << 30) | ((b) & 0x572))
+#define DEF_1395 0x573u /* flag 1395 */
+#define DEF_1396(a, b) (((a) << 1) | ((b) & 0x574))
+#define DEF_1397 0x575u /* flag 1397 */
+#define DEF_1398(a, b) (((a) << 3) | ((b) & 0x576))
+#define DEF_1399 0x577u /* flag 1399 */
+#define DEF_1400(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1400); })
+#define DEF_1401 0x579u /* flag 1401 */
+#define DEF_1402(a, b) (((a) << 7) | ((b) & 0x57a))
+#define DEF_1403 0x57bu /* flag 1403 */
+#define DEF_1404(a, b) (((a) << 9) | ((b) & 0x57c))
+#define DEF_1405 0x57du /* flag 1405 */
+#define DEF_1406(a, b) (((a) << 11) | ((b) & 0x57e))
+#define DEF_1407 0x57fu /* flag 1407 */
+#define DEF_1408(a, b) (((a) << 13) | ((b) & 0x580))
+#define DEF_1409 0x581u /* flag 1409 */
+#define DEF_1410(a, b) (((a) << 15) | ((b) & 0x582))
+#define DEF_1411 0x583u /* flag 1411 */
+#define DEF_1412(a, b) (((a) << 17) | ((b) & 0x584))
+#define DEF_1413 0x585u /* flag 1413 */
+#define DEF_1414(a, b) (((a) << 19) | ((b) & 0x586))
+#define DEF_1415 0x587u /* flag 1415 */
+#define DEF_1416(a, b) (((a) << 21) | ((b) & 0x588))
+#define DEF_1417 0x589u /* flag 1417 */
+#define DEF_1418(a, b) (((a) << 23) | ((b) & 0x58a))
+#define DEF_1419 0x58bu /* flag 1419 */
+#define DEF_1420(a, b) (((a) << 25) | ((b) & 0x58c))
+#define DEF_1421 0x58du /* flag 1421 */
+#define DEF_1422(a, b) (((a) << 27) | ((b) & 0x58e))
+#define DEF_1423 0x58fu /* flag 1423 */
+#define DEF_1424(a, b) (((a) << 29) | ((b) & 0x590))
+#define DEF_1425 0x591u /* flag 1425 */
+#define DEF_1426(a, b) (((a) << 0) | ((b) & 0x592))
+#define DEF_1427 0x593u /* flag 1427 */
+#define DEF_1428(a, b) (((a) << 2) | ((b) & 0x594))
+#define DEF_1429 0x595u /* flag 1429 */
+#define DEF_1430(a, b) (((a) << 4) | ((b) & 0x596))
+#define DEF_1431 0x597u /* flag 1431 */
+#define DEF_1432(a, b) (((a) << 6) | ((b) & 0x598))
+#define DEF_1433 0x599u /* flag 1433 */
+#define DEF_1434(a, b) (((a) << 8) | ((b) & 0x59a))
+#define DEF_1435 0x59bu /* flag 1435 */
+#define DEF_1436(a, b) (((a) << 10) | ((b) & 0x59c))
+#define DEF_1437 0x59du /* flag 1437 */
+#define DEF_1438(a, b) (((a) << 12) | ((b) & 0x59e))
+#define DEF_1439 0x59fu /* flag 1439 */
+#define DEF_1440(a, b) (((a) << 14) | ((b) & 0x5a0))
+#define DEF_1441 0x5a1u /* flag 1441 */
+#define DEF_1442(a, b) (((a) << 16) | ((b) & 0x5a2))
+#define DEF_1443 0x5a3u /* flag 1443 */
+#define DEF_1444(a, b) (((a) << 18) | ((b) & 0x5a4))
+#define DEF_1445 0x5a5u /* flag 1445 */
+#define DEF_1446(a, b) (((a) << 20) | ((b) & 0x5a6))
+#define DEF_1447 0x5a7u /* flag 1447 */
+#define DEF_1448(a, b) (((a) << 22) | ((b) & 0x5a8))
+#define DEF_1449 0x5a9u /* flag 1449 */
+#define DEF_1450(a, b) (((a) << 24) | ((b) & 0x5aa))
+#define DEF_1451 0x5abu /* flag 1451 */
+#define DEF_1452(a, b) (((a) << 26) | ((b) & 0x5ac))
+#define DEF_1453 0x5adu /* flag 1453 */
+#define DEF_1454(a, b) (((a) << 28) | ((b) & 0x5ae))
+#define DEF_1455 0x5afu /* flag 1455 */
+#define DEF_1456(a, b) (((a) << 30) | ((b) & 0x5b0))
+#define DEF_1457 0x5b1u /* flag 1457 */
+#define DEF_1458(a, b) (((a) << 1) | ((b) & 0x5b2))
+#define DEF_1459 0x5b3u /* flag 1459 */
+#define DEF_1460(a, b) (((a) << 3) | ((b) & 0x5b4))
+#define DEF_1461 0x5b5u /* flag 1461 */
+#define DEF_1462(a, b) (((a) << 5) | ((b) & 0x5b6))
+#define DEF_1463 0x5b7u /* flag 1463 */
+#define DEF_1464(a, b) (((a) << 7) | ((b) & 0x5b8))
+#define DEF_1465 0x5b9u /* flag 1465 */
+#define DEF_1466(a, b) (((a) << 9) | ((b) & 0x5ba))
+#define DEF_1467 0x5bbu /* flag 1467 */
+#define DEF_1468(a, b) (((a) << 11) | ((b) & 0x5bc))
+#define DEF_1469 0x5bdu /* flag 1469 */
+#define DEF_1470(a, b) (((a) << 13) | ((b) & 0x5be))
+#define DEF_1471 0x5bfu /* flag 1471 */
+#define DEF_1472(a, b) (((a) << 15) | ((b) & 0x5c0))
+#define DEF_1473 0x5c1u /* flag 1473 */
+#define DEF_1474(a, b) (((a) << 17) | ((b) & 0x5c2))
+#define DEF_1475 0x5c3u /* flag 1475 */
+#define DEF_1476(a, b) (((a) << 19) | ((b) & 0x5c4))
+#define DEF_1477 0x5c5u /* flag 1477 */
+#define DEF_1478(a, b) (((a) << 21) | ((b) & 0x5c6))
+#define DEF_1479 0x5c7u /* flag 1479 */
+#define DEF_1480(a, b) (((a) << 23) | ((b) & 0x5c8))
+#define DEF_1481 0x5c9u /* flag 1481 */
+#define DEF_1482(a, b) (((a) << 25) | ((b) & 0x5ca))
+#define DEF_1483 0x5cbu /* flag 1483 */
+#define DEF_1484(a, b) (((a) << 27) | ((b) & 0x5cc))
+#define DEF_1485 0x5cdu /* flag 1485 */
+#define DEF_1486(a, b) (((a) << 29) | ((b) & 0x5ce))
+#define DEF_1487 0x5cfu /* flag 1487 */
+#define DEF_1488(a, b) (((a) << 0) | ((b) & 0x5d0))
+#define DEF_1489 0x5d1u /* flag 1489 */
+#define DEF_1490(a, b) (((a) << 2) | ((b) & 0x5d2))
+#define DEF_1491 0x5d3u /* flag 1491 */
+#define DEF_1492(a, b) (((a) << 4) | ((b) & 0x5d4))
+#define DEF_1493 0x5d5u /* flag 1493 */
+#define DEF_1494(a, b) (((a) << 6) | ((b) & 0x5d6))
+#define DEF_1495 0x5d7u /* flag 1495 */
+#define DEF_1496(a, b) (((a) << 8) | ((b) & 0x5d8))
+#define DEF_1497 0x5d9u /* flag 1497 */
+#define DEF_1498(a, b) (((a) << 10) | ((b) & 0x5da))
+#define DEF_1499 0x5dbu /* flag 1499 */
+#define DEF_1500(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1500); })
+#define DEF_1501 0x5ddu /* flag 1501 */
+#define DEF_1502(a, b) (((a) << 14) | ((b) & 0x5de))
+#define DEF_1503 0x5dfu /* flag 1503 */
+#define DEF_1504(a, b) (((a) << 16) | ((b) & 0x5e0))
+#define DEF_1505 0x5e1u /* flag 1505 */
+#define DEF_1506(a, b) (((a) << 18) | ((b) & 0x5e2))
+#define DEF_1507 0x5e3u /* flag 1507 */
+#define DEF_1508(a, b) (((a) << 20) | ((b) & 0x5e4))
+#define DEF_1509 0x5e5u /* flag 1509 */
+#define DEF_1510(a, b) (((a) << 22) | ((b) & 0x5e6))
+#define DEF_1511 0x5e7u /* flag 1511 */
+#define DEF_1512(a, b) (((a) << 24) | ((b) & 0x5e8))
+#define DEF_1513 0x5e9u /* flag 1513 */
+#define DEF_1514(a, b) (((a) << 26) | ((b) & 0x5ea))
+#define DEF_1515 0x5ebu /* flag 1515 */
+#define DEF_1516(a, b) (((a) << 28) | ((b) & 0x5ec))
+#define DEF_1517 0x5edu /* flag 1517 */
+#define DEF_1518(a, b) (((a) << 30) | ((b) & 0x5ee))
+#define DEF_1519 0x5efu /* flag 1519 */
+#define DEF_1520(a, b) (((a) << 1) | ((b) & 0x5f0))
+#define DEF_1521 0x5f1u /* flag 1521 */
+#define DEF_1522(a, b) (((a) << 3) | ((b) & 0x5f2))
+#define DEF_1523 0x5f3u /* flag 1523 */
+#define DEF_1524(a, b) (((a) << 5) | ((b) & 0x5f4))
+#define DEF_1525 0x5f5u /* flag 1525 */
+#define DEF_1526(a, b) (((a) << 7) | ((b) & 0x5f6))
+#define DEF_1527 0x5f7u /* flag 1527 */
+#define DEF_1528(a, b) (((a) << 9) | ((b) & 0x5f8))
+#define DEF_1529 0x5f9u /* flag 1529 */
+#define DEF_1530(a, b) (((a) << 11) | ((b) & 0x5fa))
+#define DEF_1531 0x5fbu /* flag 1531 */
+#define DEF_1532(a, b) (((a) << 13) | ((b) & 0x5fc))
+#define DEF_1533 0x5fdu /* flag 1533 */
+#define DEF_1534(a, b) (((a) << 15) | ((b) & 0x5fe))
+#define DEF_1535 0x5ffu /* flag 1535 */
+#define DEF_1536(a, b) (((a) << 17) | ((b) & 0x600))
+#define DEF_1537 0x601u /* flag 1537 */
+#define DEF_1538(a, b) (((a) << 19) | ((b) & 0x602))
+#define DEF_1539 0x603u /* flag 1539 */
+#define DEF_1540(a, b) (((a) << 21) | ((b) & 0x604))
+#define DEF_1541 0x605u /* flag 1541 */
+#define DEF_1542(a, b) (((a) << 23) | ((b) & 0x606))
+#define DEF_1543 0x607u /* flag 1543 */
+#define DEF_1544(a, b) (((a) << 25) | ((b) & 0x608))
+#define DEF_1545 0x609u /* flag 1545 */
+#define DEF_1546(a, b) (((a) << 27) | ((b) & 0x60a))
+#define DEF_1547 0x60bu /* flag 1547 */
+#define DEF_1548(a, b) (((a) << 29) | ((b) & 0x60c))
+#define DEF_1549 0x60du /* flag 1549 */
+#define DEF_1550(a, b) (((a) << 0) | ((b) & 0x60e))
+#define DEF_1551 0x60fu /* flag 1551 */
+#define DEF_1552(a, b) (((a) << 2) | ((b) & 0x610))
+#define DEF_1553 0x611u /* flag 1553 */
+#define DEF_1554(a, b) (((a) << 4) | ((b) & 0x612))
+#define DEF_1555 0x613u /* flag 1555 */
+#define DEF_1556(a, b) (((a) << 6) | ((b) & 0x614))
+#define DEF_1557 0x615u /* flag 1557 */
+#define DEF_1558(a, b) (((a) << 8) | ((b) & 0x616))
+#define DEF_1559 0x617u /* flag 1559 */
+#define DEF_1560(a, b) (((a) << 10) | ((b) & 0x618))
+#define DEF_1561 0x619u /* flag 1561 */
+#define DEF_1562(a, b) (((a) << 12) | ((b) & 0x61a))
+#define DEF_1563 0x61bu /* flag 1563 */
+#define DEF_1564(a, b) (((a) << 14) | ((b) & 0x61c))
+#define DEF_1565 0x61du /* flag 1565 */
+#define DEF_1566(a, b) (((a) << 16) | ((b) & 0x61e))
+#define DEF_1567 0x61fu /* flag 1567 */
+#define DEF_1568(a, b) (((a) << 18) | ((b) & 0x620))
+#define DEF_1569 0x621u /* flag 1569 */
+#define DEF_1570(a, b) (((a) << 20) | ((b) & 0x622))
+#define DEF_1571 0x623u /* flag 1571 */
+#define DEF_1572(a, b) (((a) << 22) | ((b) & 0x624))
+#define DEF_1573 0x625u /* flag 1573 */
+#define DEF_1574(a, b) (((a) << 24) | ((b) & 0x626))
+#define DEF_1575 0x627u /* flag 1575 */
+#define DEF_1576(a, b) (((a) << 26) | ((b) & 0x628))
+#define DEF_1577 0x629u /* flag 1577 */
+#define DEF_1578(a, b) (((a) << 28) | ((b) & 0x62a))
+#define DEF_1579 0x62bu /* flag 1579 */
+#define DEF_1580(a, b) (((a) << 30) | ((b) & 0x62c))
+#define DEF_1581 0x62du /* flag 1581 */
+#define DEF_1582(a, b) (((a) << 1) | ((b) & 0x62e))
+#define DEF_1583 0x62fu /* flag 1583 */
+#define DEF_1584(a, b) (((a) << 3) | ((b) & 0x630))
+#define DEF_1585 0x631u /* flag 1585 */
+#define DEF_1586(a, b) (((a) << 5) | ((b) & 0x632))
+#define DEF_1587 0x633u /* flag 1587 */
+#define DEF_1588(a, b) (((a) << 7) | ((b) & 0x634))
+#define DEF_1589 0x635u /* flag 1589 */
+#define DEF_1590(a, b) (((a) << 9) | ((b) & 0x636))
+#define DEF_1591 0x637u /* flag 1591 */
+#define DEF_1592(a, b) (((a) << 11) | ((b) & 0x638))
+#define DEF_1593 0x639u /* flag 1593 */
+#define DEF_1594(a, b) (((a) << 13) | ((b) & 0x63a))
+#define DEF_1595 0x63bu /* flag 1595 */
+#define DEF_1596(a, b) (((a) << 15) | ((b) & 0x63c))
+#define DEF_1597 0x63du /* flag 1597 */
+#define DEF_1598(a, b) (((a) << 17) | ((b) & 0x63e))
+#define DEF_1599 0x63fu /* flag 1599 */
+#define DEF_1600(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1600); })
+#define DEF_1601 0x641u /* flag 1601 */
+#define DEF_1602(a, b) (((a) << 21) | ((b) & 0x642))
+#define DEF_1603 0x643u /* flag 1603 */
+#define DEF_1604(a, b) (((a) << 23) | ((b) & 0x644))
+#define DEF_1605 0x645u /* flag 1605 */
+#define DEF_1606(a, b) (((a) << 25) | ((b) & 0x646))
+#define DEF_1607 0x647u /* flag 1607 */
+#define DEF_1608(a, b) (((a) << 27) | ((b) & 0x648))
+#define DEF_1609 0x649u /* flag 1609 */
+#define DEF_1610(a, b) (((a) << 29) | ((b) & 0x64a))
+#define DEF_1611 0x64bu /* flag 1611 */
+#define DEF_1612(a, b) (((a) << 0) | ((b) & 0x64c))
+#define DEF_1613 0x64du /* flag 1613 */
+#define DEF_1614(a, b) (((a) << 2) | ((b) & 0x64e))
+#define DEF_1615 0x64fu /* flag 1615 */
+#define DEF_1616(a, b) (((a) << 4) | ((b) & 0x650))
+#define DEF_1617 0x651u /* flag 1617 */
+#define DEF_1618(a, b) (((a) << 6) | ((b) & 0x652))
+#define DEF_1619 0x653u /* flag 1619 */
+#define DEF_1620(a, b) (((a) << 8) | ((b) & 0x654))
+#define DEF_1621 0x655u /* flag 1621 */
+#define DEF_1622(a, b) (((a) << 10) | ((b) & 0x656))
+#define DEF_1623 0x657u /* flag 1623 */
+#define DEF_1624(a, b) (((a) << 12) | ((b) & 0x658))
+#define DEF_1625 0x659u /* flag 1625 */
+#define DEF_1626(a, b) (((a) << 14) | ((b) & 0x65a))
+#define DEF_1627 0x65bu /* flag 1627 */
+#define DEF_1628(a, b) (((a) << 16) | ((b) & 0x65c))
+#define DEF_1629 0x65du /* flag 1629 */
+#define DEF_1630(a, b) (((a) << 18) | ((b) & 0x65e))
+#define DEF_1631 0x65fu /* flag 1631 */
+#define DEF_1632(a, b) (((a) << 20) | ((b) & 0x660))
+#define DEF_1633 0x661u /* flag 1633 */
+#define DEF_1634(a, b) (((a) << 22) | ((b) & 0x662))
+#define DEF_1635 0x663u /* flag 1635 */
+#define DEF_1636(a, b) (((a) << 24) | ((b) & 0x664))
+#define DEF_1637 0x665u /* flag 1637 */
+#define DEF_1638(a, b) (((a) << 26) | ((b) & 0x666))
+#define DEF_1639 0x667u /* flag 1639 */
+#define DEF_1640(a, b) (((a) << 28) | ((b) & 0x668))
+#define DEF_1641 0x669u /* flag 1641 */
+#define DEF_1642(a, b) (((a) << 30) | ((b) & 0x66a))
+#define DEF_1643 0x66bu /* flag 1643 */
+#define DEF_1644(a, b) (((a) << 1) | ((b) & 0x66c))
+#define DEF_1645 0x66du /* flag 1645 */
+#define DEF_1646(a, b) (((a) << 3) | ((b) & 0x66e))
+#define DEF_1647 0x66fu /* flag 1647 */
+#define DEF_1648(a, b) (((a) << 5) | ((b) & 0x670))
+#define DEF_1649 0x671u /* flag 1649 */
+#define DEF_1650(a, b) (((a) << 7) | ((b) & 0x672))
+#define DEF_1651 0x673u /* flag 1651 */
+#define DEF_1652(a, b) (((a) << 9) | ((b) & 0x674))
+#define DEF_1653 0x675u /* flag 1653 */
+#define DEF_1654(a, b) (((a) << 11) | ((b) & 0x676))
+#define DEF_1655 0x677u /* flag 1655 */
+#define DEF_1656(a, b) (((a) << 13) | ((b) & 0x678))
+#define DEF_1657 0x679u /* flag 1657 */
+#define DEF_1658(a, b) (((a) << 15) | ((b) & 0x67a))
+#define DEF_1659 0x67bu /* flag 1659 */
+#define DEF_1660(a, b) (((a) << 17) | ((b) & 0x67c))
+#define DEF_1661 0x67du /* flag 1661 */
+#define DEF_1662(a, b) (((a) << 19) | ((b) & 0x67e))
+#define DEF_1663 0x67fu /* flag 1663 */
+#define DEF_1664(a, b) (((a) << 21) | ((b) & 0x680))
+#define DEF_1665 0x681u /* flag 1665 */
+#define DEF_1666(a, b) (((a) << 23) | ((b) & 0x682))
+#define DEF_1667 0x683u /* flag 1667 */
+#define DEF_1668(a, b) (((a) << 25) | ((b) & 0x684))
+#define DEF_1669 0x685u /* flag 1669 */
+#define DEF_1670(a, b) (((a) << 27) | ((b) & 0x686))
+#define DEF_1671 0x687u /* flag 1671 */
+#define DEF_1672(a, b) (((a) << 29) | ((b) & 0x688))
+#define DEF_1673 0x689u /* flag 1673 */
+#define DEF_1674(a, b) (((a) << 0) | ((b) & 0x68a))
+#define DEF_1675 0x68bu /* flag 1675 */
+#define DEF_1676(a, b) (((a) << 2) | ((b) & 0x68c))
+#define DEF_1677 0x68du /* flag 1677 */
+#define DEF_1678(a, b) (((a) << 4) | ((b) & 0x68e))
+#define DEF_1679 0x68fu /* flag 1679 */
+#define DEF_1680(a, b) (((a) << 6) | ((b) & 0x690))
+#define DEF_1681 0x691u /* flag 1681 */
+#define DEF_1682(a, b) (((a) << 8) | ((b) & 0x692))
+#define DEF_1683 0x693u /* flag 1683 */
+#define DEF_1684(a, b) (((a) << 10) | ((b) & 0x694))
+#define DEF_1685 0x695u /* flag 1685 */
+#define DEF_1686(a, b) (((a) << 12) | ((b) & 0x696))
+#define DEF_1687 0x697u /* flag 1687 */
+#define DEF_1688(a, b) (((a) << 14) | ((b) & 0x698))
+#define DEF_1689 0x699u /* flag 1689 */
+#define DEF_1690(a, b) (((a) << 16) | ((b) & 0x69a))
+#define DEF_1691 0x69bu /* flag 1691 */
+#define DEF_1692(a, b) (((a) << 18) | ((b) & 0x69c))
+#define DEF_1693 0x69du /* flag 1693 */
+#define DEF_1694(a, b) (((a) << 20) | ((b) & 0x69e))
+#define DEF_1695 0x69fu /* flag 1695 */
+#define DEF_1696(a, b) (((a) << 22) | ((b) & 0x6a0))
+#define DEF_1697 0x6a1u /* flag 1697 */
+#define DEF_1698(a, b) (((a) << 24) | ((b) & 0x6a2))
+#define DEF_1699 0x6a3u /* flag 1699 */
+#define DEF_1700(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1700); })
+#define DEF_1701 0x6a5u /* flag 1701 */
+#define DEF_1702(a, b) (((a) << 28) | ((b) & 0x6a6))
+#define DEF_1703 0x6a7u /* flag 1703 */
+#define DEF_1704(a, b) (((a) << 30) | ((b) & 0x6a8))
+#define DEF_1705 0x6a9u /* flag 1705 */
+#define DEF_1706(a, b) (((a) << 1) | ((b) & 0x6aa))
+#define DEF_1707 0x6abu /* flag 1707 */
+#define DEF_1708(a, b) (((a) << 3) | ((b) & 0x6ac))
+#define DEF_1709 0x6adu /* flag 1709 */
+#define DEF_1710(a, b) (((a) << 5) | ((b) & 0x6ae))
+#define DEF_1711 0x6afu /* flag 1711 */
+#define DEF_1712(a, b) (((a) << 7) | ((b) & 0x6b0))
+#define DEF_1713 0x6b1u /* flag 1713 */
+#define DEF_1714(a, b) (((a) << 9) | ((b) & 0x6b2))
+#define DEF_1715 0x6b3u /* flag 1715 */
+#define DEF_1716(a, b) (((a) << 11) | ((b) & 0x6b4))
+#define DEF_1717 0x6b5u /* flag 1717 */
+#define DEF_1718(a, b) (((a) << 13) | ((b) & 0x6b6))
+#define DEF_1719 0x6b7u /* flag 1719 */
+#define DEF_1720(a, b) (((a) << 15) | ((b) & 0x6b8))
+#define DEF_1721 0x6b9u /* flag 1721 */
+#define DEF_1722(a, b) (((a) << 17) | ((b) & 0x6ba))
+#define DEF_1723 0x6bbu /* flag 1723 */
+#define DEF_1724(a, b) (((a) << 19) | ((b) & 0x6bc))
+#define DEF_1725 0x6bdu /* flag 1725 */
+#define DEF_1726(a, b) (((a) << 21) | ((b) & 0x6be))
+#define DEF_1727 0x6bfu /* flag 1727 */
+#define DEF_1728(a, b) (((a) << 23) | ((b) & 0x6c0))
+#define DEF_1729 0x6c1u /* flag 1729 */
+#define DEF_1730(a, b) (((a) << 25) | ((b) & 0x6c2))
+#define DEF_1731 0x6c3u /* flag 1731 */
+#define DEF_1732(a, b) (((a) << 27) | ((b) & 0x6c4))
+#define DEF_1733 0x6c5u /* flag 1733 */
+#define DEF_1734(a, b) (((a) << 29) | ((b) & 0x6c6))
+#define DEF_1735 0x6c7u /* flag 1735 */
+#define DEF_1736(a, b) (((a) << 0) | ((b) & 0x6c8))
+#define DEF_1737 0x6c9u /* flag 1737 */
+#define DEF_1738(a, b) (((a) << 2) | ((b) & 0x6ca))
+#define DEF_1739 0x6cbu /* flag 1739 */
+#define DEF_1740(a, b) (((a) << 4) | ((b) & 0x6cc))
+#define DEF_1741 0x6cdu /* flag 1741 */
+#define DEF_1742(a, b) (((a) << 6) | ((b) & 0x6ce))
+#define DEF_1743 0x6cfu /* flag 1743 */
+#define DEF_1744(a, b) (((a) << 8) | ((b) & 0x6d0))
+#define DEF_1745 0x6d1u /* flag 1745 */
+#define DEF_1746(a, b) (((a) << 10) | ((b) & 0x6d2))
+#define DEF_1747 0x6d3u /* flag 1747 */
+#define DEF_1748(a, b) (((a) << 12) | ((b) & 0x6d4))
+#define DEF_1749 0x6d5u /* flag 1749 */
+#define DEF_1750(a, b) (((a) << 14) | ((b) & 0x6d6))
+#define DEF_1751 0x6d7u /* flag 1751 */
+#define DEF_1752(a, b) (((a) << 16) | ((b) & 0x6d8))
+#define DEF_1753 0x6d9u /* flag 1753 */
+#define DEF_1754(a, b) (((a) << 18) | ((b) & 0x6da))
+#define DEF_1755 0x6dbu /* flag 1755 */
+#define DEF_1756(a, b) (((a) << 20) | ((b) & 0x6dc))
+#define DEF_1757 0x6ddu /* flag 1757 */
+#define DEF_1758(a, b) (((a) << 22) | ((b) & 0x6de))
+#define DEF_1759 0x6dfu /* flag 1759 */
+#define DEF_1760(a, b) (((a) << 24) | ((b) & 0x6e0))
+#define DEF_1761 0x6e1u /* flag 1761 */
+#define DEF_1762(a, b) (((a) << 26) | ((b) & 0x6e2))
+#define DEF_1763 0x6e3u /* flag 1763 */
+#define DEF_1764(a, b) (((a) << 28) | ((b) & 0x6e4))
+#define DEF_1765 0x6e5u /* flag 1765 */
+#define DEF_1766(a, b) (((a) << 30) | ((b) & 0x6e6))
+#define DEF_1767 0x6e7u /* flag 1767 */
+#define DEF_1768(a, b) (((a) << 1) | ((b) & 0x6e8))
+#define DEF_1769 0x6e9u /* flag 1769 */
+#define DEF_1770(a, b) (((a) << 3) | ((b) & 0x6ea))
+#define DEF_1771 0x6ebu /* flag 1771 */
+#define DEF_1772(a, b) (((a) << 5) | ((b) & 0x6ec))
+#define DEF_1773 0x6edu /* flag 1773 */
+#define DEF_1774(a, b) (((a) << 7) | ((b) & 0x6ee))
+#define DEF_1775 0x6efu /* flag 1775 */
+#define DEF_1776(a, b) (((a) << 9) | ((b) & 0x6f0))
+#define DEF_1777 0x6f1u /* flag 1777 */
+#define DEF_1778(a, b) (((a) << 11) | ((b) & 0x6f2))
+#define DEF_1779 0x6f3u /* flag 1779 */
+#define DEF_1780(a, b) (((a) << 13) | ((b) & 0x6f4))
+#define DEF_1781 0x6f5u /* flag 1781 */
+#define DEF_1782(a, b) (((a) << 15) | ((b) & 0x6f6))
+#define DEF_1783 0x6f7u /* flag 1783 */
+#define DEF_1784(a, b) (((a) << 17) | ((b) & 0x6f8))
+#define DEF_1785 0x6f9u /* flag 1785 */
+#define DEF_1786(a, b) (((a) << 19) | ((b) & 0x6fa))
+#define DEF_1787 0x6fbu /* flag 1787 */
+#define DEF_1788(a, b) (((a) << 21) | ((b) & 0x6fc))
+#define DEF_1789 0x6fdu /* flag 1789 */
+#define DEF_1790(a, b) (((a) << 23) | ((b) & 0x6fe))
+#define DEF_1791 0x6ffu /* flag 1791 */
+#define DEF_1792(a, b) (((a) << 25) | ((b) & 0x700))
+#define DEF_1793 0x701u /* flag 1793 */
+#define DEF_1794(a, b) (((a) << 27) | ((b) & 0x702))
+#define DEF_1795 0x703u /* flag 1795 */
+#define DEF_1796(a, b) (((a) << 29) | ((b) & 0x704))
+#define DEF_1797 0x705u /* flag 1797 */
+#define DEF_1798(a, b) (((a) << 0) | ((b) & 0x706))
+#define DEF_1799 0x707u /* flag 1799 */
+#define DEF_1800(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1800); })
+#define DEF_1801 0x709u /* flag 1801 */
+#define DEF_1802(a, b) (((a) << 4) | ((b) & 0x70a))
+#define DEF_1803 0x70bu /* flag 1803 */
+#define DEF_1804(a, b) (((a) << 6) | ((b) & 0x70c))
+#define DEF_1805 0x70du /* flag 1805 */
+#define DEF_1806(a, b) (((a) << 8) | ((b) & 0x70e))
+#define DEF_1807 0x70fu /* flag 1807 */
+#define DEF_1808(a, b) (((a) << 10) | ((b) & 0x710))
+#define DEF_1809 0x711u /* flag 1809 */
+#define DEF_1810(a, b) (((a) << 12) | ((b) & 0x712))
+#define DEF_1811 0x713u /* flag 1811 */
+#define DEF_1812(a, b) (((a) << 14) | ((b) & 0x714))
+#define DEF_1813 0x715u /* flag 1813 */
+#define DEF_1814(a, b) (((a) << 16) | ((b) & 0x716))
+#define DEF_1815 0x717u /* flag 1815 */
+#define DEF_1816(a, b) (((a) << 18) | ((b) & 0x718))
+#define DEF_1817 0x719u /* flag 1817 */
+#define DEF_1818(a, b) (((a) << 20) | ((b) & 0x71a))
+#define DEF_1819 0x71bu /* flag 1819 */
+#define DEF_1820(a, b) (((a) << 22) | ((b) & 0x71c))
+#define DEF_1821 0x71du /* flag 1821 */
+#define DEF_1822(a, b) (((a) << 24) | ((b) & 0x71e))
+#define DEF_1823 0x71fu /* flag 1823 */
+#define DEF_1824(a, b) (((a) << 26) | ((b) & 0x720))
+#define DEF_1825 0x721u /* flag 1825 */
+#define DEF_1826(a, b) (((a) << 28) | ((b) & 0x722))
+#define DEF_1827 0x723u /* flag 1827 */
+#define DEF_1828(a, b) (((a) << 30) | ((b) & 0x724))
+#define DEF_1829 0x725u /* flag 1829 */
+#define DEF_1830(a, b) (((a) << 1) | ((b) & 0x726))
+#define DEF_1831 0x727u /* flag 1831 */
+#define DEF_1832(a, b) (((a) << 3) | ((b) & 0x728))
+#define DEF_1833 0x729u /* flag 1833 */
+#define DEF_1834(a, b) (((a) << 5) | ((b) & 0x72a))
+#define DEF_1835 0x72bu /* flag 1835 */
+#define DEF_1836(a, b) (((a) << 7) | ((b) & 0x72c))
+#define DEF_1837 0x72du /* flag 1837 */
+#define DEF_1838(a, b) (((a) << 9) | ((b) & 0x72e))
+#define DEF_1839 0x72fu /* flag 1839 */
+#define DEF_1840(a, b) (((a) << 11) | ((b) & 0x730))
+#define DEF_1841 0x731u /* flag 1841 */
+#define DEF_1842(a, b) (((a) << 13) | ((b) & 0x732))
+#define DEF_1843 0x733u /* flag 1843 */
+#define DEF_1844(a, b) (((a) << 15) | ((b) & 0x734))
+#define DEF_1845 0x735u /* flag 1845 */
+#define DEF_1846(a, b) (((a) << 17) | ((b) & 0x736))
+#define DEF_1847 0x737u /* flag 1847 */
+#define DEF_1848(a, b) (((a) << 19) | ((b) & 0x738))
+#define DEF_1849 0x739u /* flag 1849 */
+#define DEF_1850(a, b) (((a) << 21) | ((b) & 0x73a))
+#define DEF_1851 0x73bu /* flag 1851 */
+#define DEF_1852(a, b) (((a) << 23) | ((b) & 0x73c))
+#define DEF_1853 0x73du /* flag 1853 */
+#define DEF_1854(a, b) (((a) << 25) | ((b) & 0x73e))
+#define DEF_1855 0x73fu /* flag 1855 */
+#define DEF_1856(a, b) (((a) << 27) | ((b) & 0x740))
+#define DEF_1857 0x741u /* flag 1857 */
+#define DEF_1858(a, b) (((a) << 29) | ((b) & 0x742))
+#define DEF_1859 0x743u /* flag 1859 */
+#define DEF_1860(a, b) (((a) << 0) | ((b) & 0x744))
+#define DEF_1861 0x745u /* flag 1861 */
+#define DEF_1862(a, b) (((a) << 2) | ((b) & 0x746))
+#define DEF_1863 0x747u /* flag 1863 */
+#define DEF_1864(a, b) (((a) << 4) | ((b) & 0x748))
+#define DEF_1865 0x749u /* flag 1865 */
+#define DEF_1866(a, b) (((a) << 6) | ((b) & 0x74a))
+#define DEF_1867 0x74bu /* flag 1867 */
+#define DEF_1868(a, b) (((a) << 8) | ((b) & 0x74c))
+#define DEF_1869 0x74du /* flag 1869 */
+#define DEF_1870(a, b) (((a) << 10) | ((b) & 0x74e))
+#define DEF_1871 0x74fu /* flag 1871 */
+#define DEF_1872(a, b) (((a) << 12) | ((b) & 0x750))
+#define DEF_1873 0x751u /* flag 1873 */
+#define DEF_1874(a, b) (((a) << 14) | ((b) & 0x752))
+#define DEF_1875 0x753u /* flag 1875 */
+#define DEF_1876(a, b) (((a) << 16) | ((b) & 0x754))
+#define DEF_1877 0x755u /* flag 1877 */
+#define DEF_1878(a, b) (((a) << 18) | ((b) & 0x756))
+#define DEF_1879 0x757u /* flag 1879 */
+#define DEF_1880(a, b) (((a) << 20) | ((b) & 0x758))
+#define DEF_1881 0x759u /* flag 1881 */
+#define DEF_1882(a, b) (((a) << 22) | ((b) & 0x75a))
+#define DEF_1883 0x75bu /* flag 1883 */
+#define DEF_1884(a, b) (((a) << 24) | ((b) & 0x75c))
+#define DEF_1885 0x75du /* flag 1885 */
+#define DEF_1886(a, b) (((a) << 26) | ((b) & 0x75e))
+#define DEF_1887 0x75fu /* flag 1887 */
+#define DEF_1888(a, b) (((a) << 28) | ((b) & 0x760))
+#define DEF_1889 0x761u /* flag 1889 */
+#define DEF_1890(a, b) (((a) << 30) | ((b) & 0x762))
+#define DEF_1891 0x763u /* flag 1891 */
+#define DEF_1892(a, b) (((a) << 1) | ((b) & 0x764))
+#define DEF_1893 0x765u /* flag 1893 */
+#define DEF_1894(a, b) (((a) << 3) | ((b) & 0x766))
+#define DEF_1895 0x767u /* flag 1895 */
+#define DEF_1896(a, b) (((a) << 5) | ((b) & 0x768))
+#define DEF_1897 0x769u /* flag 1897 */
+#define DEF_1898(a, b) (((a) << 7) | ((b) & 0x76a))
+#define DEF_1899 0x76bu /* flag 1899 */
+#define DEF_1900(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 1900); })
+#define DEF_1901 0x76du /* flag 1901 */
+#define DEF_1902(a, b) (((a) << 11) | ((b) & 0x76e))
+#define DEF_1903 0x76fu /* flag 1903 */
+#define DEF_1904(a, b) (((a) << 13) | ((b) & 0x770))
+#define DEF_1905 0x771u /* flag 1905 */
+#define DEF_1906(a, b) (((a) << 15) | ((b) & 0x772))
+#define DEF_1907 0x773u /* flag 1907 */
+#define DEF_1908(a, b) (((a) << 17) | ((b) & 0x774))
+#define DEF_1909 0x775u /* flag 1909 */
+#define DEF_1910(a, b) (((a) << 19) | ((b) & 0x776))
+#define DEF_1911 0x777u /* flag 1911 */
+#define DEF_1912(a, b) (((a) << 21) | ((b) & 0x778))
+#define DEF_1913 0x779u /* flag 1913 */
+#define DEF_1914(a, b) (((a) << 23) | ((b) & 0x77a))
+#define DEF_1915 0x77bu /* flag 1915 */
+#define DEF_1916(a, b) (((a) << 25) | ((b) & 0x77c))
+#define DEF_1917 0x77du /* flag 1917 */
+#define DEF_1918(a, b) (((a) << 27) | ((b) & 0x77e))
+#define DEF_1919 0x77fu /* flag 1919 */
+#define DEF_1920(a, b) (((a) << 29) | ((b) & 0x780))
+#define DEF_1921 0x781u /* flag 1921 */
+#define DEF_1922(a, b) (((a) << 0) | ((b) & 0x782))
+#define DEF_1923 0x783u /* flag 1923 */
+#define DEF_1924(a, b) (((a) << 2) | ((b) & 0x784))
+#define DEF_1925 0x785u /* flag 1925 */
+#define DEF_1926(a, b) (((a) << 4) | ((b) & 0x786))
+#define DEF_1927 0x787u /* flag 1927 */
+#define DEF_1928(a, b) (((a) << 6) | ((b) & 0x788))
+#define DEF_1929 0x789u /* flag 1929 */
+#define DEF_1930(a, b) (((a) << 8) | ((b) & 0x78a))
+#define DEF_1931 0x78bu /* flag 1931 */
+#define DEF_1932(a, b) (((a) << 10) | ((b) & 0x78c))
+#define DEF_1933 0x78du /* flag 1933 */
+#define DEF_1934(a, b) (((a) << 12) | ((b) & 0x78e))
+#define DEF_1935 0x78fu /* flag 1935 */
+#define DEF_1936(a, b) (((a) << 14) | ((b) & 0x790))
+#define DEF_1937 0x791u /* flag 1937 */
+#define DEF_1938(a, b) (((a) << 16) | ((b) & 0x792))
+#define DEF_1939 0x793u /* flag 1939 */
+#define DEF_1940(a, b) (((a) << 18) | ((b) & 0x794))
+#define DEF_1941 0x795u /* flag 1941 */
+#define DEF_1942(a, b) (((a) << 20) | ((b) & 0x796))
+#define DEF_1943 0x797u /* flag 1943 */
+#define DEF_1944(a, b) (((a) << 22) | ((b) & 0x798))
+#define DEF_1945 0x799u /* flag 1945 */
+#define DEF_1946(a, b) (((a) << 24) | ((b) & 0x79a))
+#define DEF_1947 0x79bu /* flag 1947 */
+#define DEF_1948(a, b) (((a) << 26) | ((b) & 0x79c))
+#define DEF_1949 0x79du /* flag 1949 */
+#define DEF_1950(a, b) (((a) << 28) | ((b) & 0x79e))
+#define DEF_1951 0x79fu /* flag 1951 */
+#define DEF_1952(a, b) (((a) << 30) | ((b) & 0x7a0))
+#define DEF_1953 0x7a1u /* flag 1953 */
+#define DEF_1954(a, b) (((a) << 1) | ((b) & 0x7a2))
+#define DEF_1955 0x7a3u /* flag 1955 */
+#define DEF_1956(a, b) (((a) << 3) | ((b) & 0x7a4))
+#define DEF_1957 0x7a5u /* flag 1957 */
+#define DEF_1958(a, b) (((a) << 5) | ((b) & 0x7a6))
+#define DEF_1959 0x7a7u /* flag 1959 */
+#define DEF_1960(a, b) (((a) << 7) | ((b) & 0x7a8))
+#define DEF_1961 0x7a9u /* flag 1961 */
+#define DEF_1962(a, b) (((a) << 9) | ((b) & 0x7aa))
+#define DEF_1963 0x7abu /* flag 1963 */
+#define DEF_1964(a, b) (((a) << 11) | ((b) & 0x7ac))
+#define DEF_1965 0x7adu /* flag 1965 */
+#define DEF_1966(a, b) (((a) << 13) | ((b) & 0x7ae))
+#define DEF_1967 0x7afu /* flag 1967 */
+#define DEF_1968(a, b) (((a) << 15) | ((b) & 0x7b0))
+#define DEF_1969 0x7b1u /* flag 1969 */
+#define DEF_1970(a, b) (((a) << 17) | ((b) & 0x7b2))
+#define DEF_1971 0x7b3u /* flag 1971 */
+#define DEF_1972(a, b) (((a) << 19) | ((b) & 0x7b4))
+#define DEF_1973 0x7b5u /* flag 1973 */
+#define DEF_1974(a, b) (((a) << 21) | ((b) & 0x7b6))
+#define DEF_1975 0x7b7u /* flag 1975 */
+#define DEF_1976(a, b) (((a) << 23) | ((b) & 0x7b8))
+#define DEF_1977 0x7b9u /* flag 1977 */
+#define DEF_1978(a, b) (((a) << 25) | ((b) & 0x7ba))
+#define DEF_1979 0x7bbu /* flag 1979 */
+#define DEF_1980(a, b) (((a) << 27) | ((b) & 0x7bc))
+#define DEF_1981 0x7bdu /* flag 1981 */
+#define DEF_1982(a, b) (((a) << 29) | ((b) & 0x7be))
+#define DEF_1983 0x7bfu /* flag 1983 */
+#define DEF_1984(a, b) (((a) << 0) | ((b) & 0x7c0))
+#define DEF_1985 0x7c1u /* flag 1985 */
+#define DEF_1986(a, b) (((a) << 2) | ((b) & 0x7c2))
+#define DEF_1987 0x7c3u /* flag 1987 */
+#define DEF_1988(a, b) (((a) << 4) | ((b) & 0x7c4))
+#define DEF_1989 0x7c5u /* flag 1989 */
+#define DEF_1990(a, b) (((a) << 6) | ((b) & 0x7c6))
+#define DEF_1991 0x7c7u /* flag 1991 */
+#define DEF_1992(a, b) (((a) << 8) | ((b) & 0x7c8))
+#define DEF_1993 0x7c9u /* flag 1993 */
+#define DEF_1994(a, b) (((a) << 10) | ((b) & 0x7ca))
+#define DEF_1995 0x7cbu /* flag 1995 */
+#define DEF_1996(a, b) (((a) << 12) | ((b) & 0x7cc))
+#define DEF_1997 0x7cdu /* flag 1997 */
+#define DEF_1998(a, b) (((a) << 14) | ((b) & 0x7ce))
+#define DEF_1999 0x7cfu /* flag 1999 */
+#define DEF_2000(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2000); })
+#define DEF_2001 0x7d1u /* flag 2001 */
+#define DEF_2002(a, b) (((a) << 18) | ((b) & 0x7d2))
+#define DEF_2003 0x7d3u /* flag 2003 */
+#define DEF_2004(a, b) (((a) << 20) | ((b) & 0x7d4))
+#define DEF_2005 0x7d5u /* flag 2005 */
+#define DEF_2006(a, b) (((a) << 22) | ((b) & 0x7d6))
+#define DEF_2007 0x7d7u /* flag 2007 */
+#define DEF_2008(a, b) (((a) << 24) | ((b) & 0x7d8))
+#define DEF_2009 0x7d9u /* flag 2009 */
+#define DEF_2010(a, b) (((a) << 26) | ((b) & 0x7da))
+#define DEF_2011 0x7dbu /* flag 2011 */
+#define DEF_2012(a, b) (((a) << 28) | ((b) & 0x7dc))
+#define DEF_2013 0x7ddu /* flag 2013 */
+#define DEF_2014(a, b) (((a) << 30) | ((b) & 0x7de))
+#define DEF_2015 0x7dfu /* flag 2015 */
+#define DEF_2016(a, b) (((a) << 1) | ((b) & 0x7e0))
+#define DEF_2017 0x7e1u /* flag 2017 */
+#define DEF_2018(a, b) (((a) << 3) | ((b) & 0x7e2))
+#define DEF_2019 0x7e3u /* flag 2019 */
+#define DEF_2020(a, b) (((a) << 5) | ((b) & 0x7e4))
+#define DEF_2021 0x7e5u /* flag 2021 */
+#define DEF_2022(a, b) (((a) << 7) | ((b) & 0x7e6))
+#define DEF_2023 0x7e7u /* flag 2023 */
+#define DEF_2024(a, b) (((a) << 9) | ((b) & 0x7e8))
+#define DEF_2025 0x7e9u /* flag 2025 */
+#define DEF_2026(a, b) (((a) << 11) | ((b) & 0x7ea))
+#define DEF_2027 0x7ebu /* flag 2027 */
+#define DEF_2028(a, b) (((a) << 13) | ((b) & 0x7ec))
+#define DEF_2029 0x7edu /* flag 2029 */
+#define DEF_2030(a, b) (((a) << 15) | ((b) & 0x7ee))
+#define DEF_2031 0x7efu /* flag 2031 */
+#define DEF_2032(a, b) (((a) << 17) | ((b) & 0x7f0))
+#define DEF_2033 0x7f1u /* flag 2033 */
+#define DEF_2034(a, b) (((a) << 19) | ((b) & 0x7f2))
+#define DEF_2035 0x7f3u /* flag 2035 */
+#define DEF_2036(a, b) (((a) << 21) | ((b) & 0x7f4))
+#define DEF_2037 0x7f5u /* flag 2037 */
+#define DEF_2038(a, b) (((a) << 23) | ((b) & 0x7f6))
+#define DEF_2039 0x7f7u /* flag 2039 */
+#define DEF_2040(a, b) (((a) << 25) | ((b) & 0x7f8))
+#define DEF_2041 0x7f9u /* flag 2041 */
+#define DEF_2042(a, b) (((a) << 27) | ((b) & 0x7fa))
+#define DEF_2043 0x7fbu /* flag 2043 */
+#define DEF_2044(a, b) (((a) << 29) | ((b) & 0x7fc))
+#define DEF_2045 0x7fdu /* flag 2045 */
+#define DEF_2046(a, b) (((a) << 0) | ((b) & 0x7fe))
+#define DEF_2047 0x7ffu /* flag 2047 */
+#define DEF_2048(a, b) (((a) << 2) | ((b) & 0x800))
+#define DEF_2049 0x801u /* flag 2049 */
+#define DEF_2050(a, b) (((a) << 4) | ((b) & 0x802))
+#define DEF_2051 0x803u /* flag 2051 */
+#define DEF_2052(a, b) (((a) << 6) | ((b) & 0x804))
+#define DEF_2053 0x805u /* flag 2053 */
+#define DEF_2054(a, b) (((a) << 8) | ((b) & 0x806))
+#define DEF_2055 0x807u /* flag 2055 */
+#define DEF_2056(a, b) (((a) << 10) | ((b) & 0x808))
+#define DEF_2057 0x809u /* flag 2057 */
+#define DEF_2058(a, b) (((a) << 12) | ((b) & 0x80a))
+#define DEF_2059 0x80bu /* flag 2059 */
+#define DEF_2060(a, b) (((a) << 14) | ((b) & 0x80c))
+#define DEF_2061 0x80du /* flag 2061 */
+#define DEF_2062(a, b) (((a) << 16) | ((b) & 0x80e))
+#define DEF_2063 0x80fu /* flag 2063 */
+#define DEF_2064(a, b) (((a) << 18) | ((b) & 0x810))
+#define DEF_2065 0x811u /* flag 2065 */
+#define DEF_2066(a, b) (((a) << 20) | ((b) & 0x812))
+#define DEF_2067 0x813u /* flag 2067 */
+#define DEF_2068(a, b) (((a) << 22) | ((b) & 0x814))
+#define DEF_2069 0x815u /* flag 2069 */
+#define DEF_2070(a, b) (((a) << 24) | ((b) & 0x816))
+#define DEF_2071 0x817u /* flag 2071 */
+#define DEF_2072(a, b) (((a) << 26) | ((b) & 0x818))
+#define DEF_2073 0x819u /* flag 2073 */
+#define DEF_2074(a, b) (((a) << 28) | ((b) & 0x81a))
+#define DEF_2075 0x81bu /* flag 2075 */
+#define DEF_2076(a, b) (((a) << 30) | ((b) & 0x81c))
+#define DEF_2077 0x81du /* flag 2077 */
+#define DEF_2078(a, b) (((a) << 1) | ((b) & 0x81e))
+#define DEF_2079 0x81fu /* flag 2079 */
+#define DEF_2080(a, b) (((a) << 3) | ((b) & 0x820))
+#define DEF_2081 0x821u /* flag 2081 */
+#define DEF_2082(a, b) (((a) << 5) | ((b) & 0x822))
+#define DEF_2083 0x823u /* flag 2083 */
+#define DEF_2084(a, b) (((a) << 7) | ((b) & 0x824))
+#define DEF_2085 0x825u /* flag 2085 */
+#define DEF_2086(a, b) (((a) << 9) | ((b) & 0x826))
+#define DEF_2087 0x827u /* flag 2087 */
+#define DEF_2088(a, b) (((a) << 11) | ((b) & 0x828))
+#define DEF_2089 0x829u /* flag 2089 */
+#define DEF_2090(a, b) (((a) << 13) | ((b) & 0x82a))
+#define DEF_2091 0x82bu /* flag 2091 */
+#define DEF_2092(a, b) (((a) << 15) | ((b) & 0x82c))
+#define DEF_2093 0x82du /* flag 2093 */
+#define DEF_2094(a, b) (((a) << 17) | ((b) & 0x82e))
+#define DEF_2095 0x82fu /* flag 2095 */
+#define DEF_2096(a, b) (((a) << 19) | ((b) & 0x830))
+#define DEF_2097 0x831u /* flag 2097 */
+#define DEF_2098(a, b) (((a) << 21) | ((b) & 0x832))
+#define DEF_2099 0x833u /* flag 2099 */
+#define DEF_2100(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2100); })
+#define DEF_2101 0x835u /* flag 2101 */
+#define DEF_2102(a, b) (((a) << 25) | ((b) & 0x836))
+#define DEF_2103 0x837u /* flag 2103 */
+#define DEF_2104(a, b) (((a) << 27) | ((b) & 0x838))
+#define DEF_2105 0x839u /* flag 2105 */
+#define DEF_2106(a, b) (((a) << 29) | ((b) & 0x83a))
+#define DEF_2107 0x83bu /* flag 2107 */
+#define DEF_2108(a, b) (((a) << 0) | ((b) & 0x83c))
+#define DEF_2109 0x83du /* flag 2109 */
+#define DEF_2110(a, b) (((a) << 2) | ((b) & 0x83e))
+#define DEF_2111 0x83fu /* flag 2111 */
+#define DEF_2112(a, b) (((a) << 4) | ((b) & 0x840))
+#define DEF_2113 0x841u /* flag 2113 */
+#define DEF_2114(a, b) (((a) << 6) | ((b) & 0x842))
+#define DEF_2115 0x843u /* flag 2115 */
+#define DEF_2116(a, b) (((a) << 8) | ((b) & 0x844))
+#define DEF_2117 0x845u /* flag 2117 */
+#define DEF_2118(a, b) (((a) << 10) | ((b) & 0x846))
+#define DEF_2119 0x847u /* flag 2119 */
+#define DEF_2120(a, b) (((a) << 12) | ((b) & 0x848))
+#define DEF_2121 0x849u /* flag 2121 */
+#define DEF_2122(a, b) (((a) << 14) | ((b) & 0x84a))
+#define DEF_2123 0x84bu /* flag 2123 */
+#define DEF_2124(a, b) (((a) << 16) | ((b) & 0x84c))
+#define DEF_2125 0x84du /* flag 2125 */
+#define DEF_2126(a, b) (((a) << 18) | ((b) & 0x84e))
+#define DEF_2127 0x84fu /* flag 2127 */
+#define DEF_2128(a, b) (((a) << 20) | ((b) & 0x850))
+#define DEF_2129 0x851u /* flag 2129 */
+#define DEF_2130(a, b) (((a) << 22) | ((b) & 0x852))
+#define DEF_2131 0x853u /* flag 2131 */
+#define DEF_2132(a, b) (((a) << 24) | ((b) & 0x854))
+#define DEF_2133 0x855u /* flag 2133 */
+#define DEF_2134(a, b) (((a) << 26) | ((b) & 0x856))
+#define DEF_2135 0x857u /* flag 2135 */
+#define DEF_2136(a, b) (((a) << 28) | ((b) & 0x858))
+#define DEF_2137 0x859u /* flag 2137 */
+#define DEF_2138(a, b) (((a) << 30) | ((b) & 0x85a))
+#define DEF_2139 0x85bu /* flag 2139 */
+#define DEF_2140(a, b) (((a) << 1) | ((b) & 0x85c))
+#define DEF_2141 0x85du /* flag 2141 */
+#define DEF_2142(a, b) (((a) << 3) | ((b) & 0x85e))
+#define DEF_2143 0x85fu /* flag 2143 */
+#define DEF_2144(a, b) (((a) << 5) | ((b) & 0x860))
+#define DEF_2145 0x861u /* flag 2145 */
+#define DEF_2146(a, b) (((a) << 7) | ((b) & 0x862))
+#define DEF_2147 0x863u /* flag 2147 */
+#define DEF_2148(a, b) (((a) << 9) | ((b) & 0x864))
+#define DEF_2149 0x865u /* flag 2149 */
+#define DEF_2150(a, b) (((a) << 11) | ((b) & 0x866))
+#define DEF_2151 0x867u /* flag 2151 */
+#define DEF_2152(a, b) (((a) << 13) | ((b) & 0x868))
+#define DEF_2153 0x869u /* flag 2153 */
+#define DEF_2154(a, b) (((a) << 15) | ((b) & 0x86a))
+#define DEF_2155 0x86bu /* flag 2155 */
+#define DEF_2156(a, b) (((a) << 17) | ((b) & 0x86c))
+#define DEF_2157 0x86du /* flag 2157 */
+#define DEF_2158(a, b) (((a) << 19) | ((b) & 0x86e))
+#define DEF_2159 0x86fu /* flag 2159 */
+#define DEF_2160(a, b) (((a) << 21) | ((b) & 0x870))
+#define DEF_2161 0x871u /* flag 2161 */
+#define DEF_2162(a, b) (((a) << 23) | ((b) & 0x872))
+#define DEF_2163 0x873u /* flag 2163 */
+#define DEF_2164(a, b) (((a) << 25) | ((b) & 0x874))
+#define DEF_2165 0x875u /* flag 2165 */
+#define DEF_2166(a, b) (((a) << 27) | ((b) & 0x876))
+#define DEF_2167 0x877u /* flag 2167 */
+#define DEF_2168(a, b) (((a) << 29) | ((b) & 0x878))
+#define DEF_2169 0x879u /* flag 2169 */
+#define DEF_2170(a, b) (((a) << 0) | ((b) & 0x87a))
+#define DEF_2171 0x87bu /* flag 2171 */
+#define DEF_2172(a, b) (((a) << 2) | ((b) & 0x87c))
+#define DEF_2173 0x87du /* flag 2173 */
+#define DEF_2174(a, b) (((a) << 4) | ((b) & 0x87e))
+#define DEF_2175 0x87fu /* flag 2175 */
+#define DEF_2176(a, b) (((a) << 6) | ((b) & 0x880))
+#define DEF_2177 0x881u /* flag 2177 */
+#define DEF_2178(a, b) (((a) << 8) | ((b) & 0x882))
+#define DEF_2179 0x883u /* flag 2179 */
+#define DEF_2180(a, b) (((a) << 10) | ((b) & 0x884))
+#define DEF_2181 0x885u /* flag 2181 */
+#define DEF_2182(a, b) (((a) << 12) | ((b) & 0x886))
+#define DEF_2183 0x887u /* flag 2183 */
+#define DEF_2184(a, b) (((a) << 14) | ((b) & 0x888))
+#define DEF_2185 0x889u /* flag 2185 */
+#define DEF_2186(a, b) (((a) << 16) | ((b) & 0x88a))
+#define DEF_2187 0x88bu /* flag 2187 */
+#define DEF_2188(a, b) (((a) << 18) | ((b) & 0x88c))
+#define DEF_2189 0x88du /* flag 2189 */
+#define DEF_2190(a, b) (((a) << 20) | ((b) & 0x88e))
+#define DEF_2191 0x88fu /* flag 2191 */
+#define DEF_2192(a, b) (((a) << 22) | ((b) & 0x890))
+#define DEF_2193 0x891u /* flag 2193 */
+#define DEF_2194(a, b) (((a) << 24) | ((b) & 0x892))
+#define DEF_2195 0x893u /* flag 2195 */
+#define DEF_2196(a, b) (((a) << 26) | ((b) & 0x894))
+#define DEF_2197 0x895u /* flag 2197 */
+#define DEF_2198(a, b) (((a) << 28) | ((b) & 0x896))
+#define DEF_2199 0x897u /* flag 2199 */
+#define DEF_2200(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2200); })
+#define DEF_2201 0x899u /* flag 2201 */
+#define DEF_2202(a, b) (((a) << 1) | ((b) & 0x89a))
+#define DEF_2203 0x89bu /* flag 2203 */
+#define DEF_2204(a, b) (((a) << 3) | ((b) & 0x89c))
+#define DEF_2205 0x89du /* flag 2205 */
+#define DEF_2206(a, b) (((a) << 5) | ((b) & 0x89e))
+#define DEF_2207 0x89fu /* flag 2207 */
+#define DEF_2208(a, b) (((a) << 7) | ((b) & 0x8a0))
+#define DEF_2209 0x8a1u /* flag 2209 */
+#define DEF_2210(a, b) (((a) << 9) | ((b) & 0x8a2))
+#define DEF_2211 0x8a3u /* flag 2211 */
+#define DEF_2212(a, b) (((a) << 11) | ((b) & 0x8a4))
+#define DEF_2213 0x8a5u /* flag 2213 */
+#define DEF_2214(a, b) (((a) << 13) | ((b) & 0x8a6))
+#define DEF_2215 0x8a7u /* flag 2215 */
+#define DEF_2216(a, b) (((a) << 15) | ((b) & 0x8a8))
+#define DEF_2217 0x8a9u /* flag 2217 */
+#define DEF_2218(a, b) (((a) << 17) | ((b) & 0x8aa))
+#define DEF_2219 0x8abu /* flag 2219 */
+#define DEF_2220(a, b) (((a) << 19) | ((b) & 0x8ac))
+#define DEF_2221 0x8adu /* flag 2221 */
+#define DEF_2222(a, b) (((a) << 21) | ((b) & 0x8ae))
+#define DEF_2223 0x8afu /* flag 2223 */
+#define DEF_2224(a, b) (((a) << 23) | ((b) & 0x8b0))
+#define DEF_2225 0x8b1u /* flag 2225 */
+#define DEF_2226(a, b) (((a) << 25) | ((b) & 0x8b2))
+#define DEF_2227 0x8b3u /* flag 2227 */
+#define DEF_2228(a, b) (((a) << 27) | ((b) & 0x8b4))
+#define DEF_2229 0x8b5u /* flag 2229 */
+#define DEF_2230(a, b) (((a) << 29) | ((b) & 0x8b6))
+#define DEF_2231 0x8b7u /* flag 2231 */
+#define DEF_2232(a, b) (((a) << 0) | ((b) & 0x8b8))
+#define DEF_2233 0x8b9u /* flag 2233 */
+#define DEF_2234(a, b) (((a) << 2) | ((b) & 0x8ba))
+#define DEF_2235 0x8bbu /* flag 2235 */
+#define DEF_2236(a, b) (((a) << 4) | ((b) & 0x8bc))
+#define DEF_2237 0x8bdu /* flag 2237 */
+#define DEF_2238(a, b) (((a) << 6) | ((b) & 0x8be))
+#define DEF_2239 0x8bfu /* flag 2239 */
+#define DEF_2240(a, b) (((a) << 8) | ((b) & 0x8c0))
+#define DEF_2241 0x8c1u /* flag 2241 */
+#define DEF_2242(a, b) (((a) << 10) | ((b) & 0x8c2))
+#define DEF_2243 0x8c3u /* flag 2243 */
+#define DEF_2244(a, b) (((a) << 12) | ((b) & 0x8c4))
+#define DEF_2245 0x8c5u /* flag 2245 */
+#define DEF_2246(a, b) (((a) << 14) | ((b) & 0x8c6))
+#define DEF_2247 0x8c7u /* flag 2247 */
+#define DEF_2248(a, b) (((a) << 16) | ((b) & 0x8c8))
+#define DEF_2249 0x8c9u /* flag 2249 */
+#define DEF_2250(a, b) (((a) << 18) | ((b) & 0x8ca))
+#define DEF_2251 0x8cbu /* flag 2251 */
+#define DEF_2252(a, b) (((a) << 20) | ((b) & 0x8cc))
+#define DEF_2253 0x8cdu /* flag 2253 */
+#define DEF_2254(a, b) (((a) << 22) | ((b) & 0x8ce))
+#define DEF_2255 0x8cfu /* flag 2255 */
+#define DEF_2256(a, b) (((a) << 24) | ((b) & 0x8d0))
+#define DEF_2257 0x8d1u /* flag 2257 */
+#define DEF_2258(a, b) (((a) << 26) | ((b) & 0x8d2))
+#define DEF_2259 0x8d3u /* flag 2259 */
+#define DEF_2260(a, b) (((a) << 28) | ((b) & 0x8d4))
+#define DEF_2261 0x8d5u /* flag 2261 */
+#define DEF_2262(a, b) (((a) << 30) | ((b) & 0x8d6))
+#define DEF_2263 0x8d7u /* flag 2263 */
+#define DEF_2264(a, b) (((a) << 1) | ((b) & 0x8d8))
+#define DEF_2265 0x8d9u /* flag 2265 */
+#define DEF_2266(a, b) (((a) << 3) | ((b) & 0x8da))
+#define DEF_2267 0x8dbu /* flag 2267 */
+#define DEF_2268(a, b) (((a) << 5) | ((b) & 0x8dc))
+#define DEF_2269 0x8ddu /* flag 2269 */
+#define DEF_2270(a, b) (((a) << 7) | ((b) & 0x8de))
+#define DEF_2271 0x8dfu /* flag 2271 */
+#define DEF_2272(a, b) (((a) << 9) | ((b) & 0x8e0))
+#define DEF_2273 0x8e1u /* flag 2273 */
+#define DEF_2274(a, b) (((a) << 11) | ((b) & 0x8e2))
+#define DEF_2275 0x8e3u /* flag 2275 */
+#define DEF_2276(a, b) (((a) << 13) | ((b) & 0x8e4))
+#define DEF_2277 0x8e5u /* flag 2277 */
+#define DEF_2278(a, b) (((a) << 15) | ((b) & 0x8e6))
+#define DEF_2279 0x8e7u /* flag 2279 */
+#define DEF_2280(a, b) (((a) << 17) | ((b) & 0x8e8))
+#define DEF_2281 0x8e9u /* flag 2281 */
+#define DEF_2282(a, b) (((a) << 19) | ((b) & 0x8ea))
+#define DEF_2283 0x8ebu /* flag 2283 */
+#define DEF_2284(a, b) (((a) << 21) | ((b) & 0x8ec))
+#define DEF_2285 0x8edu /* flag 2285 */
+#define DEF_2286(a, b) (((a) << 23) | ((b) & 0x8ee))
+#define DEF_2287 0x8efu /* flag 2287 */
+#define DEF_2288(a, b) (((a) << 25) | ((b) & 0x8f0))
+#define DEF_2289 0x8f1u /* flag 2289 */
+#define DEF_2290(a, b) (((a) << 27) | ((b) & 0x8f2))
+#define DEF_2291 0x8f3u /* flag 2291 */
+#define DEF_2292(a, b) (((a) << 29) | ((b) & 0x8f4))
+#define DEF_2293 0x8f5u /* flag 2293 */
+#define DEF_2294(a, b) (((a) << 0) | ((b) & 0x8f6))
+#define DEF_2295 0x8f7u /* flag 2295 */
+#define DEF_2296(a, b) (((a) << 2) | ((b) & 0x8f8))
+#define DEF_2297 0x8f9u /* flag 2297 */
+#define DEF_2298(a, b) (((a) << 4) | ((b) & 0x8fa))
+#define DEF_2299 0x8fbu /* flag 2299 */
+#define DEF_2300(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2300); })
+#define DEF_2301 0x8fdu /* flag 2301 */
+#define DEF_2302(a, b) (((a) << 8) | ((b) & 0x8fe))
+#define DEF_2303 0x8ffu /* flag 2303 */
+#define DEF_2304(a, b) (((a) << 10) | ((b) & 0x900))
+#define DEF_2305 0x901u /* flag 2305 */
+#define DEF_2306(a, b) (((a) << 12) | ((b) & 0x902))
+#define DEF_2307 0x903u /* flag 2307 */
+#define DEF_2308(a, b) (((a) << 14) | ((b) & 0x904))
+#define DEF_2309 0x905u /* flag 2309 */
+#define DEF_2310(a, b) (((a) << 16) | ((b) & 0x906))
+#define DEF_2311 0x907u /* flag 2311 */
+#define DEF_2312(a, b) (((a) << 18) | ((b) & 0x908))
+#define DEF_2313 0x909u /* flag 2313 */
+#define DEF_2314(a, b) (((a) << 20) | ((b) & 0x90a))
+#define DEF_2315 0x90bu /* flag 2315 */
+#define DEF_2316(a, b) (((a) << 22) | ((b) & 0x90c))
+#define DEF_2317 0x90du /* flag 2317 */
+#define DEF_2318(a, b) (((a) << 24) | ((b) & 0x90e))
+#define DEF_2319 0x90fu /* flag 2319 */
+#define DEF_2320(a, b) (((a) << 26) | ((b) & 0x910))
+#define DEF_2321 0x911u /* flag 2321 */
+#define DEF_2322(a, b) (((a) << 28) | ((b) & 0x912))
+#define DEF_2323 0x913u /* flag 2323 */
+#define DEF_2324(a, b) (((a) << 30) | ((b) & 0x914))
+#define DEF_2325 0x915u /* flag 2325 */
+#define DEF_2326(a, b) (((a) << 1) | ((b) & 0x916))
+#define DEF_2327 0x917u /* flag 2327 */
+#define DEF_2328(a, b) (((a) << 3) | ((b) & 0x918))
+#define DEF_2329 0x919u /* flag 2329 */
+#define DEF_2330(a, b) (((a) << 5) | ((b) & 0x91a))
+#define DEF_2331 0x91bu /* flag 2331 */
+#define DEF_2332(a, b) (((a) << 7) | ((b) & 0x91c))
+#define DEF_2333 0x91du /* flag 2333 */
+#define DEF_2334(a, b) (((a) << 9) | ((b) & 0x91e))
+#define DEF_2335 0x91fu /* flag 2335 */
+#define DEF_2336(a, b) (((a) << 11) | ((b) & 0x920))
+#define DEF_2337 0x921u /* flag 2337 */
+#define DEF_2338(a, b) (((a) << 13) | ((b) & 0x922))
+#define DEF_2339 0x923u /* flag 2339 */
+#define DEF_2340(a, b) (((a) << 15) | ((b) & 0x924))
+#define DEF_2341 0x925u /* flag 2341 */
+#define DEF_2342(a, b) (((a) << 17) | ((b) & 0x926))
+#define DEF_2343 0x927u /* flag 2343 */
+#define DEF_2344(a, b) (((a) << 19) | ((b) & 0x928))
+#define DEF_2345 0x929u /* flag 2345 */
+#define DEF_2346(a, b) (((a) << 21) | ((b) & 0x92a))
+#define DEF_2347 0x92bu /* flag 2347 */
+#define DEF_2348(a, b) (((a) << 23) | ((b) & 0x92c))
+#define DEF_2349 0x92du /* flag 2349 */
+#define DEF_2350(a, b) (((a) << 25) | ((b) & 0x92e))
+#define DEF_2351 0x92fu /* flag 2351 */
+#define DEF_2352(a, b) (((a) << 27) | ((b) & 0x930))
+#define DEF_2353 0x931u /* flag 2353 */
+#define DEF_2354(a, b) (((a) << 29) | ((b) & 0x932))
+#define DEF_2355 0x933u /* flag 2355 */
+#define DEF_2356(a, b) (((a) << 0) | ((b) & 0x934))
+#define DEF_2357 0x935u /* flag 2357 */
+#define DEF_2358(a, b) (((a) << 2) | ((b) & 0x936))
+#define DEF_2359 0x937u /* flag 2359 */
+#define DEF_2360(a, b) (((a) << 4) | ((b) & 0x938))
+#define DEF_2361 0x939u /* flag 2361 */
+#define DEF_2362(a, b) (((a) << 6) | ((b) & 0x93a))
+#define DEF_2363 0x93bu /* flag 2363 */
+#define DEF_2364(a, b) (((a) << 8) | ((b) & 0x93c))
+#define DEF_2365 0x93du /* flag 2365 */
+#define DEF_2366(a, b) (((a) << 10) | ((b) & 0x93e))
+#define DEF_2367 0x93fu /* flag 2367 */
+#define DEF_2368(a, b) (((a) << 12) | ((b) & 0x940))
+#define DEF_2369 0x941u /* flag 2369 */
+#define DEF_2370(a, b) (((a) << 14) | ((b) & 0x942))
+#define DEF_2371 0x943u /* flag 2371 */
+#define DEF_2372(a, b) (((a) << 16) | ((b) & 0x944))
+#define DEF_2373 0x945u /* flag 2373 */
+#define DEF_2374(a, b) (((a) << 18) | ((b) & 0x946))
+#define DEF_2375 0x947u /* flag 2375 */
+#define DEF_2376(a, b) (((a) << 20) | ((b) & 0x948))
+#define DEF_2377 0x949u /* flag 2377 */
+#define DEF_2378(a, b) (((a) << 22) | ((b) & 0x94a))
+#define DEF_2379 0x94bu /* flag 2379 */
+#define DEF_2380(a, b) (((a) << 24) | ((b) & 0x94c))
+#define DEF_2381 0x94du /* flag 2381 */
+#define DEF_2382(a, b) (((a) << 26) | ((b) & 0x94e))
+#define DEF_2383 0x94fu /* flag 2383 */
+#define DEF_2384(a, b) (((a) << 28) | ((b) & 0x950))
+#define DEF_2385 0x951u /* flag 2385 */
+#define DEF_2386(a, b) (((a) << 30) | ((b) & 0x952))
+#define DEF_2387 0x953u /* flag 2387 */
+#define DEF_2388(a, b) (((a) << 1) | ((b) & 0x954))
+#define DEF_2389 0x955u /* flag 2389 */
+#define DEF_2390(a, b) (((a) << 3) | ((b) & 0x956))
+#define DEF_2391 0x957u /* flag 2391 */
+#define DEF_2392(a, b) (((a) << 5) | ((b) & 0x958))
+#define DEF_2393 0x959u /* flag 2393 */
+#define DEF_2394(a, b) (((a) << 7) | ((b) & 0x95a))
+#define DEF_2395 0x95bu /* flag 2395 */
+#define DEF_2396(a, b) (((a) << 9) | ((b) & 0x95c))
+#define DEF_2397 0x95du /* flag 2397 */
+#define DEF_2398(a, b) (((a) << 11) | ((b) & 0x95e))
+#define DEF_2399 0x95fu /* flag 2399 */
+#define DEF_2400(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2400); })
+#define DEF_2401 0x961u /* flag 2401 */
+#define DEF_2402(a, b) (((a) << 15) | ((b) & 0x962))
+#define DEF_2403 0x963u /* flag 2403 */
+#define DEF_2404(a, b) (((a) << 17) | ((b) & 0x964))
+#define DEF_2405 0x965u /* flag 2405 */
+#define DEF_2406(a, b) (((a) << 19) | ((b) & 0x966))
+#define DEF_2407 0x967u /* flag 2407 */
+#define DEF_2408(a, b) (((a) << 21) | ((b) & 0x968))
+#define DEF_2409 0x969u /* flag 2409 */
+#define DEF_2410(a, b) (((a) << 23) | ((b) & 0x96a))
+#define DEF_2411 0x96bu /* flag 2411 */
+#define DEF_2412(a, b) (((a) << 25) | ((b) & 0x96c))
+#define DEF_2413 0x96du /* flag 2413 */
+#define DEF_2414(a, b) (((a) << 27) | ((b) & 0x96e))
+#define DEF_2415 0x96fu /* flag 2415 */
+#define DEF_2416(a, b) (((a) << 29) | ((b) & 0x970))
+#define DEF_2417 0x971u /* flag 2417 */
+#define DEF_2418(a, b) (((a) << 0) | ((b) & 0x972))
+#define DEF_2419 0x973u /* flag 2419 */
+#define DEF_2420(a, b) (((a) << 2) | ((b) & 0x974))
+#define DEF_2421 0x975u /* flag 2421 */
+#define DEF_2422(a, b) (((a) << 4) | ((b) & 0x976))
+#define DEF_2423 0x977u /* flag 2423 */
+#define DEF_2424(a, b) (((a) << 6) | ((b) & 0x978))
+#define DEF_2425 0x979u /* flag 2425 */
+#define DEF_2426(a, b) (((a) << 8) | ((b) & 0x97a))
+#define DEF_2427 0x97bu /* flag 2427 */
+#define DEF_2428(a, b) (((a) << 10) | ((b) & 0x97c))
+#define DEF_2429 0x97du /* flag 2429 */
+#define DEF_2430(a, b) (((a) << 12) | ((b) & 0x97e))
+#define DEF_2431 0x97fu /* flag 2431 */
+#define DEF_2432(a, b) (((a) << 14) | ((b) & 0x980))
+#define DEF_2433 0x981u /* flag 2433 */
+#define DEF_2434(a, b) (((a) << 16) | ((b) & 0x982))
+#define DEF_2435 0x983u /* flag 2435 */
+#define DEF_2436(a, b) (((a) << 18) | ((b) & 0x984))
+#define DEF_2437 0x985u /* flag 2437 */
+#define DEF_2438(a, b) (((a) << 20) | ((b) & 0x986))
+#define DEF_2439 0x987u /* flag 2439 */
+#define DEF_2440(a, b) (((a) << 22) | ((b) & 0x988))
+#define DEF_2441 0x989u /* flag 2441 */
+#define DEF_2442(a, b) (((a) << 24) | ((b) & 0x98a))
+#define DEF_2443 0x98bu /* flag 2443 */
+#define DEF_2444(a, b) (((a) << 26) | ((b) & 0x98c))
+#define DEF_2445 0x98du /* flag 2445 */
+#define DEF_2446(a, b) (((a) << 28) | ((b) & 0x98e))
+#define DEF_2447 0x98fu /* flag 2447 */
+#define DEF_2448(a, b) (((a) << 30) | ((b) & 0x990))
+#define DEF_2449 0x991u /* flag 2449 */
+#define DEF_2450(a, b) (((a) << 1) | ((b) & 0x992))
+#define DEF_2451 0x993u /* flag 2451 */
+#define DEF_2452(a, b) (((a) << 3) | ((b) & 0x994))
+#define DEF_2453 0x995u /* flag 2453 */
+#define DEF_2454(a, b) (((a) << 5) | ((b) & 0x996))
+#define DEF_2455 0x997u /* flag 2455 */
+#define DEF_2456(a, b) (((a) << 7) | ((b) & 0x998))
+#define DEF_2457 0x999u /* flag 2457 */
+#define DEF_2458(a, b) (((a) << 9) | ((b) & 0x99a))
+#define DEF_2459 0x99bu /* flag 2459 */
+#define DEF_2460(a, b) (((a) << 11) | ((b) & 0x99c))
+#define DEF_2461 0x99du /* flag 2461 */
+#define DEF_2462(a, b) (((a) << 13) | ((b) & 0x99e))
+#define DEF_2463 0x99fu /* flag 2463 */
+#define DEF_2464(a, b) (((a) << 15) | ((b) & 0x9a0))
+#define DEF_2465 0x9a1u /* flag 2465 */
+#define DEF_2466(a, b) (((a) << 17) | ((b) & 0x9a2))
+#define DEF_2467 0x9a3u /* flag 2467 */
+#define DEF_2468(a, b) (((a) << 19) | ((b) & 0x9a4))
+#define DEF_2469 0x9a5u /* flag 2469 */
+#define DEF_2470(a, b) (((a) << 21) | ((b) & 0x9a6))
+#define DEF_2471 0x9a7u /* flag 2471 */
+#define DEF_2472(a, b) (((a) << 23) | ((b) & 0x9a8))
+#define DEF_2473 0x9a9u /* flag 2473 */
+#define DEF_2474(a, b) (((a) << 25) | ((b) & 0x9aa))
+#define DEF_2475 0x9abu /* flag 2475 */
+#define DEF_2476(a, b) (((a) << 27) | ((b) & 0x9ac))
+#define DEF_2477 0x9adu /* flag 2477 */
+#define DEF_2478(a, b) (((a) << 29) | ((b) & 0x9ae))
+#define DEF_2479 0x9afu /* flag 2479 */
+#define DEF_2480(a, b) (((a) << 0) | ((b) & 0x9b0))
+#define DEF_2481 0x9b1u /* flag 2481 */
+#define DEF_2482(a, b) (((a) << 2) | ((b) & 0x9b2))
+#define DEF_2483 0x9b3u /* flag 2483 */
+#define DEF_2484(a, b) (((a) << 4) | ((b) & 0x9b4))
+#define DEF_2485 0x9b5u /* flag 2485 */
+#define DEF_2486(a, b) (((a) << 6) | ((b) & 0x9b6))
+#define DEF_2487 0x9b7u /* flag 2487 */
+#define DEF_2488(a, b) (((a) << 8) | ((b) & 0x9b8))
+#define DEF_2489 0x9b9u /* flag 2489 */
+#define DEF_2490(a, b) (((a) << 10) | ((b) & 0x9ba))
+#define DEF_2491 0x9bbu /* flag 2491 */
+#define DEF_2492(a, b) (((a) << 12) | ((b) & 0x9bc))
+#define DEF_2493 0x9bdu /* flag 2493 */
+#define DEF_2494(a, b) (((a) << 14) | ((b) & 0x9be))
+#define DEF_2495 0x9bfu /* flag 2495 */
+#define DEF_2496(a, b) (((a) << 16) | ((b) & 0x9c0))
+#define DEF_2497 0x9c1u /* flag 2497 */
+#define DEF_2498(a, b) (((a) << 18) | ((b) & 0x9c2))
+#define DEF_2499 0x9c3u /* flag 2499 */
+#define DEF_2500(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2500); })
+#define DEF_2501 0x9c5u /* flag 2501 */
+#define DEF_2502(a, b) (((a) << 22) | ((b) & 0x9c6))
+#define DEF_2503 0x9c7u /* flag 2503 */
+#define DEF_2504(a, b) (((a) << 24) | ((b) & 0x9c8))
+#define DEF_2505 0x9c9u /* flag 2505 */
+#define DEF_2506(a, b) (((a) << 26) | ((b) & 0x9ca))
+#define DEF_2507 0x9cbu /* flag 2507 */
+#define DEF_2508(a, b) (((a) << 28) | ((b) & 0x9cc))
+#define DEF_2509 0x9cdu /* flag 2509 */
+#define DEF_2510(a, b) (((a) << 30) | ((b) & 0x9ce))
+#define DEF_2511 0x9cfu /* flag 2511 */
+#define DEF_2512(a, b) (((a) << 1) | ((b) & 0x9d0))
+#define DEF_2513 0x9d1u /* flag 2513 */
+#define DEF_2514(a, b) (((a) << 3) | ((b) & 0x9d2))
+#define DEF_2515 0x9d3u /* flag 2515 */
+#define DEF_2516(a, b) (((a) << 5) | ((b) & 0x9d4))
+#define DEF_2517 0x9d5u /* flag 2517 */
+#define DEF_2518(a, b) (((a) << 7) | ((b) & 0x9d6))
+#define DEF_2519 0x9d7u /* flag 2519 */
+#define DEF_2520(a, b) (((a) << 9) | ((b) & 0x9d8))
+#define DEF_2521 0x9d9u /* flag 2521 */
+#define DEF_2522(a, b) (((a) << 11) | ((b) & 0x9da))
+#define DEF_2523 0x9dbu /* flag 2523 */
+#define DEF_2524(a, b) (((a) << 13) | ((b) & 0x9dc))
+#define DEF_2525 0x9ddu /* flag 2525 */
+#define DEF_2526(a, b) (((a) << 15) | ((b) & 0x9de))
+#define DEF_2527 0x9dfu /* flag 2527 */
+#define DEF_2528(a, b) (((a) << 17) | ((b) & 0x9e0))
+#define DEF_2529 0x9e1u /* flag 2529 */
+#define DEF_2530(a, b) (((a) << 19) | ((b) & 0x9e2))
+#define DEF_2531 0x9e3u /* flag 2531 */
+#define DEF_2532(a, b) (((a) << 21) | ((b) & 0x9e4))
+#define DEF_2533 0x9e5u /* flag 2533 */
+#define DEF_2534(a, b) (((a) << 23) | ((b) & 0x9e6))
+#define DEF_2535 0x9e7u /* flag 2535 */
+#define DEF_2536(a, b) (((a) << 25) | ((b) & 0x9e8))
+#define DEF_2537 0x9e9u /* flag 2537 */
+#define DEF_2538(a, b) (((a) << 27) | ((b) & 0x9ea))
+#define DEF_2539 0x9ebu /* flag 2539 */
+#define DEF_2540(a, b) (((a) << 29) | ((b) & 0x9ec))
+#define DEF_2541 0x9edu /* flag 2541 */
+#define DEF_2542(a, b) (((a) << 0) | ((b) & 0x9ee))
+#define DEF_2543 0x9efu /* flag 2543 */
+#define DEF_2544(a, b) (((a) << 2) | ((b) & 0x9f0))
+#define DEF_2545 0x9f1u /* flag 2545 */
+#define DEF_2546(a, b) (((a) << 4) | ((b) & 0x9f2))
+#define DEF_2547 0x9f3u /* flag 2547 */
+#define DEF_2548(a, b) (((a) << 6) | ((b) & 0x9f4))
+#define DEF_2549 0x9f5u /* flag 2549 */
+#define DEF_2550(a, b) (((a) << 8) | ((b) & 0x9f6))
+#define DEF_2551 0x9f7u /* flag 2551 */
+#define DEF_2552(a, b) (((a) << 10) | ((b) & 0x9f8))
+#define DEF_2553 0x9f9u /* flag 2553 */
+#define DEF_2554(a, b) (((a) << 12) | ((b) & 0x9fa))
+#define DEF_2555 0x9fbu /* flag 2555 */
+#define DEF_2556(a, b) (((a) << 14) | ((b) & 0x9fc))
+#define DEF_2557 0x9fdu /* flag 2557 */
+#define DEF_2558(a, b) (((a) << 16) | ((b) & 0x9fe))
+#define DEF_2559 0x9ffu /* flag 2559 */
+#define DEF_2560(a, b) (((a) << 18) | ((b) & 0xa00))
+#define DEF_2561 0xa01u /* flag 2561 */
+#define DEF_2562(a, b) (((a) << 20) | ((b) & 0xa02))
+#define DEF_2563 0xa03u /* flag 2563 */
+#define DEF_2564(a, b) (((a) << 22) | ((b) & 0xa04))
+#define DEF_2565 0xa05u /* flag 2565 */
+#define DEF_2566(a, b) (((a) << 24) | ((b) & 0xa06))
+#define DEF_2567 0xa07u /* flag 2567 */
+#define DEF_2568(a, b) (((a) << 26) | ((b) & 0xa08))
+#define DEF_2569 0xa09u /* flag 2569 */
+#define DEF_2570(a, b) (((a) << 28) | ((b) & 0xa0a))
+#define DEF_2571 0xa0bu /* flag 2571 */
+#define DEF_2572(a, b) (((a) << 30) | ((b) & 0xa0c))
+#define DEF_2573 0xa0du /* flag 2573 */
+#define DEF_2574(a, b) (((a) << 1) | ((b) & 0xa0e))
+#define DEF_2575 0xa0fu /* flag 2575 */
+#define DEF_2576(a, b) (((a) << 3) | ((b) & 0xa10))
+#define DEF_2577 0xa11u /* flag 2577 */
+#define DEF_2578(a, b) (((a) << 5) | ((b) & 0xa12))
+#define DEF_2579 0xa13u /* flag 2579 */
+#define DEF_2580(a, b) (((a) << 7) | ((b) & 0xa14))
+#define DEF_2581 0xa15u /* flag 2581 */
+#define DEF_2582(a, b) (((a) << 9) | ((b) & 0xa16))
+#define DEF_2583 0xa17u /* flag 2583 */
+#define DEF_2584(a, b) (((a) << 11) | ((b) & 0xa18))
+#define DEF_2585 0xa19u /* flag 2585 */
+#define DEF_2586(a, b) (((a) << 13) | ((b) & 0xa1a))
+#define DEF_2587 0xa1bu /* flag 2587 */
+#define DEF_2588(a, b) (((a) << 15) | ((b) & 0xa1c))
+#define DEF_2589 0xa1du /* flag 2589 */
+#define DEF_2590(a, b) (((a) << 17) | ((b) & 0xa1e))
+#define DEF_2591 0xa1fu /* flag 2591 */
+#define DEF_2592(a, b) (((a) << 19) | ((b) & 0xa20))
+#define DEF_2593 0xa21u /* flag 2593 */
+#define DEF_2594(a, b) (((a) << 21) | ((b) & 0xa22))
+#define DEF_2595 0xa23u /* flag 2595 */
+#define DEF_2596(a, b) (((a) << 23) | ((b) & 0xa24))
+#define DEF_2597 0xa25u /* flag 2597 */
+#define DEF_2598(a, b) (((a) << 25) | ((b) & 0xa26))
+#define DEF_2599 0xa27u /* flag 2599 */
+#define DEF_2600(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2600); })
+#define DEF_2601 0xa29u /* flag 2601 */
+#define DEF_2602(a, b) (((a) << 29) | ((b) & 0xa2a))
+#define DEF_2603 0xa2bu /* flag 2603 */
+#define DEF_2604(a, b) (((a) << 0) | ((b) & 0xa2c))
+#define DEF_2605 0xa2du /* flag 2605 */
+#define DEF_2606(a, b) (((a) << 2) | ((b) & 0xa2e))
+#define DEF_2607 0xa2fu /* flag 2607 */
+#define DEF_2608(a, b) (((a) << 4) | ((b) & 0xa30))
+#define DEF_2609 0xa31u /* flag 2609 */
+#define DEF_2610(a, b) (((a) << 6) | ((b) & 0xa32))
+#define DEF_2611 0xa33u /* flag 2611 */
+#define DEF_2612(a, b) (((a) << 8) | ((b) & 0xa34))
+#define DEF_2613 0xa35u /* flag 2613 */
+#define DEF_2614(a, b) (((a) << 10) | ((b) & 0xa36))
+#define DEF_2615 0xa37u /* flag 2615 */
+#define DEF_2616(a, b) (((a) << 12) | ((b) & 0xa38))
+#define DEF_2617 0xa39u /* flag 2617 */
+#define DEF_2618(a, b) (((a) << 14) | ((b) & 0xa3a))
+#define DEF_2619 0xa3bu /* flag 2619 */
+#define DEF_2620(a, b) (((a) << 16) | ((b) & 0xa3c))
+#define DEF_2621 0xa3du /* flag 2621 */
+#define DEF_2622(a, b) (((a) << 18) | ((b) & 0xa3e))
+#define DEF_2623 0xa3fu /* flag 2623 */
+#define DEF_2624(a, b) (((a) << 20) | ((b) & 0xa40))
+#define DEF_2625 0xa41u /* flag 2625 */
+#define DEF_2626(a, b) (((a) << 22) | ((b) & 0xa42))
+#define DEF_2627 0xa43u /* flag 2627 */
+#define DEF_2628(a, b) (((a) << 24) | ((b) & 0xa44))
+#define DEF_2629 0xa45u /* flag 2629 */
+#define DEF_2630(a, b) (((a) << 26) | ((b) & 0xa46))
+#define DEF_2631 0xa47u /* flag 2631 */
+#define DEF_2632(a, b) (((a) << 28) | ((b) & 0xa48))
+#define DEF_2633 0xa49u /* flag 2633 */
+#define DEF_2634(a, b) (((a) << 30) | ((b) & 0xa4a))
+#define DEF_2635 0xa4bu /* flag 2635 */
+#define DEF_2636(a, b) (((a) << 1) | ((b) & 0xa4c))
+#define DEF_2637 0xa4du /* flag 2637 */
+#define DEF_2638(a, b) (((a) << 3) | ((b) & 0xa4e))
+#define DEF_2639 0xa4fu /* flag 2639 */
+#define DEF_2640(a, b) (((a) << 5) | ((b) & 0xa50))
+#define DEF_2641 0xa51u /* flag 2641 */
+#define DEF_2642(a, b) (((a) << 7) | ((b) & 0xa52))
+#define DEF_2643 0xa53u /* flag 2643 */
+#define DEF_2644(a, b) (((a) << 9) | ((b) & 0xa54))
+#define DEF_2645 0xa55u /* flag 2645 */
+#define DEF_2646(a, b) (((a) << 11) | ((b) & 0xa56))
+#define DEF_2647 0xa57u /* flag 2647 */
+#define DEF_2648(a, b) (((a) << 13) | ((b) & 0xa58))
+#define DEF_2649 0xa59u /* flag 2649 */
+#define DEF_2650(a, b) (((a) << 15) | ((b) & 0xa5a))
+#define DEF_2651 0xa5bu /* flag 2651 */
+#define DEF_2652(a, b) (((a) << 17) | ((b) & 0xa5c))
+#define DEF_2653 0xa5du /* flag 2653 */
+#define DEF_2654(a, b) (((a) << 19) | ((b) & 0xa5e))
+#define DEF_2655 0xa5fu /* flag 2655 */
+#define DEF_2656(a, b) (((a) << 21) | ((b) & 0xa60))
+#define DEF_2657 0xa61u /* flag 2657 */
+#define DEF_2658(a, b) (((a) << 23) | ((b) & 0xa62))
+#define DEF_2659 0xa63u /* flag 2659 */
+#define DEF_2660(a, b) (((a) << 25) | ((b) & 0xa64))
+#define DEF_2661 0xa65u /* flag 2661 */
+#define DEF_2662(a, b) (((a) << 27) | ((b) & 0xa66))
+#define DEF_2663 0xa67u /* flag 2663 */
+#define DEF_2664(a, b) (((a) << 29) | ((b) & 0xa68))
+#define DEF_2665 0xa69u /* flag 2665 */
+#define DEF_2666(a, b) (((a) << 0) | ((b) & 0xa6a))
+#define DEF_2667 0xa6bu /* flag 2667 */
+#define DEF_2668(a, b) (((a) << 2) | ((b) & 0xa6c))
+#define DEF_2669 0xa6du /* flag 2669 */
+#define DEF_2670(a, b) (((a) << 4) | ((b) & 0xa6e))
+#define DEF_2671 0xa6fu /* flag 2671 */
+#define DEF_2672(a, b) (((a) << 6) | ((b) & 0xa70))
+#define DEF_2673 0xa71u /* flag 2673 */
+#define DEF_2674(a, b) (((a) << 8) | ((b) & 0xa72))
+#define DEF_2675 0xa73u /* flag 2675 */
+#define DEF_2676(a, b) (((a) << 10) | ((b) & 0xa74))
+#define DEF_2677 0xa75u /* flag 2677 */
+#define DEF_2678(a, b) (((a) << 12) | ((b) & 0xa76))
+#define DEF_2679 0xa77u /* flag 2679 */
+#define DEF_2680(a, b) (((a) << 14) | ((b) & 0xa78))
+#define DEF_2681 0xa79u /* flag 2681 */
+#define DEF_2682(a, b) (((a) << 16) | ((b) & 0xa7a))
+#define DEF_2683 0xa7bu /* flag 2683 */
+#define DEF_2684(a, b) (((a) << 18) | ((b) & 0xa7c))
+#define DEF_2685 0xa7du /* flag 2685 */
+#define DEF_2686(a, b) (((a) << 20) | ((b) & 0xa7e))
+#define DEF_2687 0xa7fu /* flag 2687 */
+#define DEF_2688(a, b) (((a) << 22) | ((b) & 0xa80))
+#define DEF_2689 0xa81u /* flag 2689 */
+#define DEF_2690(a, b) (((a) << 24) | ((b) & 0xa82))
+#define DEF_2691 0xa83u /* flag 2691 */
+#define DEF_2692(a, b) (((a) << 26) | ((b) & 0xa84))
+#define DEF_2693 0xa85u /* flag 2693 */
+#define DEF_2694(a, b) (((a) << 28) | ((b) & 0xa86))
+#define DEF_2695 0xa87u /* flag 2695 */
+#define DEF_2696(a, b) (((a) << 30) | ((b) & 0xa88))
+#define DEF_2697 0xa89u /* flag 2697 */
+#define DEF_2698(a, b) (((a) << 1) | ((b) & 0xa8a))
+#define DEF_2699 0xa8bu /* flag 2699 */
+#define DEF_2700(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2700); })
+#define DEF_2701 0xa8du /* flag 2701 */
+#define DEF_2702(a, b) (((a) << 5) | ((b) & 0xa8e))
+#define DEF_2703 0xa8fu /* flag 2703 */
+#define DEF_2704(a, b) (((a) << 7) | ((b) & 0xa90))
+#define DEF_2705 0xa91u /* flag 2705 */
+#define DEF_2706(a, b) (((a) << 9) | ((b) & 0xa92))
+#define DEF_2707 0xa93u /* flag 2707 */
+#define DEF_2708(a, b) (((a) << 11) | ((b) & 0xa94))
+#define DEF_2709 0xa95u /* flag 2709 */
+#define DEF_2710(a, b) (((a) << 13) | ((b) & 0xa96))
+#define DEF_2711 0xa97u /* flag 2711 */
+#define DEF_2712(a, b) (((a) << 15) | ((b) & 0xa98))
+#define DEF_2713 0xa99u /* flag 2713 */
+#define DEF_2714(a, b) (((a) << 17) | ((b) & 0xa9a))
+#define DEF_2715 0xa9bu /* flag 2715 */
+#define DEF_2716(a, b) (((a) << 19) | ((b) & 0xa9c))
+#define DEF_2717 0xa9du /* flag 2717 */
+#define DEF_2718(a, b) (((a) << 21) | ((b) & 0xa9e))
+#define DEF_2719 0xa9fu /* flag 2719 */
+#define DEF_2720(a, b) (((a) << 23) | ((b) & 0xaa0))
+#define DEF_2721 0xaa1u /* flag 2721 */
+#define DEF_2722(a, b) (((a) << 25) | ((b) & 0xaa2))
+#define DEF_2723 0xaa3u /* flag 2723 */
+#define DEF_2724(a, b) (((a) << 27) | ((b) & 0xaa4))
+#define DEF_2725 0xaa5u /* flag 2725 */
+#define DEF_2726(a, b) (((a) << 29) | ((b) & 0xaa6))
+#define DEF_2727 0xaa7u /* flag 2727 */
+#define DEF_2728(a, b) (((a) << 0) | ((b) & 0xaa8))
+#define DEF_2729 0xaa9u /* flag 2729 */
+#define DEF_2730(a, b) (((a) << 2) | ((b) & 0xaaa))
+#define DEF_2731 0xaabu /* flag 2731 */
+#define DEF_2732(a, b) (((a) << 4) | ((b) & 0xaac))
+#define DEF_2733 0xaadu /* flag 2733 */
+#define DEF_2734(a, b) (((a) << 6) | ((b) & 0xaae))
+#define DEF_2735 0xaafu /* flag 2735 */
+#define DEF_2736(a, b) (((a) << 8) | ((b) & 0xab0))
+#define DEF_2737 0xab1u /* flag 2737 */
+#define DEF_2738(a, b) (((a) << 10) | ((b) & 0xab2))
+#define DEF_2739 0xab3u /* flag 2739 */
+#define DEF_2740(a, b) (((a) << 12) | ((b) & 0xab4))
+#define DEF_2741 0xab5u /* flag 2741 */
+#define DEF_2742(a, b) (((a) << 14) | ((b) & 0xab6))
+#define DEF_2743 0xab7u /* flag 2743 */
+#define DEF_2744(a, b) (((a) << 16) | ((b) & 0xab8))
+#define DEF_2745 0xab9u /* flag 2745 */
+#define DEF_2746(a, b) (((a) << 18) | ((b) & 0xaba))
+#define DEF_2747 0xabbu /* flag 2747 */
+#define DEF_2748(a, b) (((a) << 20) | ((b) & 0xabc))
+#define DEF_2749 0xabdu /* flag 2749 */
+#define DEF_2750(a, b) (((a) << 22) | ((b) & 0xabe))
+#define DEF_2751 0xabfu /* flag 2751 */
+#define DEF_2752(a, b) (((a) << 24) | ((b) & 0xac0))
+#define DEF_2753 0xac1u /* flag 2753 */
+#define DEF_2754(a, b) (((a) << 26) | ((b) & 0xac2))
+#define DEF_2755 0xac3u /* flag 2755 */
+#define DEF_2756(a, b) (((a) << 28) | ((b) & 0xac4))
+#define DEF_2757 0xac5u /* flag 2757 */
+#define DEF_2758(a, b) (((a) << 30) | ((b) & 0xac6))
+#define DEF_2759 0xac7u /* flag 2759 */
+#define DEF_2760(a, b) (((a) << 1) | ((b) & 0xac8))
+#define DEF_2761 0xac9u /* flag 2761 */
+#define DEF_2762(a, b) (((a) << 3) | ((b) & 0xaca))
+#define DEF_2763 0xacbu /* flag 2763 */
+#define DEF_2764(a, b) (((a) << 5) | ((b) & 0xacc))
+#define DEF_2765 0xacdu /* flag 2765 */
+#define DEF_2766(a, b) (((a) << 7) | ((b) & 0xace))
+#define DEF_2767 0xacfu /* flag 2767 */
+#define DEF_2768(a, b) (((a) << 9) | ((b) & 0xad0))
+#define DEF_2769 0xad1u /* flag 2769 */
+#define DEF_2770(a, b) (((a) << 11) | ((b) & 0xad2))
+#define DEF_2771 0xad3u /* flag 2771 */
+#define DEF_2772(a, b) (((a) << 13) | ((b) & 0xad4))
+#define DEF_2773 0xad5u /* flag 2773 */
+#define DEF_2774(a, b) (((a) << 15) | ((b) & 0xad6))
+#define DEF_2775 0xad7u /* flag 2775 */
+#define DEF_2776(a, b) (((a) << 17) | ((b) & 0xad8))
+#define DEF_2777 0xad9u /* flag 2777 */
+#define DEF_2778(a, b) (((a) << 19) | ((b) & 0xada))
+#define DEF_2779 0xadbu /* flag 2779 */
+#define DEF_2780(a, b) (((a) << 21) | ((b) & 0xadc))
+#define DEF_2781 0xaddu /* flag 2781 */
+#define DEF_2782(a, b) (((a) << 23) | ((b) & 0xade))
+#define DEF_2783 0xadfu /* flag 2783 */
+#define DEF_2784(a, b) (((a) << 25) | ((b) & 0xae0))
+#define DEF_2785 0xae1u /* flag 2785 */
+#define DEF_2786(a, b) (((a) << 27) | ((b) & 0xae2))
+#define DEF_2787 0xae3u /* flag 2787 */
+#define DEF_2788(a, b) (((a) << 29) | ((b) & 0xae4))
+#define DEF_2789 0xae5u /* flag 2789 */
+#define DEF_2790(a, b) (((a) << 0) | ((b) & 0xae6))
+#define DEF_2791 0xae7u /* flag 2791 */
+#define DEF_2792(a, b) (((a) << 2) | ((b) & 0xae8))
+#define DEF_2793 0xae9u /* flag 2793 */
+#define DEF_2794(a, b) (((a) << 4) | ((b) & 0xaea))
+#define DEF_2795 0xaebu /* flag 2795 */
+#define DEF_2796(a, b) (((a) << 6) | ((b) & 0xaec))
+#define DEF_2797 0xaedu /* flag 2797 */
+#define DEF_2798(a, b) (((a) << 8) | ((b) & 0xaee))
+#define DEF_2799 0xaefu /* flag 2799 */
+#define DEF_2800(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2800); })
+#define DEF_2801 0xaf1u /* flag 2801 */
+#define DEF_2802(a, b) (((a) << 12) | ((b) & 0xaf2))
+#define DEF_2803 0xaf3u /* flag 2803 */
+#define DEF_2804(a, b) (((a) << 14) | ((b) & 0xaf4))
+#define DEF_2805 0xaf5u /* flag 2805 */
+#define DEF_2806(a, b) (((a) << 16) | ((b) & 0xaf6))
+#define DEF_2807 0xaf7u /* flag 2807 */
+#define DEF_2808(a, b) (((a) << 18) | ((b) & 0xaf8))
+#define DEF_2809 0xaf9u /* flag 2809 */
+#define DEF_2810(a, b) (((a) << 20) | ((b) & 0xafa))
+#define DEF_2811 0xafbu /* flag 2811 */
+#define DEF_2812(a, b) (((a) << 22) | ((b) & 0xafc))
+#define DEF_2813 0xafdu /* flag 2813 */
+#define DEF_2814(a, b) (((a) << 24) | ((b) & 0xafe))
+#define DEF_2815 0xaffu /* flag 2815 */
+#define DEF_2816(a, b) (((a) << 26) | ((b) & 0xb00))
+#define DEF_2817 0xb01u /* flag 2817 */
+#define DEF_2818(a, b) (((a) << 28) | ((b) & 0xb02))
+#define DEF_2819 0xb03u /* flag 2819 */
+#define DEF_2820(a, b) (((a) << 30) | ((b) & 0xb04))
+#define DEF_2821 0xb05u /* flag 2821 */
+#define DEF_2822(a, b) (((a) << 1) | ((b) & 0xb06))
+#define DEF_2823 0xb07u /* flag 2823 */
+#define DEF_2824(a, b) (((a) << 3) | ((b) & 0xb08))
+#define DEF_2825 0xb09u /* flag 2825 */
+#define DEF_2826(a, b) (((a) << 5) | ((b) & 0xb0a))
+#define DEF_2827 0xb0bu /* flag 2827 */
+#define DEF_2828(a, b) (((a) << 7) | ((b) & 0xb0c))
+#define DEF_2829 0xb0du /* flag 2829 */
+#define DEF_2830(a, b) (((a) << 9) | ((b) & 0xb0e))
+#define DEF_2831 0xb0fu /* flag 2831 */
+#define DEF_2832(a, b) (((a) << 11) | ((b) & 0xb10))
+#define DEF_2833 0xb11u /* flag 2833 */
+#define DEF_2834(a, b) (((a) << 13) | ((b) & 0xb12))
+#define DEF_2835 0xb13u /* flag 2835 */
+#define DEF_2836(a, b) (((a) << 15) | ((b) & 0xb14))
+#define DEF_2837 0xb15u /* flag 2837 */
+#define DEF_2838(a, b) (((a) << 17) | ((b) & 0xb16))
+#define DEF_2839 0xb17u /* flag 2839 */
+#define DEF_2840(a, b) (((a) << 19) | ((b) & 0xb18))
+#define DEF_2841 0xb19u /* flag 2841 */
+#define DEF_2842(a, b) (((a) << 21) | ((b) & 0xb1a))
+#define DEF_2843 0xb1bu /* flag 2843 */
+#define DEF_2844(a, b) (((a) << 23) | ((b) & 0xb1c))
+#define DEF_2845 0xb1du /* flag 2845 */
+#define DEF_2846(a, b) (((a) << 25) | ((b) & 0xb1e))
+#define DEF_2847 0xb1fu /* flag 2847 */
+#define DEF_2848(a, b) (((a) << 27) | ((b) & 0xb20))
+#define DEF_2849 0xb21u /* flag 2849 */
+#define DEF_2850(a, b) (((a) << 29) | ((b) & 0xb22))
+#define DEF_2851 0xb23u /* flag 2851 */
+#define DEF_2852(a, b) (((a) << 0) | ((b) & 0xb24))
+#define DEF_2853 0xb25u /* flag 2853 */
+#define DEF_2854(a, b) (((a) << 2) | ((b) & 0xb26))
+#define DEF_2855 0xb27u /* flag 2855 */
+#define DEF_2856(a, b) (((a) << 4) | ((b) & 0xb28))
+#define DEF_2857 0xb29u /* flag 2857 */
+#define DEF_2858(a, b) (((a) << 6) | ((b) & 0xb2a))
+#define DEF_2859 0xb2bu /* flag 2859 */
+#define DEF_2860(a, b) (((a) << 8) | ((b) & 0xb2c))
+#define DEF_2861 0xb2du /* flag 2861 */
+#define DEF_2862(a, b) (((a) << 10) | ((b) & 0xb2e))
+#define DEF_2863 0xb2fu /* flag 2863 */
+#define DEF_2864(a, b) (((a) << 12) | ((b) & 0xb30))
+#define DEF_2865 0xb31u /* flag 2865 */
+#define DEF_2866(a, b) (((a) << 14) | ((b) & 0xb32))
+#define DEF_2867 0xb33u /* flag 2867 */
+#define DEF_2868(a, b) (((a) << 16) | ((b) & 0xb34))
+#define DEF_2869 0xb35u /* flag 2869 */
+#define DEF_2870(a, b) (((a) << 18) | ((b) & 0xb36))
+#define DEF_2871 0xb37u /* flag 2871 */
+#define DEF_2872(a, b) (((a) << 20) | ((b) & 0xb38))
+#define DEF_2873 0xb39u /* flag 2873 */
+#define DEF_2874(a, b) (((a) << 22) | ((b) & 0xb3a))
+#define DEF_2875 0xb3bu /* flag 2875 */
+#define DEF_2876(a, b) (((a) << 24) | ((b) & 0xb3c))
+#define DEF_2877 0xb3du /* flag 2877 */
+#define DEF_2878(a, b) (((a) << 26) | ((b) & 0xb3e))
+#define DEF_2879 0xb3fu /* flag 2879 */
+#define DEF_2880(a, b) (((a) << 28) | ((b) & 0xb40))
+#define DEF_2881 0xb41u /* flag 2881 */
+#define DEF_2882(a, b) (((a) << 30) | ((b) & 0xb42))
+#define DEF_2883 0xb43u /* flag 2883 */
+#define DEF_2884(a, b) (((a) << 1) | ((b) & 0xb44))
+#define DEF_2885 0xb45u /* flag 2885 */
+#define DEF_2886(a, b) (((a) << 3) | ((b) & 0xb46))
+#define DEF_2887 0xb47u /* flag 2887 */
+#define DEF_2888(a, b) (((a) << 5) | ((b) & 0xb48))
+#define DEF_2889 0xb49u /* flag 2889 */
+#define DEF_2890(a, b) (((a) << 7) | ((b) & 0xb4a))
+#define DEF_2891 0xb4bu /* flag 2891 */
+#define DEF_2892(a, b) (((a) << 9) | ((b) & 0xb4c))
+#define DEF_2893 0xb4du /* flag 2893 */
+#define DEF_2894(a, b) (((a) << 11) | ((b) & 0xb4e))
+#define DEF_2895 0xb4fu /* flag 2895 */
+#define DEF_2896(a, b) (((a) << 13) | ((b) & 0xb50))
+#define DEF_2897 0xb51u /* flag 2897 */
+#define DEF_2898(a, b) (((a) << 15) | ((b) & 0xb52))
+#define DEF_2899 0xb53u /* flag 2899 */
+#define DEF_2900(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 2900); })
+#define DEF_2901 0xb55u /* flag 2901 */
+#define DEF_2902(a, b) (((a) << 19) | ((b) & 0xb56))
+#define DEF_2903 0xb57u /* flag 2903 */
+#define DEF_2904(a, b) (((a) << 21) | ((b) & 0xb58))
+#define DEF_2905 0xb59u /* flag 2905 */
+#define DEF_2906(a, b) (((a) << 23) | ((b) & 0xb5a))
+#define DEF_2907 0xb5bu /* flag 2907 */
+#define DEF_2908(a, b) (((a) << 25) | ((b) & 0xb5c))
+#define DEF_2909 0xb5du /* flag 2909 */
+#define DEF_2910(a, b) (((a) << 27) | ((b) & 0xb5e))
+#define DEF_2911 0xb5fu /* flag 2911 */
+#define DEF_2912(a, b) (((a) << 29) | ((b) & 0xb60))
+#define DEF_2913 0xb61u /* flag 2913 */
+#define DEF_2914(a, b) (((a) << 0) | ((b) & 0xb62))
+#define DEF_2915 0xb63u /* flag 2915 */
+#define DEF_2916(a, b) (((a) << 2) | ((b) & 0xb64))
+#define DEF_2917 0xb65u /* flag 2917 */
+#define DEF_2918(a, b) (((a) << 4) | ((b) & 0xb66))
+#define DEF_2919 0xb67u /* flag 2919 */
+#define DEF_2920(a, b) (((a) << 6) | ((b) & 0xb68))
+#define DEF_2921 0xb69u /* flag 2921 */
+#define DEF_2922(a, b) (((a) << 8) | ((b) & 0xb6a))
+#define DEF_2923 0xb6bu /* flag 2923 */
+#define DEF_2924(a, b) (((a) << 10) | ((b) & 0xb6c))
+#define DEF_2925 0xb6du /* flag 2925 */
+#define DEF_2926(a, b) (((a) << 12) | ((b) & 0xb6e))
+#define DEF_2927 0xb6fu /* flag 2927 */
+#define DEF_2928(a, b) (((a) << 14) | ((b) & 0xb70))
+#define DEF_2929 0xb71u /* flag 2929 */
+#define DEF_2930(a, b) (((a) << 16) | ((b) & 0xb72))
+#define DEF_2931 0xb73u /* flag 2931 */
+#define DEF_2932(a, b) (((a) << 18) | ((b) & 0xb74))
+#define DEF_2933 0xb75u /* flag 2933 */
+#define DEF_2934(a, b) (((a) << 20) | ((b) & 0xb76))
+#define DEF_2935 0xb77u /* flag 2935 */
+#define DEF_2936(a, b) (((a) << 22) | ((b) & 0xb78))
+#define DEF_2937 0xb79u /* flag 2937 */
+#define DEF_2938(a, b) (((a) << 24) | ((b) & 0xb7a))
+#define DEF_2939 0xb7bu /* flag 2939 */
+#define DEF_2940(a, b) (((a) << 26) | ((b) & 0xb7c))
+#define DEF_2941 0xb7du /* flag 2941 */
+#define DEF_2942(a, b) (((a) << 28) | ((b) & 0xb7e))
+#define DEF_2943 0xb7fu /* flag 2943 */
+#define DEF_2944(a, b) (((a) << 30) | ((b) & 0xb80))
+#define DEF_2945 0xb81u /* flag 2945 */
+#define DEF_2946(a, b) (((a) << 1) | ((b) & 0xb82))
+#define DEF_2947 0xb83u /* flag 2947 */
+#define DEF_2948(a, b) (((a) << 3) | ((b) & 0xb84))
+#define DEF_2949 0xb85u /* flag 2949 */
+#define DEF_2950(a, b) (((a) << 5) | ((b) & 0xb86))
+#define DEF_2951 0xb87u /* flag 2951 */
+#define DEF_2952(a, b) (((a) << 7) | ((b) & 0xb88))
+#define DEF_2953 0xb89u /* flag 2953 */
+#define DEF_2954(a, b) (((a) << 9) | ((b) & 0xb8a))
+#define DEF_2955 0xb8bu /* flag 2955 */
+#define DEF_2956(a, b) (((a) << 11) | ((b) & 0xb8c))
+#define DEF_2957 0xb8du /* flag 2957 */
+#define DEF_2958(a, b) (((a) << 13) | ((b) & 0xb8e))
+#define DEF_2959 0xb8fu /* flag 2959 */
+#define DEF_2960(a, b) (((a) << 15) | ((b) & 0xb90))
+#define DEF_2961 0xb91u /* flag 2961 */
+#define DEF_2962(a, b) (((a) << 17) | ((b) & 0xb92))
+#define DEF_2963 0xb93u /* flag 2963 */
+#define DEF_2964(a, b) (((a) << 19) | ((b) & 0xb94))
+#define DEF_2965 0xb95u /* flag 2965 */
+#define DEF_2966(a, b) (((a) << 21) | ((b) & 0xb96))
+#define DEF_2967 0xb97u /* flag 2967 */
+#define DEF_2968(a, b) (((a) << 23) | ((b) & 0xb98))
+#define DEF_2969 0xb99u /* flag 2969 */
+#define DEF_2970(a, b) (((a) << 25) | ((b) & 0xb9a))
+#define DEF_2971 0xb9bu /* flag 2971 */
+#define DEF_2972(a, b) (((a) << 27) | ((b) & 0xb9c))
+#define DEF_2973 0xb9du /* flag 2973 */
+#define DEF_2974(a, b) (((a) << 29) | ((b) & 0xb9e))
+#define DEF_2975 0xb9fu /* flag 2975 */
+#define DEF_2976(a, b) (((a) << 0) | ((b) & 0xba0))
+#define DEF_2977 0xba1u /* flag 2977 */
+#define DEF_2978(a, b) (((a) << 2) | ((b) & 0xba2))
+#define DEF_2979 0xba3u /* flag 2979 */
+#define DEF_2980(a, b) (((a) << 4) | ((b) & 0xba4))
+#define DEF_2981 0xba5u /* flag 2981 */
+#define DEF_2982(a, b) (((a) << 6) | ((b) & 0xba6))
+#define DEF_2983 0xba7u /* flag 2983 */
+#define DEF_2984(a, b) (((a) << 8) | ((b) & 0xba8))
+#define DEF_2985 0xba9u /* flag 2985 */
+#define DEF_2986(a, b) (((a) << 10) | ((b) & 0xbaa))
+#define DEF_2987 0xbabu /* flag 2987 */
+#define DEF_2988(a, b) (((a) << 12) | ((b) & 0xbac))
+#define DEF_2989 0xbadu /* flag 2989 */
+#define DEF_2990(a, b) (((a) << 14) | ((b) & 0xbae))
+#define DEF_2991 0xbafu /* flag 2991 */
+#define DEF_2992(a, b) (((a) << 16) | ((b) & 0xbb0))
+#define DEF_2993 0xbb1u /* flag 2993 */
+#define DEF_2994(a, b) (((a) << 18) | ((b) & 0xbb2))
+#define DEF_2995 0xbb3u /* flag 2995 */
+#define DEF_2996(a, b) (((a) << 20) | ((b) & 0xbb4))
+#define DEF_2997 0xbb5u /* flag 2997 */
+#define DEF_2998(a, b) (((a) << 22) | ((b) & 0xbb6))
+#define DEF_2999 0xbb7u /* flag 2999 */
+#define DEF_3000(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3000); })
+#define DEF_3001 0xbb9u /* flag 3001 */
+#define DEF_3002(a, b) (((a) << 26) | ((b) & 0xbba))
+#define DEF_3003 0xbbbu /* flag 3003 */
+#define DEF_3004(a, b) (((a) << 28) | ((b) & 0xbbc))
+#define DEF_3005 0xbbdu /* flag 3005 */
+#define DEF_3006(a, b) (((a) << 30) | ((b) & 0xbbe))
+#define DEF_3007 0xbbfu /* flag 3007 */
+#define DEF_3008(a, b) (((a) << 1) | ((b) & 0xbc0))
+#define DEF_3009 0xbc1u /* flag 3009 */
+#define DEF_3010(a, b) (((a) << 3) | ((b) & 0xbc2))
+#define DEF_3011 0xbc3u /* flag 3011 */
+#define DEF_3012(a, b) (((a) << 5) | ((b) & 0xbc4))
+#define DEF_3013 0xbc5u /* flag 3013 */
+#define DEF_3014(a, b) (((a) << 7) | ((b) & 0xbc6))
+#define DEF_3015 0xbc7u /* flag 3015 */
+#define DEF_3016(a, b) (((a) << 9) | ((b) & 0xbc8))
+#define DEF_3017 0xbc9u /* flag 3017 */
+#define DEF_3018(a, b) (((a) << 11) | ((b) & 0xbca))
+#define DEF_3019 0xbcbu /* flag 3019 */
+#define DEF_3020(a, b) (((a) << 13) | ((b) & 0xbcc))
+#define DEF_3021 0xbcdu /* flag 3021 */
+#define DEF_3022(a, b) (((a) << 15) | ((b) & 0xbce))
+#define DEF_3023 0xbcfu /* flag 3023 */
+#define DEF_3024(a, b) (((a) << 17) | ((b) & 0xbd0))
+#define DEF_3025 0xbd1u /* flag 3025 */
+#define DEF_3026(a, b) (((a) << 19) | ((b) & 0xbd2))
+#define DEF_3027 0xbd3u /* flag 3027 */
+#define DEF_3028(a, b) (((a) << 21) | ((b) & 0xbd4))
+#define DEF_3029 0xbd5u /* flag 3029 */
+#define DEF_3030(a, b) (((a) << 23) | ((b) & 0xbd6))
+#define DEF_3031 0xbd7u /* flag 3031 */
+#define DEF_3032(a, b) (((a) << 25) | ((b) & 0xbd8))
+#define DEF_3033 0xbd9u /* flag 3033 */
+#define DEF_3034(a, b) (((a) << 27) | ((b) & 0xbda))
+#define DEF_3035 0xbdbu /* flag 3035 */
+#define DEF_3036(a, b) (((a) << 29) | ((b) & 0xbdc))
+#define DEF_3037 0xbddu /* flag 3037 */
+#define DEF_3038(a, b) (((a) << 0) | ((b) & 0xbde))
+#define DEF_3039 0xbdfu /* flag 3039 */
+#define DEF_3040(a, b) (((a) << 2) | ((b) & 0xbe0))
+#define DEF_3041 0xbe1u /* flag 3041 */
+#define DEF_3042(a, b) (((a) << 4) | ((b) & 0xbe2))
+#define DEF_3043 0xbe3u /* flag 3043 */
+#define DEF_3044(a, b) (((a) << 6) | ((b) & 0xbe4))
+#define DEF_3045 0xbe5u /* flag 3045 */
+#define DEF_3046(a, b) (((a) << 8) | ((b) & 0xbe6))
+#define DEF_3047 0xbe7u /* flag 3047 */
+#define DEF_3048(a, b) (((a) << 10) | ((b) & 0xbe8))
+#define DEF_3049 0xbe9u /* flag 3049 */
+#define DEF_3050(a, b) (((a) << 12) | ((b) & 0xbea))
+#define DEF_3051 0xbebu /* flag 3051 */
+#define DEF_3052(a, b) (((a) << 14) | ((b) & 0xbec))
+#define DEF_3053 0xbedu /* flag 3053 */
+#define DEF_3054(a, b) (((a) << 16) | ((b) & 0xbee))
+#define DEF_3055 0xbefu /* flag 3055 */
+#define DEF_3056(a, b) (((a) << 18) | ((b) & 0xbf0))
+#define DEF_3057 0xbf1u /* flag 3057 */
+#define DEF_3058(a, b) (((a) << 20) | ((b) & 0xbf2))
+#define DEF_3059 0xbf3u /* flag 3059 */
+#define DEF_3060(a, b) (((a) << 22) | ((b) & 0xbf4))
+#define DEF_3061 0xbf5u /* flag 3061 */
+#define DEF_3062(a, b) (((a) << 24) | ((b) & 0xbf6))
+#define DEF_3063 0xbf7u /* flag 3063 */
+#define DEF_3064(a, b) (((a) << 26) | ((b) & 0xbf8))
+#define DEF_3065 0xbf9u /* flag 3065 */
+#define DEF_3066(a, b) (((a) << 28) | ((b) & 0xbfa))
+#define DEF_3067 0xbfbu /* flag 3067 */
+#define DEF_3068(a, b) (((a) << 30) | ((b) & 0xbfc))
+#define DEF_3069 0xbfdu /* flag 3069 */
+#define DEF_3070(a, b) (((a) << 1) | ((b) & 0xbfe))
+#define DEF_3071 0xbffu /* flag 3071 */
+#define DEF_3072(a, b) (((a) << 3) | ((b) & 0xc00))
+#define DEF_3073 0xc01u /* flag 3073 */
+#define DEF_3074(a, b) (((a) << 5) | ((b) & 0xc02))
+#define DEF_3075 0xc03u /* flag 3075 */
+#define DEF_3076(a, b) (((a) << 7) | ((b) & 0xc04))
+#define DEF_3077 0xc05u /* flag 3077 */
+#define DEF_3078(a, b) (((a) << 9) | ((b) & 0xc06))
+#define DEF_3079 0xc07u /* flag 3079 */
+#define DEF_3080(a, b) (((a) << 11) | ((b) & 0xc08))
+#define DEF_3081 0xc09u /* flag 3081 */
+#define DEF_3082(a, b) (((a) << 13) | ((b) & 0xc0a))
+#define DEF_3083 0xc0bu /* flag 3083 */
+#define DEF_3084(a, b) (((a) << 15) | ((b) & 0xc0c))
+#define DEF_3085 0xc0du /* flag 3085 */
+#define DEF_3086(a, b) (((a) << 17) | ((b) & 0xc0e))
+#define DEF_3087 0xc0fu /* flag 3087 */
+#define DEF_3088(a, b) (((a) << 19) | ((b) & 0xc10))
+#define DEF_3089 0xc11u /* flag 3089 */
+#define DEF_3090(a, b) (((a) << 21) | ((b) & 0xc12))
+#define DEF_3091 0xc13u /* flag 3091 */
+#define DEF_3092(a, b) (((a) << 23) | ((b) & 0xc14))
+#define DEF_3093 0xc15u /* flag 3093 */
+#define DEF_3094(a, b) (((a) << 25) | ((b) & 0xc16))
+#define DEF_3095 0xc17u /* flag 3095 */
+#define DEF_3096(a, b) (((a) << 27) | ((b) & 0xc18))
+#define DEF_3097 0xc19u /* flag 3097 */
+#define DEF_3098(a, b) (((a) << 29) | ((b) & 0xc1a))
+#define DEF_3099 0xc1bu /* flag 3099 */
+#define DEF_3100(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3100); })
+#define DEF_3101 0xc1du /* flag 3101 */
+#define DEF_3102(a, b) (((a) << 2) | ((b) & 0xc1e))
+#define DEF_3103 0xc1fu /* flag 3103 */
+#define DEF_3104(a, b) (((a) << 4) | ((b) & 0xc20))
+#define DEF_3105 0xc21u /* flag 3105 */
+#define DEF_3106(a, b) (((a) << 6) | ((b) & 0xc22))
+#define DEF_3107 0xc23u /* flag 3107 */
+#define DEF_3108(a, b) (((a) << 8) | ((b) & 0xc24))
+#define DEF_3109 0xc25u /* flag 3109 */
+#define DEF_3110(a, b) (((a) << 10) | ((b) & 0xc26))
+#define DEF_3111 0xc27u /* flag 3111 */
+#define DEF_3112(a, b) (((a) << 12) | ((b) & 0xc28))
+#define DEF_3113 0xc29u /* flag 3113 */
+#define DEF_3114(a, b) (((a) << 14) | ((b) & 0xc2a))
+#define DEF_3115 0xc2bu /* flag 3115 */
+#define DEF_3116(a, b) (((a) << 16) | ((b) & 0xc2c))
+#define DEF_3117 0xc2du /* flag 3117 */
+#define DEF_3118(a, b) (((a) << 18) | ((b) & 0xc2e))
+#define DEF_3119 0xc2fu /* flag 3119 */
+#define DEF_3120(a, b) (((a) << 20) | ((b) & 0xc30))
+#define DEF_3121 0xc31u /* flag 3121 */
+#define DEF_3122(a, b) (((a) << 22) | ((b) & 0xc32))
+#define DEF_3123 0xc33u /* flag 3123 */
+#define DEF_3124(a, b) (((a) << 24) | ((b) & 0xc34))
+#define DEF_3125 0xc35u /* flag 3125 */
+#define DEF_3126(a, b) (((a) << 26) | ((b) & 0xc36))
+#define DEF_3127 0xc37u /* flag 3127 */
+#define DEF_3128(a, b) (((a) << 28) | ((b) & 0xc38))
+#define DEF_3129 0xc39u /* flag 3129 */
+#define DEF_3130(a, b) (((a) << 30) | ((b) & 0xc3a))
+#define DEF_3131 0xc3bu /* flag 3131 */
+#define DEF_3132(a, b) (((a) << 1) | ((b) & 0xc3c))
+#define DEF_3133 0xc3du /* flag 3133 */
+#define DEF_3134(a, b) (((a) << 3) | ((b) & 0xc3e))
+#define DEF_3135 0xc3fu /* flag 3135 */
+#define DEF_3136(a, b) (((a) << 5) | ((b) & 0xc40))
+#define DEF_3137 0xc41u /* flag 3137 */
+#define DEF_3138(a, b) (((a) << 7) | ((b) & 0xc42))
+#define DEF_3139 0xc43u /* flag 3139 */
+#define DEF_3140(a, b) (((a) << 9) | ((b) & 0xc44))
+#define DEF_3141 0xc45u /* flag 3141 */
+#define DEF_3142(a, b) (((a) << 11) | ((b) & 0xc46))
+#define DEF_3143 0xc47u /* flag 3143 */
+#define DEF_3144(a, b) (((a) << 13) | ((b) & 0xc48))
+#define DEF_3145 0xc49u /* flag 3145 */
+#define DEF_3146(a, b) (((a) << 15) | ((b) & 0xc4a))
+#define DEF_3147 0xc4bu /* flag 3147 */
+#define DEF_3148(a, b) (((a) << 17) | ((b) & 0xc4c))
+#define DEF_3149 0xc4du /* flag 3149 */
+#define DEF_3150(a, b) (((a) << 19) | ((b) & 0xc4e))
+#define DEF_3151 0xc4fu /* flag 3151 */
+#define DEF_3152(a, b) (((a) << 21) | ((b) & 0xc50))
+#define DEF_3153 0xc51u /* flag 3153 */
+#define DEF_3154(a, b) (((a) << 23) | ((b) & 0xc52))
+#define DEF_3155 0xc53u /* flag 3155 */
+#define DEF_3156(a, b) (((a) << 25) | ((b) & 0xc54))
+#define DEF_3157 0xc55u /* flag 3157 */
+#define DEF_3158(a, b) (((a) << 27) | ((b) & 0xc56))
+#define DEF_3159 0xc57u /* flag 3159 */
+#define DEF_3160(a, b) (((a) << 29) | ((b) & 0xc58))
+#define DEF_3161 0xc59u /* flag 3161 */
+#define DEF_3162(a, b) (((a) << 0) | ((b) & 0xc5a))
+#define DEF_3163 0xc5bu /* flag 3163 */
+#define DEF_3164(a, b) (((a) << 2) | ((b) & 0xc5c))
+#define DEF_3165 0xc5du /* flag 3165 */
+#define DEF_3166(a, b) (((a) << 4) | ((b) & 0xc5e))
+#define DEF_3167 0xc5fu /* flag 3167 */
+#define DEF_3168(a, b) (((a) << 6) | ((b) & 0xc60))
+#define DEF_3169 0xc61u /* flag 3169 */
+#define DEF_3170(a, b) (((a) << 8) | ((b) & 0xc62))
+#define DEF_3171 0xc63u /* flag 3171 */
+#define DEF_3172(a, b) (((a) << 10) | ((b) & 0xc64))
+#define DEF_3173 0xc65u /* flag 3173 */
+#define DEF_3174(a, b) (((a) << 12) | ((b) & 0xc66))
+#define DEF_3175 0xc67u /* flag 3175 */
+#define DEF_3176(a, b) (((a) << 14) | ((b) & 0xc68))
+#define DEF_3177 0xc69u /* flag 3177 */
+#define DEF_3178(a, b) (((a) << 16) | ((b) & 0xc6a))
+#define DEF_3179 0xc6bu /* flag 3179 */
+#define DEF_3180(a, b) (((a) << 18) | ((b) & 0xc6c))
+#define DEF_3181 0xc6du /* flag 3181 */
+#define DEF_3182(a, b) (((a) << 20) | ((b) & 0xc6e))
+#define DEF_3183 0xc6fu /* flag 3183 */
+#define DEF_3184(a, b) (((a) << 22) | ((b) & 0xc70))
+#define DEF_3185 0xc71u /* flag 3185 */
+#define DEF_3186(a, b) (((a) << 24) | ((b) & 0xc72))
+#define DEF_3187 0xc73u /* flag 3187 */
+#define DEF_3188(a, b) (((a) << 26) | ((b) & 0xc74))
+#define DEF_3189 0xc75u /* flag 3189 */
+#define DEF_3190(a, b) (((a) << 28) | ((b) & 0xc76))
+#define DEF_3191 0xc77u /* flag 3191 */
+#define DEF_3192(a, b) (((a) << 30) | ((b) & 0xc78))
+#define DEF_3193 0xc79u /* flag 3193 */
+#define DEF_3194(a, b) (((a) << 1) | ((b) & 0xc7a))
+#define DEF_3195 0xc7bu /* flag 3195 */
+#define DEF_3196(a, b) (((a) << 3) | ((b) & 0xc7c))
+#define DEF_3197 0xc7du /* flag 3197 */
+#define DEF_3198(a, b) (((a) << 5) | ((b) & 0xc7e))
+#define DEF_3199 0xc7fu /* flag 3199 */
+#define DEF_3200(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3200); })
+#define DEF_3201 0xc81u /* flag 3201 */
+#define DEF_3202(a, b) (((a) << 9) | ((b) & 0xc82))
+#define DEF_3203 0xc83u /* flag 3203 */
+#define DEF_3204(a, b) (((a) << 11) | ((b) & 0xc84))
+#define DEF_3205 0xc85u /* flag 3205 */
+#define DEF_3206(a, b) (((a) << 13) | ((b) & 0xc86))
+#define DEF_3207 0xc87u /* flag 3207 */
+#define DEF_3208(a, b) (((a) << 15) | ((b) & 0xc88))
+#define DEF_3209 0xc89u /* flag 3209 */
+#define DEF_3210(a, b) (((a) << 17) | ((b) & 0xc8a))
+#define DEF_3211 0xc8bu /* flag 3211 */
+#define DEF_3212(a, b) (((a) << 19) | ((b) & 0xc8c))
+#define DEF_3213 0xc8du /* flag 3213 */
+#define DEF_3214(a, b) (((a) << 21) | ((b) & 0xc8e))
+#define DEF_3215 0xc8fu /* flag 3215 */
+#define DEF_3216(a, b) (((a) << 23) | ((b) & 0xc90))
+#define DEF_3217 0xc91u /* flag 3217 */
+#define DEF_3218(a, b) (((a) << 25) | ((b) & 0xc92))
+#define DEF_3219 0xc93u /* flag 3219 */
+#define DEF_3220(a, b) (((a) << 27) | ((b) & 0xc94))
+#define DEF_3221 0xc95u /* flag 3221 */
+#define DEF_3222(a, b) (((a) << 29) | ((b) & 0xc96))
+#define DEF_3223 0xc97u /* flag 3223 */
+#define DEF_3224(a, b) (((a) << 0) | ((b) & 0xc98))
+#define DEF_3225 0xc99u /* flag 3225 */
+#define DEF_3226(a, b) (((a) << 2) | ((b) & 0xc9a))
+#define DEF_3227 0xc9bu /* flag 3227 */
+#define DEF_3228(a, b) (((a) << 4) | ((b) & 0xc9c))
+#define DEF_3229 0xc9du /* flag 3229 */
+#define DEF_3230(a, b) (((a) << 6) | ((b) & 0xc9e))
+#define DEF_3231 0xc9fu /* flag 3231 */
+#define DEF_3232(a, b) (((a) << 8) | ((b) & 0xca0))
+#define DEF_3233 0xca1u /* flag 3233 */
+#define DEF_3234(a, b) (((a) << 10) | ((b) & 0xca2))
+#define DEF_3235 0xca3u /* flag 3235 */
+#define DEF_3236(a, b) (((a) << 12) | ((b) & 0xca4))
+#define DEF_3237 0xca5u /* flag 3237 */
+#define DEF_3238(a, b) (((a) << 14) | ((b) & 0xca6))
+#define DEF_3239 0xca7u /* flag 3239 */
+#define DEF_3240(a, b) (((a) << 16) | ((b) & 0xca8))
+#define DEF_3241 0xca9u /* flag 3241 */
+#define DEF_3242(a, b) (((a) << 18) | ((b) & 0xcaa))
+#define DEF_3243 0xcabu /* flag 3243 */
+#define DEF_3244(a, b) (((a) << 20) | ((b) & 0xcac))
+#define DEF_3245 0xcadu /* flag 3245 */
+#define DEF_3246(a, b) (((a) << 22) | ((b) & 0xcae))
+#define DEF_3247 0xcafu /* flag 3247 */
+#define DEF_3248(a, b) (((a) << 24) | ((b) & 0xcb0))
+#define DEF_3249 0xcb1u /* flag 3249 */
+#define DEF_3250(a, b) (((a) << 26) | ((b) & 0xcb2))
+#define DEF_3251 0xcb3u /* flag 3251 */
+#define DEF_3252(a, b) (((a) << 28) | ((b) & 0xcb4))
+#define DEF_3253 0xcb5u /* flag 3253 */
+#define DEF_3254(a, b) (((a) << 30) | ((b) & 0xcb6))
+#define DEF_3255 0xcb7u /* flag 3255 */
+#define DEF_3256(a, b) (((a) << 1) | ((b) & 0xcb8))
+#define DEF_3257 0xcb9u /* flag 3257 */
+#define DEF_3258(a, b) (((a) << 3) | ((b) & 0xcba))
+#define DEF_3259 0xcbbu /* flag 3259 */
+#define DEF_3260(a, b) (((a) << 5) | ((b) & 0xcbc))
+#define DEF_3261 0xcbdu /* flag 3261 */
+#define DEF_3262(a, b) (((a) << 7) | ((b) & 0xcbe))
+#define DEF_3263 0xcbfu /* flag 3263 */
+#define DEF_3264(a, b) (((a) << 9) | ((b) & 0xcc0))
+#define DEF_3265 0xcc1u /* flag 3265 */
+#define DEF_3266(a, b) (((a) << 11) | ((b) & 0xcc2))
+#define DEF_3267 0xcc3u /* flag 3267 */
+#define DEF_3268(a, b) (((a) << 13) | ((b) & 0xcc4))
+#define DEF_3269 0xcc5u /* flag 3269 */
+#define DEF_3270(a, b) (((a) << 15) | ((b) & 0xcc6))
+#define DEF_3271 0xcc7u /* flag 3271 */
+#define DEF_3272(a, b) (((a) << 17) | ((b) & 0xcc8))
+#define DEF_3273 0xcc9u /* flag 3273 */
+#define DEF_3274(a, b) (((a) << 19) | ((b) & 0xcca))
+#define DEF_3275 0xccbu /* flag 3275 */
+#define DEF_3276(a, b) (((a) << 21) | ((b) & 0xccc))
+#define DEF_3277 0xccdu /* flag 3277 */
+#define DEF_3278(a, b) (((a) << 23) | ((b) & 0xcce))
+#define DEF_3279 0xccfu /* flag 3279 */
+#define DEF_3280(a, b) (((a) << 25) | ((b) & 0xcd0))
+#define DEF_3281 0xcd1u /* flag 3281 */
+#define DEF_3282(a, b) (((a) << 27) | ((b) & 0xcd2))
+#define DEF_3283 0xcd3u /* flag 3283 */
+#define DEF_3284(a, b) (((a) << 29) | ((b) & 0xcd4))
+#define DEF_3285 0xcd5u /* flag 3285 */
+#define DEF_3286(a, b) (((a) << 0) | ((b) & 0xcd6))
+#define DEF_3287 0xcd7u /* flag 3287 */
+#define DEF_3288(a, b) (((a) << 2) | ((b) & 0xcd8))
+#define DEF_3289 0xcd9u /* flag 3289 */
+#define DEF_3290(a, b) (((a) << 4) | ((b) & 0xcda))
+#define DEF_3291 0xcdbu /* flag 3291 */
+#define DEF_3292(a, b) (((a) << 6) | ((b) & 0xcdc))
+#define DEF_3293 0xcddu /* flag 3293 */
+#define DEF_3294(a, b) (((a) << 8) | ((b) & 0xcde))
+#define DEF_3295 0xcdfu /* flag 3295 */
+#define DEF_3296(a, b) (((a) << 10) | ((b) & 0xce0))
+#define DEF_3297 0xce1u /* flag 3297 */
+#define DEF_3298(a, b) (((a) << 12) | ((b) & 0xce2))
+#define DEF_3299 0xce3u /* flag 3299 */
+#define DEF_3300(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3300); })
+#define DEF_3301 0xce5u /* flag 3301 */
+#define DEF_3302(a, b) (((a) << 16) | ((b) & 0xce6))
+#define DEF_3303 0xce7u /* flag 3303 */
+#define DEF_3304(a, b) (((a) << 18) | ((b) & 0xce8))
+#define DEF_3305 0xce9u /* flag 3305 */
+#define DEF_3306(a, b) (((a) << 20) | ((b) & 0xcea))
+#define DEF_3307 0xcebu /* flag 3307 */
+#define DEF_3308(a, b) (((a) << 22) | ((b) & 0xcec))
+#define DEF_3309 0xcedu /* flag 3309 */
+#define DEF_3310(a, b) (((a) << 24) | ((b) & 0xcee))
+#define DEF_3311 0xcefu /* flag 3311 */
+#define DEF_3312(a, b) (((a) << 26) | ((b) & 0xcf0))
+#define DEF_3313 0xcf1u /* flag 3313 */
+#define DEF_3314(a, b) (((a) << 28) | ((b) & 0xcf2))
+#define DEF_3315 0xcf3u /* flag 3315 */
+#define DEF_3316(a, b) (((a) << 30) | ((b) & 0xcf4))
+#define DEF_3317 0xcf5u /* flag 3317 */
+#define DEF_3318(a, b) (((a) << 1) | ((b) & 0xcf6))
+#define DEF_3319 0xcf7u /* flag 3319 */
+#define DEF_3320(a, b) (((a) << 3) | ((b) & 0xcf8))
+#define DEF_3321 0xcf9u /* flag 3321 */
+#define DEF_3322(a, b) (((a) << 5) | ((b) & 0xcfa))
+#define DEF_3323 0xcfbu /* flag 3323 */
+#define DEF_3324(a, b) (((a) << 7) | ((b) & 0xcfc))
+#define DEF_3325 0xcfdu /* flag 3325 */
+#define DEF_3326(a, b) (((a) << 9) | ((b) & 0xcfe))
+#define DEF_3327 0xcffu /* flag 3327 */
+#define DEF_3328(a, b) (((a) << 11) | ((b) & 0xd00))
+#define DEF_3329 0xd01u /* flag 3329 */
+#define DEF_3330(a, b) (((a) << 13) | ((b) & 0xd02))
+#define DEF_3331 0xd03u /* flag 3331 */
+#define DEF_3332(a, b) (((a) << 15) | ((b) & 0xd04))
+#define DEF_3333 0xd05u /* flag 3333 */
+#define DEF_3334(a, b) (((a) << 17) | ((b) & 0xd06))
+#define DEF_3335 0xd07u /* flag 3335 */
+#define DEF_3336(a, b) (((a) << 19) | ((b) & 0xd08))
+#define DEF_3337 0xd09u /* flag 3337 */
+#define DEF_3338(a, b) (((a) << 21) | ((b) & 0xd0a))
+#define DEF_3339 0xd0bu /* flag 3339 */
+#define DEF_3340(a, b) (((a) << 23) | ((b) & 0xd0c))
+#define DEF_3341 0xd0du /* flag 3341 */
+#define DEF_3342(a, b) (((a) << 25) | ((b) & 0xd0e))
+#define DEF_3343 0xd0fu /* flag 3343 */
+#define DEF_3344(a, b) (((a) << 27) | ((b) & 0xd10))
+#define DEF_3345 0xd11u /* flag 3345 */
+#define DEF_3346(a, b) (((a) << 29) | ((b) & 0xd12))
+#define DEF_3347 0xd13u /* flag 3347 */
+#define DEF_3348(a, b) (((a) << 0) | ((b) & 0xd14))
+#define DEF_3349 0xd15u /* flag 3349 */
+#define DEF_3350(a, b) (((a) << 2) | ((b) & 0xd16))
+#define DEF_3351 0xd17u /* flag 3351 */
+#define DEF_3352(a, b) (((a) << 4) | ((b) & 0xd18))
+#define DEF_3353 0xd19u /* flag 3353 */
+#define DEF_3354(a, b) (((a) << 6) | ((b) & 0xd1a))
+#define DEF_3355 0xd1bu /* flag 3355 */
+#define DEF_3356(a, b) (((a) << 8) | ((b) & 0xd1c))
+#define DEF_3357 0xd1du /* flag 3357 */
+#define DEF_3358(a, b) (((a) << 10) | ((b) & 0xd1e))
+#define DEF_3359 0xd1fu /* flag 3359 */
+#define DEF_3360(a, b) (((a) << 12) | ((b) & 0xd20))
+#define DEF_3361 0xd21u /* flag 3361 */
+#define DEF_3362(a, b) (((a) << 14) | ((b) & 0xd22))
+#define DEF_3363 0xd23u /* flag 3363 */
+#define DEF_3364(a, b) (((a) << 16) | ((b) & 0xd24))
+#define DEF_3365 0xd25u /* flag 3365 */
+#define DEF_3366(a, b) (((a) << 18) | ((b) & 0xd26))
+#define DEF_3367 0xd27u /* flag 3367 */
+#define DEF_3368(a, b) (((a) << 20) | ((b) & 0xd28))
+#define DEF_3369 0xd29u /* flag 3369 */
+#define DEF_3370(a, b) (((a) << 22) | ((b) & 0xd2a))
+#define DEF_3371 0xd2bu /* flag 3371 */
+#define DEF_3372(a, b) (((a) << 24) | ((b) & 0xd2c))
+#define DEF_3373 0xd2du /* flag 3373 */
+#define DEF_3374(a, b) (((a) << 26) | ((b) & 0xd2e))
+#define DEF_3375 0xd2fu /* flag 3375 */
+#define DEF_3376(a, b) (((a) << 28) | ((b) & 0xd30))
+#define DEF_3377 0xd31u /* flag 3377 */
+#define DEF_3378(a, b) (((a) << 30) | ((b) & 0xd32))
+#define DEF_3379 0xd33u /* flag 3379 */
+#define DEF_3380(a, b) (((a) << 1) | ((b) & 0xd34))
+#define DEF_3381 0xd35u /* flag 3381 */
+#define DEF_3382(a, b) (((a) << 3) | ((b) & 0xd36))
+#define DEF_3383 0xd37u /* flag 3383 */
+#define DEF_3384(a, b) (((a) << 5) | ((b) & 0xd38))
+#define DEF_3385 0xd39u /* flag 3385 */
+#define DEF_3386(a, b) (((a) << 7) | ((b) & 0xd3a))
+#define DEF_3387 0xd3bu /* flag 3387 */
+#define DEF_3388(a, b) (((a) << 9) | ((b) & 0xd3c))
+#define DEF_3389 0xd3du /* flag 3389 */
+#define DEF_3390(a, b) (((a) << 11) | ((b) & 0xd3e))
+#define DEF_3391 0xd3fu /* flag 3391 */
+#define DEF_3392(a, b) (((a) << 13) | ((b) & 0xd40))
+#define DEF_3393 0xd41u /* flag 3393 */
+#define DEF_3394(a, b) (((a) << 15) | ((b) & 0xd42))
+#define DEF_3395 0xd43u /* flag 3395 */
+#define DEF_3396(a, b) (((a) << 17) | ((b) & 0xd44))
+#define DEF_3397 0xd45u /* flag 3397 */
+#define DEF_3398(a, b) (((a) << 19) | ((b) & 0xd46))
+#define DEF_3399 0xd47u /* flag 3399 */
+#define DEF_3400(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3400); })
+#define DEF_3401 0xd49u /* flag 3401 */
+#define DEF_3402(a, b) (((a) << 23) | ((b) & 0xd4a))
+#define DEF_3403 0xd4bu /* flag 3403 */
+#define DEF_3404(a, b) (((a) << 25) | ((b) & 0xd4c))
+#define DEF_3405 0xd4du /* flag 3405 */
+#define DEF_3406(a, b) (((a) << 27) | ((b) & 0xd4e))
+#define DEF_3407 0xd4fu /* flag 3407 */
+#define DEF_3408(a, b) (((a) << 29) | ((b) & 0xd50))
+#define DEF_3409 0xd51u /* flag 3409 */
+#define DEF_3410(a, b) (((a) << 0) | ((b) & 0xd52))
+#define DEF_3411 0xd53u /* flag 3411 */
+#define DEF_3412(a, b) (((a) << 2) | ((b) & 0xd54))
+#define DEF_3413 0xd55u /* flag 3413 */
+#define DEF_3414(a, b) (((a) << 4) | ((b) & 0xd56))
+#define DEF_3415 0xd57u /* flag 3415 */
+#define DEF_3416(a, b) (((a) << 6) | ((b) & 0xd58))
+#define DEF_3417 0xd59u /* flag 3417 */
+#define DEF_3418(a, b) (((a) << 8) | ((b) & 0xd5a))
+#define DEF_3419 0xd5bu /* flag 3419 */
+#define DEF_3420(a, b) (((a) << 10) | ((b) & 0xd5c))
+#define DEF_3421 0xd5du /* flag 3421 */
+#define DEF_3422(a, b) (((a) << 12) | ((b) & 0xd5e))
+#define DEF_3423 0xd5fu /* flag 3423 */
+#define DEF_3424(a, b) (((a) << 14) | ((b) & 0xd60))
+#define DEF_3425 0xd61u /* flag 3425 */
+#define DEF_3426(a, b) (((a) << 16) | ((b) & 0xd62))
+#define DEF_3427 0xd63u /* flag 3427 */
+#define DEF_3428(a, b) (((a) << 18) | ((b) & 0xd64))
+#define DEF_3429 0xd65u /* flag 3429 */
+#define DEF_3430(a, b) (((a) << 20) | ((b) & 0xd66))
+#define DEF_3431 0xd67u /* flag 3431 */
+#define DEF_3432(a, b) (((a) << 22) | ((b) & 0xd68))
+#define DEF_3433 0xd69u /* flag 3433 */
+#define DEF_3434(a, b) (((a) << 24) | ((b) & 0xd6a))
+#define DEF_3435 0xd6bu /* flag 3435 */
+#define DEF_3436(a, b) (((a) << 26) | ((b) & 0xd6c))
+#define DEF_3437 0xd6du /* flag 3437 */
+#define DEF_3438(a, b) (((a) << 28) | ((b) & 0xd6e))
+#define DEF_3439 0xd6fu /* flag 3439 */
+#define DEF_3440(a, b) (((a) << 30) | ((b) & 0xd70))
+#define DEF_3441 0xd71u /* flag 3441 */
+#define DEF_3442(a, b) (((a) << 1) | ((b) & 0xd72))
+#define DEF_3443 0xd73u /* flag 3443 */
+#define DEF_3444(a, b) (((a) << 3) | ((b) & 0xd74))
+#define DEF_3445 0xd75u /* flag 3445 */
+#define DEF_3446(a, b) (((a) << 5) | ((b) & 0xd76))
+#define DEF_3447 0xd77u /* flag 3447 */
+#define DEF_3448(a, b) (((a) << 7) | ((b) & 0xd78))
+#define DEF_3449 0xd79u /* flag 3449 */
+#define DEF_3450(a, b) (((a) << 9) | ((b) & 0xd7a))
+#define DEF_3451 0xd7bu /* flag 3451 */
+#define DEF_3452(a, b) (((a) << 11) | ((b) & 0xd7c))
+#define DEF_3453 0xd7du /* flag 3453 */
+#define DEF_3454(a, b) (((a) << 13) | ((b) & 0xd7e))
+#define DEF_3455 0xd7fu /* flag 3455 */
+#define DEF_3456(a, b) (((a) << 15) | ((b) & 0xd80))
+#define DEF_3457 0xd81u /* flag 3457 */
+#define DEF_3458(a, b) (((a) << 17) | ((b) & 0xd82))
+#define DEF_3459 0xd83u /* flag 3459 */
+#define DEF_3460(a, b) (((a) << 19) | ((b) & 0xd84))
+#define DEF_3461 0xd85u /* flag 3461 */
+#define DEF_3462(a, b) (((a) << 21) | ((b) & 0xd86))
+#define DEF_3463 0xd87u /* flag 3463 */
+#define DEF_3464(a, b) (((a) << 23) | ((b) & 0xd88))
+#define DEF_3465 0xd89u /* flag 3465 */
+#define DEF_3466(a, b) (((a) << 25) | ((b) & 0xd8a))
+#define DEF_3467 0xd8bu /* flag 3467 */
+#define DEF_3468(a, b) (((a) << 27) | ((b) & 0xd8c))
+#define DEF_3469 0xd8du /* flag 3469 */
+#define DEF_3470(a, b) (((a) << 29) | ((b) & 0xd8e))
+#define DEF_3471 0xd8fu /* flag 3471 */
+#define DEF_3472(a, b) (((a) << 0) | ((b) & 0xd90))
+#define DEF_3473 0xd91u /* flag 3473 */
+#define DEF_3474(a, b) (((a) << 2) | ((b) & 0xd92))
+#define DEF_3475 0xd93u /* flag 3475 */
+#define DEF_3476(a, b) (((a) << 4) | ((b) & 0xd94))
+#define DEF_3477 0xd95u /* flag 3477 */
+#define DEF_3478(a, b) (((a) << 6) | ((b) & 0xd96))
+#define DEF_3479 0xd97u /* flag 3479 */
+#define DEF_3480(a, b) (((a) << 8) | ((b) & 0xd98))
+#define DEF_3481 0xd99u /* flag 3481 */
+#define DEF_3482(a, b) (((a) << 10) | ((b) & 0xd9a))
+#define DEF_3483 0xd9bu /* flag 3483 */
+#define DEF_3484(a, b) (((a) << 12) | ((b) & 0xd9c))
+#define DEF_3485 0xd9du /* flag 3485 */
+#define DEF_3486(a, b) (((a) << 14) | ((b) & 0xd9e))
+#define DEF_3487 0xd9fu /* flag 3487 */
+#define DEF_3488(a, b) (((a) << 16) | ((b) & 0xda0))
+#define DEF_3489 0xda1u /* flag 3489 */
+#define DEF_3490(a, b) (((a) << 18) | ((b) & 0xda2))
+#define DEF_3491 0xda3u /* flag 3491 */
+#define DEF_3492(a, b) (((a) << 20) | ((b) & 0xda4))
+#define DEF_3493 0xda5u /* flag 3493 */
+#define DEF_3494(a, b) (((a) << 22) | ((b) & 0xda6))
+#define DEF_3495 0xda7u /* flag 3495 */
+#define DEF_3496(a, b) (((a) << 24) | ((b) & 0xda8))
+#define DEF_3497 0xda9u /* flag 3497 */
+#define DEF_3498(a, b) (((a) << 26) | ((b) & 0xdaa))
+#define DEF_3499 0xdabu /* flag 3499 */
+#define DEF_3500(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3500); })
+#define DEF_3501 0xdadu /* flag 3501 */
+#define DEF_3502(a, b) (((a) << 30) | ((b) & 0xdae))
+#define DEF_3503 0xdafu /* flag 3503 */
+#define DEF_3504(a, b) (((a) << 1) | ((b) & 0xdb0))
+#define DEF_3505 0xdb1u /* flag 3505 */
+#define DEF_3506(a, b) (((a) << 3) | ((b) & 0xdb2))
+#define DEF_3507 0xdb3u /* flag 3507 */
+#define DEF_3508(a, b) (((a) << 5) | ((b) & 0xdb4))
+#define DEF_3509 0xdb5u /* flag 3509 */
+#define DEF_3510(a, b) (((a) << 7) | ((b) & 0xdb6))
+#define DEF_3511 0xdb7u /* flag 3511 */
+#define DEF_3512(a, b) (((a) << 9) | ((b) & 0xdb8))
+#define DEF_3513 0xdb9u /* flag 3513 */
+#define DEF_3514(a, b) (((a) << 11) | ((b) & 0xdba))
+#define DEF_3515 0xdbbu /* flag 3515 */
+#define DEF_3516(a, b) (((a) << 13) | ((b) & 0xdbc))
+#define DEF_3517 0xdbdu /* flag 3517 */
+#define DEF_3518(a, b) (((a) << 15) | ((b) & 0xdbe))
+#define DEF_3519 0xdbfu /* flag 3519 */
+#define DEF_3520(a, b) (((a) << 17) | ((b) & 0xdc0))
+#define DEF_3521 0xdc1u /* flag 3521 */
+#define DEF_3522(a, b) (((a) << 19) | ((b) & 0xdc2))
+#define DEF_3523 0xdc3u /* flag 3523 */
+#define DEF_3524(a, b) (((a) << 21) | ((b) & 0xdc4))
+#define DEF_3525 0xdc5u /* flag 3525 */
+#define DEF_3526(a, b) (((a) << 23) | ((b) & 0xdc6))
+#define DEF_3527 0xdc7u /* flag 3527 */
+#define DEF_3528(a, b) (((a) << 25) | ((b) & 0xdc8))
+#define DEF_3529 0xdc9u /* flag 3529 */
+#define DEF_3530(a, b) (((a) << 27) | ((b) & 0xdca))
+#define DEF_3531 0xdcbu /* flag 3531 */
+#define DEF_3532(a, b) (((a) << 29) | ((b) & 0xdcc))
+#define DEF_3533 0xdcdu /* flag 3533 */
+#define DEF_3534(a, b) (((a) << 0) | ((b) & 0xdce))
+#define DEF_3535 0xdcfu /* flag 3535 */
+#define DEF_3536(a, b) (((a) << 2) | ((b) & 0xdd0))
+#define DEF_3537 0xdd1u /* flag 3537 */
+#define DEF_3538(a, b) (((a) << 4) | ((b) & 0xdd2))
+#define DEF_3539 0xdd3u /* flag 3539 */
+#define DEF_3540(a, b) (((a) << 6) | ((b) & 0xdd4))
+#define DEF_3541 0xdd5u /* flag 3541 */
+#define DEF_3542(a, b) (((a) << 8) | ((b) & 0xdd6))
+#define DEF_3543 0xdd7u /* flag 3543 */
+#define DEF_3544(a, b) (((a) << 10) | ((b) & 0xdd8))
+#define DEF_3545 0xdd9u /* flag 3545 */
+#define DEF_3546(a, b) (((a) << 12) | ((b) & 0xdda))
+#define DEF_3547 0xddbu /* flag 3547 */
+#define DEF_3548(a, b) (((a) << 14) | ((b) & 0xddc))
+#define DEF_3549 0xdddu /* flag 3549 */
+#define DEF_3550(a, b) (((a) << 16) | ((b) & 0xdde))
+#define DEF_3551 0xddfu /* flag 3551 */
+#define DEF_3552(a, b) (((a) << 18) | ((b) & 0xde0))
+#define DEF_3553 0xde1u /* flag 3553 */
+#define DEF_3554(a, b) (((a) << 20) | ((b) & 0xde2))
+#define DEF_3555 0xde3u /* flag 3555 */
+#define DEF_3556(a, b) (((a) << 22) | ((b) & 0xde4))
+#define DEF_3557 0xde5u /* flag 3557 */
+#define DEF_3558(a, b) (((a) << 24) | ((b) & 0xde6))
+#define DEF_3559 0xde7u /* flag 3559 */
+#define DEF_3560(a, b) (((a) << 26) | ((b) & 0xde8))
+#define DEF_3561 0xde9u /* flag 3561 */
+#define DEF_3562(a, b) (((a) << 28) | ((b) & 0xdea))
+#define DEF_3563 0xdebu /* flag 3563 */
+#define DEF_3564(a, b) (((a) << 30) | ((b) & 0xdec))
+#define DEF_3565 0xdedu /* flag 3565 */
+#define DEF_3566(a, b) (((a) << 1) | ((b) & 0xdee))
+#define DEF_3567 0xdefu /* flag 3567 */
+#define DEF_3568(a, b) (((a) << 3) | ((b) & 0xdf0))
+#define DEF_3569 0xdf1u /* flag 3569 */
+#define DEF_3570(a, b) (((a) << 5) | ((b) & 0xdf2))
+#define DEF_3571 0xdf3u /* flag 3571 */
+#define DEF_3572(a, b) (((a) << 7) | ((b) & 0xdf4))
+#define DEF_3573 0xdf5u /* flag 3573 */
+#define DEF_3574(a, b) (((a) << 9) | ((b) & 0xdf6))
+#define DEF_3575 0xdf7u /* flag 3575 */
+#define DEF_3576(a, b) (((a) << 11) | ((b) & 0xdf8))
+#define DEF_3577 0xdf9u /* flag 3577 */
+#define DEF_3578(a, b) (((a) << 13) | ((b) & 0xdfa))
+#define DEF_3579 0xdfbu /* flag 3579 */
+#define DEF_3580(a, b) (((a) << 15) | ((b) & 0xdfc))
+#define DEF_3581 0xdfdu /* flag 3581 */
+#define DEF_3582(a, b) (((a) << 17) | ((b) & 0xdfe))
+#define DEF_3583 0xdffu /* flag 3583 */
+#define DEF_3584(a, b) (((a) << 19) | ((b) & 0xe00))
+#define DEF_3585 0xe01u /* flag 3585 */
+#define DEF_3586(a, b) (((a) << 21) | ((b) & 0xe02))
+#define DEF_3587 0xe03u /* flag 3587 */
+#define DEF_3588(a, b) (((a) << 23) | ((b) & 0xe04))
+#define DEF_3589 0xe05u /* flag 3589 */
+#define DEF_3590(a, b) (((a) << 25) | ((b) & 0xe06))
+#define DEF_3591 0xe07u /* flag 3591 */
+#define DEF_3592(a, b) (((a) << 27) | ((b) & 0xe08))
+#define DEF_3593 0xe09u /* flag 3593 */
+#define DEF_3594(a, b) (((a) << 29) | ((b) & 0xe0a))
+#define DEF_3595 0xe0bu /* flag 3595 */
+#define DEF_3596(a, b) (((a) << 0) | ((b) & 0xe0c))
+#define DEF_3597 0xe0du /* flag 3597 */
+#define DEF_3598(a, b) (((a) << 2) | ((b) & 0xe0e))
+#define DEF_3599 0xe0fu /* flag 3599 */
+#define DEF_3600(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3600); })
+#define DEF_3601 0xe11u /* flag 3601 */
+#define DEF_3602(a, b) (((a) << 6) | ((b) & 0xe12))
+#define DEF_3603 0xe13u /* flag 3603 */
+#define DEF_3604(a, b) (((a) << 8) | ((b) & 0xe14))
+#define DEF_3605 0xe15u /* flag 3605 */
+#define DEF_3606(a, b) (((a) << 10) | ((b) & 0xe16))
+#define DEF_3607 0xe17u /* flag 3607 */
+#define DEF_3608(a, b) (((a) << 12) | ((b) & 0xe18))
+#define DEF_3609 0xe19u /* flag 3609 */
+#define DEF_3610(a, b) (((a) << 14) | ((b) & 0xe1a))
+#define DEF_3611 0xe1bu /* flag 3611 */
+#define DEF_3612(a, b) (((a) << 16) | ((b) & 0xe1c))
+#define DEF_3613 0xe1du /* flag 3613 */
+#define DEF_3614(a, b) (((a) << 18) | ((b) & 0xe1e))
+#define DEF_3615 0xe1fu /* flag 3615 */
+#define DEF_3616(a, b) (((a) << 20) | ((b) & 0xe20))
+#define DEF_3617 0xe21u /* flag 3617 */
+#define DEF_3618(a, b) (((a) << 22) | ((b) & 0xe22))
+#define DEF_3619 0xe23u /* flag 3619 */
+#define DEF_3620(a, b) (((a) << 24) | ((b) & 0xe24))
+#define DEF_3621 0xe25u /* flag 3621 */
+#define DEF_3622(a, b) (((a) << 26) | ((b) & 0xe26))
+#define DEF_3623 0xe27u /* flag 3623 */
+#define DEF_3624(a, b) (((a) << 28) | ((b) & 0xe28))
+#define DEF_3625 0xe29u /* flag 3625 */
+#define DEF_3626(a, b) (((a) << 30) | ((b) & 0xe2a))
+#define DEF_3627 0xe2bu /* flag 3627 */
+#define DEF_3628(a, b) (((a) << 1) | ((b) & 0xe2c))
+#define DEF_3629 0xe2du /* flag 3629 */
+#define DEF_3630(a, b) (((a) << 3) | ((b) & 0xe2e))
+#define DEF_3631 0xe2fu /* flag 3631 */
+#define DEF_3632(a, b) (((a) << 5) | ((b) & 0xe30))
+#define DEF_3633 0xe31u /* flag 3633 */
+#define DEF_3634(a, b) (((a) << 7) | ((b) & 0xe32))
+#define DEF_3635 0xe33u /* flag 3635 */
+#define DEF_3636(a, b) (((a) << 9) | ((b) & 0xe34))
+#define DEF_3637 0xe35u /* flag 3637 */
+#define DEF_3638(a, b) (((a) << 11) | ((b) & 0xe36))
+#define DEF_3639 0xe37u /* flag 3639 */
+#define DEF_3640(a, b) (((a) << 13) | ((b) & 0xe38))
+#define DEF_3641 0xe39u /* flag 3641 */
+#define DEF_3642(a, b) (((a) << 15) | ((b) & 0xe3a))
+#define DEF_3643 0xe3bu /* flag 3643 */
+#define DEF_3644(a, b) (((a) << 17) | ((b) & 0xe3c))
+#define DEF_3645 0xe3du /* flag 3645 */
+#define DEF_3646(a, b) (((a) << 19) | ((b) & 0xe3e))
+#define DEF_3647 0xe3fu /* flag 3647 */
+#define DEF_3648(a, b) (((a) << 21) | ((b) & 0xe40))
+#define DEF_3649 0xe41u /* flag 3649 */
+#define DEF_3650(a, b) (((a) << 23) | ((b) & 0xe42))
+#define DEF_3651 0xe43u /* flag 3651 */
+#define DEF_3652(a, b) (((a) << 25) | ((b) & 0xe44))
+#define DEF_3653 0xe45u /* flag 3653 */
+#define DEF_3654(a, b) (((a) << 27) | ((b) & 0xe46))
+#define DEF_3655 0xe47u /* flag 3655 */
+#define DEF_3656(a, b) (((a) << 29) | ((b) & 0xe48))
+#define DEF_3657 0xe49u /* flag 3657 */
+#define DEF_3658(a, b) (((a) << 0) | ((b) & 0xe4a))
+#define DEF_3659 0xe4bu /* flag 3659 */
+#define DEF_3660(a, b) (((a) << 2) | ((b) & 0xe4c))
+#define DEF_3661 0xe4du /* flag 3661 */
+#define DEF_3662(a, b) (((a) << 4) | ((b) & 0xe4e))
+#define DEF_3663 0xe4fu /* flag 3663 */
+#define DEF_3664(a, b) (((a) << 6) | ((b) & 0xe50))
+#define DEF_3665 0xe51u /* flag 3665 */
+#define DEF_3666(a, b) (((a) << 8) | ((b) & 0xe52))
+#define DEF_3667 0xe53u /* flag 3667 */
+#define DEF_3668(a, b) (((a) << 10) | ((b) & 0xe54))
+#define DEF_3669 0xe55u /* flag 3669 */
+#define DEF_3670(a, b) (((a) << 12) | ((b) & 0xe56))
+#define DEF_3671 0xe57u /* flag 3671 */
+#define DEF_3672(a, b) (((a) << 14) | ((b) & 0xe58))
+#define DEF_3673 0xe59u /* flag 3673 */
+#define DEF_3674(a, b) (((a) << 16) | ((b) & 0xe5a))
+#define DEF_3675 0xe5bu /* flag 3675 */
+#define DEF_3676(a, b) (((a) << 18) | ((b) & 0xe5c))
+#define DEF_3677 0xe5du /* flag 3677 */
+#define DEF_3678(a, b) (((a) << 20) | ((b) & 0xe5e))
+#define DEF_3679 0xe5fu /* flag 3679 */
+#define DEF_3680(a, b) (((a) << 22) | ((b) & 0xe60))
+#define DEF_3681 0xe61u /* flag 3681 */
+#define DEF_3682(a, b) (((a) << 24) | ((b) & 0xe62))
+#define DEF_3683 0xe63u /* flag 3683 */
+#define DEF_3684(a, b) (((a) << 26) | ((b) & 0xe64))
+#define DEF_3685 0xe65u /* flag 3685 */
+#define DEF_3686(a, b) (((a) << 28) | ((b) & 0xe66))
+#define DEF_3687 0xe67u /* flag 3687 */
+#define DEF_3688(a, b) (((a) << 30) | ((b) & 0xe68))
+#define DEF_3689 0xe69u /* flag 3689 */
+#define DEF_3690(a, b) (((a) << 1) | ((b) & 0xe6a))
+#define DEF_3691 0xe6bu /* flag 3691 */
+#define DEF_3692(a, b) (((a) << 3) | ((b) & 0xe6c))
+#define DEF_3693 0xe6du /* flag 3693 */
+#define DEF_3694(a, b) (((a) << 5) | ((b) & 0xe6e))
+#define DEF_3695 0xe6fu /* flag 3695 */
+#define DEF_3696(a, b) (((a) << 7) | ((b) & 0xe70))
+#define DEF_3697 0xe71u /* flag 3697 */
+#define DEF_3698(a, b) (((a) << 9) | ((b) & 0xe72))
+#define DEF_3699 0xe73u /* flag 3699 */
+#define DEF_3700(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3700); })
+#define DEF_3701 0xe75u /* flag 3701 */
+#define DEF_3702(a, b) (((a) << 13) | ((b) & 0xe76))
+#define DEF_3703 0xe77u /* flag 3703 */
+#define DEF_3704(a, b) (((a) << 15) | ((b) & 0xe78))
+#define DEF_3705 0xe79u /* flag 3705 */
+#define DEF_3706(a, b) (((a) << 17) | ((b) & 0xe7a))
+#define DEF_3707 0xe7bu /* flag 3707 */
+#define DEF_3708(a, b) (((a) << 19) | ((b) & 0xe7c))
+#define DEF_3709 0xe7du /* flag 3709 */
+#define DEF_3710(a, b) (((a) << 21) | ((b) & 0xe7e))
+#define DEF_3711 0xe7fu /* flag 3711 */
+#define DEF_3712(a, b) (((a) << 23) | ((b) & 0xe80))
+#define DEF_3713 0xe81u /* flag 3713 */
+#define DEF_3714(a, b) (((a) << 25) | ((b) & 0xe82))
+#define DEF_3715 0xe83u /* flag 3715 */
+#define DEF_3716(a, b) (((a) << 27) | ((b) & 0xe84))
+#define DEF_3717 0xe85u /* flag 3717 */
+#define DEF_3718(a, b) (((a) << 29) | ((b) & 0xe86))
+#define DEF_3719 0xe87u /* flag 3719 */
+#define DEF_3720(a, b) (((a) << 0) | ((b) & 0xe88))
+#define DEF_3721 0xe89u /* flag 3721 */
+#define DEF_3722(a, b) (((a) << 2) | ((b) & 0xe8a))
+#define DEF_3723 0xe8bu /* flag 3723 */
+#define DEF_3724(a, b) (((a) << 4) | ((b) & 0xe8c))
+#define DEF_3725 0xe8du /* flag 3725 */
+#define DEF_3726(a, b) (((a) << 6) | ((b) & 0xe8e))
+#define DEF_3727 0xe8fu /* flag 3727 */
+#define DEF_3728(a, b) (((a) << 8) | ((b) & 0xe90))
+#define DEF_3729 0xe91u /* flag 3729 */
+#define DEF_3730(a, b) (((a) << 10) | ((b) & 0xe92))
+#define DEF_3731 0xe93u /* flag 3731 */
+#define DEF_3732(a, b) (((a) << 12) | ((b) & 0xe94))
+#define DEF_3733 0xe95u /* flag 3733 */
+#define DEF_3734(a, b) (((a) << 14) | ((b) & 0xe96))
+#define DEF_3735 0xe97u /* flag 3735 */
+#define DEF_3736(a, b) (((a) << 16) | ((b) & 0xe98))
+#define DEF_3737 0xe99u /* flag 3737 */
+#define DEF_3738(a, b) (((a) << 18) | ((b) & 0xe9a))
+#define DEF_3739 0xe9bu /* flag 3739 */
+#define DEF_3740(a, b) (((a) << 20) | ((b) & 0xe9c))
+#define DEF_3741 0xe9du /* flag 3741 */
+#define DEF_3742(a, b) (((a) << 22) | ((b) & 0xe9e))
+#define DEF_3743 0xe9fu /* flag 3743 */
+#define DEF_3744(a, b) (((a) << 24) | ((b) & 0xea0))
+#define DEF_3745 0xea1u /* flag 3745 */
+#define DEF_3746(a, b) (((a) << 26) | ((b) & 0xea2))
+#define DEF_3747 0xea3u /* flag 3747 */
+#define DEF_3748(a, b) (((a) << 28) | ((b) & 0xea4))
+#define DEF_3749 0xea5u /* flag 3749 */
+#define DEF_3750(a, b) (((a) << 30) | ((b) & 0xea6))
+#define DEF_3751 0xea7u /* flag 3751 */
+#define DEF_3752(a, b) (((a) << 1) | ((b) & 0xea8))
+#define DEF_3753 0xea9u /* flag 3753 */
+#define DEF_3754(a, b) (((a) << 3) | ((b) & 0xeaa))
+#define DEF_3755 0xeabu /* flag 3755 */
+#define DEF_3756(a, b) (((a) << 5) | ((b) & 0xeac))
+#define DEF_3757 0xeadu /* flag 3757 */
+#define DEF_3758(a, b) (((a) << 7) | ((b) & 0xeae))
+#define DEF_3759 0xeafu /* flag 3759 */
+#define DEF_3760(a, b) (((a) << 9) | ((b) & 0xeb0))
+#define DEF_3761 0xeb1u /* flag 3761 */
+#define DEF_3762(a, b) (((a) << 11) | ((b) & 0xeb2))
+#define DEF_3763 0xeb3u /* flag 3763 */
+#define DEF_3764(a, b) (((a) << 13) | ((b) & 0xeb4))
+#define DEF_3765 0xeb5u /* flag 3765 */
+#define DEF_3766(a, b) (((a) << 15) | ((b) & 0xeb6))
+#define DEF_3767 0xeb7u /* flag 3767 */
+#define DEF_3768(a, b) (((a) << 17) | ((b) & 0xeb8))
+#define DEF_3769 0xeb9u /* flag 3769 */
+#define DEF_3770(a, b) (((a) << 19) | ((b) & 0xeba))
+#define DEF_3771 0xebbu /* flag 3771 */
+#define DEF_3772(a, b) (((a) << 21) | ((b) & 0xebc))
+#define DEF_3773 0xebdu /* flag 3773 */
+#define DEF_3774(a, b) (((a) << 23) | ((b) & 0xebe))
+#define DEF_3775 0xebfu /* flag 3775 */
+#define DEF_3776(a, b) (((a) << 25) | ((b) & 0xec0))
+#define DEF_3777 0xec1u /* flag 3777 */
+#define DEF_3778(a, b) (((a) << 27) | ((b) & 0xec2))
+#define DEF_3779 0xec3u /* flag 3779 */
+#define DEF_3780(a, b) (((a) << 29) | ((b) & 0xec4))
+#define DEF_3781 0xec5u /* flag 3781 */
+#define DEF_3782(a, b) (((a) << 0) | ((b) & 0xec6))
+#define DEF_3783 0xec7u /* flag 3783 */
+#define DEF_3784(a, b) (((a) << 2) | ((b) & 0xec8))
+#define DEF_3785 0xec9u /* flag 3785 */
+#define DEF_3786(a, b) (((a) << 4) | ((b) & 0xeca))
+#define DEF_3787 0xecbu /* flag 3787 */
+#define DEF_3788(a, b) (((a) << 6) | ((b) & 0xecc))
+#define DEF_3789 0xecdu /* flag 3789 */
+#define DEF_3790(a, b) (((a) << 8) | ((b) & 0xece))
+#define DEF_3791 0xecfu /* flag 3791 */
+#define DEF_3792(a, b) (((a) << 10) | ((b) & 0xed0))
+#define DEF_3793 0xed1u /* flag 3793 */
+#define DEF_3794(a, b) (((a) << 12) | ((b) & 0xed2))
+#define DEF_3795 0xed3u /* flag 3795 */
+#define DEF_3796(a, b) (((a) << 14) | ((b) & 0xed4))
+#define DEF_3797 0xed5u /* flag 3797 */
+#define DEF_3798(a, b) (((a) << 16) | ((b) & 0xed6))
+#define DEF_3799 0xed7u /* flag 3799 */
+#define DEF_3800(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3800); })
+#define DEF_3801 0xed9u /* flag 3801 */
+#define DEF_3802(a, b) (((a) << 20) | ((b) & 0xeda))
+#define DEF_3803 0xedbu /* flag 3803 */
+#define DEF_3804(a, b) (((a) << 22) | ((b) & 0xedc))
+#define DEF_3805 0xeddu /* flag 3805 */
+#define DEF_3806(a, b) (((a) << 24) | ((b) & 0xede))
+#define DEF_3807 0xedfu /* flag 3807 */
+#define DEF_3808(a, b) (((a) << 26) | ((b) & 0xee0))
+#define DEF_3809 0xee1u /* flag 3809 */
+#define DEF_3810(a, b) (((a) << 28) | ((b) & 0xee2))
+#define DEF_3811 0xee3u /* flag 3811 */
+#define DEF_3812(a, b) (((a) << 30) | ((b) & 0xee4))
+#define DEF_3813 0xee5u /* flag 3813 */
+#define DEF_3814(a, b) (((a) << 1) | ((b) & 0xee6))
+#define DEF_3815 0xee7u /* flag 3815 */
+#define DEF_3816(a, b) (((a) << 3) | ((b) & 0xee8))
+#define DEF_3817 0xee9u /* flag 3817 */
+#define DEF_3818(a, b) (((a) << 5) | ((b) & 0xeea))
+#define DEF_3819 0xeebu /* flag 3819 */
+#define DEF_3820(a, b) (((a) << 7) | ((b) & 0xeec))
+#define DEF_3821 0xeedu /* flag 3821 */
+#define DEF_3822(a, b) (((a) << 9) | ((b) & 0xeee))
+#define DEF_3823 0xeefu /* flag 3823 */
+#define DEF_3824(a, b) (((a) << 11) | ((b) & 0xef0))
+#define DEF_3825 0xef1u /* flag 3825 */
+#define DEF_3826(a, b) (((a) << 13) | ((b) & 0xef2))
+#define DEF_3827 0xef3u /* flag 3827 */
+#define DEF_3828(a, b) (((a) << 15) | ((b) & 0xef4))
+#define DEF_3829 0xef5u /* flag 3829 */
+#define DEF_3830(a, b) (((a) << 17) | ((b) & 0xef6))
+#define DEF_3831 0xef7u /* flag 3831 */
+#define DEF_3832(a, b) (((a) << 19) | ((b) & 0xef8))
+#define DEF_3833 0xef9u /* flag 3833 */
+#define DEF_3834(a, b) (((a) << 21) | ((b) & 0xefa))
+#define DEF_3835 0xefbu /* flag 3835 */
+#define DEF_3836(a, b) (((a) << 23) | ((b) & 0xefc))
+#define DEF_3837 0xefdu /* flag 3837 */
+#define DEF_3838(a, b) (((a) << 25) | ((b) & 0xefe))
+#define DEF_3839 0xeffu /* flag 3839 */
+#define DEF_3840(a, b) (((a) << 27) | ((b) & 0xf00))
+#define DEF_3841 0xf01u /* flag 3841 */
+#define DEF_3842(a, b) (((a) << 29) | ((b) & 0xf02))
+#define DEF_3843 0xf03u /* flag 3843 */
+#define DEF_3844(a, b) (((a) << 0) | ((b) & 0xf04))
+#define DEF_3845 0xf05u /* flag 3845 */
+#define DEF_3846(a, b) (((a) << 2) | ((b) & 0xf06))
+#define DEF_3847 0xf07u /* flag 3847 */
+#define DEF_3848(a, b) (((a) << 4) | ((b) & 0xf08))
+#define DEF_3849 0xf09u /* flag 3849 */
+#define DEF_3850(a, b) (((a) << 6) | ((b) & 0xf0a))
+#define DEF_3851 0xf0bu /* flag 3851 */
+#define DEF_3852(a, b) (((a) << 8) | ((b) & 0xf0c))
+#define DEF_3853 0xf0du /* flag 3853 */
+#define DEF_3854(a, b) (((a) << 10) | ((b) & 0xf0e))
+#define DEF_3855 0xf0fu /* flag 3855 */
+#define DEF_3856(a, b) (((a) << 12) | ((b) & 0xf10))
+#define DEF_3857 0xf11u /* flag 3857 */
+#define DEF_3858(a, b) (((a) << 14) | ((b) & 0xf12))
+#define DEF_3859 0xf13u /* flag 3859 */
+#define DEF_3860(a, b) (((a) << 16) | ((b) & 0xf14))
+#define DEF_3861 0xf15u /* flag 3861 */
+#define DEF_3862(a, b) (((a) << 18) | ((b) & 0xf16))
+#define DEF_3863 0xf17u /* flag 3863 */
+#define DEF_3864(a, b) (((a) << 20) | ((b) & 0xf18))
+#define DEF_3865 0xf19u /* flag 3865 */
+#define DEF_3866(a, b) (((a) << 22) | ((b) & 0xf1a))
+#define DEF_3867 0xf1bu /* flag 3867 */
+#define DEF_3868(a, b) (((a) << 24) | ((b) & 0xf1c))
+#define DEF_3869 0xf1du /* flag 3869 */
+#define DEF_3870(a, b) (((a) << 26) | ((b) & 0xf1e))
+#define DEF_3871 0xf1fu /* flag 3871 */
+#define DEF_3872(a, b) (((a) << 28) | ((b) & 0xf20))
+#define DEF_3873 0xf21u /* flag 3873 */
+#define DEF_3874(a, b) (((a) << 30) | ((b) & 0xf22))
+#define DEF_3875 0xf23u /* flag 3875 */
+#define DEF_3876(a, b) (((a) << 1) | ((b) & 0xf24))
+#define DEF_3877 0xf25u /* flag 3877 */
+#define DEF_3878(a, b) (((a) << 3) | ((b) & 0xf26))
+#define DEF_3879 0xf27u /* flag 3879 */
+#define DEF_3880(a, b) (((a) << 5) | ((b) & 0xf28))
+#define DEF_3881 0xf29u /* flag 3881 */
+#define DEF_3882(a, b) (((a) << 7) | ((b) & 0xf2a))
+#define DEF_3883 0xf2bu /* flag 3883 */
+#define DEF_3884(a, b) (((a) << 9) | ((b) & 0xf2c))
+#define DEF_3885 0xf2du /* flag 3885 */
+#define DEF_3886(a, b) (((a) << 11) | ((b) & 0xf2e))
+#define DEF_3887 0xf2fu /* flag 3887 */
+#define DEF_3888(a, b) (((a) << 13) | ((b) & 0xf30))
+#define DEF_3889 0xf31u /* flag 3889 */
+#define DEF_3890(a, b) (((a) << 15) | ((b) & 0xf32))
+#define DEF_3891 0xf33u /* flag 3891 */
+#define DEF_3892(a, b) (((a) << 17) | ((b) & 0xf34))
+#define DEF_3893 0xf35u /* flag 3893 */
+#define DEF_3894(a, b) (((a) << 19) | ((b) & 0xf36))
+#define DEF_3895 0xf37u /* flag 3895 */
+#define DEF_3896(a, b) (((a) << 21) | ((b) & 0xf38))
+#define DEF_3897 0xf39u /* flag 3897 */
+#define DEF_3898(a, b) (((a) << 23) | ((b) & 0xf3a))
+#define DEF_3899 0xf3bu /* flag 3899 */
+#define DEF_3900(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 3900); })
+#define DEF_3901 0xf3du /* flag 3901 */
+#define DEF_3902(a, b) (((a) << 27) | ((b) & 0xf3e))
+#define DEF_3903 0xf3fu /* flag 3903 */
+#define DEF_3904(a, b) (((a) << 29) | ((b) & 0xf40))
+#define DEF_3905 0xf41u /* flag 3905 */
+#define DEF_3906(a, b) (((a) << 0) | ((b) & 0xf42))
+#define DEF_3907 0xf43u /* flag 3907 */
+#define DEF_3908(a, b) (((a) << 2) | ((b) & 0xf44))
+#define DEF_3909 0xf45u /* flag 3909 */
+#define DEF_3910(a, b) (((a) << 4) | ((b) & 0xf46))
+#define DEF_3911 0xf47u /* flag 3911 */
+#define DEF_3912(a, b) (((a) << 6) | ((b) & 0xf48))
+#define DEF_3913 0xf49u /* flag 3913 */
+#define DEF_3914(a, b) (((a) << 8) | ((b) & 0xf4a))
+#define DEF_3915 0xf4bu /* flag 3915 */
+#define DEF_3916(a, b) (((a) << 10) | ((b) & 0xf4c))
+#define DEF_3917 0xf4du /* flag 3917 */
+#define DEF_3918(a, b) (((a) << 12) | ((b) & 0xf4e))
+#define DEF_3919 0xf4fu /* flag 3919 */
+#define DEF_3920(a, b) (((a) << 14) | ((b) & 0xf50))
+#define DEF_3921 0xf51u /* flag 3921 */
+#define DEF_3922(a, b) (((a) << 16) | ((b) & 0xf52))
+#define DEF_3923 0xf53u /* flag 3923 */
+#define DEF_3924(a, b) (((a) << 18) | ((b) & 0xf54))
+#define DEF_3925 0xf55u /* flag 3925 */
+#define DEF_3926(a, b) (((a) << 20) | ((b) & 0xf56))
+#define DEF_3927 0xf57u /* flag 3927 */
+#define DEF_3928(a, b) (((a) << 22) | ((b) & 0xf58))
+#define DEF_3929 0xf59u /* flag 3929 */
+#define DEF_3930(a, b) (((a) << 24) | ((b) & 0xf5a))
+#define DEF_3931 0xf5bu /* flag 3931 */
+#define DEF_3932(a, b) (((a) << 26) | ((b) & 0xf5c))
+#define DEF_3933 0xf5du /* flag 3933 */
+#define DEF_3934(a, b) (((a) << 28) | ((b) & 0xf5e))
+#define DEF_3935 0xf5fu /* flag 3935 */
+#define DEF_3936(a, b) (((a) << 30) | ((b) & 0xf60))
+#define DEF_3937 0xf61u /* flag 3937 */
+#define DEF_3938(a, b) (((a) << 1) | ((b) & 0xf62))
+#define DEF_3939 0xf63u /* flag 3939 */
+#define DEF_3940(a, b) (((a) << 3) | ((b) & 0xf64))
+#define DEF_3941 0xf65u /* flag 3941 */
+#define DEF_3942(a, b) (((a) << 5) | ((b) & 0xf66))
+#define DEF_3943 0xf67u /* flag 3943 */
+#define DEF_3944(a, b) (((a) << 7) | ((b) & 0xf68))
+#define DEF_3945 0xf69u /* flag 3945 */
+#define DEF_3946(a, b) (((a) << 9) | ((b) & 0xf6a))
+#define DEF_3947 0xf6bu /* flag 3947 */
+#define DEF_3948(a, b) (((a) << 11) | ((b) & 0xf6c))
+#define DEF_3949 0xf6du /* flag 3949 */
+#define DEF_3950(a, b) (((a) << 13) | ((b) & 0xf6e))
+#define DEF_3951 0xf6fu /* flag 3951 */
+#define DEF_3952(a, b) (((a) << 15) | ((b) & 0xf70))
+#define DEF_3953 0xf71u /* flag 3953 */
+#define DEF_3954(a, b) (((a) << 17) | ((b) & 0xf72))
+#define DEF_3955 0xf73u /* flag 3955 */
+#define DEF_3956(a, b) (((a) << 19) | ((b) & 0xf74))
+#define DEF_3957 0xf75u /* flag 3957 */
+#define DEF_3958(a, b) (((a) << 21) | ((b) & 0xf76))
+#define DEF_3959 0xf77u /* flag 3959 */
+#define DEF_3960(a, b) (((a) << 23) | ((b) & 0xf78))
+#define DEF_3961 0xf79u /* flag 3961 */
+#define DEF_3962(a, b) (((a) << 25) | ((b) & 0xf7a))
+#define DEF_3963 0xf7bu /* flag 3963 */
+#define DEF_3964(a, b) (((a) << 27) | ((b) & 0xf7c))
+#define DEF_3965 0xf7du /* flag 3965 */
+#define DEF_3966(a, b) (((a) << 29) | ((b) & 0xf7e))
+#define DEF_3967 0xf7fu /* flag 3967 */
+#define DEF_3968(a, b) (((a) << 0) | ((b) & 0xf80))
+#define DEF_3969 0xf81u /* flag 3969 */
+#define DEF_3970(a, b) (((a) << 2) | ((b) & 0xf82))
+#define DEF_3971 0xf83u /* flag 3971 */
+#define DEF_3972(a, b) (((a) << 4) | ((b) & 0xf84))
+#define DEF_3973 0xf85u /* flag 3973 */
+#define DEF_3974(a, b) (((a) << 6) | ((b) & 0xf86))
+#define DEF_3975 0xf87u /* flag 3975 */
+#define DEF_3976(a, b) (((a) << 8) | ((b) & 0xf88))
+#define DEF_3977 0xf89u /* flag 3977 */
+#define DEF_3978(a, b) (((a) << 10) | ((b) & 0xf8a))
+#define DEF_3979 0xf8bu /* flag 3979 */
+#define DEF_3980(a, b) (((a) << 12) | ((b) & 0xf8c))
+#define DEF_3981 0xf8du /* flag 3981 */
+#define DEF_3982(a, b) (((a) << 14) | ((b) & 0xf8e))
+#define DEF_3983 0xf8fu /* flag 3983 */
+#define DEF_3984(a, b) (((a) << 16) | ((b) & 0xf90))
+#define DEF_3985 0xf91u /* flag 3985 */
+#define DEF_3986(a, b) (((a) << 18) | ((b) & 0xf92))
+#define DEF_3987 0xf93u /* flag 3987 */
+#define DEF_3988(a, b) (((a) << 20) | ((b) & 0xf94))
+#define DEF_3989 0xf95u /* flag 3989 */
+#define DEF_3990(a, b) (((a) << 22) | ((b) & 0xf96))
+#define DEF_3991 0xf97u /* flag 3991 */
+#define DEF_3992(a, b) (((a) << 24) | ((b) & 0xf98))
+#define DEF_3993 0xf99u /* flag 3993 */
+#define DEF_3994(a, b) (((a) << 26) | ((b) & 0xf9a))
+#define DEF_3995 0xf9bu /* flag 3995 */
+#define DEF_3996(a, b) (((a) << 28) | ((b) & 0xf9c))
+#define DEF_3997 0xf9du /* flag 3997 */
+#define DEF_3998(a, b) (((a) << 30) | ((b) & 0xf9e))
+#define DEF_3999 0xf9fu /* flag 3999 */
+#define DEF_4000(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4000); })
+#define DEF_4001 0xfa1u /* flag 4001 */
+#define DEF_4002(a, b) (((a) << 3) | ((b) & 0xfa2))
+#define DEF_4003 0xfa3u /* flag 4003 */
+#define DEF_4004(a, b) (((a) << 5) | ((b) & 0xfa4))
+#define DEF_4005 0xfa5u /* flag 4005 */
+#define DEF_4006(a, b) (((a) << 7) | ((b) & 0xfa6))
+#define DEF_4007 0xfa7u /* flag 4007 */
+#define DEF_4008(a, b) (((a) << 9) | ((b) & 0xfa8))
+#define DEF_4009 0xfa9u /* flag 4009 */
+#define DEF_4010(a, b) (((a) << 11) | ((b) & 0xfaa))
+#define DEF_4011 0xfabu /* flag 4011 */
+#define DEF_4012(a, b) (((a) << 13) | ((b) & 0xfac))
+#define DEF_4013 0xfadu /* flag 4013 */
+#define DEF_4014(a, b) (((a) << 15) | ((b) & 0xfae))
+#define DEF_4015 0xfafu /* flag 4015 */
+#define DEF_4016(a, b) (((a) << 17) | ((b) & 0xfb0))
+#define DEF_4017 0xfb1u /* flag 4017 */
+#define DEF_4018(a, b) (((a) << 19) | ((b) & 0xfb2))
+#define DEF_4019 0xfb3u /* flag 4019 */
+#define DEF_4020(a, b) (((a) << 21) | ((b) & 0xfb4))
+#define DEF_4021 0xfb5u /* flag 4021 */
+#define DEF_4022(a, b) (((a) << 23) | ((b) & 0xfb6))
+#define DEF_4023 0xfb7u /* flag 4023 */
+#define DEF_4024(a, b) (((a) << 25) | ((b) & 0xfb8))
+#define DEF_4025 0xfb9u /* flag 4025 */
+#define DEF_4026(a, b) (((a) << 27) | ((b) & 0xfba))
+#define DEF_4027 0xfbbu /* flag 4027 */
+#define DEF_4028(a, b) (((a) << 29) | ((b) & 0xfbc))
+#define DEF_4029 0xfbdu /* flag 4029 */
+#define DEF_4030(a, b) (((a) << 0) | ((b) & 0xfbe))
+#define DEF_4031 0xfbfu /* flag 4031 */
+#define DEF_4032(a, b) (((a) << 2) | ((b) & 0xfc0))
+#define DEF_4033 0xfc1u /* flag 4033 */
+#define DEF_4034(a, b) (((a) << 4) | ((b) & 0xfc2))
+#define DEF_4035 0xfc3u /* flag 4035 */
+#define DEF_4036(a, b) (((a) << 6) | ((b) & 0xfc4))
+#define DEF_4037 0xfc5u /* flag 4037 */
+#define DEF_4038(a, b) (((a) << 8) | ((b) & 0xfc6))
+#define DEF_4039 0xfc7u /* flag 4039 */
+#define DEF_4040(a, b) (((a) << 10) | ((b) & 0xfc8))
+#define DEF_4041 0xfc9u /* flag 4041 */
+#define DEF_4042(a, b) (((a) << 12) | ((b) & 0xfca))
+#define DEF_4043 0xfcbu /* flag 4043 */
+#define DEF_4044(a, b) (((a) << 14) | ((b) & 0xfcc))
+#define DEF_4045 0xfcdu /* flag 4045 */
+#define DEF_4046(a, b) (((a) << 16) | ((b) & 0xfce))
+#define DEF_4047 0xfcfu /* flag 4047 */
+#define DEF_4048(a, b) (((a) << 18) | ((b) & 0xfd0))
+#define DEF_4049 0xfd1u /* flag 4049 */
+#define DEF_4050(a, b) (((a) << 20) | ((b) & 0xfd2))
+#define DEF_4051 0xfd3u /* flag 4051 */
+#define DEF_4052(a, b) (((a) << 22) | ((b) & 0xfd4))
+#define DEF_4053 0xfd5u /* flag 4053 */
+#define DEF_4054(a, b) (((a) << 24) | ((b) & 0xfd6))
+#define DEF_4055 0xfd7u /* flag 4055 */
+#define DEF_4056(a, b) (((a) << 26) | ((b) & 0xfd8))
+#define DEF_4057 0xfd9u /* flag 4057 */
+#define DEF_4058(a, b) (((a) << 28) | ((b) & 0xfda))
+#define DEF_4059 0xfdbu /* flag 4059 */
+#define DEF_4060(a, b) (((a) << 30) | ((b) & 0xfdc))
+#define DEF_4061 0xfddu /* flag 4061 */
+#define DEF_4062(a, b) (((a) << 1) | ((b) & 0xfde))
+#define DEF_4063 0xfdfu /* flag 4063 */
+#define DEF_4064(a, b) (((a) << 3) | ((b) & 0xfe0))
+#define DEF_4065 0xfe1u /* flag 4065 */
+#define DEF_4066(a, b) (((a) << 5) | ((b) & 0xfe2))
+#define DEF_4067 0xfe3u /* flag 4067 */
+#define DEF_4068(a, b) (((a) << 7) | ((b) & 0xfe4))
+#define DEF_4069 0xfe5u /* flag 4069 */
+#define DEF_4070(a, b) (((a) << 9) | ((b) & 0xfe6))
+#define DEF_4071 0xfe7u /* flag 4071 */
+#define DEF_4072(a, b) (((a) << 11) | ((b) & 0xfe8))
+#define DEF_4073 0xfe9u /* flag 4073 */
+#define DEF_4074(a, b) (((a) << 13) | ((b) & 0xfea))
+#define DEF_4075 0xfebu /* flag 4075 */
+#define DEF_4076(a, b) (((a) << 15) | ((b) & 0xfec))
+#define DEF_4077 0xfedu /* flag 4077 */
+#define DEF_4078(a, b) (((a) << 17) | ((b) & 0xfee))
+#define DEF_4079 0xfefu /* flag 4079 */
+#define DEF_4080(a, b) (((a) << 19) | ((b) & 0xff0))
+#define DEF_4081 0xff1u /* flag 4081 */
+#define DEF_4082(a, b) (((a) << 21) | ((b) & 0xff2))
+#define DEF_4083 0xff3u /* flag 4083 */
+#define DEF_4084(a, b) (((a) << 23) | ((b) & 0xff4))
+#define DEF_4085 0xff5u /* flag 4085 */
+#define DEF_4086(a, b) (((a) << 25) | ((b) & 0xff6))
+#define DEF_4087 0xff7u /* flag 4087 */
+#define DEF_4088(a, b) (((a) << 27) | ((b) & 0xff8))
+#define DEF_4089 0xff9u /* flag 4089 */
+#define DEF_4090(a, b) (((a) << 29) | ((b) & 0xffa))
+#define DEF_4091 0xffbu /* flag 4091 */
+#define DEF_4092(a, b) (((a) << 0) | ((b) & 0xffc))
+#define DEF_4093 0xffdu /* flag 4093 */
+#define DEF_4094(a, b) (((a) << 2) | ((b) & 0xffe))
+#define DEF_4095 0xfffu /* flag 4095 */
+#define DEF_4096(a, b) (((a) << 4) | ((b) & 0x1000))
+#define DEF_4097 0x1001u /* flag 4097 */
+#define DEF_4098(a, b) (((a) << 6) | ((b) & 0x1002))
+#define DEF_4099 0x1003u /* flag 4099 */
+#define DEF_4100(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4100); })
+#define DEF_4101 0x1005u /* flag 4101 */
+#define DEF_4102(a, b) (((a) << 10) | ((b) & 0x1006))
+#define DEF_4103 0x1007u /* flag 4103 */
+#define DEF_4104(a, b) (((a) << 12) | ((b) & 0x1008))
+#define DEF_4105 0x1009u /* flag 4105 */
+#define DEF_4106(a, b) (((a) << 14) | ((b) & 0x100a))
+#define DEF_4107 0x100bu /* flag 4107 */
+#define DEF_4108(a, b) (((a) << 16) | ((b) & 0x100c))
+#define DEF_4109 0x100du /* flag 4109 */
+#define DEF_4110(a, b) (((a) << 18) | ((b) & 0x100e))
+#define DEF_4111 0x100fu /* flag 4111 */
+#define DEF_4112(a, b) (((a) << 20) | ((b) & 0x1010))
+#define DEF_4113 0x1011u /* flag 4113 */
+#define DEF_4114(a, b) (((a) << 22) | ((b) & 0x1012))
+#define DEF_4115 0x1013u /* flag 4115 */
+#define DEF_4116(a, b) (((a) << 24) | ((b) & 0x1014))
+#define DEF_4117 0x1015u /* flag 4117 */
+#define DEF_4118(a, b) (((a) << 26) | ((b) & 0x1016))
+#define DEF_4119 0x1017u /* flag 4119 */
+#define DEF_4120(a, b) (((a) << 28) | ((b) & 0x1018))
+#define DEF_4121 0x1019u /* flag 4121 */
+#define DEF_4122(a, b) (((a) << 30) | ((b) & 0x101a))
+#define DEF_4123 0x101bu /* flag 4123 */
+#define DEF_4124(a, b) (((a) << 1) | ((b) & 0x101c))
+#define DEF_4125 0x101du /* flag 4125 */
+#define DEF_4126(a, b) (((a) << 3) | ((b) & 0x101e))
+#define DEF_4127 0x101fu /* flag 4127 */
+#define DEF_4128(a, b) (((a) << 5) | ((b) & 0x1020))
+#define DEF_4129 0x1021u /* flag 4129 */
+#define DEF_4130(a, b) (((a) << 7) | ((b) & 0x1022))
+#define DEF_4131 0x1023u /* flag 4131 */
+#define DEF_4132(a, b) (((a) << 9) | ((b) & 0x1024))
+#define DEF_4133 0x1025u /* flag 4133 */
+#define DEF_4134(a, b) (((a) << 11) | ((b) & 0x1026))
+#define DEF_4135 0x1027u /* flag 4135 */
+#define DEF_4136(a, b) (((a) << 13) | ((b) & 0x1028))
+#define DEF_4137 0x1029u /* flag 4137 */
+#define DEF_4138(a, b) (((a) << 15) | ((b) & 0x102a))
+#define DEF_4139 0x102bu /* flag 4139 */
+#define DEF_4140(a, b) (((a) << 17) | ((b) & 0x102c))
+#define DEF_4141 0x102du /* flag 4141 */
+#define DEF_4142(a, b) (((a) << 19) | ((b) & 0x102e))
+#define DEF_4143 0x102fu /* flag 4143 */
+#define DEF_4144(a, b) (((a) << 21) | ((b) & 0x1030))
+#define DEF_4145 0x1031u /* flag 4145 */
+#define DEF_4146(a, b) (((a) << 23) | ((b) & 0x1032))
+#define DEF_4147 0x1033u /* flag 4147 */
+#define DEF_4148(a, b) (((a) << 25) | ((b) & 0x1034))
+#define DEF_4149 0x1035u /* flag 4149 */
+#define DEF_4150(a, b) (((a) << 27) | ((b) & 0x1036))
+#define DEF_4151 0x1037u /* flag 4151 */
+#define DEF_4152(a, b) (((a) << 29) | ((b) & 0x1038))
+#define DEF_4153 0x1039u /* flag 4153 */
+#define DEF_4154(a, b) (((a) << 0) | ((b) & 0x103a))
+#define DEF_4155 0x103bu /* flag 4155 */
+#define DEF_4156(a, b) (((a) << 2) | ((b) & 0x103c))
+#define DEF_4157 0x103du /* flag 4157 */
+#define DEF_4158(a, b) (((a) << 4) | ((b) & 0x103e))
+#define DEF_4159 0x103fu /* flag 4159 */
+#define DEF_4160(a, b) (((a) << 6) | ((b) & 0x1040))
+#define DEF_4161 0x1041u /* flag 4161 */
+#define DEF_4162(a, b) (((a) << 8) | ((b) & 0x1042))
+#define DEF_4163 0x1043u /* flag 4163 */
+#define DEF_4164(a, b) (((a) << 10) | ((b) & 0x1044))
+#define DEF_4165 0x1045u /* flag 4165 */
+#define DEF_4166(a, b) (((a) << 12) | ((b) & 0x1046))
+#define DEF_4167 0x1047u /* flag 4167 */
+#define DEF_4168(a, b) (((a) << 14) | ((b) & 0x1048))
+#define DEF_4169 0x1049u /* flag 4169 */
+#define DEF_4170(a, b) (((a) << 16) | ((b) & 0x104a))
+#define DEF_4171 0x104bu /* flag 4171 */
+#define DEF_4172(a, b) (((a) << 18) | ((b) & 0x104c))
+#define DEF_4173 0x104du /* flag 4173 */
+#define DEF_4174(a, b) (((a) << 20) | ((b) & 0x104e))
+#define DEF_4175 0x104fu /* flag 4175 */
+#define DEF_4176(a, b) (((a) << 22) | ((b) & 0x1050))
+#define DEF_4177 0x1051u /* flag 4177 */
+#define DEF_4178(a, b) (((a) << 24) | ((b) & 0x1052))
+#define DEF_4179 0x1053u /* flag 4179 */
+#define DEF_4180(a, b) (((a) << 26) | ((b) & 0x1054))
+#define DEF_4181 0x1055u /* flag 4181 */
+#define DEF_4182(a, b) (((a) << 28) | ((b) & 0x1056))
+#define DEF_4183 0x1057u /* flag 4183 */
+#define DEF_4184(a, b) (((a) << 30) | ((b) & 0x1058))
+#define DEF_4185 0x1059u /* flag 4185 */
+#define DEF_4186(a, b) (((a) << 1) | ((b) & 0x105a))
+#define DEF_4187 0x105bu /* flag 4187 */
+#define DEF_4188(a, b) (((a) << 3) | ((b) & 0x105c))
+#define DEF_4189 0x105du /* flag 4189 */
+#define DEF_4190(a, b) (((a) << 5) | ((b) & 0x105e))
+#define DEF_4191 0x105fu /* flag 4191 */
+#define DEF_4192(a, b) (((a) << 7) | ((b) & 0x1060))
+#define DEF_4193 0x1061u /* flag 4193 */
+#define DEF_4194(a, b) (((a) << 9) | ((b) & 0x1062))
+#define DEF_4195 0x1063u /* flag 4195 */
+#define DEF_4196(a, b) (((a) << 11) | ((b) & 0x1064))
+#define DEF_4197 0x1065u /* flag 4197 */
+#define DEF_4198(a, b) (((a) << 13) | ((b) & 0x1066))
+#define DEF_4199 0x1067u /* flag 4199 */
+#define DEF_4200(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4200); })
+#define DEF_4201 0x1069u /* flag 4201 */
+#define DEF_4202(a, b) (((a) << 17) | ((b) & 0x106a))
+#define DEF_4203 0x106bu /* flag 4203 */
+#define DEF_4204(a, b) (((a) << 19) | ((b) & 0x106c))
+#define DEF_4205 0x106du /* flag 4205 */
+#define DEF_4206(a, b) (((a) << 21) | ((b) & 0x106e))
+#define DEF_4207 0x106fu /* flag 4207 */
+#define DEF_4208(a, b) (((a) << 23) | ((b) & 0x1070))
+#define DEF_4209 0x1071u /* flag 4209 */
+#define DEF_4210(a, b) (((a) << 25) | ((b) & 0x1072))
+#define DEF_4211 0x1073u /* flag 4211 */
+#define DEF_4212(a, b) (((a) << 27) | ((b) & 0x1074))
+#define DEF_4213 0x1075u /* flag 4213 */
+#define DEF_4214(a, b) (((a) << 29) | ((b) & 0x1076))
+#define DEF_4215 0x1077u /* flag 4215 */
+#define DEF_4216(a, b) (((a) << 0) | ((b) & 0x1078))
+#define DEF_4217 0x1079u /* flag 4217 */
+#define DEF_4218(a, b) (((a) << 2) | ((b) & 0x107a))
+#define DEF_4219 0x107bu /* flag 4219 */
+#define DEF_4220(a, b) (((a) << 4) | ((b) & 0x107c))
+#define DEF_4221 0x107du /* flag 4221 */
+#define DEF_4222(a, b) (((a) << 6) | ((b) & 0x107e))
+#define DEF_4223 0x107fu /* flag 4223 */
+#define DEF_4224(a, b) (((a) << 8) | ((b) & 0x1080))
+#define DEF_4225 0x1081u /* flag 4225 */
+#define DEF_4226(a, b) (((a) << 10) | ((b) & 0x1082))
+#define DEF_4227 0x1083u /* flag 4227 */
+#define DEF_4228(a, b) (((a) << 12) | ((b) & 0x1084))
+#define DEF_4229 0x1085u /* flag 4229 */
+#define DEF_4230(a, b) (((a) << 14) | ((b) & 0x1086))
+#define DEF_4231 0x1087u /* flag 4231 */
+#define DEF_4232(a, b) (((a) << 16) | ((b) & 0x1088))
+#define DEF_4233 0x1089u /* flag 4233 */
+#define DEF_4234(a, b) (((a) << 18) | ((b) & 0x108a))
+#define DEF_4235 0x108bu /* flag 4235 */
+#define DEF_4236(a, b) (((a) << 20) | ((b) & 0x108c))
+#define DEF_4237 0x108du /* flag 4237 */
+#define DEF_4238(a, b) (((a) << 22) | ((b) & 0x108e))
+#define DEF_4239 0x108fu /* flag 4239 */
+#define DEF_4240(a, b) (((a) << 24) | ((b) & 0x1090))
+#define DEF_4241 0x1091u /* flag 4241 */
+#define DEF_4242(a, b) (((a) << 26) | ((b) & 0x1092))
+#define DEF_4243 0x1093u /* flag 4243 */
+#define DEF_4244(a, b) (((a) << 28) | ((b) & 0x1094))
+#define DEF_4245 0x1095u /* flag 4245 */
+#define DEF_4246(a, b) (((a) << 30) | ((b) & 0x1096))
+#define DEF_4247 0x1097u /* flag 4247 */
+#define DEF_4248(a, b) (((a) << 1) | ((b) & 0x1098))
+#define DEF_4249 0x1099u /* flag 4249 */
+#define DEF_4250(a, b) (((a) << 3) | ((b) & 0x109a))
+#define DEF_4251 0x109bu /* flag 4251 */
+#define DEF_4252(a, b) (((a) << 5) | ((b) & 0x109c))
+#define DEF_4253 0x109du /* flag 4253 */
+#define DEF_4254(a, b) (((a) << 7) | ((b) & 0x109e))
+#define DEF_4255 0x109fu /* flag 4255 */
+#define DEF_4256(a, b) (((a) << 9) | ((b) & 0x10a0))
+#define DEF_4257 0x10a1u /* flag 4257 */
+#define DEF_4258(a, b) (((a) << 11) | ((b) & 0x10a2))
+#define DEF_4259 0x10a3u /* flag 4259 */
+#define DEF_4260(a, b) (((a) << 13) | ((b) & 0x10a4))
+#define DEF_4261 0x10a5u /* flag 4261 */
+#define DEF_4262(a, b) (((a) << 15) | ((b) & 0x10a6))
+#define DEF_4263 0x10a7u /* flag 4263 */
+#define DEF_4264(a, b) (((a) << 17) | ((b) & 0x10a8))
+#define DEF_4265 0x10a9u /* flag 4265 */
+#define DEF_4266(a, b) (((a) << 19) | ((b) & 0x10aa))
+#define DEF_4267 0x10abu /* flag 4267 */
+#define DEF_4268(a, b) (((a) << 21) | ((b) & 0x10ac))
+#define DEF_4269 0x10adu /* flag 4269 */
+#define DEF_4270(a, b) (((a) << 23) | ((b) & 0x10ae))
+#define DEF_4271 0x10afu /* flag 4271 */
+#define DEF_4272(a, b) (((a) << 25) | ((b) & 0x10b0))
+#define DEF_4273 0x10b1u /* flag 4273 */
+#define DEF_4274(a, b) (((a) << 27) | ((b) & 0x10b2))
+#define DEF_4275 0x10b3u /* flag 4275 */
+#define DEF_4276(a, b) (((a) << 29) | ((b) & 0x10b4))
+#define DEF_4277 0x10b5u /* flag 4277 */
+#define DEF_4278(a, b) (((a) << 0) | ((b) & 0x10b6))
+#define DEF_4279 0x10b7u /* flag 4279 */
+#define DEF_4280(a, b) (((a) << 2) | ((b) & 0x10b8))
+#define DEF_4281 0x10b9u /* flag 4281 */
+#define DEF_4282(a, b) (((a) << 4) | ((b) & 0x10ba))
+#define DEF_4283 0x10bbu /* flag 4283 */
+#define DEF_4284(a, b) (((a) << 6) | ((b) & 0x10bc))
+#define DEF_4285 0x10bdu /* flag 4285 */
+#define DEF_4286(a, b) (((a) << 8) | ((b) & 0x10be))
+#define DEF_4287 0x10bfu /* flag 4287 */
+#define DEF_4288(a, b) (((a) << 10) | ((b) & 0x10c0))
+#define DEF_4289 0x10c1u /* flag 4289 */
+#define DEF_4290(a, b) (((a) << 12) | ((b) & 0x10c2))
+#define DEF_4291 0x10c3u /* flag 4291 */
+#define DEF_4292(a, b) (((a) << 14) | ((b) & 0x10c4))
+#define DEF_4293 0x10c5u /* flag 4293 */
+#define DEF_4294(a, b) (((a) << 16) | ((b) & 0x10c6))
+#define DEF_4295 0x10c7u /* flag 4295 */
+#define DEF_4296(a, b) (((a) << 18) | ((b) & 0x10c8))
+#define DEF_4297 0x10c9u /* flag 4297 */
+#define DEF_4298(a, b) (((a) << 20) | ((b) & 0x10ca))
+#define DEF_4299 0x10cbu /* flag 4299 */
+#define DEF_4300(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4300); })
+#define DEF_4301 0x10cdu /* flag 4301 */
+#define DEF_4302(a, b) (((a) << 24) | ((b) & 0x10ce))
+#define DEF_4303 0x10cfu /* flag 4303 */
+#define DEF_4304(a, b) (((a) << 26) | ((b) & 0x10d0))
+#define DEF_4305 0x10d1u /* flag 4305 */
+#define DEF_4306(a, b) (((a) << 28) | ((b) & 0x10d2))
+#define DEF_4307 0x10d3u /* flag 4307 */
+#define DEF_4308(a, b) (((a) << 30) | ((b) & 0x10d4))
+#define DEF_4309 0x10d5u /* flag 4309 */
+#define DEF_4310(a, b) (((a) << 1) | ((b) & 0x10d6))
+#define DEF_4311 0x10d7u /* flag 4311 */
+#define DEF_4312(a, b) (((a) << 3) | ((b) & 0x10d8))
+#define DEF_4313 0x10d9u /* flag 4313 */
+#define DEF_4314(a, b) (((a) << 5) | ((b) & 0x10da))
+#define DEF_4315 0x10dbu /* flag 4315 */
+#define DEF_4316(a, b) (((a) << 7) | ((b) & 0x10dc))
+#define DEF_4317 0x10ddu /* flag 4317 */
+#define DEF_4318(a, b) (((a) << 9) | ((b) & 0x10de))
+#define DEF_4319 0x10dfu /* flag 4319 */
+#define DEF_4320(a, b) (((a) << 11) | ((b) & 0x10e0))
+#define DEF_4321 0x10e1u /* flag 4321 */
+#define DEF_4322(a, b) (((a) << 13) | ((b) & 0x10e2))
+#define DEF_4323 0x10e3u /* flag 4323 */
+#define DEF_4324(a, b) (((a) << 15) | ((b) & 0x10e4))
+#define DEF_4325 0x10e5u /* flag 4325 */
+#define DEF_4326(a, b) (((a) << 17) | ((b) & 0x10e6))
+#define DEF_4327 0x10e7u /* flag 4327 */
+#define DEF_4328(a, b) (((a) << 19) | ((b) & 0x10e8))
+#define DEF_4329 0x10e9u /* flag 4329 */
+#define DEF_4330(a, b) (((a) << 21) | ((b) & 0x10ea))
+#define DEF_4331 0x10ebu /* flag 4331 */
+#define DEF_4332(a, b) (((a) << 23) | ((b) & 0x10ec))
+#define DEF_4333 0x10edu /* flag 4333 */
+#define DEF_4334(a, b) (((a) << 25) | ((b) & 0x10ee))
+#define DEF_4335 0x10efu /* flag 4335 */
+#define DEF_4336(a, b) (((a) << 27) | ((b) & 0x10f0))
+#define DEF_4337 0x10f1u /* flag 4337 */
+#define DEF_4338(a, b) (((a) << 29) | ((b) & 0x10f2))
+#define DEF_4339 0x10f3u /* flag 4339 */
+#define DEF_4340(a, b) (((a) << 0) | ((b) & 0x10f4))
+#define DEF_4341 0x10f5u /* flag 4341 */
+#define DEF_4342(a, b) (((a) << 2) | ((b) & 0x10f6))
+#define DEF_4343 0x10f7u /* flag 4343 */
+#define DEF_4344(a, b) (((a) << 4) | ((b) & 0x10f8))
+#define DEF_4345 0x10f9u /* flag 4345 */
+#define DEF_4346(a, b) (((a) << 6) | ((b) & 0x10fa))
+#define DEF_4347 0x10fbu /* flag 4347 */
+#define DEF_4348(a, b) (((a) << 8) | ((b) & 0x10fc))
+#define DEF_4349 0x10fdu /* flag 4349 */
+#define DEF_4350(a, b) (((a) << 10) | ((b) & 0x10fe))
+#define DEF_4351 0x10ffu /* flag 4351 */
+#define DEF_4352(a, b) (((a) << 12) | ((b) & 0x1100))
+#define DEF_4353 0x1101u /* flag 4353 */
+#define DEF_4354(a, b) (((a) << 14) | ((b) & 0x1102))
+#define DEF_4355 0x1103u /* flag 4355 */
+#define DEF_4356(a, b) (((a) << 16) | ((b) & 0x1104))
+#define DEF_4357 0x1105u /* flag 4357 */
+#define DEF_4358(a, b) (((a) << 18) | ((b) & 0x1106))
+#define DEF_4359 0x1107u /* flag 4359 */
+#define DEF_4360(a, b) (((a) << 20) | ((b) & 0x1108))
+#define DEF_4361 0x1109u /* flag 4361 */
+#define DEF_4362(a, b) (((a) << 22) | ((b) & 0x110a))
+#define DEF_4363 0x110bu /* flag 4363 */
+#define DEF_4364(a, b) (((a) << 24) | ((b) & 0x110c))
+#define DEF_4365 0x110du /* flag 4365 */
+#define DEF_4366(a, b) (((a) << 26) | ((b) & 0x110e))
+#define DEF_4367 0x110fu /* flag 4367 */
+#define DEF_4368(a, b) (((a) << 28) | ((b) & 0x1110))
+#define DEF_4369 0x1111u /* flag 4369 */
+#define DEF_4370(a, b) (((a) << 30) | ((b) & 0x1112))
+#define DEF_4371 0x1113u /* flag 4371 */
+#define DEF_4372(a, b) (((a) << 1) | ((b) & 0x1114))
+#define DEF_4373 0x1115u /* flag 4373 */
+#define DEF_4374(a, b) (((a) << 3) | ((b) & 0x1116))
+#define DEF_4375 0x1117u /* flag 4375 */
+#define DEF_4376(a, b) (((a) << 5) | ((b) & 0x1118))
+#define DEF_4377 0x1119u /* flag 4377 */
+#define DEF_4378(a, b) (((a) << 7) | ((b) & 0x111a))
+#define DEF_4379 0x111bu /* flag 4379 */
+#define DEF_4380(a, b) (((a) << 9) | ((b) & 0x111c))
+#define DEF_4381 0x111du /* flag 4381 */
+#define DEF_4382(a, b) (((a) << 11) | ((b) & 0x111e))
+#define DEF_4383 0x111fu /* flag 4383 */
+#define DEF_4384(a, b) (((a) << 13) | ((b) & 0x1120))
+#define DEF_4385 0x1121u /* flag 4385 */
+#define DEF_4386(a, b) (((a) << 15) | ((b) & 0x1122))
+#define DEF_4387 0x1123u /* flag 4387 */
+#define DEF_4388(a, b) (((a) << 17) | ((b) & 0x1124))
+#define DEF_4389 0x1125u /* flag 4389 */
+#define DEF_4390(a, b) (((a) << 19) | ((b) & 0x1126))
+#define DEF_4391 0x1127u /* flag 4391 */
+#define DEF_4392(a, b) (((a) << 21) | ((b) & 0x1128))
+#define DEF_4393 0x1129u /* flag 4393 */
+#define DEF_4394(a, b) (((a) << 23) | ((b) & 0x112a))
+#define DEF_4395 0x112bu /* flag 4395 */
+#define DEF_4396(a, b) (((a) << 25) | ((b) & 0x112c))
+#define DEF_4397 0x112du /* flag 4397 */
+#define DEF_4398(a, b) (((a) << 27) | ((b) & 0x112e))
+#define DEF_4399 0x112fu /* flag 4399 */
+#define DEF_4400(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4400); })
+#define DEF_4401 0x1131u /* flag 4401 */
+#define DEF_4402(a, b) (((a) << 0) | ((b) & 0x1132))
+#define DEF_4403 0x1133u /* flag 4403 */
+#define DEF_4404(a, b) (((a) << 2) | ((b) & 0x1134))
+#define DEF_4405 0x1135u /* flag 4405 */
+#define DEF_4406(a, b) (((a) << 4) | ((b) & 0x1136))
+#define DEF_4407 0x1137u /* flag 4407 */
+#define DEF_4408(a, b) (((a) << 6) | ((b) & 0x1138))
+#define DEF_4409 0x1139u /* flag 4409 */
+#define DEF_4410(a, b) (((a) << 8) | ((b) & 0x113a))
+#define DEF_4411 0x113bu /* flag 4411 */
+#define DEF_4412(a, b) (((a) << 10) | ((b) & 0x113c))
+#define DEF_4413 0x113du /* flag 4413 */
+#define DEF_4414(a, b) (((a) << 12) | ((b) & 0x113e))
+#define DEF_4415 0x113fu /* flag 4415 */
+#define DEF_4416(a, b) (((a) << 14) | ((b) & 0x1140))
+#define DEF_4417 0x1141u /* flag 4417 */
+#define DEF_4418(a, b) (((a) << 16) | ((b) & 0x1142))
+#define DEF_4419 0x1143u /* flag 4419 */
+#define DEF_4420(a, b) (((a) << 18) | ((b) & 0x1144))
+#define DEF_4421 0x1145u /* flag 4421 */
+#define DEF_4422(a, b) (((a) << 20) | ((b) & 0x1146))
+#define DEF_4423 0x1147u /* flag 4423 */
+#define DEF_4424(a, b) (((a) << 22) | ((b) & 0x1148))
+#define DEF_4425 0x1149u /* flag 4425 */
+#define DEF_4426(a, b) (((a) << 24) | ((b) & 0x114a))
+#define DEF_4427 0x114bu /* flag 4427 */
+#define DEF_4428(a, b) (((a) << 26) | ((b) & 0x114c))
+#define DEF_4429 0x114du /* flag 4429 */
+#define DEF_4430(a, b) (((a) << 28) | ((b) & 0x114e))
+#define DEF_4431 0x114fu /* flag 4431 */
+#define DEF_4432(a, b) (((a) << 30) | ((b) & 0x1150))
+#define DEF_4433 0x1151u /* flag 4433 */
+#define DEF_4434(a, b) (((a) << 1) | ((b) & 0x1152))
+#define DEF_4435 0x1153u /* flag 4435 */
+#define DEF_4436(a, b) (((a) << 3) | ((b) & 0x1154))
+#define DEF_4437 0x1155u /* flag 4437 */
+#define DEF_4438(a, b) (((a) << 5) | ((b) & 0x1156))
+#define DEF_4439 0x1157u /* flag 4439 */
+#define DEF_4440(a, b) (((a) << 7) | ((b) & 0x1158))
+#define DEF_4441 0x1159u /* flag 4441 */
+#define DEF_4442(a, b) (((a) << 9) | ((b) & 0x115a))
+#define DEF_4443 0x115bu /* flag 4443 */
+#define DEF_4444(a, b) (((a) << 11) | ((b) & 0x115c))
+#define DEF_4445 0x115du /* flag 4445 */
+#define DEF_4446(a, b) (((a) << 13) | ((b) & 0x115e))
+#define DEF_4447 0x115fu /* flag 4447 */
+#define DEF_4448(a, b) (((a) << 15) | ((b) & 0x1160))
+#define DEF_4449 0x1161u /* flag 4449 */
+#define DEF_4450(a, b) (((a) << 17) | ((b) & 0x1162))
+#define DEF_4451 0x1163u /* flag 4451 */
+#define DEF_4452(a, b) (((a) << 19) | ((b) & 0x1164))
+#define DEF_4453 0x1165u /* flag 4453 */
+#define DEF_4454(a, b) (((a) << 21) | ((b) & 0x1166))
+#define DEF_4455 0x1167u /* flag 4455 */
+#define DEF_4456(a, b) (((a) << 23) | ((b) & 0x1168))
+#define DEF_4457 0x1169u /* flag 4457 */
+#define DEF_4458(a, b) (((a) << 25) | ((b) & 0x116a))
+#define DEF_4459 0x116bu /* flag 4459 */
+#define DEF_4460(a, b) (((a) << 27) | ((b) & 0x116c))
+#define DEF_4461 0x116du /* flag 4461 */
+#define DEF_4462(a, b) (((a) << 29) | ((b) & 0x116e))
+#define DEF_4463 0x116fu /* flag 4463 */
+#define DEF_4464(a, b) (((a) << 0) | ((b) & 0x1170))
+#define DEF_4465 0x1171u /* flag 4465 */
+#define DEF_4466(a, b) (((a) << 2) | ((b) & 0x1172))
+#define DEF_4467 0x1173u /* flag 4467 */
+#define DEF_4468(a, b) (((a) << 4) | ((b) & 0x1174))
+#define DEF_4469 0x1175u /* flag 4469 */
+#define DEF_4470(a, b) (((a) << 6) | ((b) & 0x1176))
+#define DEF_4471 0x1177u /* flag 4471 */
+#define DEF_4472(a, b) (((a) << 8) | ((b) & 0x1178))
+#define DEF_4473 0x1179u /* flag 4473 */
+#define DEF_4474(a, b) (((a) << 10) | ((b) & 0x117a))
+#define DEF_4475 0x117bu /* flag 4475 */
+#define DEF_4476(a, b) (((a) << 12) | ((b) & 0x117c))
+#define DEF_4477 0x117du /* flag 4477 */
+#define DEF_4478(a, b) (((a) << 14) | ((b) & 0x117e))
+#define DEF_4479 0x117fu /* flag 4479 */
+#define DEF_4480(a, b) (((a) << 16) | ((b) & 0x1180))
+#define DEF_4481 0x1181u /* flag 4481 */
+#define DEF_4482(a, b) (((a) << 18) | ((b) & 0x1182))
+#define DEF_4483 0x1183u /* flag 4483 */
+#define DEF_4484(a, b) (((a) << 20) | ((b) & 0x1184))
+#define DEF_4485 0x1185u /* flag 4485 */
+#define DEF_4486(a, b) (((a) << 22) | ((b) & 0x1186))
+#define DEF_4487 0x1187u /* flag 4487 */
+#define DEF_4488(a, b) (((a) << 24) | ((b) & 0x1188))
+#define DEF_4489 0x1189u /* flag 4489 */
+#define DEF_4490(a, b) (((a) << 26) | ((b) & 0x118a))
+#define DEF_4491 0x118bu /* flag 4491 */
+#define DEF_4492(a, b) (((a) << 28) | ((b) & 0x118c))
+#define DEF_4493 0x118du /* flag 4493 */
+#define DEF_4494(a, b) (((a) << 30) | ((b) & 0x118e))
+#define DEF_4495 0x118fu /* flag 4495 */
+#define DEF_4496(a, b) (((a) << 1) | ((b) & 0x1190))
+#define DEF_4497 0x1191u /* flag 4497 */
+#define DEF_4498(a, b) (((a) << 3) | ((b) & 0x1192))
+#define DEF_4499 0x1193u /* flag 4499 */
+#define DEF_4500(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4500); })
+#define DEF_4501 0x1195u /* flag 4501 */
+#define DEF_4502(a, b) (((a) << 7) | ((b) & 0x1196))
+#define DEF_4503 0x1197u /* flag 4503 */
+#define DEF_4504(a, b) (((a) << 9) | ((b) & 0x1198))
+#define DEF_4505 0x1199u /* flag 4505 */
+#define DEF_4506(a, b) (((a) << 11) | ((b) & 0x119a))
+#define DEF_4507 0x119bu /* flag 4507 */
+#define DEF_4508(a, b) (((a) << 13) | ((b) & 0x119c))
+#define DEF_4509 0x119du /* flag 4509 */
+#define DEF_4510(a, b) (((a) << 15) | ((b) & 0x119e))
+#define DEF_4511 0x119fu /* flag 4511 */
+#define DEF_4512(a, b) (((a) << 17) | ((b) & 0x11a0))
+#define DEF_4513 0x11a1u /* flag 4513 */
+#define DEF_4514(a, b) (((a) << 19) | ((b) & 0x11a2))
+#define DEF_4515 0x11a3u /* flag 4515 */
+#define DEF_4516(a, b) (((a) << 21) | ((b) & 0x11a4))
+#define DEF_4517 0x11a5u /* flag 4517 */
+#define DEF_4518(a, b) (((a) << 23) | ((b) & 0x11a6))
+#define DEF_4519 0x11a7u /* flag 4519 */
+#define DEF_4520(a, b) (((a) << 25) | ((b) & 0x11a8))
+#define DEF_4521 0x11a9u /* flag 4521 */
+#define DEF_4522(a, b) (((a) << 27) | ((b) & 0x11aa))
+#define DEF_4523 0x11abu /* flag 4523 */
+#define DEF_4524(a, b) (((a) << 29) | ((b) & 0x11ac))
+#define DEF_4525 0x11adu /* flag 4525 */
+#define DEF_4526(a, b) (((a) << 0) | ((b) & 0x11ae))
+#define DEF_4527 0x11afu /* flag 4527 */
+#define DEF_4528(a, b) (((a) << 2) | ((b) & 0x11b0))
+#define DEF_4529 0x11b1u /* flag 4529 */
+#define DEF_4530(a, b) (((a) << 4) | ((b) & 0x11b2))
+#define DEF_4531 0x11b3u /* flag 4531 */
+#define DEF_4532(a, b) (((a) << 6) | ((b) & 0x11b4))
+#define DEF_4533 0x11b5u /* flag 4533 */
+#define DEF_4534(a, b) (((a) << 8) | ((b) & 0x11b6))
+#define DEF_4535 0x11b7u /* flag 4535 */
+#define DEF_4536(a, b) (((a) << 10) | ((b) & 0x11b8))
+#define DEF_4537 0x11b9u /* flag 4537 */
+#define DEF_4538(a, b) (((a) << 12) | ((b) & 0x11ba))
+#define DEF_4539 0x11bbu /* flag 4539 */
+#define DEF_4540(a, b) (((a) << 14) | ((b) & 0x11bc))
+#define DEF_4541 0x11bdu /* flag 4541 */
+#define DEF_4542(a, b) (((a) << 16) | ((b) & 0x11be))
+#define DEF_4543 0x11bfu /* flag 4543 */
+#define DEF_4544(a, b) (((a) << 18) | ((b) & 0x11c0))
+#define DEF_4545 0x11c1u /* flag 4545 */
+#define DEF_4546(a, b) (((a) << 20) | ((b) & 0x11c2))
+#define DEF_4547 0x11c3u /* flag 4547 */
+#define DEF_4548(a, b) (((a) << 22) | ((b) & 0x11c4))
+#define DEF_4549 0x11c5u /* flag 4549 */
+#define DEF_4550(a, b) (((a) << 24) | ((b) & 0x11c6))
+#define DEF_4551 0x11c7u /* flag 4551 */
+#define DEF_4552(a, b) (((a) << 26) | ((b) & 0x11c8))
+#define DEF_4553 0x11c9u /* flag 4553 */
+#define DEF_4554(a, b) (((a) << 28) | ((b) & 0x11ca))
+#define DEF_4555 0x11cbu /* flag 4555 */
+#define DEF_4556(a, b) (((a) << 30) | ((b) & 0x11cc))
+#define DEF_4557 0x11cdu /* flag 4557 */
+#define DEF_4558(a, b) (((a) << 1) | ((b) & 0x11ce))
+#define DEF_4559 0x11cfu /* flag 4559 */
+#define DEF_4560(a, b) (((a) << 3) | ((b) & 0x11d0))
+#define DEF_4561 0x11d1u /* flag 4561 */
+#define DEF_4562(a, b) (((a) << 5) | ((b) & 0x11d2))
+#define DEF_4563 0x11d3u /* flag 4563 */
+#define DEF_4564(a, b) (((a) << 7) | ((b) & 0x11d4))
+#define DEF_4565 0x11d5u /* flag 4565 */
+#define DEF_4566(a, b) (((a) << 9) | ((b) & 0x11d6))
+#define DEF_4567 0x11d7u /* flag 4567 */
+#define DEF_4568(a, b) (((a) << 11) | ((b) & 0x11d8))
+#define DEF_4569 0x11d9u /* flag 4569 */
+#define DEF_4570(a, b) (((a) << 13) | ((b) & 0x11da))
+#define DEF_4571 0x11dbu /* flag 4571 */
+#define DEF_4572(a, b) (((a) << 15) | ((b) & 0x11dc))
+#define DEF_4573 0x11ddu /* flag 4573 */
+#define DEF_4574(a, b) (((a) << 17) | ((b) & 0x11de))
+#define DEF_4575 0x11dfu /* flag 4575 */
+#define DEF_4576(a, b) (((a) << 19) | ((b) & 0x11e0))
+#define DEF_4577 0x11e1u /* flag 4577 */
+#define DEF_4578(a, b) (((a) << 21) | ((b) & 0x11e2))
+#define DEF_4579 0x11e3u /* flag 4579 */
+#define DEF_4580(a, b) (((a) << 23) | ((b) & 0x11e4))
+#define DEF_4581 0x11e5u /* flag 4581 */
+#define DEF_4582(a, b) (((a) << 25) | ((b) & 0x11e6))
+#define DEF_4583 0x11e7u /* flag 4583 */
+#define DEF_4584(a, b) (((a) << 27) | ((b) & 0x11e8))
+#define DEF_4585 0x11e9u /* flag 4585 */
+#define DEF_4586(a, b) (((a) << 29) | ((b) & 0x11ea))
+#define DEF_4587 0x11ebu /* flag 4587 */
+#define DEF_4588(a, b) (((a) << 0) | ((b) & 0x11ec))
+#define DEF_4589 0x11edu /* flag 4589 */
+#define DEF_4590(a, b) (((a) << 2) | ((b) & 0x11ee))
+#define DEF_4591 0x11efu /* flag 4591 */
+#define DEF_4592(a, b) (((a) << 4) | ((b) & 0x11f0))
+#define DEF_4593 0x11f1u /* flag 4593 */
+#define DEF_4594(a, b) (((a) << 6) | ((b) & 0x11f2))
+#define DEF_4595 0x11f3u /* flag 4595 */
+#define DEF_4596(a, b) (((a) << 8) | ((b) & 0x11f4))
+#define DEF_4597 0x11f5u /* flag 4597 */
+#define DEF_4598(a, b) (((a) << 10) | ((b) & 0x11f6))
+#define DEF_4599 0x11f7u /* flag 4599 */
+#define DEF_4600(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4600); })
+#define DEF_4601 0x11f9u /* flag 4601 */
+#define DEF_4602(a, b) (((a) << 14) | ((b) & 0x11fa))
+#define DEF_4603 0x11fbu /* flag 4603 */
+#define DEF_4604(a, b) (((a) << 16) | ((b) & 0x11fc))
+#define DEF_4605 0x11fdu /* flag 4605 */
+#define DEF_4606(a, b) (((a) << 18) | ((b) & 0x11fe))
+#define DEF_4607 0x11ffu /* flag 4607 */
+#define DEF_4608(a, b) (((a) << 20) | ((b) & 0x1200))
+#define DEF_4609 0x1201u /* flag 4609 */
+#define DEF_4610(a, b) (((a) << 22) | ((b) & 0x1202))
+#define DEF_4611 0x1203u /* flag 4611 */
+#define DEF_4612(a, b) (((a) << 24) | ((b) & 0x1204))
+#define DEF_4613 0x1205u /* flag 4613 */
+#define DEF_4614(a, b) (((a) << 26) | ((b) & 0x1206))
+#define DEF_4615 0x1207u /* flag 4615 */
+#define DEF_4616(a, b) (((a) << 28) | ((b) & 0x1208))
+#define DEF_4617 0x1209u /* flag 4617 */
+#define DEF_4618(a, b) (((a) << 30) | ((b) & 0x120a))
+#define DEF_4619 0x120bu /* flag 4619 */
+#define DEF_4620(a, b) (((a) << 1) | ((b) & 0x120c))
+#define DEF_4621 0x120du /* flag 4621 */
+#define DEF_4622(a, b) (((a) << 3) | ((b) & 0x120e))
+#define DEF_4623 0x120fu /* flag 4623 */
+#define DEF_4624(a, b) (((a) << 5) | ((b) & 0x1210))
+#define DEF_4625 0x1211u /* flag 4625 */
+#define DEF_4626(a, b) (((a) << 7) | ((b) & 0x1212))
+#define DEF_4627 0x1213u /* flag 4627 */
+#define DEF_4628(a, b) (((a) << 9) | ((b) & 0x1214))
+#define DEF_4629 0x1215u /* flag 4629 */
+#define DEF_4630(a, b) (((a) << 11) | ((b) & 0x1216))
+#define DEF_4631 0x1217u /* flag 4631 */
+#define DEF_4632(a, b) (((a) << 13) | ((b) & 0x1218))
+#define DEF_4633 0x1219u /* flag 4633 */
+#define DEF_4634(a, b) (((a) << 15) | ((b) & 0x121a))
+#define DEF_4635 0x121bu /* flag 4635 */
+#define DEF_4636(a, b) (((a) << 17) | ((b) & 0x121c))
+#define DEF_4637 0x121du /* flag 4637 */
+#define DEF_4638(a, b) (((a) << 19) | ((b) & 0x121e))
+#define DEF_4639 0x121fu /* flag 4639 */
+#define DEF_4640(a, b) (((a) << 21) | ((b) & 0x1220))
+#define DEF_4641 0x1221u /* flag 4641 */
+#define DEF_4642(a, b) (((a) << 23) | ((b) & 0x1222))
+#define DEF_4643 0x1223u /* flag 4643 */
+#define DEF_4644(a, b) (((a) << 25) | ((b) & 0x1224))
+#define DEF_4645 0x1225u /* flag 4645 */
+#define DEF_4646(a, b) (((a) << 27) | ((b) & 0x1226))
+#define DEF_4647 0x1227u /* flag 4647 */
+#define DEF_4648(a, b) (((a) << 29) | ((b) & 0x1228))
+#define DEF_4649 0x1229u /* flag 4649 */
+#define DEF_4650(a, b) (((a) << 0) | ((b) & 0x122a))
+#define DEF_4651 0x122bu /* flag 4651 */
+#define DEF_4652(a, b) (((a) << 2) | ((b) & 0x122c))
+#define DEF_4653 0x122du /* flag 4653 */
+#define DEF_4654(a, b) (((a) << 4) | ((b) & 0x122e))
+#define DEF_4655 0x122fu /* flag 4655 */
+#define DEF_4656(a, b) (((a) << 6) | ((b) & 0x1230))
+#define DEF_4657 0x1231u /* flag 4657 */
+#define DEF_4658(a, b) (((a) << 8) | ((b) & 0x1232))
+#define DEF_4659 0x1233u /* flag 4659 */
+#define DEF_4660(a, b) (((a) << 10) | ((b) & 0x1234))
+#define DEF_4661 0x1235u /* flag 4661 */
+#define DEF_4662(a, b) (((a) << 12) | ((b) & 0x1236))
+#define DEF_4663 0x1237u /* flag 4663 */
+#define DEF_4664(a, b) (((a) << 14) | ((b) & 0x1238))
+#define DEF_4665 0x1239u /* flag 4665 */
+#define DEF_4666(a, b) (((a) << 16) | ((b) & 0x123a))
+#define DEF_4667 0x123bu /* flag 4667 */
+#define DEF_4668(a, b) (((a) << 18) | ((b) & 0x123c))
+#define DEF_4669 0x123du /* flag 4669 */
+#define DEF_4670(a, b) (((a) << 20) | ((b) & 0x123e))
+#define DEF_4671 0x123fu /* flag 4671 */
+#define DEF_4672(a, b) (((a) << 22) | ((b) & 0x1240))
+#define DEF_4673 0x1241u /* flag 4673 */
+#define DEF_4674(a, b) (((a) << 24) | ((b) & 0x1242))
+#define DEF_4675 0x1243u /* flag 4675 */
+#define DEF_4676(a, b) (((a) << 26) | ((b) & 0x1244))
+#define DEF_4677 0x1245u /* flag 4677 */
+#define DEF_4678(a, b) (((a) << 28) | ((b) & 0x1246))
+#define DEF_4679 0x1247u /* flag 4679 */
+#define DEF_4680(a, b) (((a) << 30) | ((b) & 0x1248))
+#define DEF_4681 0x1249u /* flag 4681 */
+#define DEF_4682(a, b) (((a) << 1) | ((b) & 0x124a))
+#define DEF_4683 0x124bu /* flag 4683 */
+#define DEF_4684(a, b) (((a) << 3) | ((b) & 0x124c))
+#define DEF_4685 0x124du /* flag 4685 */
+#define DEF_4686(a, b) (((a) << 5) | ((b) & 0x124e))
+#define DEF_4687 0x124fu /* flag 4687 */
+#define DEF_4688(a, b) (((a) << 7) | ((b) & 0x1250))
+#define DEF_4689 0x1251u /* flag 4689 */
+#define DEF_4690(a, b) (((a) << 9) | ((b) & 0x1252))
+#define DEF_4691 0x1253u /* flag 4691 */
+#define DEF_4692(a, b) (((a) << 11) | ((b) & 0x1254))
+#define DEF_4693 0x1255u /* flag 4693 */
+#define DEF_4694(a, b) (((a) << 13) | ((b) & 0x1256))
+#define DEF_4695 0x1257u /* flag 4695 */
+#define DEF_4696(a, b) (((a) << 15) | ((b) & 0x1258))
+#define DEF_4697 0x1259u /* flag 4697 */
+#define DEF_4698(a, b) (((a) << 17) | ((b) & 0x125a))
+#define DEF_4699 0x125bu /* flag 4699 */
+#define DEF_4700(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4700); })
+#define DEF_4701 0x125du /* flag 4701 */
+#define DEF_4702(a, b) (((a) << 21) | ((b) & 0x125e))
+#define DEF_4703 0x125fu /* flag 4703 */
+#define DEF_4704(a, b) (((a) << 23) | ((b) & 0x1260))
+#define DEF_4705 0x1261u /* flag 4705 */
+#define DEF_4706(a, b) (((a) << 25) | ((b) & 0x1262))
+#define DEF_4707 0x1263u /* flag 4707 */
+#define DEF_4708(a, b) (((a) << 27) | ((b) & 0x1264))
+#define DEF_4709 0x1265u /* flag 4709 */
+#define DEF_4710(a, b) (((a) << 29) | ((b) & 0x1266))
+#define DEF_4711 0x1267u /* flag 4711 */
+#define DEF_4712(a, b) (((a) << 0) | ((b) & 0x1268))
+#define DEF_4713 0x1269u /* flag 4713 */
+#define DEF_4714(a, b) (((a) << 2) | ((b) & 0x126a))
+#define DEF_4715 0x126bu /* flag 4715 */
+#define DEF_4716(a, b) (((a) << 4) | ((b) & 0x126c))
+#define DEF_4717 0x126du /* flag 4717 */
+#define DEF_4718(a, b) (((a) << 6) | ((b) & 0x126e))
+#define DEF_4719 0x126fu /* flag 4719 */
+#define DEF_4720(a, b) (((a) << 8) | ((b) & 0x1270))
+#define DEF_4721 0x1271u /* flag 4721 */
+#define DEF_4722(a, b) (((a) << 10) | ((b) & 0x1272))
+#define DEF_4723 0x1273u /* flag 4723 */
+#define DEF_4724(a, b) (((a) << 12) | ((b) & 0x1274))
+#define DEF_4725 0x1275u /* flag 4725 */
+#define DEF_4726(a, b) (((a) << 14) | ((b) & 0x1276))
+#define DEF_4727 0x1277u /* flag 4727 */
+#define DEF_4728(a, b) (((a) << 16) | ((b) & 0x1278))
+#define DEF_4729 0x1279u /* flag 4729 */
+#define DEF_4730(a, b) (((a) << 18) | ((b) & 0x127a))
+#define DEF_4731 0x127bu /* flag 4731 */
+#define DEF_4732(a, b) (((a) << 20) | ((b) & 0x127c))
+#define DEF_4733 0x127du /* flag 4733 */
+#define DEF_4734(a, b) (((a) << 22) | ((b) & 0x127e))
+#define DEF_4735 0x127fu /* flag 4735 */
+#define DEF_4736(a, b) (((a) << 24) | ((b) & 0x1280))
+#define DEF_4737 0x1281u /* flag 4737 */
+#define DEF_4738(a, b) (((a) << 26) | ((b) & 0x1282))
+#define DEF_4739 0x1283u /* flag 4739 */
+#define DEF_4740(a, b) (((a) << 28) | ((b) & 0x1284))
+#define DEF_4741 0x1285u /* flag 4741 */
+#define DEF_4742(a, b) (((a) << 30) | ((b) & 0x1286))
+#define DEF_4743 0x1287u /* flag 4743 */
+#define DEF_4744(a, b) (((a) << 1) | ((b) & 0x1288))
+#define DEF_4745 0x1289u /* flag 4745 */
+#define DEF_4746(a, b) (((a) << 3) | ((b) & 0x128a))
+#define DEF_4747 0x128bu /* flag 4747 */
+#define DEF_4748(a, b) (((a) << 5) | ((b) & 0x128c))
+#define DEF_4749 0x128du /* flag 4749 */
+#define DEF_4750(a, b) (((a) << 7) | ((b) & 0x128e))
+#define DEF_4751 0x128fu /* flag 4751 */
+#define DEF_4752(a, b) (((a) << 9) | ((b) & 0x1290))
+#define DEF_4753 0x1291u /* flag 4753 */
+#define DEF_4754(a, b) (((a) << 11) | ((b) & 0x1292))
+#define DEF_4755 0x1293u /* flag 4755 */
+#define DEF_4756(a, b) (((a) << 13) | ((b) & 0x1294))
+#define DEF_4757 0x1295u /* flag 4757 */
+#define DEF_4758(a, b) (((a) << 15) | ((b) & 0x1296))
+#define DEF_4759 0x1297u /* flag 4759 */
+#define DEF_4760(a, b) (((a) << 17) | ((b) & 0x1298))
+#define DEF_4761 0x1299u /* flag 4761 */
+#define DEF_4762(a, b) (((a) << 19) | ((b) & 0x129a))
+#define DEF_4763 0x129bu /* flag 4763 */
+#define DEF_4764(a, b) (((a) << 21) | ((b) & 0x129c))
+#define DEF_4765 0x129du /* flag 4765 */
+#define DEF_4766(a, b) (((a) << 23) | ((b) & 0x129e))
+#define DEF_4767 0x129fu /* flag 4767 */
+#define DEF_4768(a, b) (((a) << 25) | ((b) & 0x12a0))
+#define DEF_4769 0x12a1u /* flag 4769 */
+#define DEF_4770(a, b) (((a) << 27) | ((b) & 0x12a2))
+#define DEF_4771 0x12a3u /* flag 4771 */
+#define DEF_4772(a, b) (((a) << 29) | ((b) & 0x12a4))
+#define DEF_4773 0x12a5u /* flag 4773 */
+#define DEF_4774(a, b) (((a) << 0) | ((b) & 0x12a6))
+#define DEF_4775 0x12a7u /* flag 4775 */
+#define DEF_4776(a, b) (((a) << 2) | ((b) & 0x12a8))
+#define DEF_4777 0x12a9u /* flag 4777 */
+#define DEF_4778(a, b) (((a) << 4) | ((b) & 0x12aa))
+#define DEF_4779 0x12abu /* flag 4779 */
+#define DEF_4780(a, b) (((a) << 6) | ((b) & 0x12ac))
+#define DEF_4781 0x12adu /* flag 4781 */
+#define DEF_4782(a, b) (((a) << 8) | ((b) & 0x12ae))
+#define DEF_4783 0x12afu /* flag 4783 */
+#define DEF_4784(a, b) (((a) << 10) | ((b) & 0x12b0))
+#define DEF_4785 0x12b1u /* flag 4785 */
+#define DEF_4786(a, b) (((a) << 12) | ((b) & 0x12b2))
+#define DEF_4787 0x12b3u /* flag 4787 */
+#define DEF_4788(a, b) (((a) << 14) | ((b) & 0x12b4))
+#define DEF_4789 0x12b5u /* flag 4789 */
+#define DEF_4790(a, b) (((a) << 16) | ((b) & 0x12b6))
+#define DEF_4791 0x12b7u /* flag 4791 */
+#define DEF_4792(a, b) (((a) << 18) | ((b) & 0x12b8))
+#define DEF_4793 0x12b9u /* flag 4793 */
+#define DEF_4794(a, b) (((a) << 20) | ((b) & 0x12ba))
+#define DEF_4795 0x12bbu /* flag 4795 */
+#define DEF_4796(a, b) (((a) << 22) | ((b) & 0x12bc))
+#define DEF_4797 0x12bdu /* flag 4797 */
+#define DEF_4798(a, b) (((a) << 24) | ((b) & 0x12be))
+#define DEF_4799 0x12bfu /* flag 4799 */
+#define DEF_4800(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4800); })
+#define DEF_4801 0x12c1u /* flag 4801 */
+#define DEF_4802(a, b) (((a) << 28) | ((b) & 0x12c2))
+#define DEF_4803 0x12c3u /* flag 4803 */
+#define DEF_4804(a, b) (((a) << 30) | ((b) & 0x12c4))
+#define DEF_4805 0x12c5u /* flag 4805 */
+#define DEF_4806(a, b) (((a) << 1) | ((b) & 0x12c6))
+#define DEF_4807 0x12c7u /* flag 4807 */
+#define DEF_4808(a, b) (((a) << 3) | ((b) & 0x12c8))
+#define DEF_4809 0x12c9u /* flag 4809 */
+#define DEF_4810(a, b) (((a) << 5) | ((b) & 0x12ca))
+#define DEF_4811 0x12cbu /* flag 4811 */
+#define DEF_4812(a, b) (((a) << 7) | ((b) & 0x12cc))
+#define DEF_4813 0x12cdu /* flag 4813 */
+#define DEF_4814(a, b) (((a) << 9) | ((b) & 0x12ce))
+#define DEF_4815 0x12cfu /* flag 4815 */
+#define DEF_4816(a, b) (((a) << 11) | ((b) & 0x12d0))
+#define DEF_4817 0x12d1u /* flag 4817 */
+#define DEF_4818(a, b) (((a) << 13) | ((b) & 0x12d2))
+#define DEF_4819 0x12d3u /* flag 4819 */
+#define DEF_4820(a, b) (((a) << 15) | ((b) & 0x12d4))
+#define DEF_4821 0x12d5u /* flag 4821 */
+#define DEF_4822(a, b) (((a) << 17) | ((b) & 0x12d6))
+#define DEF_4823 0x12d7u /* flag 4823 */
+#define DEF_4824(a, b) (((a) << 19) | ((b) & 0x12d8))
+#define DEF_4825 0x12d9u /* flag 4825 */
+#define DEF_4826(a, b) (((a) << 21) | ((b) & 0x12da))
+#define DEF_4827 0x12dbu /* flag 4827 */
+#define DEF_4828(a, b) (((a) << 23) | ((b) & 0x12dc))
+#define DEF_4829 0x12ddu /* flag 4829 */
+#define DEF_4830(a, b) (((a) << 25) | ((b) & 0x12de))
+#define DEF_4831 0x12dfu /* flag 4831 */
+#define DEF_4832(a, b) (((a) << 27) | ((b) & 0x12e0))
+#define DEF_4833 0x12e1u /* flag 4833 */
+#define DEF_4834(a, b) (((a) << 29) | ((b) & 0x12e2))
+#define DEF_4835 0x12e3u /* flag 4835 */
+#define DEF_4836(a, b) (((a) << 0) | ((b) & 0x12e4))
+#define DEF_4837 0x12e5u /* flag 4837 */
+#define DEF_4838(a, b) (((a) << 2) | ((b) & 0x12e6))
+#define DEF_4839 0x12e7u /* flag 4839 */
+#define DEF_4840(a, b) (((a) << 4) | ((b) & 0x12e8))
+#define DEF_4841 0x12e9u /* flag 4841 */
+#define DEF_4842(a, b) (((a) << 6) | ((b) & 0x12ea))
+#define DEF_4843 0x12ebu /* flag 4843 */
+#define DEF_4844(a, b) (((a) << 8) | ((b) & 0x12ec))
+#define DEF_4845 0x12edu /* flag 4845 */
+#define DEF_4846(a, b) (((a) << 10) | ((b) & 0x12ee))
+#define DEF_4847 0x12efu /* flag 4847 */
+#define DEF_4848(a, b) (((a) << 12) | ((b) & 0x12f0))
+#define DEF_4849 0x12f1u /* flag 4849 */
+#define DEF_4850(a, b) (((a) << 14) | ((b) & 0x12f2))
+#define DEF_4851 0x12f3u /* flag 4851 */
+#define DEF_4852(a, b) (((a) << 16) | ((b) & 0x12f4))
+#define DEF_4853 0x12f5u /* flag 4853 */
+#define DEF_4854(a, b) (((a) << 18) | ((b) & 0x12f6))
+#define DEF_4855 0x12f7u /* flag 4855 */
+#define DEF_4856(a, b) (((a) << 20) | ((b) & 0x12f8))
+#define DEF_4857 0x12f9u /* flag 4857 */
+#define DEF_4858(a, b) (((a) << 22) | ((b) & 0x12fa))
+#define DEF_4859 0x12fbu /* flag 4859 */
+#define DEF_4860(a, b) (((a) << 24) | ((b) & 0x12fc))
+#define DEF_4861 0x12fdu /* flag 4861 */
+#define DEF_4862(a, b) (((a) << 26) | ((b) & 0x12fe))
+#define DEF_4863 0x12ffu /* flag 4863 */
+#define DEF_4864(a, b) (((a) << 28) | ((b) & 0x1300))
+#define DEF_4865 0x1301u /* flag 4865 */
+#define DEF_4866(a, b) (((a) << 30) | ((b) & 0x1302))
+#define DEF_4867 0x1303u /* flag 4867 */
+#define DEF_4868(a, b) (((a) << 1) | ((b) & 0x1304))
+#define DEF_4869 0x1305u /* flag 4869 */
+#define DEF_4870(a, b) (((a) << 3) | ((b) & 0x1306))
+#define DEF_4871 0x1307u /* flag 4871 */
+#define DEF_4872(a, b) (((a) << 5) | ((b) & 0x1308))
+#define DEF_4873 0x1309u /* flag 4873 */
+#define DEF_4874(a, b) (((a) << 7) | ((b) & 0x130a))
+#define DEF_4875 0x130bu /* flag 4875 */
+#define DEF_4876(a, b) (((a) << 9) | ((b) & 0x130c))
+#define DEF_4877 0x130du /* flag 4877 */
+#define DEF_4878(a, b) (((a) << 11) | ((b) & 0x130e))
+#define DEF_4879 0x130fu /* flag 4879 */
+#define DEF_4880(a, b) (((a) << 13) | ((b) & 0x1310))
+#define DEF_4881 0x1311u /* flag 4881 */
+#define DEF_4882(a, b) (((a) << 15) | ((b) & 0x1312))
+#define DEF_4883 0x1313u /* flag 4883 */
+#define DEF_4884(a, b) (((a) << 17) | ((b) & 0x1314))
+#define DEF_4885 0x1315u /* flag 4885 */
+#define DEF_4886(a, b) (((a) << 19) | ((b) & 0x1316))
+#define DEF_4887 0x1317u /* flag 4887 */
+#define DEF_4888(a, b) (((a) << 21) | ((b) & 0x1318))
+#define DEF_4889 0x1319u /* flag 4889 */
+#define DEF_4890(a, b) (((a) << 23) | ((b) & 0x131a))
+#define DEF_4891 0x131bu /* flag 4891 */
+#define DEF_4892(a, b) (((a) << 25) | ((b) & 0x131c))
+#define DEF_4893 0x131du /* flag 4893 */
+#define DEF_4894(a, b) (((a) << 27) | ((b) & 0x131e))
+#define DEF_4895 0x131fu /* flag 4895 */
+#define DEF_4896(a, b) (((a) << 29) | ((b) & 0x1320))
+#define DEF_4897 0x1321u /* flag 4897 */
+#define DEF_4898(a, b) (((a) << 0) | ((b) & 0x1322))
+#define DEF_4899 0x1323u /* flag 4899 */
+#define DEF_4900(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 4900); })
+#define DEF_4901 0x1325u /* flag 4901 */
+#define DEF_4902(a, b) (((a) << 4) | ((b) & 0x1326))
+#define DEF_4903 0x1327u /* flag 4903 */
+#define DEF_4904(a, b) (((a) << 6) | ((b) & 0x1328))
+#define DEF_4905 0x1329u /* flag 4905 */
+#define DEF_4906(a, b) (((a) << 8) | ((b) & 0x132a))
+#define DEF_4907 0x132bu /* flag 4907 */
+#define DEF_4908(a, b) (((a) << 10) | ((b) & 0x132c))
+#define DEF_4909 0x132du /* flag 4909 */
+#define DEF_4910(a, b) (((a) << 12) | ((b) & 0x132e))
+#define DEF_4911 0x132fu /* flag 4911 */
+#define DEF_4912(a, b) (((a) << 14) | ((b) & 0x1330))
+#define DEF_4913 0x1331u /* flag 4913 */
+#define DEF_4914(a, b) (((a) << 16) | ((b) & 0x1332))
+#define DEF_4915 0x1333u /* flag 4915 */
+#define DEF_4916(a, b) (((a) << 18) | ((b) & 0x1334))
+#define DEF_4917 0x1335u /* flag 4917 */
+#define DEF_4918(a, b) (((a) << 20) | ((b) & 0x1336))
+#define DEF_4919 0x1337u /* flag 4919 */
+#define DEF_4920(a, b) (((a) << 22) | ((b) & 0x1338))
+#define DEF_4921 0x1339u /* flag 4921 */
+#define DEF_4922(a, b) (((a) << 24) | ((b) & 0x133a))
+#define DEF_4923 0x133bu /* flag 4923 */
+#define DEF_4924(a, b) (((a) << 26) | ((b) & 0x133c))
+#define DEF_4925 0x133du /* flag 4925 */
+#define DEF_4926(a, b) (((a) << 28) | ((b) & 0x133e))
+#define DEF_4927 0x133fu /* flag 4927 */
+#define DEF_4928(a, b) (((a) << 30) | ((b) & 0x1340))
+#define DEF_4929 0x1341u /* flag 4929 */
+#define DEF_4930(a, b) (((a) << 1) | ((b) & 0x1342))
+#define DEF_4931 0x1343u /* flag 4931 */
+#define DEF_4932(a, b) (((a) << 3) | ((b) & 0x1344))
+#define DEF_4933 0x1345u /* flag 4933 */
+#define DEF_4934(a, b) (((a) << 5) | ((b) & 0x1346))
+#define DEF_4935 0x1347u /* flag 4935 */
+#define DEF_4936(a, b) (((a) << 7) | ((b) & 0x1348))
+#define DEF_4937 0x1349u /* flag 4937 */
+#define DEF_4938(a, b) (((a) << 9) | ((b) & 0x134a))
+#define DEF_4939 0x134bu /* flag 4939 */
+#define DEF_4940(a, b) (((a) << 11) | ((b) & 0x134c))
+#define DEF_4941 0x134du /* flag 4941 */
+#define DEF_4942(a, b) (((a) << 13) | ((b) & 0x134e))
+#define DEF_4943 0x134fu /* flag 4943 */
+#define DEF_4944(a, b) (((a) << 15) | ((b) & 0x1350))
+#define DEF_4945 0x1351u /* flag 4945 */
+#define DEF_4946(a, b) (((a) << 17) | ((b) & 0x1352))
+#define DEF_4947 0x1353u /* flag 4947 */
+#define DEF_4948(a, b) (((a) << 19) | ((b) & 0x1354))
+#define DEF_4949 0x1355u /* flag 4949 */
+#define DEF_4950(a, b) (((a) << 21) | ((b) & 0x1356))
+#define DEF_4951 0x1357u /* flag 4951 */
+#define DEF_4952(a, b) (((a) << 23) | ((b) & 0x1358))
+#define DEF_4953 0x1359u /* flag 4953 */
+#define DEF_4954(a, b) (((a) << 25) | ((b) & 0x135a))
+#define DEF_4955 0x135bu /* flag 4955 */
+#define DEF_4956(a, b) (((a) << 27) | ((b) & 0x135c))
+#define DEF_4957 0x135du /* flag 4957 */
+#define DEF_4958(a, b) (((a) << 29) | ((b) & 0x135e))
+#define DEF_4959 0x135fu /* flag 4959 */
+#define DEF_4960(a, b) (((a) << 0) | ((b) & 0x1360))
+#define DEF_4961 0x1361u /* flag 4961 */
+#define DEF_4962(a, b) (((a) << 2) | ((b) & 0x1362))
+#define DEF_4963 0x1363u /* flag 4963 */
+#define DEF_4964(a, b) (((a) << 4) | ((b) & 0x1364))
+#define DEF_4965 0x1365u /* flag 4965 */
+#define DEF_4966(a, b) (((a) << 6) | ((b) & 0x1366))
+#define DEF_4967 0x1367u /* flag 4967 */
+#define DEF_4968(a, b) (((a) << 8) | ((b) & 0x1368))
+#define DEF_4969 0x1369u /* flag 4969 */
+#define DEF_4970(a, b) (((a) << 10) | ((b) & 0x136a))
+#define DEF_4971 0x136bu /* flag 4971 */
+#define DEF_4972(a, b) (((a) << 12) | ((b) & 0x136c))
+#define DEF_4973 0x136du /* flag 4973 */
+#define DEF_4974(a, b) (((a) << 14) | ((b) & 0x136e))
+#define DEF_4975 0x136fu /* flag 4975 */
+#define DEF_4976(a, b) (((a) << 16) | ((b) & 0x1370))
+#define DEF_4977 0x1371u /* flag 4977 */
+#define DEF_4978(a, b) (((a) << 18) | ((b) & 0x1372))
+#define DEF_4979 0x1373u /* flag 4979 */
+#define DEF_4980(a, b) (((a) << 20) | ((b) & 0x1374))
+#define DEF_4981 0x1375u /* flag 4981 */
+#define DEF_4982(a, b) (((a) << 22) | ((b) & 0x1376))
+#define DEF_4983 0x1377u /* flag 4983 */
+#define DEF_4984(a, b) (((a) << 24) | ((b) & 0x1378))
+#define DEF_4985 0x1379u /* flag 4985 */
+#define DEF_4986(a, b) (((a) << 26) | ((b) & 0x137a))
+#define DEF_4987 0x137bu /* flag 4987 */
+#define DEF_4988(a, b) (((a) << 28) | ((b) & 0x137c))
+#define DEF_4989 0x137du /* flag 4989 */
+#define DEF_4990(a, b) (((a) << 30) | ((b) & 0x137e))
+#define DEF_4991 0x137fu /* flag 4991 */
+#define DEF_4992(a, b) (((a) << 1) | ((b) & 0x1380))
+#define DEF_4993 0x1381u /* flag 4993 */
+#define DEF_4994(a, b) (((a) << 3) | ((b) & 0x1382))
+#define DEF_4995 0x1383u /* flag 4995 */
+#define DEF_4996(a, b) (((a) << 5) | ((b) & 0x1384))
+#define DEF_4997 0x1385u /* flag 4997 */
+#define DEF_4998(a, b) (((a) << 7) | ((b) & 0x1386))
+#define DEF_4999 0x1387u /* flag 4999 */
+
+int main(void) {
+  long sum = 0;
+  sum += DEF_0(0);
+  sum += DEF_100(100);
+  sum += DEF_200(200);
+  sum += DEF_300(300);
+  sum += DEF_400(400);
+  sum += DEF_500(500);
+  sum += DEF_600(600);
+  sum += DEF_700(700);
+  sum += DEF_800(800);
+  sum += DEF_900(900);
+  sum += DEF_1000(1000);
+  sum += DEF_1100(1100);
+  sum += DEF_1200(1200);
+  sum += DEF_1300(1300);
+  sum += DEF_1400(1400);
+  sum += DEF_1500(1500);
+  sum += DEF_1600(1600);
+  sum += DEF_1700(1700);
+  sum += DEF_1800(1800);
+  sum += DEF_1900(1900);
+  sum += DEF_2000(2000);
+  sum += DEF_2100(2100);
+  sum += DEF_2200(2200);
+  sum += DEF_2300(2300);
+  sum += DEF_2400(2400);
+  sum += DEF_2500(2500);
+  sum += DEF_2600(2600);
+  sum += DEF_2700(2700);
+  sum += DEF_2800(2800);
+  sum += DEF_2900(2900);
+  sum += DEF_3000(3000);
+  sum += DEF_3100(3100);
+  sum += DEF_3200(3200);
+  sum += DEF_3300(3300);
+  sum += DEF_3400(3400);
+  sum += DEF_3500(3500);
+  sum += DEF_3600(3600);
+  sum += DEF_3700(3700);
+  sum += DEF_3800(3800);
+  sum += DEF_3900(3900);
+  sum += DEF_4000(4000);
+  sum += DEF_4100(4100);
+  sum += DEF_4200(4200);
+  sum += DEF_4300(4300);
+  sum += DEF_4400(4400);
+  sum += DEF_4500(4500);
+  sum += DEF_4600(4600);
+  sum += DEF_4700(4700);
+  sum += DEF_4800(4800);
+  sum += DEF_4900(4900);
+  printf("%ld\n", sum);
+  return 0;
+}
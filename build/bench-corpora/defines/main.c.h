@@ -0,0 +1,71 @@
+/*// @generated - ccomptime™ v0.0.1 - 440dca447c39e96b \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 0
+#define _COMPTIME_X1(...) 200
+#define _COMPTIME_X2(...) 400
+#define _COMPTIME_X3(...) 600
+#define _COMPTIME_X4(...) 800
+#define _COMPTIME_X5(...) 1000
+#define _COMPTIME_X6(...) 1200
+#define _COMPTIME_X7(...) 1400
+#define _COMPTIME_X8(...) 1600
+#define _COMPTIME_X9(...) 1800
+#define _COMPTIME_X10(...) 2000
+#define _COMPTIME_X11(...) 2200
+#define _COMPTIME_X12(...) 2400
+#define _COMPTIME_X13(...) 2600
+#define _COMPTIME_X14(...) 2800
+#define _COMPTIME_X15(...) 3000
+#define _COMPTIME_X16(...) 3200
+#define _COMPTIME_X17(...) 3400
+#define _COMPTIME_X18(...) 3600
+#define _COMPTIME_X19(...) 3800
+#define _COMPTIME_X20(...) 4000
+#define _COMPTIME_X21(...) 4200
+#define _COMPTIME_X22(...) 4400
+#define _COMPTIME_X23(...) 4600
+#define _COMPTIME_X24(...) 4800
+#define _COMPTIME_X25(...) 5000
+#define _COMPTIME_X26(...) 5200
+#define _COMPTIME_X27(...) 5400
+#define _COMPTIME_X28(...) 5600
+#define _COMPTIME_X29(...) 5800
+#define _COMPTIME_X30(...) 6000
+#define _COMPTIME_X31(...) 6200
+#define _COMPTIME_X32(...) 6400
+#define _COMPTIME_X33(...) 6600
+#define _COMPTIME_X34(...) 6800
+#define _COMPTIME_X35(...) 7000
+#define _COMPTIME_X36(...) 7200
+#define _COMPTIME_X37(...) 7400
+#define _COMPTIME_X38(...) 7600
+#define _COMPTIME_X39(...) 7800
+#define _COMPTIME_X40(...) 8000
+#define _COMPTIME_X41(...) 8200
+#define _COMPTIME_X42(...) 8400
+#define _COMPTIME_X43(...) 8600
+#define _COMPTIME_X44(...) 8800
+#define _COMPTIME_X45(...) 9000
+#define _COMPTIME_X46(...) 9200
+#define _COMPTIME_X47(...) 9400
+#define _COMPTIME_X48(...) 9600
+#define _COMPTIME_X49(...) 9800
+#endif // _COMPILING
@@ -0,0 +1,2011 @@
+#include <stdio.h>
+
+#include "../../../ccomptime.h"
+#include "main.c.h"
+
+#define MACRO_0(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 0); })
+#define MACRO_1(x) ((x) * 1 + 1)
+#define MACRO_2(x) ((x) * 2 + 1)
+#define MACRO_3(x) ((x) * 3 + 1)
+#define MACRO_4(x) ((x) * 4 + 1)
+#define MACRO_5(x) ((x) * 5 + 1)
+#define MACRO_6(x) ((x) * 6 + 1)
+#define MACRO_7(x) ((x) * 7 + 1)
+#define MACRO_8(x) ((x) * 8 + 1)
+#define MACRO_9(x) ((x) * 9 + 1)
+#define MACRO_10(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 10); })
+#define MACRO_11(x) ((x) * 11 + 1)
+#define MACRO_12(x) ((x) * 12 + 1)
+#define MACRO_13(x) ((x) * 13 + 1)
+#define MACRO_14(x) ((x) * 14 + 1)
+#define MACRO_15(x) ((x) * 15 + 1)
+#define MACRO_16(x) ((x) * 16 + 1)
+#define MACRO_17(x) ((x) * 17 + 1)
+#define MACRO_18(x) ((x) * 18 + 1)
+#define MACRO_19(x) ((x) * 19 + 1)
+#define MACRO_20(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 20); })
+#define MACRO_21(x) ((x) * 21 + 1)
+#define MACRO_22(x) ((x) * 22 + 1)
+#define MACRO_23(x) ((x) * 23 + 1)
+#define MACRO_24(x) ((x) * 24 + 1)
+#define MACRO_25(x) ((x) * 25 + 1)
+#define MACRO_26(x) ((x) * 26 + 1)
+#define MACRO_27(x) ((x) * 27 + 1)
+#define MACRO_28(x) ((x) * 28 + 1)
+#define MACRO_29(x) ((x) * 29 + 1)
+#define MACRO_30(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 30); })
+#define MACRO_31(x) ((x) * 31 + 1)
+#define MACRO_32(x) ((x) * 32 + 1)
+#define MACRO_33(x) ((x) * 33 + 1)
+#define MACRO_34(x) ((x) * 34 + 1)
+#define MACRO_35(x) ((x) * 35 + 1)
+#define MACRO_36(x) ((x) * 36 + 1)
+#define MACRO_37(x) ((x) * 37 + 1)
+#define MACRO_38(x) ((x) * 38 + 1)
+#define MACRO_39(x) ((x) * 39 + 1)
+#define MACRO_40(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 40); })
+#define MACRO_41(x) ((x) * 41 + 1)
+#define MACRO_42(x) ((x) * 42 + 1)
+#define MACRO_43(x) ((x) * 43 + 1)
+#define MACRO_44(x) ((x) * 44 + 1)
+#define MACRO_45(x) ((x) * 45 + 1)
+#define MACRO_46(x) ((x) * 46 + 1)
+#define MACRO_47(x) ((x) * 47 + 1)
+#define MACRO_48(x) ((x) * 48 + 1)
+#define MACRO_49(x) ((x) * 49 + 1)
+#define MACRO_50(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 50); })
+#define MACRO_51(x) ((x) * 51 + 1)
+#define MACRO_52(x) ((x) * 52 + 1)
+#define MACRO_53(x) ((x) * 53 + 1)
+#define MACRO_54(x) ((x) * 54 + 1)
+#define MACRO_55(x) ((x) * 55 + 1)
+#define MACRO_56(x) ((x) * 56 + 1)
+#define MACRO_57(x) ((x) * 57 + 1)
+#define MACRO_58(x) ((x) * 58 + 1)
+#define MACRO_59(x) ((x) * 59 + 1)
+#define MACRO_60(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 60); })
+#define MACRO_61(x) ((x) * 61 + 1)
+#define MACRO_62(x) ((x) * 62 + 1)
+#define MACRO_63(x) ((x) * 63 + 1)
+#define MACRO_64(x) ((x) * 64 + 1)
+#define MACRO_65(x) ((x) * 65 + 1)
+#define MACRO_66(x) ((x) * 66 + 1)
+#define MACRO_67(x) ((x) * 67 + 1)
+#define MACRO_68(x) ((x) * 68 + 1)
+#define MACRO_69(x) ((x) * 69 + 1)
+#define MACRO_70(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 70); })
+#define MACRO_71(x) ((x) * 71 + 1)
+#define MACRO_72(x) ((x) * 72 + 1)
+#define MACRO_73(x) ((x) * 73 + 1)
+#define MACRO_74(x) ((x) * 74 + 1)
+#define MACRO_75(x) ((x) * 75 + 1)
+#define MACRO_76(x) ((x) * 76 + 1)
+#define MACRO_77(x) ((x) * 77 + 1)
+#define MACRO_78(x) ((x) * 78 + 1)
+#define MACRO_79(x) ((x) * 79 + 1)
+#define MACRO_80(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 80); })
+#define MACRO_81(x) ((x) * 81 + 1)
+#define MACRO_82(x) ((x) * 82 + 1)
+#define MACRO_83(x) ((x) * 83 + 1)
+#define MACRO_84(x) ((x) * 84 + 1)
+#define MACRO_85(x) ((x) * 85 + 1)
+#define MACRO_86(x) ((x) * 86 + 1)
+#define MACRO_87(x) ((x) * 87 + 1)
+#define MACRO_88(x) ((x) * 88 + 1)
+#define MACRO_89(x) ((x) * 89 + 1)
+#define MACRO_90(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 90); })
+#define MACRO_91(x) ((x) * 91 + 1)
+#define MACRO_92(x) ((x) * 92 + 1)
+#define MACRO_93(x) ((x) * 93 + 1)
+#define MACRO_94(x) ((x) * 94 + 1)
+#define MACRO_95(x) ((x) * 95 + 1)
+#define MACRO_96(x) ((x) * 96 + 1)
+#define MACRO_97(x) ((x) * 97 + 1)
+#define MACRO_98(x) ((x) * 98 + 1)
+#define MACRO_99(x) ((x) * 99 + 1)
+#define MACRO_100(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 100); })
+#define MACRO_101(x) ((x) * 101 + 1)
+#define MACRO_102(x) ((x) * 102 + 1)
+#define MACRO_103(x) ((x) * 103 + 1)
+#define MACRO_104(x) ((x) * 104 + 1)
+#define MACRO_105(x) ((x) * 105 + 1)
+#define MACRO_106(x) ((x) * 106 + 1)
+#define MACRO_107(x) ((x) * 107 + 1)
+#define MACRO_108(x) ((x) * 108 + 1)
+#define MACRO_109(x) ((x) * 109 + 1)
+#define MACRO_110(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 110); })
+#define MACRO_111(x) ((x) * 111 + 1)
+#define MACRO_112(x) ((x) * 112 + 1)
+#define MACRO_113(x) ((x) * 113 + 1)
+#define MACRO_114(x) ((x) * 114 + 1)
+#define MACRO_115(x) ((x) * 115 + 1)
+#define MACRO_116(x) ((x) * 116 + 1)
+#define MACRO_117(x) ((x) * 117 + 1)
+#define MACRO_118(x) ((x) * 118 + 1)
+#define MACRO_119(x) ((x) * 119 + 1)
+#define MACRO_120(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 120); })
+#define MACRO_121(x) ((x) * 121 + 1)
+#define MACRO_122(x) ((x) * 122 + 1)
+#define MACRO_123(x) ((x) * 123 + 1)
+#define MACRO_124(x) ((x) * 124 + 1)
+#define MACRO_125(x) ((x) * 125 + 1)
+#define MACRO_126(x) ((x) * 126 + 1)
+#define MACRO_127(x) ((x) * 127 + 1)
+#define MACRO_128(x) ((x) * 128 + 1)
+#define MACRO_129(x) ((x) * 129 + 1)
+#define MACRO_130(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 130); })
+#define MACRO_131(x) ((x) * 131 + 1)
+#define MACRO_132(x) ((x) * 132 + 1)
+#define MACRO_133(x) ((x) * 133 + 1)
+#define MACRO_134(x) ((x) * 134 + 1)
+#define MACRO_135(x) ((x) * 135 + 1)
+#define MACRO_136(x) ((x) * 136 + 1)
+#define MACRO_137(x) ((x) * 137 + 1)
+#define MACRO_138(x) ((x) * 138 + 1)
+#define MACRO_139(x) ((x) * 139 + 1)
+#define MACRO_140(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 140); })
+#define MACRO_141(x) ((x) * 141 + 1)
+#define MACRO_142(x) ((x) * 142 + 1)
+#define MACRO_143(x) ((x) * 143 + 1)
+#define MACRO_144(x) ((x) * 144 + 1)
+#define MACRO_145(x) ((x) * 145 + 1)
+#define MACRO_146(x) ((x) * 146 + 1)
+#define MACRO_147(x) ((x) * 147 + 1)
+#define MACRO_148(x) ((x) * 148 + 1)
+#define MACRO_149(x) ((x) * 149 + 1)
+#define MACRO_150(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 150); })
+#define MACRO_151(x) ((x) * 151 + 1)
+#define MACRO_152(x) ((x) * 152 + 1)
+#define MACRO_153(x) ((x) * 153 + 1)
+#define MACRO_154(x) ((x) * 154 + 1)
+#define MACRO_155(x) ((x) * 155 + 1)
+#define MACRO_156(x) ((x) * 156 + 1)
+#define MACRO_157(x) ((x) * 157 + 1)
+#define MACRO_158(x) ((x) * 158 + 1)
+#define MACRO_159(x) ((x) * 159 + 1)
+#define MACRO_160(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 160); })
+#define MACRO_161(x) ((x) * 161 + 1)
+#define MACRO_162(x) ((x) * 162 + 1)
+#define MACRO_163(x) ((x) * 163 + 1)
+#define MACRO_164(x) ((x) * 164 + 1)
+#define MACRO_165(x) ((x) * 165 + 1)
+#define MACRO_166(x) ((x) * 166 + 1)
+#define MACRO_167(x) ((x) * 167 + 1)
+#define MACRO_168(x) ((x) * 168 + 1)
+#define MACRO_169(x) ((x) * 169 + 1)
+#define MACRO_170(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 170); })
+#define MACRO_171(x) ((x) * 171 + 1)
+#define MACRO_172(x) ((x) * 172 + 1)
+#define MACRO_173(x) ((x) * 173 + 1)
+#define MACRO_174(x) ((x) * 174 + 1)
+#define MACRO_175(x) ((x) * 175 + 1)
+#define MACRO_176(x) ((x) * 176 + 1)
+#define MACRO_177(x) ((x) * 177 + 1)
+#define MACRO_178(x) ((x) * 178 + 1)
+#define MACRO_179(x) ((x) * 179 + 1)
+#define MACRO_180(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 180); })
+#define MACRO_181(x) ((x) * 181 + 1)
+#define MACRO_182(x) ((x) * 182 + 1)
+#define MACRO_183(x) ((x) * 183 + 1)
+#define MACRO_184(x) ((x) * 184 + 1)
+#define MACRO_185(x) ((x) * 185 + 1)
+#define MACRO_186(x) ((x) * 186 + 1)
+#define MACRO_187(x) ((x) * 187 + 1)
+#define MACRO_188(x) ((x) * 188 + 1)
+#define MACRO_189(x) ((x) * 189 + 1)
+#define MACRO_190(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 190); })
+#define MACRO_191(x) ((x) * 191 + 1)
+#define MACRO_192(x) ((x) * 192 + 1)
+#define MACRO_193(x) ((x) * 193 + 1)
+#define MACRO_194(x) ((x) * 194 + 1)
+#define MACRO_195(x) ((x) * 195 + 1)
+#define MACRO_196(x) ((x) * 196 + 1)
+#define MACRO_197(x) ((x) * 197 + 1)
+#define MACRO_198(x) ((x) * 198 + 1)
+#define MACRO_199(x) ((x) * 199 + 1)
+#define MACRO_200(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 200); })
+#define MACRO_201(x) ((x) * 201 + 1)
+#define MACRO_202(x) ((x) * 202 + 1)
+#define MACRO_203(x) ((x) * 203 + 1)
+#define MACRO_204(x) ((x) * 204 + 1)
+#define MACRO_205(x) ((x) * 205 + 1)
+#define MACRO_206(x) ((x) * 206 + 1)
+#define MACRO_207(x) ((x) * 207 + 1)
+#define MACRO_208(x) ((x) * 208 + 1)
+#define MACRO_209(x) ((x) * 209 + 1)
+#define MACRO_210(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 210); })
+#define MACRO_211(x) ((x) * 211 + 1)
+#define MACRO_212(x) ((x) * 212 + 1)
+#define MACRO_213(x) ((x) * 213 + 1)
+#define MACRO_214(x) ((x) * 214 + 1)
+#define MACRO_215(x) ((x) * 215 + 1)
+#define MACRO_216(x) ((x) * 216 + 1)
+#define MACRO_217(x) ((x) * 217 + 1)
+#define MACRO_218(x) ((x) * 218 + 1)
+#define MACRO_219(x) ((x) * 219 + 1)
+#define MACRO_220(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 220); })
+#define MACRO_221(x) ((x) * 221 + 1)
+#define MACRO_222(x) ((x) * 222 + 1)
+#define MACRO_223(x) ((x) * 223 + 1)
+#define MACRO_224(x) ((x) * 224 + 1)
+#define MACRO_225(x) ((x) * 225 + 1)
+#define MACRO_226(x) ((x) * 226 + 1)
+#define MACRO_227(x) ((x) * 227 + 1)
+#define MACRO_228(x) ((x) * 228 + 1)
+#define MACRO_229(x) ((x) * 229 + 1)
+#define MACRO_230(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 230); })
+#define MACRO_231(x) ((x) * 231 + 1)
+#define MACRO_232(x) ((x) * 232 + 1)
+#define MACRO_233(x) ((x) * 233 + 1)
+#define MACRO_234(x) ((x) * 234 + 1)
+#define MACRO_235(x) ((x) * 235 + 1)
+#define MACRO_236(x) ((x) * 236 + 1)
+#define MACRO_237(x) ((x) * 237 + 1)
+#define MACRO_238(x) ((x) * 238 + 1)
+#define MACRO_239(x) ((x) * 239 + 1)
+#define MACRO_240(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 240); })
+#define MACRO_241(x) ((x) * 241 + 1)
+#define MACRO_242(x) ((x) * 242 + 1)
+#define MACRO_243(x) ((x) * 243 + 1)
+#define MACRO_244(x) ((x) * 244 + 1)
+#define MACRO_245(x) ((x) * 245 + 1)
+#define MACRO_246(x) ((x) * 246 + 1)
+#define MACRO_247(x) ((x) * 247 + 1)
+#define MACRO_248(x) ((x) * 248 + 1)
+#define MACRO_249(x) ((x) * 249 + 1)
+#define MACRO_250(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 250); })
+#define MACRO_251(x) ((x) * 251 + 1)
+#define MACRO_252(x) ((x) * 252 + 1)
+#define MACRO_253(x) ((x) * 253 + 1)
+#define MACRO_254(x) ((x) * 254 + 1)
+#define MACRO_255(x) ((x) * 255 + 1)
+#define MACRO_256(x) ((x) * 256 + 1)
+#define MACRO_257(x) ((x) * 257 + 1)
+#define MACRO_258(x) ((x) * 258 + 1)
+#define MACRO_259(x) ((x) * 259 + 1)
+#define MACRO_260(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 260); })
+#define MACRO_261(x) ((x) * 261 + 1)
+#define MACRO_262(x) ((x) * 262 + 1)
+#define MACRO_263(x) ((x) * 263 + 1)
+#define MACRO_264(x) ((x) * 264 + 1)
+#define MACRO_265(x) ((x) * 265 + 1)
+#define MACRO_266(x) ((x) * 266 + 1)
+#define MACRO_267(x) ((x) * 267 + 1)
+#define MACRO_268(x) ((x) * 268 + 1)
+#define MACRO_269(x) ((x) * 269 + 1)
+#define MACRO_270(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 270); })
+#define MACRO_271(x) ((x) * 271 + 1)
+#define MACRO_272(x) ((x) * 272 + 1)
+#define MACRO_273(x) ((x) * 273 + 1)
+#define MACRO_274(x) ((x) * 274 + 1)
+#define MACRO_275(x) ((x) * 275 + 1)
+#define MACRO_276(x) ((x) * 276 + 1)
+#define MACRO_277(x) ((x) * 277 + 1)
+#define MACRO_278(x) ((x) * 278 + 1)
+#define MACRO_279(x) ((x) * 279 + 1)
+#define MACRO_280(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 280); })
+#define MACRO_281(x) ((x) * 281 + 1)
+#define MACRO_282(x) ((x) * 282 + 1)
+#define MACRO_283(x) ((x) * 283 + 1)
+#define MACRO_284(x) ((x) * 284 + 1)
+#define MACRO_285(x) ((x) * 285 + 1)
+#define MACRO_286(x) ((x) * 286 + 1)
+#define MACRO_287(x) ((x) * 287 + 1)
+#define MACRO_288(x) ((x) * 288 + 1)
+#define MACRO_289(x) ((x) * 289 + 1)
+#define MACRO_290(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 290); })
+#define MACRO_291(x) ((x) * 291 + 1)
+#define MACRO_292(x) ((x) * 292 + 1)
+#define MACRO_293(x) ((x) * 293 + 1)
+#define MACRO_294(x) ((x) * 294 + 1)
+#define MACRO_295(x) ((x) * 295 + 1)
+#define MACRO_296(x) ((x) * 296 + 1)
+#define MACRO_297(x) ((x) * 297 + 1)
+#define MACRO_298(x) ((x) * 298 + 1)
+#define MACRO_299(x) ((x) * 299 + 1)
+#define MACRO_300(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 300); })
+#define MACRO_301(x) ((x) * 301 + 1)
+#define MACRO_302(x) ((x) * 302 + 1)
+#define MACRO_303(x) ((x) * 303 + 1)
+#define MACRO_304(x) ((x) * 304 + 1)
+#define MACRO_305(x) ((x) * 305 + 1)
+#define MACRO_306(x) ((x) * 306 + 1)
+#define MACRO_307(x) ((x) * 307 + 1)
+#define MACRO_308(x) ((x) * 308 + 1)
+#define MACRO_309(x) ((x) * 309 + 1)
+#define MACRO_310(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 310); })
+#define MACRO_311(x) ((x) * 311 + 1)
+#define MACRO_312(x) ((x) * 312 + 1)
+#define MACRO_313(x) ((x) * 313 + 1)
+#define MACRO_314(x) ((x) * 314 + 1)
+#define MACRO_315(x) ((x) * 315 + 1)
+#define MACRO_316(x) ((x) * 316 + 1)
+#define MACRO_317(x) ((x) * 317 + 1)
+#define MACRO_318(x) ((x) * 318 + 1)
+#define MACRO_319(x) ((x) * 319 + 1)
+#define MACRO_320(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 320); })
+#define MACRO_321(x) ((x) * 321 + 1)
+#define MACRO_322(x) ((x) * 322 + 1)
+#define MACRO_323(x) ((x) * 323 + 1)
+#define MACRO_324(x) ((x) * 324 + 1)
+#define MACRO_325(x) ((x) * 325 + 1)
+#define MACRO_326(x) ((x) * 326 + 1)
+#define MACRO_327(x) ((x) * 327 + 1)
+#define MACRO_328(x) ((x) * 328 + 1)
+#define MACRO_329(x) ((x) * 329 + 1)
+#define MACRO_330(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 330); })
+#define MACRO_331(x) ((x) * 331 + 1)
+#define MACRO_332(x) ((x) * 332 + 1)
+#define MACRO_333(x) ((x) * 333 + 1)
+#define MACRO_334(x) ((x) * 334 + 1)
+#define MACRO_335(x) ((x) * 335 + 1)
+#define MACRO_336(x) ((x) * 336 + 1)
+#define MACRO_337(x) ((x) * 337 + 1)
+#define MACRO_338(x) ((x) * 338 + 1)
+#define MACRO_339(x) ((x) * 339 + 1)
+#define MACRO_340(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 340); })
+#define MACRO_341(x) ((x) * 341 + 1)
+#define MACRO_342(x) ((x) * 342 + 1)
+#define MACRO_343(x) ((x) * 343 + 1)
+#define MACRO_344(x) ((x) * 344 + 1)
+#define MACRO_345(x) ((x) * 345 + 1)
+#define MACRO_346(x) ((x) * 346 + 1)
+#define MACRO_347(x) ((x) * 347 + 1)
+#define MACRO_348(x) ((x) * 348 + 1)
+#define MACRO_349(x) ((x) * 349 + 1)
+#define MACRO_350(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 350); })
+#define MACRO_351(x) ((x) * 351 + 1)
+#define MACRO_352(x) ((x) * 352 + 1)
+#define MACRO_353(x) ((x) * 353 + 1)
+#define MACRO_354(x) ((x) * 354 + 1)
+#define MACRO_355(x) ((x) * 355 + 1)
+#define MACRO_356(x) ((x) * 356 + 1)
+#define MACRO_357(x) ((x) * 357 + 1)
+#define MACRO_358(x) ((x) * 358 + 1)
+#define MACRO_359(x) ((x) * 359 + 1)
+#define MACRO_360(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 360); })
+#define MACRO_361(x) ((x) * 361 + 1)
+#define MACRO_362(x) ((x) * 362 + 1)
+#define MACRO_363(x) ((x) * 363 + 1)
+#define MACRO_364(x) ((x) * 364 + 1)
+#define MACRO_365(x) ((x) * 365 + 1)
+#define MACRO_366(x) ((x) * 366 + 1)
+#define MACRO_367(x) ((x) * 367 + 1)
+#define MACRO_368(x) ((x) * 368 + 1)
+#define MACRO_369(x) ((x) * 369 + 1)
+#define MACRO_370(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 370); })
+#define MACRO_371(x) ((x) * 371 + 1)
+#define MACRO_372(x) ((x) * 372 + 1)
+#define MACRO_373(x) ((x) * 373 + 1)
+#define MACRO_374(x) ((x) * 374 + 1)
+#define MACRO_375(x) ((x) * 375 + 1)
+#define MACRO_376(x) ((x) * 376 + 1)
+#define MACRO_377(x) ((x) * 377 + 1)
+#define MACRO_378(x) ((x) * 378 + 1)
+#define MACRO_379(x) ((x) * 379 + 1)
+#define MACRO_380(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 380); })
+#define MACRO_381(x) ((x) * 381 + 1)
+#define MACRO_382(x) ((x) * 382 + 1)
+#define MACRO_383(x) ((x) * 383 + 1)
+#define MACRO_384(x) ((x) * 384 + 1)
+#define MACRO_385(x) ((x) * 385 + 1)
+#define MACRO_386(x) ((x) * 386 + 1)
+#define MACRO_387(x) ((x) * 387 + 1)
+#define MACRO_388(x) ((x) * 388 + 1)
+#define MACRO_389(x) ((x) * 389 + 1)
+#define MACRO_390(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 390); })
+#define MACRO_391(x) ((x) * 391 + 1)
+#define MACRO_392(x) ((x) * 392 + 1)
+#define MACRO_393(x) ((x) * 393 + 1)
+#define MACRO_394(x) ((x) * 394 + 1)
+#define MACRO_395(x) ((x) * 395 + 1)
+#define MACRO_396(x) ((x) * 396 + 1)
+#define MACRO_397(x) ((x) * 397 + 1)
+#define MACRO_398(x) ((x) * 398 + 1)
+#define MACRO_399(x) ((x) * 399 + 1)
+#define MACRO_400(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 400); })
+#define MACRO_401(x) ((x) * 401 + 1)
+#define MACRO_402(x) ((x) * 402 + 1)
+#define MACRO_403(x) ((x) * 403 + 1)
+#define MACRO_404(x) ((x) * 404 + 1)
+#define MACRO_405(x) ((x) * 405 + 1)
+#define MACRO_406(x) ((x) * 406 + 1)
+#define MACRO_407(x) ((x) * 407 + 1)
+#define MACRO_408(x) ((x) * 408 + 1)
+#define MACRO_409(x) ((x) * 409 + 1)
+#define MACRO_410(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 410); })
+#define MACRO_411(x) ((x) * 411 + 1)
+#define MACRO_412(x) ((x) * 412 + 1)
+#define MACRO_413(x) ((x) * 413 + 1)
+#define MACRO_414(x) ((x) * 414 + 1)
+#define MACRO_415(x) ((x) * 415 + 1)
+#define MACRO_416(x) ((x) * 416 + 1)
+#define MACRO_417(x) ((x) * 417 + 1)
+#define MACRO_418(x) ((x) * 418 + 1)
+#define MACRO_419(x) ((x) * 419 + 1)
+#define MACRO_420(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 420); })
+#define MACRO_421(x) ((x) * 421 + 1)
+#define MACRO_422(x) ((x) * 422 + 1)
+#define MACRO_423(x) ((x) * 423 + 1)
+#define MACRO_424(x) ((x) * 424 + 1)
+#define MACRO_425(x) ((x) * 425 + 1)
+#define MACRO_426(x) ((x) * 426 + 1)
+#define MACRO_427(x) ((x) * 427 + 1)
+#define MACRO_428(x) ((x) * 428 + 1)
+#define MACRO_429(x) ((x) * 429 + 1)
+#define MACRO_430(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 430); })
+#define MACRO_431(x) ((x) * 431 + 1)
+#define MACRO_432(x) ((x) * 432 + 1)
+#define MACRO_433(x) ((x) * 433 + 1)
+#define MACRO_434(x) ((x) * 434 + 1)
+#define MACRO_435(x) ((x) * 435 + 1)
+#define MACRO_436(x) ((x) * 436 + 1)
+#define MACRO_437(x) ((x) * 437 + 1)
+#define MACRO_438(x) ((x) * 438 + 1)
+#define MACRO_439(x) ((x) * 439 + 1)
+#define MACRO_440(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 440); })
+#define MACRO_441(x) ((x) * 441 + 1)
+#define MACRO_442(x) ((x) * 442 + 1)
+#define MACRO_443(x) ((x) * 443 + 1)
+#define MACRO_444(x) ((x) * 444 + 1)
+#define MACRO_445(x) ((x) * 445 + 1)
+#define MACRO_446(x) ((x) * 446 + 1)
+#define MACRO_447(x) ((x) * 447 + 1)
+#define MACRO_448(x) ((x) * 448 + 1)
+#define MACRO_449(x) ((x) * 449 + 1)
+#define MACRO_450(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 450); })
+#define MACRO_451(x) ((x) * 451 + 1)
+#define MACRO_452(x) ((x) * 452 + 1)
+#define MACRO_453(x) ((x) * 453 + 1)
+#define MACRO_454(x) ((x) * 454 + 1)
+#define MACRO_455(x) ((x) * 455 + 1)
+#define MACRO_456(x) ((x) * 456 + 1)
+#define MACRO_457(x) ((x) * 457 + 1)
+#define MACRO_458(x) ((x) * 458 + 1)
+#define MACRO_459(x) ((x) * 459 + 1)
+#define MACRO_460(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 460); })
+#define MACRO_461(x) ((x) * 461 + 1)
+#define MACRO_462(x) ((x) * 462 + 1)
+#define MACRO_463(x) ((x) * 463 + 1)
+#define MACRO_464(x) ((x) * 464 + 1)
+#define MACRO_465(x) ((x) * 465 + 1)
+#define MACRO_466(x) ((x) * 466 + 1)
+#define MACRO_467(x) ((x) * 467 + 1)
+#define MACRO_468(x) ((x) * 468 + 1)
+#define MACRO_469(x) ((x) * 469 + 1)
+#define MACRO_470(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 470); })
+#define MACRO_471(x) ((x) * 471 + 1)
+#define MACRO_472(x) ((x) * 472 + 1)
+#define MACRO_473(x) ((x) * 473 + 1)
+#define MACRO_474(x) ((x) * 474 + 1)
+#define MACRO_475(x) ((x) * 475 + 1)
+#define MACRO_476(x) ((x) * 476 + 1)
+#define MACRO_477(x) ((x) * 477 + 1)
+#define MACRO_478(x) ((x) * 478 + 1)
+#define MACRO_479(x) ((x) * 479 + 1)
+#define MACRO_480(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 480); })
+#define MACRO_481(x) ((x) * 481 + 1)
+#define MACRO_482(x) ((x) * 482 + 1)
+#define MACRO_483(x) ((x) * 483 + 1)
+#define MACRO_484(x) ((x) * 484 + 1)
+#define MACRO_485(x) ((x) * 485 + 1)
+#define MACRO_486(x) ((x) * 486 + 1)
+#define MACRO_487(x) ((x) * 487 + 1)
+#define MACRO_488(x) ((x) * 488 + 1)
+#define MACRO_489(x) ((x) * 489 + 1)
+#define MACRO_490(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 490); })
+#define MACRO_491(x) ((x) * 491 + 1)
+#define MACRO_492(x) ((x) * 492 + 1)
+#define MACRO_493(x) ((x) * 493 + 1)
+#define MACRO_494(x) ((x) * 494 + 1)
+#define MACRO_495(x) ((x) * 495 + 1)
+#define MACRO_496(x) ((x) * 496 + 1)
+#define MACRO_497(x) ((x) * 497 + 1)
+#define MACRO_498(x) ((x) * 498 + 1)
+#define MACRO_499(x) ((x) * 499 + 1)
+#define MACRO_500(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 500); })
+#define MACRO_501(x) ((x) * 501 + 1)
+#define MACRO_502(x) ((x) * 502 + 1)
+#define MACRO_503(x) ((x) * 503 + 1)
+#define MACRO_504(x) ((x) * 504 + 1)
+#define MACRO_505(x) ((x) * 505 + 1)
+#define MACRO_506(x) ((x) * 506 + 1)
+#define MACRO_507(x) ((x) * 507 + 1)
+#define MACRO_508(x) ((x) * 508 + 1)
+#define MACRO_509(x) ((x) * 509 + 1)
+#define MACRO_510(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 510); })
+#define MACRO_511(x) ((x) * 511 + 1)
+#define MACRO_512(x) ((x) * 512 + 1)
+#define MACRO_513(x) ((x) * 513 + 1)
+#define MACRO_514(x) ((x) * 514 + 1)
+#define MACRO_515(x) ((x) * 515 + 1)
+#define MACRO_516(x) ((x) * 516 + 1)
+#define MACRO_517(x) ((x) * 517 + 1)
+#define MACRO_518(x) ((x) * 518 + 1)
+#define MACRO_519(x) ((x) * 519 + 1)
+#define MACRO_520(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 520); })
+#define MACRO_521(x) ((x) * 521 + 1)
+#define MACRO_522(x) ((x) * 522 + 1)
+#define MACRO_523(x) ((x) * 523 + 1)
+#define MACRO_524(x) ((x) * 524 + 1)
+#define MACRO_525(x) ((x) * 525 + 1)
+#define MACRO_526(x) ((x) * 526 + 1)
+#define MACRO_527(x) ((x) * 527 + 1)
+#define MACRO_528(x) ((x) * 528 + 1)
+#define MACRO_529(x) ((x) * 529 + 1)
+#define MACRO_530(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 530); })
+#define MACRO_531(x) ((x) * 531 + 1)
+#define MACRO_532(x) ((x) * 532 + 1)
+#define MACRO_533(x) ((x) * 533 + 1)
+#define MACRO_534(x) ((x) * 534 + 1)
+#define MACRO_535(x) ((x) * 535 + 1)
+#define MACRO_536(x) ((x) * 536 + 1)
+#define MACRO_537(x) ((x) * 537 + 1)
+#define MACRO_538(x) ((x) * 538 + 1)
+#define MACRO_539(x) ((x) * 539 + 1)
+#define MACRO_540(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 540); })
+#define MACRO_541(x) ((x) * 541 + 1)
+#define MACRO_542(x) ((x) * 542 + 1)
+#define MACRO_543(x) ((x) * 543 + 1)
+#define MACRO_544(x) ((x) * 544 + 1)
+#define MACRO_545(x) ((x) * 545 + 1)
+#define MACRO_546(x) ((x) * 546 + 1)
+#define MACRO_547(x) ((x) * 547 + 1)
+#define MACRO_548(x) ((x) * 548 + 1)
+#define MACRO_549(x) ((x) * 549 + 1)
+#define MACRO_550(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 550); })
+#define MACRO_551(x) ((x) * 551 + 1)
+#define MACRO_552(x) ((x) * 552 + 1)
+#define MACRO_553(x) ((x) * 553 + 1)
+#define MACRO_554(x) ((x) * 554 + 1)
+#define MACRO_555(x) ((x) * 555 + 1)
+#define MACRO_556(x) ((x) * 556 + 1)
+#define MACRO_557(x) ((x) * 557 + 1)
+#define MACRO_558(x) ((x) * 558 + 1)
+#define MACRO_559(x) ((x) * 559 + 1)
+#define MACRO_560(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 560); })
+#define MACRO_561(x) ((x) * 561 + 1)
+#define MACRO_562(x) ((x) * 562 + 1)
+#define MACRO_563(x) ((x) * 563 + 1)
+#define MACRO_564(x) ((x) * 564 + 1)
+#define MACRO_565(x) ((x) * 565 + 1)
+#define MACRO_566(x) ((x) * 566 + 1)
+#define MACRO_567(x) ((x) * 567 + 1)
+#define MACRO_568(x) ((x) * 568 + 1)
+#define MACRO_569(x) ((x) * 569 + 1)
+#define MACRO_570(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 570); })
+#define MACRO_571(x) ((x) * 571 + 1)
+#define MACRO_572(x) ((x) * 572 + 1)
+#define MACRO_573(x) ((x) * 573 + 1)
+#define MACRO_574(x) ((x) * 574 + 1)
+#define MACRO_575(x) ((x) * 575 + 1)
+#define MACRO_576(x) ((x) * 576 + 1)
+#define MACRO_577(x) ((x) * 577 + 1)
+#define MACRO_578(x) ((x) * 578 + 1)
+#define MACRO_579(x) ((x) * 579 + 1)
+#define MACRO_580(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 580); })
+#define MACRO_581(x) ((x) * 581 + 1)
+#define MACRO_582(x) ((x) * 582 + 1)
+#define MACRO_583(x) ((x) * 583 + 1)
+#define MACRO_584(x) ((x) * 584 + 1)
+#define MACRO_585(x) ((x) * 585 + 1)
+#define MACRO_586(x) ((x) * 586 + 1)
+#define MACRO_587(x) ((x) * 587 + 1)
+#define MACRO_588(x) ((x) * 588 + 1)
+#define MACRO_589(x) ((x) * 589 + 1)
+#define MACRO_590(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 590); })
+#define MACRO_591(x) ((x) * 591 + 1)
+#define MACRO_592(x) ((x) * 592 + 1)
+#define MACRO_593(x) ((x) * 593 + 1)
+#define MACRO_594(x) ((x) * 594 + 1)
+#define MACRO_595(x) ((x) * 595 + 1)
+#define MACRO_596(x) ((x) * 596 + 1)
+#define MACRO_597(x) ((x) * 597 + 1)
+#define MACRO_598(x) ((x) * 598 + 1)
+#define MACRO_599(x) ((x) * 599 + 1)
+#define MACRO_600(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 600); })
+#define MACRO_601(x) ((x) * 601 + 1)
+#define MACRO_602(x) ((x) * 602 + 1)
+#define MACRO_603(x) ((x) * 603 + 1)
+#define MACRO_604(x) ((x) * 604 + 1)
+#define MACRO_605(x) ((x) * 605 + 1)
+#define MACRO_606(x) ((x) * 606 + 1)
+#define MACRO_607(x) ((x) * 607 + 1)
+#define MACRO_608(x) ((x) * 608 + 1)
+#define MACRO_609(x) ((x) * 609 + 1)
+#define MACRO_610(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 610); })
+#define MACRO_611(x) ((x) * 611 + 1)
+#define MACRO_612(x) ((x) * 612 + 1)
+#define MACRO_613(x) ((x) * 613 + 1)
+#define MACRO_614(x) ((x) * 614 + 1)
+#define MACRO_615(x) ((x) * 615 + 1)
+#define MACRO_616(x) ((x) * 616 + 1)
+#define MACRO_617(x) ((x) * 617 + 1)
+#define MACRO_618(x) ((x) * 618 + 1)
+#define MACRO_619(x) ((x) * 619 + 1)
+#define MACRO_620(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 620); })
+#define MACRO_621(x) ((x) * 621 + 1)
+#define MACRO_622(x) ((x) * 622 + 1)
+#define MACRO_623(x) ((x) * 623 + 1)
+#define MACRO_624(x) ((x) * 624 + 1)
+#define MACRO_625(x) ((x) * 625 + 1)
+#define MACRO_626(x) ((x) * 626 + 1)
+#define MACRO_627(x) ((x) * 627 + 1)
+#define MACRO_628(x) ((x) * 628 + 1)
+#define MACRO_629(x) ((x) * 629 + 1)
+#define MACRO_630(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 630); })
+#define MACRO_631(x) ((x) * 631 + 1)
+#define MACRO_632(x) ((x) * 632 + 1)
+#define MACRO_633(x) ((x) * 633 + 1)
+#define MACRO_634(x) ((x) * 634 + 1)
+#define MACRO_635(x) ((x) * 635 + 1)
+#define MACRO_636(x) ((x) * 636 + 1)
+#define MACRO_637(x) ((x) * 637 + 1)
+#define MACRO_638(x) ((x) * 638 + 1)
+#define MACRO_639(x) ((x) * 639 + 1)
+#define MACRO_640(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 640); })
+#define MACRO_641(x) ((x) * 641 + 1)
+#define MACRO_642(x) ((x) * 642 + 1)
+#define MACRO_643(x) ((x) * 643 + 1)
+#define MACRO_644(x) ((x) * 644 + 1)
+#define MACRO_645(x) ((x) * 645 + 1)
+#define MACRO_646(x) ((x) * 646 + 1)
+#define MACRO_647(x) ((x) * 647 + 1)
+#define MACRO_648(x) ((x) * 648 + 1)
+#define MACRO_649(x) ((x) * 649 + 1)
+#define MACRO_650(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 650); })
+#define MACRO_651(x) ((x) * 651 + 1)
+#define MACRO_652(x) ((x) * 652 + 1)
+#define MACRO_653(x) ((x) * 653 + 1)
+#define MACRO_654(x) ((x) * 654 + 1)
+#define MACRO_655(x) ((x) * 655 + 1)
+#define MACRO_656(x) ((x) * 656 + 1)
+#define MACRO_657(x) ((x) * 657 + 1)
+#define MACRO_658(x) ((x) * 658 + 1)
+#define MACRO_659(x) ((x) * 659 + 1)
+#define MACRO_660(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 660); })
+#define MACRO_661(x) ((x) * 661 + 1)
+#define MACRO_662(x) ((x) * 662 + 1)
+#define MACRO_663(x) ((x) * 663 + 1)
+#define MACRO_664(x) ((x) * 664 + 1)
+#define MACRO_665(x) ((x) * 665 + 1)
+#define MACRO_666(x) ((x) * 666 + 1)
+#define MACRO_667(x) ((x) * 667 + 1)
+#define MACRO_668(x) ((x) * 668 + 1)
+#define MACRO_669(x) ((x) * 669 + 1)
+#define MACRO_670(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 670); })
+#define MACRO_671(x) ((x) * 671 + 1)
+#define MACRO_672(x) ((x) * 672 + 1)
+#define MACRO_673(x) ((x) * 673 + 1)
+#define MACRO_674(x) ((x) * 674 + 1)
+#define MACRO_675(x) ((x) * 675 + 1)
+#define MACRO_676(x) ((x) * 676 + 1)
+#define MACRO_677(x) ((x) * 677 + 1)
+#define MACRO_678(x) ((x) * 678 + 1)
+#define MACRO_679(x) ((x) * 679 + 1)
+#define MACRO_680(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 680); })
+#define MACRO_681(x) ((x) * 681 + 1)
+#define MACRO_682(x) ((x) * 682 + 1)
+#define MACRO_683(x) ((x) * 683 + 1)
+#define MACRO_684(x) ((x) * 684 + 1)
+#define MACRO_685(x) ((x) * 685 + 1)
+#define MACRO_686(x) ((x) * 686 + 1)
+#define MACRO_687(x) ((x) * 687 + 1)
+#define MACRO_688(x) ((x) * 688 + 1)
+#define MACRO_689(x) ((x) * 689 + 1)
+#define MACRO_690(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 690); })
+#define MACRO_691(x) ((x) * 691 + 1)
+#define MACRO_692(x) ((x) * 692 + 1)
+#define MACRO_693(x) ((x) * 693 + 1)
+#define MACRO_694(x) ((x) * 694 + 1)
+#define MACRO_695(x) ((x) * 695 + 1)
+#define MACRO_696(x) ((x) * 696 + 1)
+#define MACRO_697(x) ((x) * 697 + 1)
+#define MACRO_698(x) ((x) * 698 + 1)
+#define MACRO_699(x) ((x) * 699 + 1)
+#define MACRO_700(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 700); })
+#define MACRO_701(x) ((x) * 701 + 1)
+#define MACRO_702(x) ((x) * 702 + 1)
+#define MACRO_703(x) ((x) * 703 + 1)
+#define MACRO_704(x) ((x) * 704 + 1)
+#define MACRO_705(x) ((x) * 705 + 1)
+#define MACRO_706(x) ((x) * 706 + 1)
+#define MACRO_707(x) ((x) * 707 + 1)
+#define MACRO_708(x) ((x) * 708 + 1)
+#define MACRO_709(x) ((x) * 709 + 1)
+#define MACRO_710(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 710); })
+#define MACRO_711(x) ((x) * 711 + 1)
+#define MACRO_712(x) ((x) * 712 + 1)
+#define MACRO_713(x) ((x) * 713 + 1)
+#define MACRO_714(x) ((x) * 714 + 1)
+#define MACRO_715(x) ((x) * 715 + 1)
+#define MACRO_716(x) ((x) * 716 + 1)
+#define MACRO_717(x) ((x) * 717 + 1)
+#define MACRO_718(x) ((x) * 718 + 1)
+#define MACRO_719(x) ((x) * 719 + 1)
+#define MACRO_720(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 720); })
+#define MACRO_721(x) ((x) * 721 + 1)
+#define MACRO_722(x) ((x) * 722 + 1)
+#define MACRO_723(x) ((x) * 723 + 1)
+#define MACRO_724(x) ((x) * 724 + 1)
+#define MACRO_725(x) ((x) * 725 + 1)
+#define MACRO_726(x) ((x) * 726 + 1)
+#define MACRO_727(x) ((x) * 727 + 1)
+#define MACRO_728(x) ((x) * 728 + 1)
+#define MACRO_729(x) ((x) * 729 + 1)
+#define MACRO_730(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 730); })
+#define MACRO_731(x) ((x) * 731 + 1)
+#define MACRO_732(x) ((x) * 732 + 1)
+#define MACRO_733(x) ((x) * 733 + 1)
+#define MACRO_734(x) ((x) * 734 + 1)
+#define MACRO_735(x) ((x) * 735 + 1)
+#define MACRO_736(x) ((x) * 736 + 1)
+#define MACRO_737(x) ((x) * 737 + 1)
+#define MACRO_738(x) ((x) * 738 + 1)
+#define MACRO_739(x) ((x) * 739 + 1)
+#define MACRO_740(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 740); })
+#define MACRO_741(x) ((x) * 741 + 1)
+#define MACRO_742(x) ((x) * 742 + 1)
+#define MACRO_743(x) ((x) * 743 + 1)
+#define MACRO_744(x) ((x) * 744 + 1)
+#define MACRO_745(x) ((x) * 745 + 1)
+#define MACRO_746(x) ((x) * 746 + 1)
+#define MACRO_747(x) ((x) * 747 + 1)
+#define MACRO_748(x) ((x) * 748 + 1)
+#define MACRO_749(x) ((x) * 749 + 1)
+#define MACRO_750(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 750); })
+#define MACRO_751(x) ((x) * 751 + 1)
+#define MACRO_752(x) ((x) * 752 + 1)
+#define MACRO_753(x) ((x) * 753 + 1)
+#define MACRO_754(x) ((x) * 754 + 1)
+#define MACRO_755(x) ((x) * 755 + 1)
+#define MACRO_756(x) ((x) * 756 + 1)
+#define MACRO_757(x) ((x) * 757 + 1)
+#define MACRO_758(x) ((x) * 758 + 1)
+#define MACRO_759(x) ((x) * 759 + 1)
+#define MACRO_760(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 760); })
+#define MACRO_761(x) ((x) * 761 + 1)
+#define MACRO_762(x) ((x) * 762 + 1)
+#define MACRO_763(x) ((x) * 763 + 1)
+#define MACRO_764(x) ((x) * 764 + 1)
+#define MACRO_765(x) ((x) * 765 + 1)
+#define MACRO_766(x) ((x) * 766 + 1)
+#define MACRO_767(x) ((x) * 767 + 1)
+#define MACRO_768(x) ((x) * 768 + 1)
+#define MACRO_769(x) ((x) * 769 + 1)
+#define MACRO_770(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 770); })
+#define MACRO_771(x) ((x) * 771 + 1)
+#define MACRO_772(x) ((x) * 772 + 1)
+#define MACRO_773(x) ((x) * 773 + 1)
+#define MACRO_774(x) ((x) * 774 + 1)
+#define MACRO_775(x) ((x) * 775 + 1)
+#define MACRO_776(x) ((x) * 776 + 1)
+#define MACRO_777(x) ((x) * 777 + 1)
+#define MACRO_778(x) ((x) * 778 + 1)
+#define MACRO_779(x) ((x) * 779 + 1)
+#define MACRO_780(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 780); })
+#define MACRO_781(x) ((x) * 781 + 1)
+#define MACRO_782(x) ((x) * 782 + 1)
+#define MACRO_783(x) ((x) * 783 + 1)
+#define MACRO_784(x) ((x) * 784 + 1)
+#define MACRO_785(x) ((x) * 785 + 1)
+#define MACRO_786(x) ((x) * 786 + 1)
+#define MACRO_787(x) ((x) * 787 + 1)
+#define MACRO_788(x) ((x) * 788 + 1)
+#define MACRO_789(x) ((x) * 789 + 1)
+#define MACRO_790(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 790); })
+#define MACRO_791(x) ((x) * 791 + 1)
+#define MACRO_792(x) ((x) * 792 + 1)
+#define MACRO_793(x) ((x) * 793 + 1)
+#define MACRO_794(x) ((x) * 794 + 1)
+#define MACRO_795(x) ((x) * 795 + 1)
+#define MACRO_796(x) ((x) * 796 + 1)
+#define MACRO_797(x) ((x) * 797 + 1)
+#define MACRO_798(x) ((x) * 798 + 1)
+#define MACRO_799(x) ((x) * 799 + 1)
+#define MACRO_800(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 800); })
+#define MACRO_801(x) ((x) * 801 + 1)
+#define MACRO_802(x) ((x) * 802 + 1)
+#define MACRO_803(x) ((x) * 803 + 1)
+#define MACRO_804(x) ((x) * 804 + 1)
+#define MACRO_805(x) ((x) * 805 + 1)
+#define MACRO_806(x) ((x) * 806 + 1)
+#define MACRO_807(x) ((x) * 807 + 1)
+#define MACRO_808(x) ((x) * 808 + 1)
+#define MACRO_809(x) ((x) * 809 + 1)
+#define MACRO_810(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 810); })
+#define MACRO_811(x) ((x) * 811 + 1)
+#define MACRO_812(x) ((x) * 812 + 1)
+#define MACRO_813(x) ((x) * 813 + 1)
+#define MACRO_814(x) ((x) * 814 + 1)
+#define MACRO_815(x) ((x) * 815 + 1)
+#define MACRO_816(x) ((x) * 816 + 1)
+#define MACRO_817(x) ((x) * 817 + 1)
+#define MACRO_818(x) ((x) * 818 + 1)
+#define MACRO_819(x) ((x) * 819 + 1)
+#define MACRO_820(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 820); })
+#define MACRO_821(x) ((x) * 821 + 1)
+#define MACRO_822(x) ((x) * 822 + 1)
+#define MACRO_823(x) ((x) * 823 + 1)
+#define MACRO_824(x) ((x) * 824 + 1)
+#define MACRO_825(x) ((x) * 825 + 1)
+#define MACRO_826(x) ((x) * 826 + 1)
+#define MACRO_827(x) ((x) * 827 + 1)
+#define MACRO_828(x) ((x) * 828 + 1)
+#define MACRO_829(x) ((x) * 829 + 1)
+#define MACRO_830(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 830); })
+#define MACRO_831(x) ((x) * 831 + 1)
+#define MACRO_832(x) ((x) * 832 + 1)
+#define MACRO_833(x) ((x) * 833 + 1)
+#define MACRO_834(x) ((x) * 834 + 1)
+#define MACRO_835(x) ((x) * 835 + 1)
+#define MACRO_836(x) ((x) * 836 + 1)
+#define MACRO_837(x) ((x) * 837 + 1)
+#define MACRO_838(x) ((x) * 838 + 1)
+#define MACRO_839(x) ((x) * 839 + 1)
+#define MACRO_840(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 840); })
+#define MACRO_841(x) ((x) * 841 + 1)
+#define MACRO_842(x) ((x) * 842 + 1)
+#define MACRO_843(x) ((x) * 843 + 1)
+#define MACRO_844(x) ((x) * 844 + 1)
+#define MACRO_845(x) ((x) * 845 + 1)
+#define MACRO_846(x) ((x) * 846 + 1)
+#define MACRO_847(x) ((x) * 847 + 1)
+#define MACRO_848(x) ((x) * 848 + 1)
+#define MACRO_849(x) ((x) * 849 + 1)
+#define MACRO_850(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 850); })
+#define MACRO_851(x) ((x) * 851 + 1)
+#define MACRO_852(x) ((x) * 852 + 1)
+#define MACRO_853(x) ((x) * 853 + 1)
+#define MACRO_854(x) ((x) * 854 + 1)
+#define MACRO_855(x) ((x) * 855 + 1)
+#define MACRO_856(x) ((x) * 856 + 1)
+#define MACRO_857(x) ((x) * 857 + 1)
+#define MACRO_858(x) ((x) * 858 + 1)
+#define MACRO_859(x) ((x) * 859 + 1)
+#define MACRO_860(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 860); })
+#define MACRO_861(x) ((x) * 861 + 1)
+#define MACRO_862(x) ((x) * 862 + 1)
+#define MACRO_863(x) ((x) * 863 + 1)
+#define MACRO_864(x) ((x) * 864 + 1)
+#define MACRO_865(x) ((x) * 865 + 1)
+#define MACRO_866(x) ((x) * 866 + 1)
+#define MACRO_867(x) ((x) * 867 + 1)
+#define MACRO_868(x) ((x) * 868 + 1)
+#define MACRO_869(x) ((x) * 869 + 1)
+#define MACRO_870(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 870); })
+#define MACRO_871(x) ((x) * 871 + 1)
+#define MACRO_872(x) ((x) * 872 + 1)
+#define MACRO_873(x) ((x) * 873 + 1)
+#define MACRO_874(x) ((x) * 874 + 1)
+#define MACRO_875(x) ((x) * 875 + 1)
+#define MACRO_876(x) ((x) * 876 + 1)
+#define MACRO_877(x) ((x) * 877 + 1)
+#define MACRO_878(x) ((x) * 878 + 1)
+#define MACRO_879(x) ((x) * 879 + 1)
+#define MACRO_880(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 880); })
+#define MACRO_881(x) ((x) * 881 + 1)
+#define MACRO_882(x) ((x) * 882 + 1)
+#define MACRO_883(x) ((x) * 883 + 1)
+#define MACRO_884(x) ((x) * 884 + 1)
+#define MACRO_885(x) ((x) * 885 + 1)
+#define MACRO_886(x) ((x) * 886 + 1)
+#define MACRO_887(x) ((x) * 887 + 1)
+#define MACRO_888(x) ((x) * 888 + 1)
+#define MACRO_889(x) ((x) * 889 + 1)
+#define MACRO_890(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 890); })
+#define MACRO_891(x) ((x) * 891 + 1)
+#define MACRO_892(x) ((x) * 892 + 1)
+#define MACRO_893(x) ((x) * 893 + 1)
+#define MACRO_894(x) ((x) * 894 + 1)
+#define MACRO_895(x) ((x) * 895 + 1)
+#define MACRO_896(x) ((x) * 896 + 1)
+#define MACRO_897(x) ((x) * 897 + 1)
+#define MACRO_898(x) ((x) * 898 + 1)
+#define MACRO_899(x) ((x) * 899 + 1)
+#define MACRO_900(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 900); })
+#define MACRO_901(x) ((x) * 901 + 1)
+#define MACRO_902(x) ((x) * 902 + 1)
+#define MACRO_903(x) ((x) * 903 + 1)
+#define MACRO_904(x) ((x) * 904 + 1)
+#define MACRO_905(x) ((x) * 905 + 1)
+#define MACRO_906(x) ((x) * 906 + 1)
+#define MACRO_907(x) ((x) * 907 + 1)
+#define MACRO_908(x) ((x) * 908 + 1)
+#define MACRO_909(x) ((x) * 909 + 1)
+#define MACRO_910(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 910); })
+#define MACRO_911(x) ((x) * 911 + 1)
+#define MACRO_912(x) ((x) * 912 + 1)
+#define MACRO_913(x) ((x) * 913 + 1)
+#define MACRO_914(x) ((x) * 914 + 1)
+#define MACRO_915(x) ((x) * 915 + 1)
+#define MACRO_916(x) ((x) * 916 + 1)
+#define MACRO_917(x) ((x) * 917 + 1)
+#define MACRO_918(x) ((x) * 918 + 1)
+#define MACRO_919(x) ((x) * 919 + 1)
+#define MACRO_920(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 920); })
+#define MACRO_921(x) ((x) * 921 + 1)
+#define MACRO_922(x) ((x) * 922 + 1)
+#define MACRO_923(x) ((x) * 923 + 1)
+#define MACRO_924(x) ((x) * 924 + 1)
+#define MACRO_925(x) ((x) * 925 + 1)
+#define MACRO_926(x) ((x) * 926 + 1)
+#define MACRO_927(x) ((x) * 927 + 1)
+#define MACRO_928(x) ((x) * 928 + 1)
+#define MACRO_929(x) ((x) * 929 + 1)
+#define MACRO_930(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 930); })
+#define MACRO_931(x) ((x) * 931 + 1)
+#define MACRO_932(x) ((x) * 932 + 1)
+#define MACRO_933(x) ((x) * 933 + 1)
+#define MACRO_934(x) ((x) * 934 + 1)
+#define MACRO_935(x) ((x) * 935 + 1)
+#define MACRO_936(x) ((x) * 936 + 1)
+#define MACRO_937(x) ((x) * 937 + 1)
+#define MACRO_938(x) ((x) * 938 + 1)
+#define MACRO_939(x) ((x) * 939 + 1)
+#define MACRO_940(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 940); })
+#define MACRO_941(x) ((x) * 941 + 1)
+#define MACRO_942(x) ((x) * 942 + 1)
+#define MACRO_943(x) ((x) * 943 + 1)
+#define MACRO_944(x) ((x) * 944 + 1)
+#define MACRO_945(x) ((x) * 945 + 1)
+#define MACRO_946(x) ((x) * 946 + 1)
+#define MACRO_947(x) ((x) * 947 + 1)
+#define MACRO_948(x) ((x) * 948 + 1)
+#define MACRO_949(x) ((x) * 949 + 1)
+#define MACRO_950(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 950); })
+#define MACRO_951(x) ((x) * 951 + 1)
+#define MACRO_952(x) ((x) * 952 + 1)
+#define MACRO_953(x) ((x) * 953 + 1)
+#define MACRO_954(x) ((x) * 954 + 1)
+#define MACRO_955(x) ((x) * 955 + 1)
+#define MACRO_956(x) ((x) * 956 + 1)
+#define MACRO_957(x) ((x) * 957 + 1)
+#define MACRO_958(x) ((x) * 958 + 1)
+#define MACRO_959(x) ((x) * 959 + 1)
+#define MACRO_960(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 960); })
+#define MACRO_961(x) ((x) * 961 + 1)
+#define MACRO_962(x) ((x) * 962 + 1)
+#define MACRO_963(x) ((x) * 963 + 1)
+#define MACRO_964(x) ((x) * 964 + 1)
+#define MACRO_965(x) ((x) * 965 + 1)
+#define MACRO_966(x) ((x) * 966 + 1)
+#define MACRO_967(x) ((x) * 967 + 1)
+#define MACRO_968(x) ((x) * 968 + 1)
+#define MACRO_969(x) ((x) * 969 + 1)
+#define MACRO_970(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 970); })
+#define MACRO_971(x) ((x) * 971 + 1)
+#define MACRO_972(x) ((x) * 972 + 1)
+#define MACRO_973(x) ((x) * 973 + 1)
+#define MACRO_974(x) ((x) * 974 + 1)
+#define MACRO_975(x) ((x) * 975 + 1)
+#define MACRO_976(x) ((x) * 976 + 1)
+#define MACRO_977(x) ((x) * 977 + 1)
+#define MACRO_978(x) ((x) * 978 + 1)
+#define MACRO_979(x) ((x) * 979 + 1)
+#define MACRO_980(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 980); })
+#define MACRO_981(x) ((x) * 981 + 1)
+#define MACRO_982(x) ((x) * 982 + 1)
+#define MACRO_983(x) ((x) * 983 + 1)
+#define MACRO_984(x) ((x) * 984 + 1)
+#define MACRO_985(x) ((x) * 985 + 1)
+#define MACRO_986(x) ((x) * 986 + 1)
+#define MACRO_987(x) ((x) * 987 + 1)
+#define MACRO_988(x) ((x) * 988 + 1)
+#define MACRO_989(x) ((x) * 989 + 1)
+#define MACRO_990(x) _Comptime({ _ComptimeCtx.Inline.appendf("%d", (x) + 990); })
+#define MACRO_991(x) ((x) * 991 + 1)
+#define MACRO_992(x) ((x) * 992 + 1)
+#define MACRO_993(x) ((x) * 993 + 1)
+#define MACRO_994(x) ((x) * 994 + 1)
+#define MACRO_995(x) ((x) * 995 + 1)
+#define MACRO_996(x) ((x) * 996 + 1)
+#define MACRO_997(x) ((x) * 997 + 1)
+#define MACRO_998(x) ((x) * 998 + 1)
+#define MACRO_999(x) ((x) * 999 + 1)
+
+int main(void) {
+  long sum = 0;
+  sum += MACRO_0(0);
+  sum += MACRO_1(1);
+  sum += MACRO_2(2);
+  sum += MACRO_3(3);
+  sum += MACRO_4(4);
+  sum += MACRO_5(5);
+  sum += MACRO_6(6);
+  sum += MACRO_7(7);
+  sum += MACRO_8(8);
+  sum += MACRO_9(9);
+  sum += MACRO_10(10);
+  sum += MACRO_11(11);
+  sum += MACRO_12(12);
+  sum += MACRO_13(13);
+  sum += MACRO_14(14);
+  sum += MACRO_15(15);
+  sum += MACRO_16(16);
+  sum += MACRO_17(17);
+  sum += MACRO_18(18);
+  sum += MACRO_19(19);
+  sum += MACRO_20(20);
+  sum += MACRO_21(21);
+  sum += MACRO_22(22);
+  sum += MACRO_23(23);
+  sum += MACRO_24(24);
+  sum += MACRO_25(25);
+  sum += MACRO_26(26);
+  sum += MACRO_27(27);
+  sum += MACRO_28(28);
+  sum += MACRO_29(29);
+  sum += MACRO_30(30);
+  sum += MACRO_31(31);
+  sum += MACRO_32(32);
+  sum += MACRO_33(33);
+  sum += MACRO_34(34);
+  sum += MACRO_35(35);
+  sum += MACRO_36(36);
+  sum += MACRO_37(37);
+  sum += MACRO_38(38);
+  sum += MACRO_39(39);
+  sum += MACRO_40(40);
+  sum += MACRO_41(41);
+  sum += MACRO_42(42);
+  sum += MACRO_43(43);
+  sum += MACRO_44(44);
+  sum += MACRO_45(45);
+  sum += MACRO_46(46);
+  sum += MACRO_47(47);
+  sum += MACRO_48(48);
+  sum += MACRO_49(49);
+  sum += MACRO_50(50);
+  sum += MACRO_51(51);
+  sum += MACRO_52(52);
+  sum += MACRO_53(53);
+  sum += MACRO_54(54);
+  sum += MACRO_55(55);
+  sum += MACRO_56(56);
+  sum += MACRO_57(57);
+  sum += MACRO_58(58);
+  sum += MACRO_59(59);
+  sum += MACRO_60(60);
+  sum += MACRO_61(61);
+  sum += MACRO_62(62);
+  sum += MACRO_63(63);
+  sum += MACRO_64(64);
+  sum += MACRO_65(65);
+  sum += MACRO_66(66);
+  sum += MACRO_67(67);
+  sum += MACRO_68(68);
+  sum += MACRO_69(69);
+  sum += MACRO_70(70);
+  sum += MACRO_71(71);
+  sum += MACRO_72(72);
+  sum += MACRO_73(73);
+  sum += MACRO_74(74);
+  sum += MACRO_75(75);
+  sum += MACRO_76(76);
+  sum += MACRO_77(77);
+  sum += MACRO_78(78);
+  sum += MACRO_79(79);
+  sum += MACRO_80(80);
+  sum += MACRO_81(81);
+  sum += MACRO_82(82);
+  sum += MACRO_83(83);
+  sum += MACRO_84(84);
+  sum += MACRO_85(85);
+  sum += MACRO_86(86);
+  sum += MACRO_87(87);
+  sum += MACRO_88(88);
+  sum += MACRO_89(89);
+  sum += MACRO_90(90);
+  sum += MACRO_91(91);
+  sum += MACRO_92(92);
+  sum += MACRO_93(93);
+  sum += MACRO_94(94);
+  sum += MACRO_95(95);
+  sum += MACRO_96(96);
+  sum += MACRO_97(97);
+  sum += MACRO_98(98);
+  sum += MACRO_99(99);
+  sum += MACRO_100(100);
+  sum += MACRO_101(101);
+  sum += MACRO_102(102);
+  sum += MACRO_103(103);
+  sum += MACRO_104(104);
+  sum += MACRO_105(105);
+  sum += MACRO_106(106);
+  sum += MACRO_107(107);
+  sum += MACRO_108(108);
+  sum += MACRO_109(109);
+  sum += MACRO_110(110);
+  sum += MACRO_111(111);
+  sum += MACRO_112(112);
+  sum += MACRO_113(113);
+  sum += MACRO_114(114);
+  sum += MACRO_115(115);
+  sum += MACRO_116(116);
+  sum += MACRO_117(117);
+  sum += MACRO_118(118);
+  sum += MACRO_119(119);
+  sum += MACRO_120(120);
+  sum += MACRO_121(121);
+  sum += MACRO_122(122);
+  sum += MACRO_123(123);
+  sum += MACRO_124(124);
+  sum += MACRO_125(125);
+  sum += MACRO_126(126);
+  sum += MACRO_127(127);
+  sum += MACRO_128(128);
+  sum += MACRO_129(129);
+  sum += MACRO_130(130);
+  sum += MACRO_131(131);
+  sum += MACRO_132(132);
+  sum += MACRO_133(133);
+  sum += MACRO_134(134);
+  sum += MACRO_135(135);
+  sum += MACRO_136(136);
+  sum += MACRO_137(137);
+  sum += MACRO_138(138);
+  sum += MACRO_139(139);
+  sum += MACRO_140(140);
+  sum += MACRO_141(141);
+  sum += MACRO_142(142);
+  sum += MACRO_143(143);
+  sum += MACRO_144(144);
+  sum += MACRO_145(145);
+  sum += MACRO_146(146);
+  sum += MACRO_147(147);
+  sum += MACRO_148(148);
+  sum += MACRO_149(149);
+  sum += MACRO_150(150);
+  sum += MACRO_151(151);
+  sum += MACRO_152(152);
+  sum += MACRO_153(153);
+  sum += MACRO_154(154);
+  sum += MACRO_155(155);
+  sum += MACRO_156(156);
+  sum += MACRO_157(157);
+  sum += MACRO_158(158);
+  sum += MACRO_159(159);
+  sum += MACRO_160(160);
+  sum += MACRO_161(161);
+  sum += MACRO_162(162);
+  sum += MACRO_163(163);
+  sum += MACRO_164(164);
+  sum += MACRO_165(165);
+  sum += MACRO_166(166);
+  sum += MACRO_167(167);
+  sum += MACRO_168(168);
+  sum += MACRO_169(169);
+  sum += MACRO_170(170);
+  sum += MACRO_171(171);
+  sum += MACRO_172(172);
+  sum += MACRO_173(173);
+  sum += MACRO_174(174);
+  sum += MACRO_175(175);
+  sum += MACRO_176(176);
+  sum += MACRO_177(177);
+  sum += MACRO_178(178);
+  sum += MACRO_179(179);
+  sum += MACRO_180(180);
+  sum += MACRO_181(181);
+  sum += MACRO_182(182);
+  sum += MACRO_183(183);
+  sum += MACRO_184(184);
+  sum += MACRO_185(185);
+  sum += MACRO_186(186);
+  sum += MACRO_187(187);
+  sum += MACRO_188(188);
+  sum += MACRO_189(189);
+  sum += MACRO_190(190);
+  sum += MACRO_191(191);
+  sum += MACRO_192(192);
+  sum += MACRO_193(193);
+  sum += MACRO_194(194);
+  sum += MACRO_195(195);
+  sum += MACRO_196(196);
+  sum += MACRO_197(197);
+  sum += MACRO_198(198);
+  sum += MACRO_199(199);
+  sum += MACRO_200(200);
+  sum += MACRO_201(201);
+  sum += MACRO_202(202);
+  sum += MACRO_203(203);
+  sum += MACRO_204(204);
+  sum += MACRO_205(205);
+  sum += MACRO_206(206);
+  sum += MACRO_207(207);
+  sum += MACRO_208(208);
+  sum += MACRO_209(209);
+  sum += MACRO_210(210);
+  sum += MACRO_211(211);
+  sum += MACRO_212(212);
+  sum += MACRO_213(213);
+  sum += MACRO_214(214);
+  sum += MACRO_215(215);
+  sum += MACRO_216(216);
+  sum += MACRO_217(217);
+  sum += MACRO_218(218);
+  sum += MACRO_219(219);
+  sum += MACRO_220(220);
+  sum += MACRO_221(221);
+  sum += MACRO_222(222);
+  sum += MACRO_223(223);
+  sum += MACRO_224(224);
+  sum += MACRO_225(225);
+  sum += MACRO_226(226);
+  sum += MACRO_227(227);
+  sum += MACRO_228(228);
+  sum += MACRO_229(229);
+  sum += MACRO_230(230);
+  sum += MACRO_231(231);
+  sum += MACRO_232(232);
+  sum += MACRO_233(233);
+  sum += MACRO_234(234);
+  sum += MACRO_235(235);
+  sum += MACRO_236(236);
+  sum += MACRO_237(237);
+  sum += MACRO_238(238);
+  sum += MACRO_239(239);
+  sum += MACRO_240(240);
+  sum += MACRO_241(241);
+  sum += MACRO_242(242);
+  sum += MACRO_243(243);
+  sum += MACRO_244(244);
+  sum += MACRO_245(245);
+  sum += MACRO_246(246);
+  sum += MACRO_247(247);
+  sum += MACRO_248(248);
+  sum += MACRO_249(249);
+  sum += MACRO_250(250);
+  sum += MACRO_251(251);
+  sum += MACRO_252(252);
+  sum += MACRO_253(253);
+  sum += MACRO_254(254);
+  sum += MACRO_255(255);
+  sum += MACRO_256(256);
+  sum += MACRO_257(257);
+  sum += MACRO_258(258);
+  sum += MACRO_259(259);
+  sum += MACRO_260(260);
+  sum += MACRO_261(261);
+  sum += MACRO_262(262);
+  sum += MACRO_263(263);
+  sum += MACRO_264(264);
+  sum += MACRO_265(265);
+  sum += MACRO_266(266);
+  sum += MACRO_267(267);
+  sum += MACRO_268(268);
+  sum += MACRO_269(269);
+  sum += MACRO_270(270);
+  sum += MACRO_271(271);
+  sum += MACRO_272(272);
+  sum += MACRO_273(273);
+  sum += MACRO_274(274);
+  sum += MACRO_275(275);
+  sum += MACRO_276(276);
+  sum += MACRO_277(277);
+  sum += MACRO_278(278);
+  sum += MACRO_279(279);
+  sum += MACRO_280(280);
+  sum += MACRO_281(281);
+  sum += MACRO_282(282);
+  sum += MACRO_283(283);
+  sum += MACRO_284(284);
+  sum += MACRO_285(285);
+  sum += MACRO_286(286);
+  sum += MACRO_287(287);
+  sum += MACRO_288(288);
+  sum += MACRO_289(289);
+  sum += MACRO_290(290);
+  sum += MACRO_291(291);
+  sum += MACRO_292(292);
+  sum += MACRO_293(293);
+  sum += MACRO_294(294);
+  sum += MACRO_295(295);
+  sum += MACRO_296(296);
+  sum += MACRO_297(297);
+  sum += MACRO_298(298);
+  sum += MACRO_299(299);
+  sum += MACRO_300(300);
+  sum += MACRO_301(301);
+  sum += MACRO_302(302);
+  sum += MACRO_303(303);
+  sum += MACRO_304(304);
+  sum += MACRO_305(305);
+  sum += MACRO_306(306);
+  sum += MACRO_307(307);
+  sum += MACRO_308(308);
+  sum += MACRO_309(309);
+  sum += MACRO_310(310);
+  sum += MACRO_311(311);
+  sum += MACRO_312(312);
+  sum += MACRO_313(313);
+  sum += MACRO_314(314);
+  sum += MACRO_315(315);
+  sum += MACRO_316(316);
+  sum += MACRO_317(317);
+  sum += MACRO_318(318);
+  sum += MACRO_319(319);
+  sum += MACRO_320(320);
+  sum += MACRO_321(321);
+  sum += MACRO_322(322);
+  sum += MACRO_323(323);
+  sum += MACRO_324(324);
+  sum += MACRO_325(325);
+  sum += MACRO_326(326);
+  sum += MACRO_327(327);
+  sum += MACRO_328(328);
+  sum += MACRO_329(329);
+  sum += MACRO_330(330);
+  sum += MACRO_331(331);
+  sum += MACRO_332(332);
+  sum += MACRO_333(333);
+  sum += MACRO_334(334);
+  sum += MACRO_335(335);
+  sum += MACRO_336(336);
+  sum += MACRO_337(337);
+  sum += MACRO_338(338);
+  sum += MACRO_339(339);
+  sum += MACRO_340(340);
+  sum += MACRO_341(341);
+  sum += MACRO_342(342);
+  sum += MACRO_343(343);
+  sum += MACRO_344(344);
+  sum += MACRO_345(345);
+  sum += MACRO_346(346);
+  sum += MACRO_347(347);
+  sum += MACRO_348(348);
+  sum += MACRO_349(349);
+  sum += MACRO_350(350);
+  sum += MACRO_351(351);
+  sum += MACRO_352(352);
+  sum += MACRO_353(353);
+  sum += MACRO_354(354);
+  sum += MACRO_355(355);
+  sum += MACRO_356(356);
+  sum += MACRO_357(357);
+  sum += MACRO_358(358);
+  sum += MACRO_359(359);
+  sum += MACRO_360(360);
+  sum += MACRO_361(361);
+  sum += MACRO_362(362);
+  sum += MACRO_363(363);
+  sum += MACRO_364(364);
+  sum += MACRO_365(365);
+  sum += MACRO_366(366);
+  sum += MACRO_367(367);
+  sum += MACRO_368(368);
+  sum += MACRO_369(369);
+  sum += MACRO_370(370);
+  sum += MACRO_371(371);
+  sum += MACRO_372(372);
+  sum += MACRO_373(373);
+  sum += MACRO_374(374);
+  sum += MACRO_375(375);
+  sum += MACRO_376(376);
+  sum += MACRO_377(377);
+  sum += MACRO_378(378);
+  sum += MACRO_379(379);
+  sum += MACRO_380(380);
+  sum += MACRO_381(381);
+  sum += MACRO_382(382);
+  sum += MACRO_383(383);
+  sum += MACRO_384(384);
+  sum += MACRO_385(385);
+  sum += MACRO_386(386);
+  sum += MACRO_387(387);
+  sum += MACRO_388(388);
+  sum += MACRO_389(389);
+  sum += MACRO_390(390);
+  sum += MACRO_391(391);
+  sum += MACRO_392(392);
+  sum += MACRO_393(393);
+  sum += MACRO_394(394);
+  sum += MACRO_395(395);
+  sum += MACRO_396(396);
+  sum += MACRO_397(397);
+  sum += MACRO_398(398);
+  sum += MACRO_399(399);
+  sum += MACRO_400(400);
+  sum += MACRO_401(401);
+  sum += MACRO_402(402);
+  sum += MACRO_403(403);
+  sum += MACRO_404(404);
+  sum += MACRO_405(405);
+  sum += MACRO_406(406);
+  sum += MACRO_407(407);
+  sum += MACRO_408(408);
+  sum += MACRO_409(409);
+  sum += MACRO_410(410);
+  sum += MACRO_411(411);
+  sum += MACRO_412(412);
+  sum += MACRO_413(413);
+  sum += MACRO_414(414);
+  sum += MACRO_415(415);
+  sum += MACRO_416(416);
+  sum += MACRO_417(417);
+  sum += MACRO_418(418);
+  sum += MACRO_419(419);
+  sum += MACRO_420(420);
+  sum += MACRO_421(421);
+  sum += MACRO_422(422);
+  sum += MACRO_423(423);
+  sum += MACRO_424(424);
+  sum += MACRO_425(425);
+  sum += MACRO_426(426);
+  sum += MACRO_427(427);
+  sum += MACRO_428(428);
+  sum += MACRO_429(429);
+  sum += MACRO_430(430);
+  sum += MACRO_431(431);
+  sum += MACRO_432(432);
+  sum += MACRO_433(433);
+  sum += MACRO_434(434);
+  sum += MACRO_435(435);
+  sum += MACRO_436(436);
+  sum += MACRO_437(437);
+  sum += MACRO_438(438);
+  sum += MACRO_439(439);
+  sum += MACRO_440(440);
+  sum += MACRO_441(441);
+  sum += MACRO_442(442);
+  sum += MACRO_443(443);
+  sum += MACRO_444(444);
+  sum += MACRO_445(445);
+  sum += MACRO_446(446);
+  sum += MACRO_447(447);
+  sum += MACRO_448(448);
+  sum += MACRO_449(449);
+  sum += MACRO_450(450);
+  sum += MACRO_451(451);
+  sum += MACRO_452(452);
+  sum += MACRO_453(453);
+  sum += MACRO_454(454);
+  sum += MACRO_455(455);
+  sum += MACRO_456(456);
+  sum += MACRO_457(457);
+  sum += MACRO_458(458);
+  sum += MACRO_459(459);
+  sum += MACRO_460(460);
+  sum += MACRO_461(461);
+  sum += MACRO_462(462);
+  sum += MACRO_463(463);
+  sum += MACRO_464(464);
+  sum += MACRO_465(465);
+  sum += MACRO_466(466);
+  sum += MACRO_467(467);
+  sum += MACRO_468(468);
+  sum += MACRO_469(469);
+  sum += MACRO_470(470);
+  sum += MACRO_471(471);
+  sum += MACRO_472(472);
+  sum += MACRO_473(473);
+  sum += MACRO_474(474);
+  sum += MACRO_475(475);
+  sum += MACRO_476(476);
+  sum += MACRO_477(477);
+  sum += MACRO_478(478);
+  sum += MACRO_479(479);
+  sum += MACRO_480(480);
+  sum += MACRO_481(481);
+  sum += MACRO_482(482);
+  sum += MACRO_483(483);
+  sum += MACRO_484(484);
+  sum += MACRO_485(485);
+  sum += MACRO_486(486);
+  sum += MACRO_487(487);
+  sum += MACRO_488(488);
+  sum += MACRO_489(489);
+  sum += MACRO_490(490);
+  sum += MACRO_491(491);
+  sum += MACRO_492(492);
+  sum += MACRO_493(493);
+  sum += MACRO_494(494);
+  sum += MACRO_495(495);
+  sum += MACRO_496(496);
+  sum += MACRO_497(497);
+  sum += MACRO_498(498);
+  sum += MACRO_499(499);
+  sum += MACRO_500(500);
+  sum += MACRO_501(501);
+  sum += MACRO_502(502);
+  sum += MACRO_503(503);
+  sum += MACRO_504(504);
+  sum += MACRO_505(505);
+  sum += MACRO_506(506);
+  sum += MACRO_507(507);
+  sum += MACRO_508(508);
+  sum += MACRO_509(509);
+  sum += MACRO_510(510);
+  sum += MACRO_511(511);
+  sum += MACRO_512(512);
+  sum += MACRO_513(513);
+  sum += MACRO_514(514);
+  sum += MACRO_515(515);
+  sum += MACRO_516(516);
+  sum += MACRO_517(517);
+  sum += MACRO_518(518);
+  sum += MACRO_519(519);
+  sum += MACRO_520(520);
+  sum += MACRO_521(521);
+  sum += MACRO_522(522);
+  sum += MACRO_523(523);
+  sum += MACRO_524(524);
+  sum += MACRO_525(525);
+  sum += MACRO_526(526);
+  sum += MACRO_527(527);
+  sum += MACRO_528(528);
+  sum += MACRO_529(529);
+  sum += MACRO_530(530);
+  sum += MACRO_531(531);
+  sum += MACRO_532(532);
+  sum += MACRO_533(533);
+  sum += MACRO_534(534);
+  sum += MACRO_535(535);
+  sum += MACRO_536(536);
+  sum += MACRO_537(537);
+  sum += MACRO_538(538);
+  sum += MACRO_539(539);
+  sum += MACRO_540(540);
+  sum += MACRO_541(541);
+  sum += MACRO_542(542);
+  sum += MACRO_543(543);
+  sum += MACRO_544(544);
+  sum += MACRO_545(545);
+  sum += MACRO_546(546);
+  sum += MACRO_547(547);
+  sum += MACRO_548(548);
+  sum += MACRO_549(549);
+  sum += MACRO_550(550);
+  sum += MACRO_551(551);
+  sum += MACRO_552(552);
+  sum += MACRO_553(553);
+  sum += MACRO_554(554);
+  sum += MACRO_555(555);
+  sum += MACRO_556(556);
+  sum += MACRO_557(557);
+  sum += MACRO_558(558);
+  sum += MACRO_559(559);
+  sum += MACRO_560(560);
+  sum += MACRO_561(561);
+  sum += MACRO_562(562);
+  sum += MACRO_563(563);
+  sum += MACRO_564(564);
+  sum += MACRO_565(565);
+  sum += MACRO_566(566);
+  sum += MACRO_567(567);
+  sum += MACRO_568(568);
+  sum += MACRO_569(569);
+  sum += MACRO_570(570);
+  sum += MACRO_571(571);
+  sum += MACRO_572(572);
+  sum += MACRO_573(573);
+  sum += MACRO_574(574);
+  sum += MACRO_575(575);
+  sum += MACRO_576(576);
+  sum += MACRO_577(577);
+  sum += MACRO_578(578);
+  sum += MACRO_579(579);
+  sum += MACRO_580(580);
+  sum += MACRO_581(581);
+  sum += MACRO_582(582);
+  sum += MACRO_583(583);
+  sum += MACRO_584(584);
+  sum += MACRO_585(585);
+  sum += MACRO_586(586);
+  sum += MACRO_587(587);
+  sum += MACRO_588(588);
+  sum += MACRO_589(589);
+  sum += MACRO_590(590);
+  sum += MACRO_591(591);
+  sum += MACRO_592(592);
+  sum += MACRO_593(593);
+  sum += MACRO_594(594);
+  sum += MACRO_595(595);
+  sum += MACRO_596(596);
+  sum += MACRO_597(597);
+  sum += MACRO_598(598);
+  sum += MACRO_599(599);
+  sum += MACRO_600(600);
+  sum += MACRO_601(601);
+  sum += MACRO_602(602);
+  sum += MACRO_603(603);
+  sum += MACRO_604(604);
+  sum += MACRO_605(605);
+  sum += MACRO_606(606);
+  sum += MACRO_607(607);
+  sum += MACRO_608(608);
+  sum += MACRO_609(609);
+  sum += MACRO_610(610);
+  sum += MACRO_611(611);
+  sum += MACRO_612(612);
+  sum += MACRO_613(613);
+  sum += MACRO_614(614);
+  sum += MACRO_615(615);
+  sum += MACRO_616(616);
+  sum += MACRO_617(617);
+  sum += MACRO_618(618);
+  sum += MACRO_619(619);
+  sum += MACRO_620(620);
+  sum += MACRO_621(621);
+  sum += MACRO_622(622);
+  sum += MACRO_623(623);
+  sum += MACRO_624(624);
+  sum += MACRO_625(625);
+  sum += MACRO_626(626);
+  sum += MACRO_627(627);
+  sum += MACRO_628(628);
+  sum += MACRO_629(629);
+  sum += MACRO_630(630);
+  sum += MACRO_631(631);
+  sum += MACRO_632(632);
+  sum += MACRO_633(633);
+  sum += MACRO_634(634);
+  sum += MACRO_635(635);
+  sum += MACRO_636(636);
+  sum += MACRO_637(637);
+  sum += MACRO_638(638);
+  sum += MACRO_639(639);
+  sum += MACRO_640(640);
+  sum += MACRO_641(641);
+  sum += MACRO_642(642);
+  sum += MACRO_643(643);
+  sum += MACRO_644(644);
+  sum += MACRO_645(645);
+  sum += MACRO_646(646);
+  sum += MACRO_647(647);
+  sum += MACRO_648(648);
+  sum += MACRO_649(649);
+  sum += MACRO_650(650);
+  sum += MACRO_651(651);
+  sum += MACRO_652(652);
+  sum += MACRO_653(653);
+  sum += MACRO_654(654);
+  sum += MACRO_655(655);
+  sum += MACRO_656(656);
+  sum += MACRO_657(657);
+  sum += MACRO_658(658);
+  sum += MACRO_659(659);
+  sum += MACRO_660(660);
+  sum += MACRO_661(661);
+  sum += MACRO_662(662);
+  sum += MACRO_663(663);
+  sum += MACRO_664(664);
+  sum += MACRO_665(665);
+  sum += MACRO_666(666);
+  sum += MACRO_667(667);
+  sum += MACRO_668(668);
+  sum += MACRO_669(669);
+  sum += MACRO_670(670);
+  sum += MACRO_671(671);
+  sum += MACRO_672(672);
+  sum += MACRO_673(673);
+  sum += MACRO_674(674);
+  sum += MACRO_675(675);
+  sum += MACRO_676(676);
+  sum += MACRO_677(677);
+  sum += MACRO_678(678);
+  sum += MACRO_679(679);
+  sum += MACRO_680(680);
+  sum += MACRO_681(681);
+  sum += MACRO_682(682);
+  sum += MACRO_683(683);
+  sum += MACRO_684(684);
+  sum += MACRO_685(685);
+  sum += MACRO_686(686);
+  sum += MACRO_687(687);
+  sum += MACRO_688(688);
+  sum += MACRO_689(689);
+  sum += MACRO_690(690);
+  sum += MACRO_691(691);
+  sum += MACRO_692(692);
+  sum += MACRO_693(693);
+  sum += MACRO_694(694);
+  sum += MACRO_695(695);
+  sum += MACRO_696(696);
+  sum += MACRO_697(697);
+  sum += MACRO_698(698);
+  sum += MACRO_699(699);
+  sum += MACRO_700(700);
+  sum += MACRO_701(701);
+  sum += MACRO_702(702);
+  sum += MACRO_703(703);
+  sum += MACRO_704(704);
+  sum += MACRO_705(705);
+  sum += MACRO_706(706);
+  sum += MACRO_707(707);
+  sum += MACRO_708(708);
+  sum += MACRO_709(709);
+  sum += MACRO_710(710);
+  sum += MACRO_711(711);
+  sum += MACRO_712(712);
+  sum += MACRO_713(713);
+  sum += MACRO_714(714);
+  sum += MACRO_715(715);
+  sum += MACRO_716(716);
+  sum += MACRO_717(717);
+  sum += MACRO_718(718);
+  sum += MACRO_719(719);
+  sum += MACRO_720(720);
+  sum += MACRO_721(721);
+  sum += MACRO_722(722);
+  sum += MACRO_723(723);
+  sum += MACRO_724(724);
+  sum += MACRO_725(725);
+  sum += MACRO_726(726);
+  sum += MACRO_727(727);
+  sum += MACRO_728(728);
+  sum += MACRO_729(729);
+  sum += MACRO_730(730);
+  sum += MACRO_731(731);
+  sum += MACRO_732(732);
+  sum += MACRO_733(733);
+  sum += MACRO_734(734);
+  sum += MACRO_735(735);
+  sum += MACRO_736(736);
+  sum += MACRO_737(737);
+  sum += MACRO_738(738);
+  sum += MACRO_739(739);
+  sum += MACRO_740(740);
+  sum += MACRO_741(741);
+  sum += MACRO_742(742);
+  sum += MACRO_743(743);
+  sum += MACRO_744(744);
+  sum += MACRO_745(745);
+  sum += MACRO_746(746);
+  sum += MACRO_747(747);
+  sum += MACRO_748(748);
+  sum += MACRO_749(749);
+  sum += MACRO_750(750);
+  sum += MACRO_751(751);
+  sum += MACRO_752(752);
+  sum += MACRO_753(753);
+  sum += MACRO_754(754);
+  sum += MACRO_755(755);
+  sum += MACRO_756(756);
+  sum += MACRO_757(757);
+  sum += MACRO_758(758);
+  sum += MACRO_759(759);
+  sum += MACRO_760(760);
+  sum += MACRO_761(761);
+  sum += MACRO_762(762);
+  sum += MACRO_763(763);
+  sum += MACRO_764(764);
+  sum += MACRO_765(765);
+  sum += MACRO_766(766);
+  sum += MACRO_767(767);
+  sum += MACRO_768(768);
+  sum += MACRO_769(769);
+  sum += MACRO_770(770);
+  sum += MACRO_771(771);
+  sum += MACRO_772(772);
+  sum += MACRO_773(773);
+  sum += MACRO_774(774);
+  sum += MACRO_775(775);
+  sum += MACRO_776(776);
+  sum += MACRO_777(777);
+  sum += MACRO_778(778);
+  sum += MACRO_779(779);
+  sum += MACRO_780(780);
+  sum += MACRO_781(781);
+  sum += MACRO_782(782);
+  sum += MACRO_783(783);
+  sum += MACRO_784(784);
+  sum += MACRO_785(785);
+  sum += MACRO_786(786);
+  sum += MACRO_787(787);
+  sum += MACRO_788(788);
+  sum += MACRO_789(789);
+  sum += MACRO_790(790);
+  sum += MACRO_791(791);
+  sum += MACRO_792(792);
+  sum += MACRO_793(793);
+  sum += MACRO_794(794);
+  sum += MACRO_795(795);
+  sum += MACRO_796(796);
+  sum += MACRO_797(797);
+  sum += MACRO_798(798);
+  sum += MACRO_799(799);
+  sum += MACRO_800(800);
+  sum += MACRO_801(801);
+  sum += MACRO_802(802);
+  sum += MACRO_803(803);
+  sum += MACRO_804(804);
+  sum += MACRO_805(805);
+  sum += MACRO_806(806);
+  sum += MACRO_807(807);
+  sum += MACRO_808(808);
+  sum += MACRO_809(809);
+  sum += MACRO_810(810);
+  sum += MACRO_811(811);
+  sum += MACRO_812(812);
+  sum += MACRO_813(813);
+  sum += MACRO_814(814);
+  sum += MACRO_815(815);
+  sum += MACRO_816(816);
+  sum += MACRO_817(817);
+  sum += MACRO_818(818);
+  sum += MACRO_819(819);
+  sum += MACRO_820(820);
+  sum += MACRO_821(821);
+  sum += MACRO_822(822);
+  sum += MACRO_823(823);
+  sum += MACRO_824(824);
+  sum += MACRO_825(825);
+  sum += MACRO_826(826);
+  sum += MACRO_827(827);
+  sum += MACRO_828(828);
+  sum += MACRO_829(829);
+  sum += MACRO_830(830);
+  sum += MACRO_831(831);
+  sum += MACRO_832(832);
+  sum += MACRO_833(833);
+  sum += MACRO_834(834);
+  sum += MACRO_835(835);
+  sum += MACRO_836(836);
+  sum += MACRO_837(837);
+  sum += MACRO_838(838);
+  sum += MACRO_839(839);
+  sum += MACRO_840(840);
+  sum += MACRO_841(841);
+  sum += MACRO_842(842);
+  sum += MACRO_843(843);
+  sum += MACRO_844(844);
+  sum += MACRO_845(845);
+  sum += MACRO_846(846);
+  sum += MACRO_847(847);
+  sum += MACRO_848(848);
+  sum += MACRO_849(849);
+  sum += MACRO_850(850);
+  sum += MACRO_851(851);
+  sum += MACRO_852(852);
+  sum += MACRO_853(853);
+  sum += MACRO_854(854);
+  sum += MACRO_855(855);
+  sum += MACRO_856(856);
+  sum += MACRO_857(857);
+  sum += MACRO_858(858);
+  sum += MACRO_859(859);
+  sum += MACRO_860(860);
+  sum += MACRO_861(861);
+  sum += MACRO_862(862);
+  sum += MACRO_863(863);
+  sum += MACRO_864(864);
+  sum += MACRO_865(865);
+  sum += MACRO_866(866);
+  sum += MACRO_867(867);
+  sum += MACRO_868(868);
+  sum += MACRO_869(869);
+  sum += MACRO_870(870);
+  sum += MACRO_871(871);
+  sum += MACRO_872(872);
+  sum += MACRO_873(873);
+  sum += MACRO_874(874);
+  sum += MACRO_875(875);
+  sum += MACRO_876(876);
+  sum += MACRO_877(877);
+  sum += MACRO_878(878);
+  sum += MACRO_879(879);
+  sum += MACRO_880(880);
+  sum += MACRO_881(881);
+  sum += MACRO_882(882);
+  sum += MACRO_883(883);
+  sum += MACRO_884(884);
+  sum += MACRO_885(885);
+  sum += MACRO_886(886);
+  sum += MACRO_887(887);
+  sum += MACRO_888(888);
+  sum += MACRO_889(889);
+  sum += MACRO_890(890);
+  sum += MACRO_891(891);
+  sum += MACRO_892(892);
+  sum += MACRO_893(893);
+  sum += MACRO_894(894);
+  sum += MACRO_895(895);
+  sum += MACRO_896(896);
+  sum += MACRO_897(897);
+  sum += MACRO_898(898);
+  sum += MACRO_899(899);
+  sum += MACRO_900(900);
+  sum += MACRO_901(901);
+  sum += MACRO_902(902);
+  sum += MACRO_903(903);
+  sum += MACRO_904(904);
+  sum += MACRO_905(905);
+  sum += MACRO_906(906);
+  sum += MACRO_907(907);
+  sum += MACRO_908(908);
+  sum += MACRO_909(909);
+  sum += MACRO_910(910);
+  sum += MACRO_911(911);
+  sum += MACRO_912(912);
+  sum += MACRO_913(913);
+  sum += MACRO_914(914);
+  sum += MACRO_915(915);
+  sum += MACRO_916(916);
+  sum += MACRO_917(917);
+  sum += MACRO_918(918);
+  sum += MACRO_919(919);
+  sum += MACRO_920(920);
+  sum += MACRO_921(921);
+  sum += MACRO_922(922);
+  sum += MACRO_923(923);
+  sum += MACRO_924(924);
+  sum += MACRO_925(925);
+  sum += MACRO_926(926);
+  sum += MACRO_927(927);
+  sum += MACRO_928(928);
+  sum += MACRO_929(929);
+  sum += MACRO_930(930);
+  sum += MACRO_931(931);
+  sum += MACRO_932(932);
+  sum += MACRO_933(933);
+  sum += MACRO_934(934);
+  sum += MACRO_935(935);
+  sum += MACRO_936(936);
+  sum += MACRO_937(937);
+  sum += MACRO_938(938);
+  sum += MACRO_939(939);
+  sum += MACRO_940(940);
+  sum += MACRO_941(941);
+  sum += MACRO_942(942);
+  sum += MACRO_943(943);
+  sum += MACRO_944(944);
+  sum += MACRO_945(945);
+  sum += MACRO_946(946);
+  sum += MACRO_947(947);
+  sum += MACRO_948(948);
+  sum += MACRO_949(949);
+  sum += MACRO_950(950);
+  sum += MACRO_951(951);
+  sum += MACRO_952(952);
+  sum += MACRO_953(953);
+  sum += MACRO_954(954);
+  sum += MACRO_955(955);
+  sum += MACRO_956(956);
+  sum += MACRO_957(957);
+  sum += MACRO_958(958);
+  sum += MACRO_959(959);
+  sum += MACRO_960(960);
+  sum += MACRO_961(961);
+  sum += MACRO_962(962);
+  sum += MACRO_963(963);
+  sum += MACRO_964(964);
+  sum += MACRO_965(965);
+  sum += MACRO_966(966);
+  sum += MACRO_967(967);
+  sum += MACRO_968(968);
+  sum += MACRO_969(969);
+  sum += MACRO_970(970);
+  sum += MACRO_971(971);
+  sum += MACRO_972(972);
+  sum += MACRO_973(973);
+  sum += MACRO_974(974);
+  sum += MACRO_975(975);
+  sum += MACRO_976(976);
+  sum += MACRO_977(977);
+  sum += MACRO_978(978);
+  sum += MACRO_979(979);
+  sum += MACRO_980(980);
+  sum += MACRO_981(981);
+  sum += MACRO_982(982);
+  sum += MACRO_983(983);
+  sum += MACRO_984(984);
+  sum += MACRO_985(985);
+  sum += MACRO_986(986);
+  sum += MACRO_987(987);
+  sum += MACRO_988(988);
+  sum += MACRO_989(989);
+  sum += MACRO_990(990);
+  sum += MACRO_991(991);
+  sum += MACRO_992(992);
+  sum += MACRO_993(993);
+  sum += MACRO_994(994);
+  sum += MACRO_995(995);
+  sum += MACRO_996(996);
+  sum += MACRO_997(997);
+  sum += MACRO_998(998);
+  sum += MACRO_999(999);
+  printf("%ld\n", sum);
+  return 0;
+}
@@ -0,0 +1,121 @@
+/*// @generated - ccomptime™ v0.0.1 - de908b60366e2cb5 \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 0
+#define _COMPTIME_X1(...) 20
+#define _COMPTIME_X2(...) 40
+#define _COMPTIME_X3(...) 60
+#define _COMPTIME_X4(...) 80
+#define _COMPTIME_X5(...) 100
+#define _COMPTIME_X6(...) 120
+#define _COMPTIME_X7(...) 140
+#define _COMPTIME_X8(...) 160
+#define _COMPTIME_X9(...) 180
+#define _COMPTIME_X10(...) 200
+#define _COMPTIME_X11(...) 220
+#define _COMPTIME_X12(...) 240
+#define _COMPTIME_X13(...) 260
+#define _COMPTIME_X14(...) 280
+#define _COMPTIME_X15(...) 300
+#define _COMPTIME_X16(...) 320
+#define _COMPTIME_X17(...) 340
+#define _COMPTIME_X18(...) 360
+#define _COMPTIME_X19(...) 380
+#define _COMPTIME_X20(...) 400
+#define _COMPTIME_X21(...) 420
+#define _COMPTIME_X22(...) 440
+#define _COMPTIME_X23(...) 460
+#define _COMPTIME_X24(...) 480
+#define _COMPTIME_X25(...) 500
+#define _COMPTIME_X26(...) 520
+#define _COMPTIME_X27(...) 540
+#define _COMPTIME_X28(...) 560
+#define _COMPTIME_X29(...) 580
+#define _COMPTIME_X30(...) 600
+#define _COMPTIME_X31(...) 620
+#define _COMPTIME_X32(...) 640
+#define _COMPTIME_X33(...) 660
+#define _COMPTIME_X34(...) 680
+#define _COMPTIME_X35(...) 700
+#define _COMPTIME_X36(...) 720
+#define _COMPTIME_X37(...) 740
+#define _COMPTIME_X38(...) 760
+#define _COMPTIME_X39(...) 780
+#define _COMPTIME_X40(...) 800
+#define _COMPTIME_X41(...) 820
+#define _COMPTIME_X42(...) 840
+#define _COMPTIME_X43(...) 860
+#define _COMPTIME_X44(...) 880
+#define _COMPTIME_X45(...) 900
+#define _COMPTIME_X46(...) 920
+#define _COMPTIME_X47(...) 940
+#define _COMPTIME_X48(...) 960
+#define _COMPTIME_X49(...) 980
+#define _COMPTIME_X50(...) 1000
+#define _COMPTIME_X51(...) 1020
+#define _COMPTIME_X52(...) 1040
+#define _COMPTIME_X53(...) 1060
+#define _COMPTIME_X54(...) 1080
+#define _COMPTIME_X55(...) 1100
+#define _COMPTIME_X56(...) 1120
+#define _COMPTIME_X57(...) 1140
+#define _COMPTIME_X58(...) 1160
+#define _COMPTIME_X59(...) 1180
+#define _COMPTIME_X60(...) 1200
+#define _COMPTIME_X61(...) 1220
+#define _COMPTIME_X62(...) 1240
+#define _COMPTIME_X63(...) 1260
+#define _COMPTIME_X64(...) 1280
+#define _COMPTIME_X65(...) 1300
+#define _COMPTIME_X66(...) 1320
+#define _COMPTIME_X67(...) 1340
+#define _COMPTIME_X68(...) 1360
+#define _COMPTIME_X69(...) 1380
+#define _COMPTIME_X70(...) 1400
+#define _COMPTIME_X71(...) 1420
+#define _COMPTIME_X72(...) 1440
+#define _COMPTIME_X73(...) 1460
+#define _COMPTIME_X74(...) 1480
+#define _COMPTIME_X75(...) 1500
+#define _COMPTIME_X76(...) 1520
+#define _COMPTIME_X77(...) 1540
+#define _COMPTIME_X78(...) 1560
+#define _COMPTIME_X79(...) 1580
+#define _COMPTIME_X80(...) 1600
+#define _COMPTIME_X81(...) 1620
+#define _COMPTIME_X82(...) 1640
+#define _COMPTIME_X83(...) 1660
+#define _COMPTIME_X84(...) 1680
+#define _COMPTIME_X85(...) 1700
+#define _COMPTIME_X86(...) 1720
+#define _COMPTIME_X87(...) 1740
+#define _COMPTIME_X88(...) 1760
+#define _COMPTIME_X89(...) 1780
+#define _COMPTIME_X90(...) 1800
+#define _COMPTIME_X91(...) 1820
+#define _COMPTIME_X92(...) 1840
+#define _COMPTIME_X93(...) 1860
+#define _COMPTIME_X94(...) 1880
+#define _COMPTIME_X95(...) 1900
+#define _COMPTIME_X96(...) 1920
+#define _COMPTIME_X97(...) 1940
+#define _COMPTIME_X98(...) 1960
+#define _COMPTIME_X99(...) 1980
+#endif // _COMPILING
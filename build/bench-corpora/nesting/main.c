@@ -0,0 +1,312 @@
+#include <stdio.h>
+
+#include "../../../ccomptime.h"
+#include "main.c.h"
+
+int main(int argc, char **argv) {
+  (void)argv;
+  long sum = 0;
+  if (argc > 0 - 150) {
+   if (argc > 1 - 150) {
+    if (argc > 2 - 150) {
+     if (argc > 3 - 150) {
+      if (argc > 4 - 150) {
+       if (argc > 5 - 150) {
+        if (argc > 6 - 150) {
+         if (argc > 7 - 150) {
+          if (argc > 8 - 150) {
+           if (argc > 9 - 150) {
+            if (argc > 10 - 150) {
+             if (argc > 11 - 150) {
+              if (argc > 12 - 150) {
+               if (argc > 13 - 150) {
+                if (argc > 14 - 150) {
+                 if (argc > 15 - 150) {
+                  if (argc > 16 - 150) {
+                   if (argc > 17 - 150) {
+                    if (argc > 18 - 150) {
+                     if (argc > 19 - 150) {
+                      if (argc > 20 - 150) {
+                       if (argc > 21 - 150) {
+                        if (argc > 22 - 150) {
+                         if (argc > 23 - 150) {
+                          if (argc > 24 - 150) {
+                           if (argc > 25 - 150) {
+                            if (argc > 26 - 150) {
+                             if (argc > 27 - 150) {
+                              if (argc > 28 - 150) {
+                               if (argc > 29 - 150) {
+                                if (argc > 30 - 150) {
+                                 if (argc > 31 - 150) {
+                                  if (argc > 32 - 150) {
+                                   if (argc > 33 - 150) {
+                                    if (argc > 34 - 150) {
+                                     if (argc > 35 - 150) {
+                                      if (argc > 36 - 150) {
+                                       if (argc > 37 - 150) {
+                                        if (argc > 38 - 150) {
+                                         if (argc > 39 - 150) {
+                                          if (argc > 40 - 150) {
+                                           if (argc > 41 - 150) {
+                                            if (argc > 42 - 150) {
+                                             if (argc > 43 - 150) {
+                                              if (argc > 44 - 150) {
+                                               if (argc > 45 - 150) {
+                                                if (argc > 46 - 150) {
+                                                 if (argc > 47 - 150) {
+                                                  if (argc > 48 - 150) {
+                                                   if (argc > 49 - 150) {
+                                                    if (argc > 50 - 150) {
+                                                     if (argc > 51 - 150) {
+                                                      if (argc > 52 - 150) {
+                                                       if (argc > 53 - 150) {
+                                                        if (argc > 54 - 150) {
+                                                         if (argc > 55 - 150) {
+                                                          if (argc > 56 - 150) {
+                                                           if (argc > 57 - 150) {
+                                                            if (argc > 58 - 150) {
+                                                             if (argc > 59 - 150) {
+                                                              if (argc > 60 - 150) {
+                                                               if (argc > 61 - 150) {
+                                                                if (argc > 62 - 150) {
+                                                                 if (argc > 63 - 150) {
+                                                                  if (argc > 64 - 150) {
+                                                                   if (argc > 65 - 150) {
+                                                                    if (argc > 66 - 150) {
+                                                                     if (argc > 67 - 150) {
+                                                                      if (argc > 68 - 150) {
+                                                                       if (argc > 69 - 150) {
+                                                                        if (argc > 70 - 150) {
+                                                                         if (argc > 71 - 150) {
+                                                                          if (argc > 72 - 150) {
+                                                                           if (argc > 73 - 150) {
+                                                                            if (argc > 74 - 150) {
+                                                                             if (argc > 75 - 150) {
+                                                                              if (argc > 76 - 150) {
+                                                                               if (argc > 77 - 150) {
+                                                                                if (argc > 78 - 150) {
+                                                                                 if (argc > 79 - 150) {
+                                                                                  if (argc > 80 - 150) {
+                                                                                   if (argc > 81 - 150) {
+                                                                                    if (argc > 82 - 150) {
+                                                                                     if (argc > 83 - 150) {
+                                                                                      if (argc > 84 - 150) {
+                                                                                       if (argc > 85 - 150) {
+                                                                                        if (argc > 86 - 150) {
+                                                                                         if (argc > 87 - 150) {
+                                                                                          if (argc > 88 - 150) {
+                                                                                           if (argc > 89 - 150) {
+                                                                                            if (argc > 90 - 150) {
+                                                                                             if (argc > 91 - 150) {
+                                                                                              if (argc > 92 - 150) {
+                                                                                               if (argc > 93 - 150) {
+                                                                                                if (argc > 94 - 150) {
+                                                                                                 if (argc > 95 - 150) {
+                                                                                                  if (argc > 96 - 150) {
+                                                                                                   if (argc > 97 - 150) {
+                                                                                                    if (argc > 98 - 150) {
+                                                                                                     if (argc > 99 - 150) {
+                                                                                                      if (argc > 100 - 150) {
+                                                                                                       if (argc > 101 - 150) {
+                                                                                                        if (argc > 102 - 150) {
+                                                                                                         if (argc > 103 - 150) {
+                                                                                                          if (argc > 104 - 150) {
+                                                                                                           if (argc > 105 - 150) {
+                                                                                                            if (argc > 106 - 150) {
+                                                                                                             if (argc > 107 - 150) {
+                                                                                                              if (argc > 108 - 150) {
+                                                                                                               if (argc > 109 - 150) {
+                                                                                                                if (argc > 110 - 150) {
+                                                                                                                 if (argc > 111 - 150) {
+                                                                                                                  if (argc > 112 - 150) {
+                                                                                                                   if (argc > 113 - 150) {
+                                                                                                                    if (argc > 114 - 150) {
+                                                                                                                     if (argc > 115 - 150) {
+                                                                                                                      if (argc > 116 - 150) {
+                                                                                                                       if (argc > 117 - 150) {
+                                                                                                                        if (argc > 118 - 150) {
+                                                                                                                         if (argc > 119 - 150) {
+                                                                                                                          if (argc > 120 - 150) {
+                                                                                                                           if (argc > 121 - 150) {
+                                                                                                                            if (argc > 122 - 150) {
+                                                                                                                             if (argc > 123 - 150) {
+                                                                                                                              if (argc > 124 - 150) {
+                                                                                                                               if (argc > 125 - 150) {
+                                                                                                                                if (argc > 126 - 150) {
+                                                                                                                                 if (argc > 127 - 150) {
+                                                                                                                                  if (argc > 128 - 150) {
+                                                                                                                                   if (argc > 129 - 150) {
+                                                                                                                                    if (argc > 130 - 150) {
+                                                                                                                                     if (argc > 131 - 150) {
+                                                                                                                                      if (argc > 132 - 150) {
+                                                                                                                                       if (argc > 133 - 150) {
+                                                                                                                                        if (argc > 134 - 150) {
+                                                                                                                                         if (argc > 135 - 150) {
+                                                                                                                                          if (argc > 136 - 150) {
+                                                                                                                                           if (argc > 137 - 150) {
+                                                                                                                                            if (argc > 138 - 150) {
+                                                                                                                                             if (argc > 139 - 150) {
+                                                                                                                                              if (argc > 140 - 150) {
+                                                                                                                                               if (argc > 141 - 150) {
+                                                                                                                                                if (argc > 142 - 150) {
+                                                                                                                                                 if (argc > 143 - 150) {
+                                                                                                                                                  if (argc > 144 - 150) {
+                                                                                                                                                   if (argc > 145 - 150) {
+                                                                                                                                                    if (argc > 146 - 150) {
+                                                                                                                                                     if (argc > 147 - 150) {
+                                                                                                                                                      if (argc > 148 - 150) {
+                                                                                                                                                       if (argc > 149 - 150) {
+                                                                                                                                                        sum += (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + (1 + _Comptime({ _ComptimeCtx.Inline.appendf("42"); })))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+                                                                                                                                                       }
+                                                                                                                                                      }
+                                                                                                                                                     }
+                                                                                                                                                    }
+                                                                                                                                                   }
+                                                                                                                                                  }
+                                                                                                                                                 }
+                                                                                                                                                }
+                                                                                                                                               }
+                                                                                                                                              }
+                                                                                                                                             }
+                                                                                                                                            }
+                                                                                                                                           }
+                                                                                                                                          }
+                                                                                                                                         }
+                                                                                                                                        }
+                                                                                                                                       }
+                                                                                                                                      }
+                                                                                                                                     }
+                                                                                                                                    }
+                                                                                                                                   }
+                                                                                                                                  }
+                                                                                                                                 }
+                                                                                                                                }
+                                                                                                                               }
+                                                                                                                              }
+                                                                                                                             }
+                                                                                                                            }
+                                                                                                                           }
+                                                                                                                          }
+                                                                                                                         }
+                                                                                                                        }
+                                                                                                                       }
+                                                                                                                      }
+                                                                                                                     }
+                                                                                                                    }
+                                                                                                                   }
+                                                                                                                  }
+                                                                                                                 }
+                                                                                                                }
+                                                                                                               }
+                                                                                                              }
+                                                                                                             }
+                                                                                                            }
+                                                                                                           }
+                                                                                                          }
+                                                                                                         }
+                                                                                                        }
+                                                                                                       }
+                                                                                                      }
+                                                                                                     }
+                                                                                                    }
+                                                                                                   }
+                                                                                                  }
+                                                                                                 }
+                                                                                                }
+                                                                                               }
+                                                                                              }
+                                                                                             }
+                                                                                            }
+                                                                                           }
+                                                                                          }
+                                                                                         }
+                                                                                        }
+                                                                                       }
+                                                                                      }
+                                                                                     }
+                                                                                    }
+                                                                                   }
+                                                                                  }
+                                                                                 }
+                                                                                }
+                                                                               }
+                                                                              }
+                                                                             }
+                                                                            }
+                                                                           }
+                                                                          }
+                                                                         }
+                                                                        }
+                                                                       }
+                                                                      }
+                                                                     }
+                                                                    }
+                                                                   }
+                                                                  }
+                                                                 }
+                                                                }
+                                                               }
+                                                              }
+                                                             }
+                                                            }
+                                                           }
+                                                          }
+                                                         }
+                                                        }
+                                                       }
+                                                      }
+                                                     }
+                                                    }
+                                                   }
+                                                  }
+                                                 }
+                                                }
+                                               }
+                                              }
+                                             }
+                                            }
+                                           }
+                                          }
+                                         }
+                                        }
+                                       }
+                                      }
+                                     }
+                                    }
+                                   }
+                                  }
+                                 }
+                                }
+                               }
+                              }
+                             }
+                            }
+                           }
+                          }
+                         }
+                        }
+                       }
+                      }
+                     }
+                    }
+                   }
+                  }
+                 }
+                }
+               }
+              }
+             }
+            }
+           }
+          }
+         }
+        }
+       }
+      }
+     }
+    }
+   }
+  }
+  printf("%ld\n", sum);
+  return 0;
+}
@@ -0,0 +1,22 @@
+/*// @generated - ccomptime™ v0.0.1 - 1745c06a833bb1c0 \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 42
+#endif // _COMPILING
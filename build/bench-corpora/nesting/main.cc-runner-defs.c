@@ -0,0 +1,2 @@
+
+__Comptime_Statement_Fn(0, _ComptimeCtx.Inline.appendf("42"))
@@ -0,0 +1 @@
+__Comptime_Register_Main_Exec(0, -1); // execute comptime statement #0
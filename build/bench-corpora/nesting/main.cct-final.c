@@ -0,0 +1,2 @@
+#include "main.c.h"
+#include "main.c"
@@ -0,0 +1,422 @@
+#include "cache.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+CacheKey cache_key_bytes(CacheKey key, const void *data, size_t len) {
+  const unsigned char *p = data;
+  for (size_t i = 0; i < len; i++) {
+    key ^= p[i];
+    key *= 0x100000001b3ull;
+  }
+  return key;
+}
+
+// Strings are hashed with their terminator so ("ab", "c") != ("a", "bc").
+CacheKey cache_key_cstr(CacheKey key, const char *s) {
+  return cache_key_bytes(key, s, strlen(s) + 1);
+}
+
+static bool is_word_char(char c) {
+  return isalnum((unsigned char)c) || c == '_';
+}
+
+// Comments are dropped and whitespace only matters where it separates two
+// tokens that would otherwise merge, or ends a preprocessor directive. Inside
+// a directive every gap counts: `#define E(x)` and `#define E (x)` differ.
+CacheKey cache_key_tokens(CacheKey key, const char *src, size_t len) {
+  bool line_start = true, in_directive = false, pending_space = false;
+  char last = '\0';
+  size_t i = 0;
+  while (i < len) {
+    char c = src[i];
+    char next = i + 1 < len ? src[i + 1] : '\0';
+
+    if (c == '\\' && next == '\n') {
+      pending_space = true;
+      i += 2;
+    } else if (c == '\n') {
+      if (in_directive) {
+        key = cache_key_bytes(key, "\n", 1);
+        in_directive = false;
+        last = '\0';
+      }
+      line_start = true;
+      pending_space = true;
+      i++;
+    } else if (isspace((unsigned char)c)) {
+      pending_space = true;
+      i++;
+    } else if (c == '/' && next == '/') {
+      while (i < len && src[i] != '\n')
+        i++;
+    } else if (c == '/' && next == '*') {
+      i += 2;
+      while (i + 1 < len && !(src[i] == '*' && src[i + 1] == '/'))
+        i++;
+      i += 2;
+      pending_space = true;
+    } else {
+      if (pending_space && last != '\0' &&
+          (in_directive || is_word_char(last) == is_word_char(c)))
+        key = cache_key_bytes(key, " ", 1);
+      pending_space = false;
+      if (line_start && c == '#')
+        in_directive = true;
+      line_start = false;
+
+      size_t start = i++;
+      if (c == '"' || c == '\'') {
+        while (i < len && src[i] != c && src[i] != '\n')
+          i += src[i] == '\\' ? 2 : 1;
+        if (i < len && src[i] == c)
+          i++;
+        if (i > len)
+          i = len;
+      }
+      key = cache_key_bytes(key, src + start, i - start);
+      last = src[i - 1];
+    }
+  }
+  return key;
+}
+
+bool cache_hash_file(const char *path, CacheKey *out) {
+  String_Builder sb = {0};
+  if (!nob_read_entire_file(path, &sb))
+    return false;
+  *out = cache_key_bytes(CACHE_KEY_INIT, sb.items, sb.count);
+  sb_free(sb);
+  return true;
+}
+
+// The resolved path of what exec would run for `name`, NULL if nothing.
+static char *find_executable(const char *name) {
+  if (strchr(name, '/'))
+    return realpath(name, NULL);
+
+  const char *path = getenv("PATH");
+  if (!path)
+    return NULL;
+  String_Builder candidate = {0};
+  char *found = NULL;
+  while (!found) {
+    const char *end = strchr(path, ':');
+    size_t len = end ? (size_t)(end - path) : strlen(path);
+    candidate.count = 0;
+    if (len == 0)
+      sb_append_cstr(&candidate, ".");
+    else
+      sb_append_buf(&candidate, path, len);
+    sb_appendf(&candidate, "/%s", name);
+    sb_append_null(&candidate);
+    if (access(candidate.items, X_OK) == 0)
+      found = realpath(candidate.items, NULL);
+    if (!end)
+      break;
+    path = end + 1;
+  }
+  sb_free(candidate);
+  return found;
+}
+
+CacheKey cache_key_compiler(CacheKey key, const char *name) {
+  static char *resolved_name = NULL;
+  static CacheKey identity;
+  if (!resolved_name || strcmp(resolved_name, name) != 0) {
+    free(resolved_name);
+    resolved_name = strdup(name);
+    identity = cache_key_cstr(CACHE_KEY_INIT, name);
+
+    char *binary = find_executable(name);
+    struct stat st;
+    if (binary && stat(binary, &st) == 0) {
+      int64_t size = (int64_t)st.st_size, mtime = (int64_t)st.st_mtime;
+      identity = cache_key_cstr(identity, binary);
+      identity = cache_key_bytes(identity, &size, sizeof(size));
+      identity = cache_key_bytes(identity, &mtime, sizeof(mtime));
+    } else {
+      nob_log(WARNING, "Could not find compiler %s, the runner cache will not "
+                       "notice it changing", name);
+    }
+    free(binary);
+  }
+  return cache_key_bytes(key, &identity, sizeof(identity));
+}
+
+static bool mkdir_recursive(const char *path) {
+  String_Builder sb = {0};
+  sb_append_cstr(&sb, path);
+  sb_append_null(&sb);
+
+  bool ok = true;
+  for (char *p = sb.items + 1; ok; p++) {
+    if (*p != '/' && *p != '\0')
+      continue;
+    char saved = *p;
+    *p = '\0';
+    if (mkdir(sb.items, 0755) < 0 && errno != EEXIST)
+      ok = false;
+    *p = saved;
+    if (saved == '\0')
+      break;
+  }
+
+  sb_free(sb);
+  return ok;
+}
+
+const char *cache_dir(void) {
+  static bool resolved = false;
+  static char *dir = NULL;
+  if (resolved)
+    return dir;
+  resolved = true;
+
+  String_Builder sb = {0};
+  const char *env = getenv("CCOMPTIME_CACHE_DIR");
+  const char *xdg = getenv("XDG_CACHE_HOME");
+  const char *home = getenv("HOME");
+  if (env && *env) {
+    sb_append_cstr(&sb, env);
+  } else if (xdg && *xdg) {
+    sb_appendf(&sb, "%s/ccomptime", xdg);
+  } else if (home && *home) {
+    sb_appendf(&sb, "%s/.cache/ccomptime", home);
+  } else {
+    return NULL;
+  }
+  sb_append_null(&sb);
+
+  if (!mkdir_recursive(sb.items)) {
+    nob_log(WARNING, "Could not create cache directory %s: %s", sb.items,
+            strerror(errno));
+    sb_free(sb);
+    return NULL;
+  }
+
+  dir = sb.items;
+  return dir;
+}
+
+const char *cache_entry_path(CacheKey key, const char *suffix) {
+  const char *dir = cache_dir();
+  assert(dir && "cache_entry_path requires a cache directory");
+  return nob_temp_sprintf("%s/%016" PRIx64 "%s", dir, key, suffix);
+}
+
+const char *cache_temp_path(const char *final_path) {
+  return nob_temp_sprintf("%s.%ld.tmp", final_path, (long)getpid());
+}
+
+bool cache_publish(const char *temp_path, const char *final_path) {
+  if (rename(temp_path, final_path) < 0) {
+    nob_log(WARNING, "Could not publish cache entry %s: %s", final_path,
+            strerror(errno));
+    unlink(temp_path);
+    return false;
+  }
+  return true;
+}
+
+bool depfile_read_prerequisites(const char *depfile_path, Nob_File_Paths *out) {
+  String_Builder content = {0};
+  if (!nob_read_entire_file(depfile_path, &content))
+    return false;
+
+  const char *p = content.items;
+  const char *end = content.items + content.count;
+
+  // skip the target(s), up to the first `:` that is followed by whitespace
+  while (p < end &&
+         !(*p == ':' && (p + 1 == end || isspace((unsigned char)p[1]))))
+    p++;
+  if (p < end)
+    p++;
+
+  String_Builder path = {0};
+#define FLUSH_PATH()                                                           \
+  do {                                                                         \
+    if (path.count > 0) {                                                      \
+      sb_append_null(&path);                                                   \
+      nob_da_append(out, strdup(path.items));                                  \
+      path.count = 0;                                                          \
+    }                                                                          \
+  } while (0)
+
+  while (p < end) {
+    char c = *p;
+    if (c == '\\' && p + 1 < end && p[1] == '\n') {
+      FLUSH_PATH();
+      p += 2;
+    } else if (c == '\\' && p + 1 < end && (p[1] == ' ' || p[1] == '#')) {
+      da_append(&path, p[1]);
+      p += 2;
+    } else if (c == '$' && p + 1 < end && p[1] == '$') {
+      da_append(&path, '$');
+      p += 2;
+    } else if (c == '\n') {
+      // the first rule is over, anything after it (e.g. -MP) is not ours
+      break;
+    } else if (isspace((unsigned char)c)) {
+      FLUSH_PATH();
+      p++;
+    } else {
+      da_append(&path, c);
+      p++;
+    }
+  }
+  FLUSH_PATH();
+#undef FLUSH_PATH
+
+  sb_free(path);
+  sb_free(content);
+  return true;
+}
+
+bool cache_manifest_from_paths(const Nob_File_Paths *paths,
+                               const char *manifest_path) {
+  return cache_manifest_from_inputs(paths, NULL, manifest_path);
+}
+
+bool cache_manifest_from_inputs(const Nob_File_Paths *paths,
+                                const Nob_File_Paths *env,
+                                const char *manifest_path) {
+  String_Builder manifest = {0};
+  for (size_t i = 0; i < paths->count; i++) {
+    const char *path = paths->items[i];
+    bool seen = false;
+    for (size_t j = 0; j < i && !seen; j++) {
+      seen = strcmp(paths->items[j], path) == 0;
+    }
+    if (seen)
+      continue;
+
+    CacheKey hash;
+    if (cache_hash_file(path, &hash)) {
+      sb_appendf(&manifest, "%016" PRIx64 " %s\n", hash, path);
+    } else {
+      sb_appendf(&manifest, "- %s\n", path);
+    }
+  }
+
+  // variables are recorded as `$<hash of the value> <name>`, or `$- <name>`
+  for (size_t i = 0; env && i < env->count; i++) {
+    const char *name = env->items[i];
+    bool seen = false;
+    for (size_t j = 0; j < i && !seen; j++) {
+      seen = strcmp(env->items[j], name) == 0;
+    }
+    if (seen)
+      continue;
+
+    const char *value = getenv(name);
+    if (value) {
+      sb_appendf(&manifest, "$%016" PRIx64 " %s\n",
+                 cache_key_cstr(CACHE_KEY_INIT, value), name);
+    } else {
+      sb_appendf(&manifest, "$- %s\n", name);
+    }
+  }
+
+  bool ok =
+      nob_write_entire_file(manifest_path, manifest.items, manifest.count);
+  sb_free(manifest);
+  return ok;
+}
+
+bool cache_manifest_from_depfile(const char *depfile_path,
+                                 const char *manifest_path,
+                                 const Nob_File_Paths *exclude) {
+  Nob_File_Paths prerequisites = {0};
+  if (!depfile_read_prerequisites(depfile_path, &prerequisites))
+    return false;
+
+  for (size_t i = 0; exclude && i < prerequisites.count;) {
+    bool excluded = false;
+    nob_da_foreach(const char *, it, exclude) {
+      excluded = excluded || strcmp(*it, prerequisites.items[i]) == 0;
+    }
+    if (excluded) {
+      free((char *)prerequisites.items[i]);
+      prerequisites.items[i] = prerequisites.items[--prerequisites.count];
+    } else {
+      i++;
+    }
+  }
+
+  bool ok = cache_manifest_from_paths(&prerequisites, manifest_path);
+
+  nob_da_foreach(const char *, it, &prerequisites) { free((char *)*it); }
+  da_free(prerequisites);
+  return ok;
+}
+
+bool cache_manifest_valid(const char *manifest_path) {
+  String_Builder manifest = {0};
+  if (!nob_read_entire_file(manifest_path, &manifest))
+    return false;
+  sb_append_null(&manifest);
+
+  bool valid = true;
+  char *line = manifest.items;
+  while (valid && *line) {
+    char *newline = strchr(line, '\n');
+    if (!newline)
+      break;
+    *newline = '\0';
+
+    CacheKey recorded, actual;
+    char *path = NULL;
+    bool stale;
+    if (line[0] == '$') {
+      // an environment variable
+      const char *value;
+      if (line[1] == '-' && line[2] == ' ') {
+        path = line + 2;
+        stale = getenv(path + 1) != NULL;
+      } else {
+        recorded = strtoull(line + 1, &path, 16);
+        stale = !path || *path != ' ' || !(value = getenv(path + 1)) ||
+                cache_key_cstr(CACHE_KEY_INIT, value) != recorded;
+      }
+    } else if (line[0] == '-' && line[1] == ' ') {
+      // recorded as absent, stays valid until the file shows up
+      path = line + 1;
+      stale = nob_file_exists(path + 1) != 0;
+    } else {
+      recorded = strtoull(line, &path, 16);
+      stale = !path || *path != ' ' || !cache_hash_file(path + 1, &actual) ||
+              actual != recorded;
+    }
+    if (stale) {
+      nob_log(VERBOSE, "Cache manifest %s is stale (%s)", manifest_path,
+              path ? path + 1 : line);
+      valid = false;
+    }
+
+    line = newline + 1;
+  }
+
+  sb_free(manifest);
+  return valid;
+}
+
+bool cache_manifest_merge(const char **manifest_paths, size_t count,
+                          const char *out_path) {
+  String_Builder merged = {0};
+  bool ok = true;
+  for (size_t i = 0; ok && i < count; i++) {
+    ok = nob_read_entire_file(manifest_paths[i], &merged);
+  }
+  if (ok)
+    ok = nob_write_entire_file(out_path, merged.items, merged.count);
+  sb_free(merged);
+  return ok;
+}
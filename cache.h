@@ -0,0 +1,57 @@
+#ifndef CCOMPTIME_CACHE_H
+#define CCOMPTIME_CACHE_H
+
+#include "comptime_common.h"
+
+#include <stdint.h>
+
+// Content-addressed cache for runner artifacts. Entries live in
+// $CCOMPTIME_CACHE_DIR (default: $XDG_CACHE_HOME/ccomptime or
+// ~/.cache/ccomptime) and are published with an atomic rename, so concurrent
+// ccomptime processes can share them.
+
+typedef uint64_t CacheKey;
+
+#define CACHE_KEY_INIT ((CacheKey)0xcbf29ce484222325ull)
+
+CacheKey cache_key_bytes(CacheKey key, const void *data, size_t len);
+CacheKey cache_key_cstr(CacheKey key, const char *s);
+// Key of the token stream of C source, so reformatting or commenting code
+// does not change it.
+CacheKey cache_key_tokens(CacheKey key, const char *src, size_t len);
+bool cache_hash_file(const char *path, CacheKey *out);
+// Key of which compiler `name` runs: the binary found like exec would find
+// it, with its size and mtime, so replacing or upgrading it changes the key.
+// Resolved once per name.
+CacheKey cache_key_compiler(CacheKey key, const char *name);
+
+// NULL when no cache directory could be created.
+const char *cache_dir(void);
+const char *cache_entry_path(CacheKey key, const char *suffix);
+const char *cache_temp_path(const char *final_path);
+bool cache_publish(const char *temp_path, const char *final_path);
+
+// Manifests record the content hash of every file an artifact was built
+// from (as reported by a compiler depfile, or recorded by the runner), so an
+// entry is only reused while all of them are unchanged. Files that did not
+// exist are recorded as absent.
+bool cache_manifest_from_paths(const Nob_File_Paths *paths,
+                               const char *manifest_path);
+// As above, plus the value of every environment variable in `env` (or that
+// it was unset).
+bool cache_manifest_from_inputs(const Nob_File_Paths *paths,
+                                const Nob_File_Paths *env,
+                                const char *manifest_path);
+// Paths in `exclude` (e.g. generated sources already covered by the entry
+// key) are left out of the manifest.
+bool cache_manifest_from_depfile(const char *depfile_path,
+                                 const char *manifest_path,
+                                 const Nob_File_Paths *exclude);
+bool cache_manifest_valid(const char *manifest_path);
+bool cache_manifest_merge(const char **manifest_paths, size_t count,
+                          const char *out_path);
+
+// Split a Make-style depfile into its prerequisite paths (leaky).
+bool depfile_read_prerequisites(const char *depfile_path, Nob_File_Paths *out);
+
+#endif // CCOMPTIME_CACHE_H
@@ -17,9 +17,20 @@ typedef struct {
   void (*appendf)(const char *fmt, ...);
 } _Comptime_Buffer_Vtable;
 
+// Output buffer of one parallel_for chunk.
+typedef struct _ComptimeChunk {
+  _Comptime__String_Builder _sb;
+  void (*appendf)(struct _ComptimeChunk *chunk, const char *fmt, ...);
+} _ComptimeChunk;
+
+typedef void (*_ComptimeChunkFn)(long i, _ComptimeChunk *out, void *ctx);
+
 typedef struct {
   _Comptime_Buffer_Vtable Inline;
   _Comptime_Buffer_Vtable TopLevel;
+  // Calls fn(i, out, ctx) for every i in [begin, end) on the runner's worker
+  // pool. Returns what the chunks appended, in index order (free() it).
+  char *(*parallel_for)(long begin, long end, _ComptimeChunkFn fn, void *ctx);
   int _StatementIndex;
   int _PlaceholderIndex;
 } _ComptimeCtx;
@@ -0,0 +1,348 @@
+#include "chunks.h"
+
+#include <assert.h>
+#include <ctype.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+extern const TSLanguage *tree_sitter_c(void);
+
+// Scanner state for finding cuts. Braces and parentheses are only counted
+// outside of comments, literals and directives (a macro body may well hold an
+// unbalanced brace).
+typedef struct {
+  const char *src;
+  size_t len, i;
+  int braces, parens, conditionals;
+  char last;          // last significant character outside of directives
+  bool declaring;     // past a top-level `=`, until its `;`
+  bool function_body; // the open top-level brace follows a `)`
+  bool between_items; // nothing but whitespace, comments and directives
+                      // since the last complete top-level item
+} Scanner;
+
+static void skip_quoted(Scanner *s) {
+  char quote = s->src[s->i++];
+  while (s->i < s->len && s->src[s->i] != quote && s->src[s->i] != '\n') {
+    if (s->src[s->i] == '\\' && s->i + 1 < s->len)
+      s->i++;
+    s->i++;
+  }
+  if (s->i < s->len && s->src[s->i] == quote)
+    s->i++;
+}
+
+// At a `/`: skip the comment starting there, if any.
+static bool skip_comment(Scanner *s) {
+  const char *p = s->src + s->i;
+  if (s->i + 1 >= s->len)
+    return false;
+  if (p[1] == '/') {
+    while (s->i < s->len && s->src[s->i] != '\n') {
+      if (s->src[s->i] == '\\' && s->i + 1 < s->len)
+        s->i++;
+      s->i++;
+    }
+    return true;
+  }
+  if (p[1] == '*') {
+    s->i += 2;
+    while (s->i + 1 < s->len &&
+           !(s->src[s->i] == '*' && s->src[s->i + 1] == '/'))
+      s->i++;
+    s->i = s->i + 2 < s->len ? s->i + 2 : s->len;
+    return true;
+  }
+  return false;
+}
+
+static bool directive_is(const char *name, size_t len, const char *kw) {
+  return strlen(kw) == len && memcmp(name, kw, len) == 0;
+}
+
+// At a `#` starting a line: skip the directive up to (not including) its
+// newline, tracking conditional nesting.
+static void skip_directive(Scanner *s) {
+  s->i++;
+  while (s->i < s->len && (s->src[s->i] == ' ' || s->src[s->i] == '\t'))
+    s->i++;
+  const char *name = s->src + s->i;
+  while (s->i < s->len && isalpha((unsigned char)s->src[s->i]))
+    s->i++;
+  size_t name_len = (size_t)(s->src + s->i - name);
+  if (directive_is(name, name_len, "if") ||
+      directive_is(name, name_len, "ifdef") ||
+      directive_is(name, name_len, "ifndef"))
+    s->conditionals++;
+  else if (directive_is(name, name_len, "endif"))
+    s->conditionals--;
+
+  while (s->i < s->len && s->src[s->i] != '\n') {
+    char c = s->src[s->i];
+    if (c == '\\' && s->i + 1 < s->len) {
+      s->i += 2; // a continuation line
+    } else if (c == '"' || c == '\'') {
+      skip_quoted(s);
+    } else if (!(c == '/' && skip_comment(s))) {
+      s->i++;
+    }
+  }
+}
+
+static void significant(Scanner *s, char c) {
+  bool top = s->braces == 0 && s->parens == 0;
+  switch (c) {
+  case '{':
+    if (top)
+      s->function_body = s->last == ')' && !s->declaring;
+    s->braces++;
+    break;
+  case '}':
+    s->braces--;
+    break;
+  case '(':
+  case '[':
+    s->parens++;
+    break;
+  case ')':
+  case ']':
+    s->parens--;
+    break;
+  case '=':
+    if (top)
+      s->declaring = true;
+    break;
+  default:
+    break;
+  }
+
+  if (top && c == ';') {
+    s->declaring = false;
+    s->between_items = true;
+  } else if (c == '}' && s->braces == 0 && s->parens == 0) {
+    s->between_items = s->function_body;
+  } else {
+    s->between_items = false;
+  }
+  s->last = c;
+}
+
+// A `'` inside a numeric literal (`1'000'000`) separates digits instead of
+// opening a character constant, unlike after a prefix such as `u8'}'`. Looks
+// back to the start of the preprocessing number, which begins with a digit
+// or with `.` and a digit.
+static bool is_digit_separator(const char *src, size_t i) {
+  size_t start = i;
+  while (start > 0 && (isalnum((unsigned char)src[start - 1]) ||
+                       src[start - 1] == '_' || src[start - 1] == '\'' ||
+                       src[start - 1] == '.'))
+    start--;
+  if (start == i)
+    return false;
+  if (src[start] == '.')
+    start++;
+  return start < i && isdigit((unsigned char)src[start]);
+}
+
+static bool at_cut(const Scanner *s) {
+  return s->between_items && s->braces == 0 && s->parens == 0 &&
+         s->conditionals == 0;
+}
+
+void chunks_split(const char *src, size_t len, size_t target, Chunks *out) {
+  Scanner s = {.src = src, .len = len, .between_items = true};
+  size_t start = 0;
+  bool line_start = true;
+
+  while (len - start > target && s.i < len) {
+    char c = src[s.i];
+    if (c == '\n') {
+      s.i++;
+      line_start = true;
+      if (at_cut(&s) && s.i - start >= target) {
+        da_append(out, ((Chunk){.offset = start, .len = s.i - start}));
+        start = s.i;
+      }
+    } else if (isspace((unsigned char)c)) {
+      s.i++;
+    } else if (c == '#' && line_start) {
+      skip_directive(&s);
+    } else if (c == '/' && skip_comment(&s)) {
+      // comments change nothing
+    } else if (c == '\'' && is_digit_separator(src, s.i)) {
+      s.i++;
+      line_start = false;
+    } else {
+      if (c == '"' || c == '\'') {
+        skip_quoted(&s);
+        significant(&s, c);
+      } else {
+        significant(&s, c);
+        s.i++;
+      }
+      line_start = false;
+    }
+  }
+  da_append(out, ((Chunk){.offset = start, .len = len - start}));
+}
+
+typedef struct {
+  const char *src;
+  Chunks *chunks;
+  size_t next; // first chunk no parser has looked at
+#ifndef _WIN32
+  pthread_mutex_t lock;
+#endif
+} ParseQueue;
+
+static Chunk *parse_queue_take(ParseQueue *queue) {
+  Chunk *chunk = NULL;
+#ifndef _WIN32
+  pthread_mutex_lock(&queue->lock);
+#endif
+  while (!chunk && queue->next < queue->chunks->count) {
+    Chunk *it = &queue->chunks->items[queue->next++];
+    if (!it->tree)
+      chunk = it;
+  }
+#ifndef _WIN32
+  pthread_mutex_unlock(&queue->lock);
+#endif
+  return chunk;
+}
+
+static void parse_queue_run(TSParser *parser, ParseQueue *queue) {
+  Chunk *chunk;
+  while ((chunk = parse_queue_take(queue))) {
+    chunk->tree = ts_parser_parse_string(
+        parser, NULL, queue->src + chunk->offset, (uint32_t)chunk->len);
+  }
+}
+
+#ifndef _WIN32
+// Helpers have no tree-sitter arena, so their trees come from malloc and can
+// be deleted on any thread.
+static void *parse_thread(void *arg) {
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_c());
+  parse_queue_run(parser, arg);
+  ts_parser_delete(parser);
+  return NULL;
+}
+#endif
+
+void chunks_parse(TSParser *parser, const char *src, Chunks *chunks) {
+  ParseQueue queue = {.src = src, .chunks = chunks};
+#ifndef _WIN32
+  size_t pending = 0;
+  nob_da_foreach(Chunk, chunk, chunks) { pending += !chunk->tree; }
+  if (pending == 0)
+    return;
+  size_t helpers = chunks->threads > 1 ? (size_t)chunks->threads - 1 : 0;
+  if (helpers > pending - 1)
+    helpers = pending - 1;
+
+  pthread_mutex_init(&queue.lock, NULL);
+  pthread_t *threads = helpers ? malloc(helpers * sizeof(*threads)) : NULL;
+  for (size_t i = 0; i < helpers; i++) {
+    if (pthread_create(&threads[i], NULL, parse_thread, &queue) != 0) {
+      helpers = i;
+      break;
+    }
+  }
+  parse_queue_run(parser, &queue);
+  for (size_t i = 0; i < helpers; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  free(threads);
+  pthread_mutex_destroy(&queue.lock);
+#else
+  parse_queue_run(parser, &queue);
+#endif
+}
+
+void chunks_apply_edits(TSParser *parser, Chunks *chunks, const char *src,
+                        size_t len, const SourceEdits *edits,
+                        String_Builder *out) {
+  if (edits->count == 0) {
+    out->items = (char *)src;
+    out->count = len;
+    return;
+  }
+
+  const SourceEdit *edit = edits->items;
+  const SourceEdit *end = edit + edits->count;
+  for (size_t i = 0; i < chunks->count; i++) {
+    Chunk *chunk = &chunks->items[i];
+    const char *cursor = src + chunk->offset;
+    const char *stop = cursor + chunk->len;
+    bool last = i + 1 == chunks->count;
+    size_t offset = out->count;
+    bool edited = false;
+
+    for (; edit < end && (edit->range.start < stop || last); edit++) {
+      if (edit->range.start < cursor)
+        continue;
+      assert(edit->range.start + edit->range.len <= stop);
+      nob_sb_append_buf(out, cursor, (size_t)(edit->range.start - cursor));
+      if (edit->with.count)
+        nob_sb_append_buf(out, edit->with.data, edit->with.count);
+      cursor = edit->range.start + edit->range.len;
+      edited = true;
+    }
+    nob_sb_append_buf(out, cursor, (size_t)(stop - cursor));
+
+    chunk->offset = offset;
+    chunk->len = out->count - offset;
+    if (edited) {
+      ts_tree_delete(chunk->tree);
+      chunk->tree = NULL;
+    }
+  }
+  chunks_parse(parser, out->items, chunks);
+}
+
+static const char *find(const char *p, const char *end, const char *needle,
+                        size_t len) {
+  if (len == 0)
+    return p;
+  while ((size_t)(end - p) >= len) {
+    p = memchr(p, needle[0], (size_t)(end - p) - len + 1);
+    if (!p)
+      return NULL;
+    if (memcmp(p, needle, len) == 0)
+      return p;
+    p++;
+  }
+  return NULL;
+}
+
+bool chunk_mentions(const Chunk *chunk, const char *src, const char *needle,
+                    size_t len) {
+  const char *p = src + chunk->offset;
+  return find(p, p + chunk->len, needle, len) != NULL;
+}
+
+bool chunk_find(const Chunk *chunk, const char *src, const char *needle,
+                size_t len, uint32_t *at) {
+  const char *base = src + chunk->offset;
+  if (*at >= chunk->len)
+    return false;
+  const char *p = find(base + *at, base + chunk->len, needle, len);
+  if (!p)
+    return false;
+  *at = (uint32_t)(p - base);
+  return true;
+}
+
+void chunks_free(Chunks *chunks) {
+  nob_da_foreach(Chunk, chunk, chunks) {
+    if (chunk->tree)
+      ts_tree_delete(chunk->tree);
+  }
+  free(chunks->items);
+  *chunks = (Chunks){0};
+}
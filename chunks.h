@@ -0,0 +1,67 @@
+#ifndef CCOMPTIME_CHUNKS_H
+#define CCOMPTIME_CHUNKS_H
+
+#include "nob.h"
+#include "slice_map.h"
+#include "tree_sitter/api.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A translation unit cut at top-level boundaries into chunks that are parsed
+// on their own, so a large source parses on several threads and a rewrite
+// only reparses the chunks it touched. Node offsets are relative to their
+// chunk: passes resolve them against `src + chunk->offset`, which gives
+// slices into the whole source as before.
+
+#define CHUNK_TARGET_SIZE (64 * 1024)
+
+typedef struct {
+  size_t offset, len;
+  TSTree *tree; // NULL until parsed
+} Chunk;
+
+typedef struct {
+  Chunk *items;
+  size_t count, capacity;
+  int threads; // parsers chunks_parse may run at once
+} Chunks;
+
+typedef struct {
+  Slice range;
+  String_View with;
+} SourceEdit;
+
+typedef struct {
+  SourceEdit *items;
+  size_t count, capacity;
+} SourceEdits;
+
+// Cut `src` into chunks of at least `target` bytes (the last one may be
+// shorter). Cuts only fall between top-level items outside of preprocessor
+// conditionals; a source without such places stays one chunk.
+void chunks_split(const char *src, size_t len, size_t target, Chunks *out);
+
+// Parse the chunks that have no tree yet.
+void chunks_parse(TSParser *parser, const char *src, Chunks *chunks);
+
+// Write `src` with `edits` (in source order; one inside an edit already
+// applied is covered by it) to `out`, move the chunks to their place in it
+// and reparse the edited ones. Without edits `out` borrows `src`.
+void chunks_apply_edits(TSParser *parser, Chunks *chunks, const char *src,
+                        size_t len, const SourceEdits *edits,
+                        String_Builder *out);
+
+// Whether the bytes of `chunk` contain `needle`.
+bool chunk_mentions(const Chunk *chunk, const char *src, const char *needle,
+                    size_t len);
+// Advance `*at` (an offset in the chunk) to the next mention of `needle` at or
+// after it; false when there is none.
+bool chunk_find(const Chunk *chunk, const char *src, const char *needle,
+                size_t len, uint32_t *at);
+
+// Delete the trees.
+void chunks_free(Chunks *chunks);
+
+#endif // CCOMPTIME_CHUNKS_H
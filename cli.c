@@ -1,8 +1,11 @@
 #include "ansi.h"
+#include "arena.h"
+#include "mapped_file.h"
 #include <stdint.h>
 #include <string.h>
 // #define NOB_IMPLEMENTATION
 #include "nob.h"
+#include "profile.h"
 #include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -21,13 +24,17 @@ void print_usage(int argc, char **argv) {
 
   printf(BOLD("-- ccomptime™ v0.0.1 --") "\nUSAGE"
                                          ": %s [clang-like "
-                                         "args] file.c ...\n",
-         argv[0]);
+                                         "args] file.c ...\n"
+                                         "       %s stats [-since=DAYS]\n",
+         argv[0], argv[0]);
 }
 typedef enum {
   CliComptimeFlag_Debug = 1u << 0,
   CliComptimeFlag_KeepInter = 1u << 1,
   CliComptimeFlag_NoLogs = 1u << 2,
+  CliComptimeFlag_NoTreeShake = 1u << 3,
+  CliComptimeFlag_NoCache = 1u << 4,
+  CliComptimeFlag_Fork = 1u << 5,
 } CliComptimeFlag;
 typedef struct {
   int *items;
@@ -65,53 +72,79 @@ typedef struct {
   ArgIndexList output_files;
   ArgIndexList flags;
   u_int32_t cct_flags;
+  int comptime_jobs; // threads running independent comptime blocks
+  // -comptime-profile: "" prints a report, anything else is a JSON path
+  const char *comptime_profile;
+  const char *comptime_trace; // Chrome trace-event JSON path
+  const char *comptime_stats; // stats JSON path, "" for stderr
 } CliArgs;
 
 typedef struct {
-  String_Builder *raw_source;
-  String_Builder *preprocessed_source;
+  const MappedFile *source;
 
   const char *input_path;
+  const char *input_arg; // as given on the command line
   const char *runner_exepath;
+  bool runner_is_cached;
+  uint64_t runner_key;
+  const char *runner_inputs_path;
+  const char *runner_header_path;
+  const char *runner_profile_path;
   const char *runner_defs_path;
   const char *runner_main_path;
+  const char *runner_iface_path;
 
   const char *final_out_path;
   const char *gen_header_path;
   const char *comptime_safe_path;
+  const char *comptime_full_path; // unshaken, when anything was shaken
+  bool program_shaken;
   CliArgs *parsed_argv;
+  BlockProfiles *profiles; // with -comptime-profile
+  size_t profile_first;    // first entry of this file in `profiles`
+
+  // written by the front end (on any thread), read by the back end
+  BlockProfiles located; // the blocks, moved to `profiles` by the back end
+  String_Builder runner_program;
+  String_Builder runner_program_full;
+  String_Builder runner_interface;
+  String_Builder runner_definitions;
+  String_Builder runner_main;
+
+  int track;          // trace track of the input
+  size_t stats_index; // its entry in the stats
+  Arena *arena;       // back end only, reset once the input is done
+  Arena *session;     // lives until exit
 } Context;
 
-static char *leaky_sprintf(const char *fmt, ...)
-    __attribute__((format(printf, 1, 2)));
-
-char *leaky_sprintf(const char *fmt, ...) {
-  va_list args;
-  va_start(args, fmt);
-  int n = vsnprintf(NULL, 0, fmt, args);
-  va_end(args);
-
-  NOB_ASSERT(n >= 0);
-  char *result = (char *)malloc(n + 1);
-  NOB_ASSERT(result != NULL && "Extend the size of the temporary allocator");
-  va_start(args, fmt);
-  vsnprintf(result, n + 1, fmt, args);
-  va_end(args);
-  return result;
-}
-
+// The paths outlive the input (the final compile and the cleanup use them),
+// so they come from the session arena.
 static void Context_fill_paths(Context *ctx, const char *original_source) {
-  ctx->runner_defs_path = leaky_sprintf("%sc-runner-defs.c", original_source);
-  ctx->runner_main_path = leaky_sprintf("%sc-runner-main.c", original_source);
-  ctx->comptime_safe_path = leaky_sprintf("%somptime_safe.c", original_source);
+  Arena *a = ctx->session;
+  ctx->runner_defs_path =
+      arena_sprintf(a, "%sc-runner-defs.c", original_source);
+  ctx->runner_main_path =
+      arena_sprintf(a, "%sc-runner-main.c", original_source);
+  ctx->runner_iface_path =
+      arena_sprintf(a, "%sc-runner-iface.c", original_source);
+  ctx->runner_inputs_path =
+      arena_sprintf(a, "%sc-runner-inputs.txt", original_source);
+  ctx->runner_header_path =
+      arena_sprintf(a, "%sc-runner-header.h", original_source);
+  ctx->runner_profile_path =
+      arena_sprintf(a, "%sc-runner-profile.txt", original_source);
+  ctx->comptime_safe_path =
+      arena_sprintf(a, "%somptime_safe.c", original_source);
+  ctx->comptime_full_path =
+      arena_sprintf(a, "%somptime_full.c", original_source);
 
 #ifdef _WIN32
-  ctx->runner_exepath = leaky_sprintf("%sct-runner.exe", original_source);
+  ctx->runner_exepath = arena_sprintf(a, "%sct-runner.exe", original_source);
 #else
-  ctx->runner_exepath = leaky_sprintf("%sct-runner", original_source);
+  ctx->runner_exepath = arena_sprintf(a, "%sct-runner", original_source);
 #endif
-  ctx->final_out_path = leaky_sprintf("%sct-final.c", original_source);
-  ctx->gen_header_path = leaky_sprintf("%s.h", original_source);
+  ctx->final_out_path = arena_sprintf(a, "%sct-final.c", original_source);
+  ctx->gen_header_path = arena_sprintf(a, "%s.h", original_source);
 }
 
 #define TOOL_FLAG_PREFIX "-comptime"
@@ -123,6 +156,7 @@ CliArgs CliArgs_parse(int argc, char **argv) {
       .input_files = {0},
       .output_files = {0},
       .cct_flags = 0,
+      .comptime_jobs = 1,
       .flags = {0},
   };
 
@@ -163,6 +197,27 @@ CliArgs CliArgs_parse(int argc, char **argv) {
           parsed_argv.cct_flags |= CliComptimeFlag_NoLogs;
         } else if (strcmp(flag, "-keep-inter") == 0) {
           parsed_argv.cct_flags |= CliComptimeFlag_KeepInter;
+        } else if (strcmp(flag, "-no-tree-shake") == 0) {
+          parsed_argv.cct_flags |= CliComptimeFlag_NoTreeShake;
+        } else if (strcmp(flag, "-no-cache") == 0) {
+          parsed_argv.cct_flags |= CliComptimeFlag_NoCache;
+        } else if (strcmp(flag, "-fork") == 0) {
+          parsed_argv.cct_flags |= CliComptimeFlag_Fork;
+        } else if (strcmp(flag, "-profile") == 0) {
+          parsed_argv.comptime_profile = "";
+        } else if (has_prefix(flag, "-profile=")) {
+          parsed_argv.comptime_profile = flag + strlen("-profile=");
+        } else if (strcmp(flag, "-stats=json") == 0) {
+          parsed_argv.comptime_stats = "";
+        } else if (has_prefix(flag, "-stats=json:")) {
+          parsed_argv.comptime_stats = flag + strlen("-stats=json:");
+        } else if (has_prefix(flag, "-trace=")) {
+          parsed_argv.comptime_trace = flag + strlen("-trace=");
+        } else if (has_prefix(flag, "-jobs=")) {
+          // 0 means one per core
+          parsed_argv.comptime_jobs = atoi(flag + strlen("-jobs="));
+          if (parsed_argv.comptime_jobs <= 0)
+            parsed_argv.comptime_jobs = nob_nprocs();
         } else {
           // nob_log(ERROR, "Unknown -comptime flag: %s", flag);
           nob_log(ERROR, "Unknown -comptime flag: %s", flag);
@@ -183,6 +238,11 @@ CliArgs CliArgs_parse(int argc, char **argv) {
     i++;
   }
 
+  // forking only pays off with several children, so default to one per core
+  if ((parsed_argv.cct_flags & CliComptimeFlag_Fork) &&
+      parsed_argv.comptime_jobs == 1)
+    parsed_argv.comptime_jobs = nob_nprocs();
+
   return parsed_argv;
 }
 
@@ -211,6 +271,61 @@ void cmd_append_arg_indeces(CliArgs *pa, ArgIndexList *pointers, Cmd *cmd) {
   }
 }
 
+// Flags that only make sense for the final compilation (output kind and
+// dependency generation) must not leak into the runner build.
+void cmd_append_runner_flags(CliArgs *pa, Cmd *cmd) {
+  for (size_t i = 0; i < pa->flags.count; i++) {
+    const char *f = pa->argv[pa->flags.items[i]];
+    if (strcmp(f, "-c") == 0 || strcmp(f, "-S") == 0 || strcmp(f, "-E") == 0)
+      continue;
+    if (strcmp(f, "-MF") == 0 || strcmp(f, "-MT") == 0 ||
+        strcmp(f, "-MQ") == 0) {
+      i++;
+      continue;
+    }
+    if (has_prefix(f, "-M"))
+      continue;
+    nob_cmd_append(cmd, f);
+  }
+}
+
+typedef struct {
+  bool enabled;     // -MD / -MMD
+  bool phony;       // -MP
+  bool has_target;  // -MT / -MQ
+  const char *path; // -MF, NULL when the compiler picks the name
+} CliDepfile;
+
+CliDepfile cli_depfile(CliArgs *pa) {
+  CliDepfile depfile = {0};
+  for (size_t i = 0; i < pa->flags.count; i++) {
+    const char *f = pa->argv[pa->flags.items[i]];
+    const char *next = i + 1 < pa->flags.count
+                           ? pa->argv[pa->flags.items[i + 1]]
+                           : NULL;
+    if (strcmp(f, "-MD") == 0 || strcmp(f, "-MMD") == 0) {
+      depfile.enabled = true;
+    } else if (strcmp(f, "-MP") == 0) {
+      depfile.phony = true;
+    } else if (has_prefix(f, "-MF")) {
+      depfile.path = f[3] ? f + 3 : next;
+      i += f[3] ? 0 : 1;
+    } else if (has_prefix(f, "-MT") || has_prefix(f, "-MQ")) {
+      depfile.has_target = true;
+      i += f[3] ? 0 : 1;
+    }
+  }
+  return depfile;
+}
+
+bool cli_has_flag(CliArgs *pa, const char *flag) {
+  nob_da_foreach(int, index, &pa->flags) {
+    if (strcmp(pa->argv[*index], flag) == 0)
+      return true;
+  }
+  return false;
+}
+
 int cli(int argc, char **argv, CliArgs *parsed_argv) {
   nob_minimal_log_level = ERROR;
   if (argc < 2) {
@@ -1,7 +1,7 @@
-#define HASHMAP_IMPLEMENTATION
 #include "comptime_common.h"
 
 #include <assert.h>
+#include <ctype.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -28,8 +28,67 @@ Slice slice_strip_prefix(Slice s, const char *prefix) {
   return out;
 }
 
-const char *get_parent_dir(const char *filepath) {
-  static char buffer[1024];
+bool slice_contains(Slice s, const char *needle) {
+  size_t len = strlen(needle);
+  assert(len > 0);
+  const char *p = s.start;
+  const char *end = s.start + s.len;
+  while ((size_t)(end - p) >= len &&
+         (p = memchr(p, needle[0], (size_t)(end - p) - len + 1))) {
+    if (memcmp(p, needle, len) == 0)
+      return true;
+    p++;
+  }
+  return false;
+}
+
+static bool is_ident_start(char c) {
+  return isalpha((unsigned char)c) || c == '_';
+}
+
+static bool is_ident_char(char c) {
+  return isalnum((unsigned char)c) || c == '_';
+}
+
+// Lexical scan for identifier tokens, skipping literals and comments. Used
+// where we only care about which names a piece of code mentions.
+void slice_collect_identifiers(Slice s, Slices *out) {
+  const char *p = s.start;
+  const char *end = s.start + s.len;
+
+  while (p < end) {
+    char c = *p;
+    if (c == '"' || c == '\'') {
+      p++;
+      while (p < end && *p != c) {
+        if (*p == '\\' && p + 1 < end)
+          p++;
+        p++;
+      }
+      p++;
+    } else if (c == '/' && p + 1 < end && p[1] == '/') {
+      while (p < end && *p != '\n')
+        p++;
+    } else if (c == '/' && p + 1 < end && p[1] == '*') {
+      p += 2;
+      while (p + 1 < end && !(p[0] == '*' && p[1] == '/'))
+        p++;
+      p += 2;
+    } else if (is_ident_start(c)) {
+      const char *start = p;
+      while (p < end && is_ident_char(*p))
+        p++;
+      nob_da_append(out, ((Slice){.start = start, .len = (int)(p - start)}));
+    } else if (isdigit((unsigned char)c)) {
+      while (p < end && (is_ident_char(*p) || *p == '.'))
+        p++;
+    } else {
+      p++;
+    }
+  }
+}
+
+char *get_parent_dir(Arena *a, const char *filepath) {
   const char *last_slash = strrchr(filepath, '/');
 
 #ifdef _WIN32
@@ -38,17 +97,9 @@ const char *get_parent_dir(const char *filepath) {
     last_slash = last_bslash;
 #endif
 
-  if (!last_slash) {
-    return ".";
-  }
-
-  size_t len = (size_t)(last_slash - filepath);
-  if (len >= sizeof(buffer))
-    len = sizeof(buffer) - 1;
-
-  memcpy(buffer, filepath, len);
-  buffer[len] = '\0';
-  return buffer;
+  if (!last_slash)
+    return arena_strdup(a, ".");
+  return arena_sprintf(a, "%.*s", (int)(last_slash - filepath), filepath);
 }
 
 const char *path_basename(const char *filepath) {
@@ -63,8 +114,27 @@ const char *path_basename(const char *filepath) {
   return last_slash + 1;
 }
 
-const char *resolve(const char *FILE_NAME, const char *path) {
-  return nob_temp_sprintf("%s/%s", get_parent_dir(FILE_NAME), path);
+const char *resolve(Arena *a, const char *FILE_NAME, const char *path) {
+  return arena_sprintf(a, "%s/%s", get_parent_dir(a, FILE_NAME), path);
+}
+
+void walk_context_free(WalkContext *ctx) {
+  free(ctx->to_be_removed.items);
+  free(ctx->shaken.items);
+  free(ctx->comptimetype_stmts.items);
+  free(ctx->comptimetype_stmt_indices.items);
+  free(ctx->comptime_stmts.items);
+  free(ctx->comptime_stmt_placeholder.items);
+  free(ctx->comptime_stmt_group.items);
+  free(ctx->comptime_dependencies.items);
+  nob_da_foreach(TopLevelItem, item, &ctx->top_level) {
+    free(item->names.items);
+  }
+  free(ctx->top_level.items);
+  sb_free(ctx->out_c.definitions);
+  sb_free(ctx->out_c.main);
+  slice_map_free(&ctx->macros);
+  *ctx = (WalkContext){0};
 }
 
 Slice ts_node_range(TSNode node, const char *src) {
@@ -75,6 +145,10 @@ Slice ts_node_range(TSNode node, const char *src) {
   return (Slice){start, len};
 }
 
+IdentId ts_node_ident(Interner *idents, TSNode node, const char *src) {
+  return intern(idents, ts_node_range(node, src));
+}
+
 String_View ts_node_to_str_view(TSNode node, const char *src) {
   const char *start = src + ts_node_start_byte(node);
   int len = ts_node_end_byte(node) - ts_node_start_byte(node);
@@ -135,3 +209,55 @@ bool ts_node_is_comptime_kw(TSNode node, const char *src) {
          memcmp(ts_node_range(node, src).start, "_Comptime",
                 ts_node_range(node, src).len) == 0;
 }
+
+bool ts_node_is_keyword(TSNode node, const char *src, const char *kw) {
+  Slice s = ts_node_range(node, src);
+  return (size_t)s.len == strlen(kw) && memcmp(s.start, kw, s.len) == 0;
+}
+
+static bool declarator_has_pointer(TSNode declarator) {
+  if (ts_node_symbol(declarator) == sym_pointer_declarator)
+    return true;
+  uint32_t n = ts_node_named_child_count(declarator);
+  for (uint32_t i = 0; i < n; i++) {
+    if (declarator_has_pointer(ts_node_named_child(declarator, i)))
+      return true;
+  }
+  return false;
+}
+
+// A declaration of `const` objects only (no prototypes, no pointers whose
+// target could still be written through).
+bool ts_declaration_is_const_object(TSNode node, const char *src) {
+  bool is_const = false;
+  bool has_object = false;
+  uint32_t n = ts_node_child_count(node);
+  for (uint32_t i = 0; i < n; i++) {
+    TSNode child = ts_node_child(node, i);
+    const char *field = ts_node_field_name_for_child(node, i);
+    if (ts_node_symbol(child) == sym_type_qualifier &&
+        ts_node_is_keyword(child, src, "const")) {
+      is_const = true;
+    } else if (field && strcmp(field, "declarator") == 0) {
+      if (ts_node_symbol(child) == sym_function_declarator)
+        return false;
+      if (declarator_has_pointer(child))
+        return false;
+      has_object = true;
+    }
+  }
+  return is_const && has_object;
+}
+
+void sb_append_json_string(String_Builder *out, const char *s) {
+  da_append(out, '"');
+  for (; *s; s++) {
+    if (*s == '"' || *s == '\\')
+      sb_appendf(out, "\\%c", *s);
+    else if ((unsigned char)*s < 0x20)
+      sb_appendf(out, "\\u%04x", *s);
+    else
+      da_append(out, *s);
+  }
+  da_append(out, '"');
+}
@@ -2,31 +2,66 @@
 #define CCOMPTIME_COMMON_H
 
 #include "ansi.h"
+#include "arena.h"
+#include "intern.h"
+#include "slice_map.h"
 #include "utils.h"
 
-#include "deps/hashmap/hashmap.h"
 #include "nob.h"
 #ifndef TS_INCLUDE_SYMBOLS
 #define TS_INCLUDE_SYMBOLS
 #endif
 #include "tree_sitter_c_api.h"
 
+// after the symbols above, its tree-sitter header would hide them
+#include "chunks.h"
+
 #include <stdbool.h>
 #include <stddef.h>
 
 typedef struct {
-  const char *start;
-  int len;
-} Slice;
+  Slice *items;
+  size_t count, capacity;
+} Slices;
+
+typedef enum {
+  TopLevelKind_Other, // always kept: preprocessor, types, externs, ...
+  TopLevelKind_Macro, // always kept, only reachable through a use
+  TopLevelKind_Function,
+  TopLevelKind_Variable,
+  TopLevelKind_Prototype, // kept when the function it declares is reached
+} TopLevelKind;
+
+typedef struct {
+  TopLevelKind kind;
+  TSNode node;
+  const char *src; // what the offsets of `node` are relative to: its chunk
+  Slice range;
+  Slices names;
+  bool reachable;
+} TopLevelItem;
+
+typedef struct {
+  TopLevelItem *items;
+  size_t count, capacity;
+} TopLevelItems;
 
 typedef struct {
   TSNode identifier;
+  bool function_like; // only expanded when called
   Strings arg_names;
   TSTree *body_tree;
   const char *body_src;
 } MacroDefinition;
 
-typedef HashMap MacroDefinitionHashMap;
+// Indexed by the IdentId of the macro name. The definitions live in `arena`,
+// the trees of their bodies are deleted by macros_free.
+typedef struct {
+  Interner *idents;
+  Arena *arena;
+  MacroDefinition **items;
+  size_t count, capacity;
+} MacroTable;
 
 typedef struct {
   String_Builder definitions;
@@ -34,10 +69,11 @@ typedef struct {
 } C_FileBuilder;
 
 typedef struct {
-  String_Builder out_h;
   int comptime_count;
-  HashMap macros;
-  HashMap comptime_dependencies;
+  Interner *idents;
+  Arena *arena; // placeholder names
+  SliceMap macros;
+  IdentSet comptime_dependencies;
 
   C_FileBuilder out_c;
 
@@ -46,6 +82,12 @@ typedef struct {
     size_t count, capacity;
   } to_be_removed;
 
+  // top-level items no block reaches, removed from the program unit only
+  struct {
+    Slice *items;
+    size_t count, capacity;
+  } shaken;
+
   struct {
     Slice *items;
     size_t count, capacity;
@@ -60,13 +102,30 @@ typedef struct {
     Slice *items;
     size_t count, capacity;
   } comptime_stmts;
+
+  // per comptime statement: the `_COMPTIMETYPE_N` it evaluates, -1 for blocks
+  struct {
+    int *items;
+    size_t count, capacity;
+  } comptime_stmt_placeholder;
+
+  // per comptime statement: concurrency group, -1 for sequential
+  struct {
+    int *items;
+    size_t count, capacity;
+  } comptime_stmt_group;
+
+  TopLevelItems top_level;
 } WalkContext;
 
+void walk_context_free(WalkContext *ctx);
+
 int min_int(int a, int b);
 bool slice_begins_with(Slice s, const char *prefix);
 Slice slice_strip_prefix(Slice s, const char *prefix);
-const char *get_parent_dir(const char *filepath);
-const char *resolve(const char *FILE_NAME, const char *path);
+bool slice_contains(Slice s, const char *needle);
+char *get_parent_dir(Arena *a, const char *filepath);
+const char *resolve(Arena *a, const char *FILE_NAME, const char *path);
 const char *path_basename(const char *filepath);
 
 Slice ts_node_range(TSNode node, const char *src);
@@ -74,7 +133,15 @@ String_View ts_node_to_str_view(TSNode node, const char *src);
 void debug_tree(TSTree *tree, const char *src, int depth);
 void debug_tree_node(TSNode node, const char *src, int depth);
 
+void slice_collect_identifiers(Slice s, Slices *out);
+
+// Append `s` as a quoted, escaped JSON string.
+void sb_append_json_string(String_Builder *out, const char *s);
+
+bool ts_node_is_keyword(TSNode node, const char *src, const char *kw);
+bool ts_declaration_is_const_object(TSNode node, const char *src);
 bool ts_node_is_comptime_kw(TSNode node, const char *src);
 bool ts_node_is_comptimetype_kw(TSNode node, const char *src);
+IdentId ts_node_ident(Interner *idents, TSNode node, const char *src);
 
 #endif // CCOMPTIME_COMMON_H
@@ -0,0 +1,186 @@
+#include "depfile.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void depfile_escape(String_Builder *out, const char *path) {
+  for (const char *p = path; *p; p++) {
+    if (*p == ' ' || *p == '#')
+      da_append(out, '\\');
+    else if (*p == '$')
+      da_append(out, '$');
+    da_append(out, *p);
+  }
+}
+
+static const char *depfile_escape_temp(const char *path) {
+  String_Builder sb = {0};
+  depfile_escape(&sb, path);
+  sb_append_null(&sb);
+  const char *result = nob_temp_strdup(sb.items);
+  sb_free(sb);
+  return result;
+}
+
+static bool is_path_boundary(char c) {
+  return c == '\0' || c == ' ' || c == '\t' || c == '\n' || c == ':';
+}
+
+// Whole-path search, `a.c` must not match inside `a.c.h`.
+static const char *find_path(const char *text, const char *from,
+                             const char *path) {
+  size_t len = strlen(path);
+  const char *hit = from;
+  while (len > 0 && (hit = strstr(hit, path)) != NULL) {
+    if ((hit == text || isspace((unsigned char)hit[-1])) &&
+        is_path_boundary(hit[len]))
+      return hit;
+    hit++;
+  }
+  return NULL;
+}
+
+static void replace_path(String_Builder *sb, const char *from, const char *to) {
+  sb_append_null(sb);
+
+  String_Builder out = {0};
+  const char *p = sb->items;
+  const char *hit;
+  while ((hit = find_path(sb->items, p, from)) != NULL) {
+    sb_append_buf(&out, p, hit - p);
+    sb_append_cstr(&out, to);
+    p = hit + strlen(from);
+  }
+  sb_append_cstr(&out, p);
+
+  sb_free(*sb);
+  *sb = out;
+}
+
+// Offset of the newline ending the first rule, skipping `\`-continuations.
+static size_t first_rule_end(const String_Builder *sb) {
+  for (size_t i = 0; i < sb->count; i++) {
+    if (sb->items[i] == '\n' && !(i > 0 && sb->items[i - 1] == '\\'))
+      return i;
+  }
+  return sb->count;
+}
+
+// Offset just past the `:` ending the targets of the rule in [0, end). A colon
+// followed by a path character is a drive letter, not the separator.
+static size_t rule_targets_end(const char *rule, size_t end) {
+  for (size_t i = 0; i < end; i++) {
+    if (rule[i] == '\\') {
+      i++;
+    } else if (rule[i] == ':' &&
+               (i + 1 == end || isspace((unsigned char)rule[i + 1]))) {
+      return i + 1;
+    }
+  }
+  return end;
+}
+
+// Next prerequisite in `*p` (up to `end`), unescaped into a temp string.
+// Returns NULL when there is none left.
+static const char *next_prerequisite(const char **p, const char *end) {
+  const char *it = *p;
+  while (it < end && (isspace((unsigned char)*it) ||
+                      (*it == '\\' && it + 1 < end && it[1] == '\n')))
+    it++;
+  if (it == end) {
+    *p = it;
+    return NULL;
+  }
+
+  String_Builder sb = {0};
+  while (it < end && !isspace((unsigned char)*it)) {
+    if (*it == '\\' && it + 1 < end && (it[1] == ' ' || it[1] == '#'))
+      it++;
+    else if (*it == '\\' && it + 1 < end && it[1] == '\n')
+      break;
+    else if (*it == '$' && it + 1 < end && it[1] == '$')
+      it++;
+    da_append(&sb, *it);
+    it++;
+  }
+  sb_append_null(&sb);
+  *p = it;
+
+  const char *result = nob_temp_strdup(sb.items);
+  sb_free(sb);
+  return result;
+}
+
+// The compiler spells the source and its headers the way they were named on
+// the command line or in `#include`, comptime blocks the way they opened
+// them, so the same file can show up both relative and absolute. Compare
+// paths resolved against the working directory.
+static const char *canonical_path_temp(const char *path) {
+#ifdef _WIN32
+  char *resolved = _fullpath(NULL, path, 0);
+#else
+  char *resolved = realpath(path, NULL);
+#endif
+  if (!resolved)
+    return path;
+  const char *result = nob_temp_strdup(resolved);
+  free(resolved);
+  return result;
+}
+
+static bool add_prerequisite(Nob_File_Paths *seen, String_Builder *out,
+                             const char *path) {
+  const char *canonical = canonical_path_temp(path);
+  nob_da_foreach(const char *, it, seen) {
+    if (strcmp(*it, canonical) == 0)
+      return false;
+  }
+  da_append(seen, canonical);
+  sb_appendf(out, " \\\n %s", depfile_escape_temp(path));
+  return true;
+}
+
+bool depfile_patch(const char *path, const DepfileRenames *renames,
+                   const Nob_File_Paths *extra, bool phony) {
+  String_Builder content = {0};
+  if (!nob_read_entire_file(path, &content))
+    return false;
+
+  nob_da_foreach(DepfileRename, it, renames) {
+    replace_path(&content, depfile_escape_temp(it->from),
+                depfile_escape_temp(it->to));
+  }
+
+  // The first rule is rewritten with one prerequisite per line, each file
+  // listed once however it was spelled.
+  size_t end = first_rule_end(&content);
+  size_t targets_end = rule_targets_end(content.items, end);
+  String_Builder out = {0};
+  sb_append_buf(&out, content.items, targets_end);
+
+  Nob_File_Paths seen = {0};
+  const char *p = content.items + targets_end;
+  const char *prerequisite;
+  while ((prerequisite = next_prerequisite(&p, content.items + end)))
+    add_prerequisite(&seen, &out, prerequisite);
+
+  String_Builder phony_rules = {0};
+  nob_da_foreach(const char *, it, extra) {
+    if (add_prerequisite(&seen, &out, *it) && phony)
+      sb_appendf(&phony_rules, "%s:\n", depfile_escape_temp(*it));
+  }
+
+  sb_append_buf(&out, content.items + end, content.count - end);
+  if (out.count == 0 || out.items[out.count - 1] != '\n')
+    da_append(&out, '\n');
+  sb_append_buf(&out, phony_rules.items, phony_rules.count);
+
+  bool ok = nob_write_entire_file(path, out.items, out.count);
+
+  da_free(seen);
+  sb_free(out);
+  sb_free(phony_rules);
+  sb_free(content);
+  return ok;
+}
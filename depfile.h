@@ -0,0 +1,27 @@
+#ifndef CCOMPTIME_DEPFILE_H
+#define CCOMPTIME_DEPFILE_H
+
+#include "comptime_common.h"
+
+// Path replacement inside a compiler generated depfile, e.g. the generated
+// wrapper source back to the file the user actually compiled.
+typedef struct {
+  const char *from;
+  const char *to;
+} DepfileRename;
+
+typedef struct {
+  DepfileRename *items;
+  size_t count;
+  size_t capacity;
+} DepfileRenames;
+
+// Rewrite the depfile at `path` in place: apply `renames` and add `extra`
+// paths (files read by comptime blocks, generated headers) to the
+// prerequisites of its first rule, listing every file once however it is
+// spelled (relative or absolute). With `phony` (-MP) each added path also
+// gets an empty rule, like the compiler does for headers.
+bool depfile_patch(const char *path, const DepfileRenames *renames,
+                   const Nob_File_Paths *extra, bool phony);
+
+#endif // CCOMPTIME_DEPFILE_H
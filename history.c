@@ -0,0 +1,202 @@
+#include "history.h"
+#include "cache.h"
+#include "stats.h"
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define HISTORY_VERSION "v1"
+#define HISTORY_TOTAL_STAGE "total"
+
+const char *history_path(void) {
+  const char *dir = cache_dir();
+  return dir ? temp_sprintf("%s/history.log", dir) : NULL;
+}
+
+static void append_record(String_Builder *out, long long now,
+                          const char *file, uint64_t hash, size_t hits,
+                          size_t misses, const StatsStages *stages) {
+  sb_appendf(out, HISTORY_VERSION "\t%lld\t%s\t%016" PRIx64 "\t%zu\t%zu\t",
+             now, file, hash, hits, misses);
+  for (size_t i = 0; i < stages->count; i++) {
+    const char *name = stages->items[i].name;
+    // the stage spanning the whole file is named after it
+    if (strcmp(name, file) == 0)
+      name = HISTORY_TOTAL_STAGE;
+    sb_appendf(out, "%s%s=%.3f", i > 0 ? ";" : "", name, stages->items[i].ms);
+  }
+  da_append(out, '\n');
+}
+
+bool history_append(void) {
+  const char *path = history_path();
+  if (!path)
+    return false;
+
+  long long now = (long long)time(NULL);
+  String_Builder out = {0};
+  size_t count;
+  const FileStats *files = stats_files(&count);
+  for (size_t i = 0; i < count; i++) {
+    append_record(&out, now, files[i].file, files[i].source_hash,
+                  files[i].cache_hits, files[i].cache_misses,
+                  &files[i].stages);
+  }
+  append_record(&out, now, "*", 0, 0, 0, stats_global_stages());
+
+  // one write, so records of concurrent builds do not interleave
+  FILE *f = fopen(path, "ab");
+  bool ok = f != NULL;
+  if (ok) {
+    setvbuf(f, NULL, _IOFBF, out.count + 1);
+    ok = fwrite(out.items, 1, out.count, f) == out.count;
+    ok = fclose(f) == 0 && ok;
+  }
+  if (!ok)
+    nob_log(WARNING, "Could not append to build history %s", path);
+  sb_free(out);
+  return ok;
+}
+
+typedef struct {
+  const char *name;
+  struct {
+    double *items;
+    size_t count;
+    size_t capacity;
+  } ms;
+  size_t hits, misses;
+} HistorySeries;
+
+typedef struct {
+  HistorySeries *items;
+  size_t count;
+  size_t capacity;
+} HistorySeriesList;
+
+static HistorySeries *series_get(HistorySeriesList *list, const char *name,
+                                 size_t len) {
+  for (size_t i = 0; i < list->count; i++) {
+    if (strlen(list->items[i].name) == len &&
+        memcmp(list->items[i].name, name, len) == 0)
+      return &list->items[i];
+  }
+  da_append(list, ((HistorySeries){.name = strndup(name, len)}));
+  return &list->items[list->count - 1];
+}
+
+static int compare_double(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// nearest rank, on sorted values
+static double percentile(const HistorySeries *series, double p) {
+  size_t rank = (size_t)(p / 100.0 * series->ms.count + 0.999999);
+  if (rank < 1)
+    rank = 1;
+  if (rank > series->ms.count)
+    rank = series->ms.count;
+  return series->ms.items[rank - 1];
+}
+
+static void print_series(const char *title, HistorySeriesList *list,
+                         bool hit_rate) {
+  printf("\n%-40s %7s %10s %10s %10s%s\n", title, "n", "p50 ms", "p95 ms",
+         "p99 ms", hit_rate ? "   hit rate" : "");
+  for (size_t i = 0; i < list->count; i++) {
+    HistorySeries *series = &list->items[i];
+    if (series->ms.count == 0)
+      continue;
+    qsort(series->ms.items, series->ms.count, sizeof(double), compare_double);
+    printf("%-40s %7zu %10.2f %10.2f %10.2f", series->name, series->ms.count,
+           percentile(series, 50), percentile(series, 95),
+           percentile(series, 99));
+    size_t lookups = series->hits + series->misses;
+    if (hit_rate && lookups > 0)
+      printf(" %10.1f%%", 100.0 * series->hits / lookups);
+    printf("\n");
+  }
+}
+
+int history_main(int argc, char **argv) {
+  long long since = 0;
+  for (int i = 2; i < argc; i++) {
+    if (strncmp(argv[i], "-since=", 7) == 0) {
+      since = (long long)time(NULL) - atoll(argv[i] + 7) * 24 * 60 * 60;
+    } else {
+      fprintf(stderr, "usage: %s stats [-since=DAYS]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  const char *path = history_path();
+  String_Builder log = {0};
+  if (!path || nob_file_exists(path) != 1 ||
+      !nob_read_entire_file(path, &log)) {
+    printf("No build history yet%s%s\n", path ? " in " : "", path ? path : "");
+    return 0;
+  }
+
+  HistorySeriesList stages = {0}, files = {0};
+  size_t builds = 0;
+  long long first = 0, last = 0;
+  String_View rest = sb_to_sv(log);
+  while (rest.count > 0) {
+    String_View line = sv_chop_by_delim(&rest, '\n');
+    String_View fields[7];
+    size_t n = 0;
+    while (n < 6 && line.count > 0) {
+      fields[n++] = sv_chop_by_delim(&line, '\t');
+    }
+    fields[n++] = line; // the stages
+    if (n < 7 || !sv_eq(fields[0], sv_from_cstr(HISTORY_VERSION)))
+      continue; // partial write or another version
+
+    size_t mark = temp_save();
+    long long when = atoll(temp_sv_to_cstr(fields[1]));
+    if (when < since) {
+      temp_rewind(mark);
+      continue;
+    }
+    if (first == 0)
+      first = when;
+    last = when;
+
+    bool invocation = sv_eq(fields[2], sv_from_cstr("*"));
+    builds += invocation;
+    HistorySeries *file = NULL;
+    if (!invocation) {
+      file = series_get(&files, fields[2].data, fields[2].count);
+      file->hits += atoll(temp_sv_to_cstr(fields[4]));
+      file->misses += atoll(temp_sv_to_cstr(fields[5]));
+    }
+
+    String_View list = fields[6];
+    while (list.count > 0) {
+      String_View stage = sv_chop_by_delim(&list, ';');
+      String_View name = sv_chop_by_delim(&stage, '=');
+      double ms = atof(temp_sv_to_cstr(stage));
+      da_append(&series_get(&stages, name.data, name.count)->ms, ms);
+      if (file && sv_eq(name, sv_from_cstr(HISTORY_TOTAL_STAGE)))
+        da_append(&file->ms, ms);
+    }
+    temp_rewind(mark);
+  }
+
+  printf("%zu builds", builds);
+  if (first > 0) {
+    char from[32], to[32];
+    time_t t = (time_t)first;
+    strftime(from, sizeof(from), "%Y-%m-%d %H:%M", localtime(&t));
+    t = (time_t)last;
+    strftime(to, sizeof(to), "%Y-%m-%d %H:%M", localtime(&t));
+    printf(" from %s to %s", from, to);
+  }
+  printf(" (%s)\n", path);
+  print_series("stage", &stages, false);
+  print_series("file", &files, true);
+  return 0;
+}
@@ -0,0 +1,22 @@
+#ifndef CCOMPTIME_HISTORY_H
+#define CCOMPTIME_HISTORY_H
+
+#include "comptime_common.h"
+
+// Append-only log of past builds in the cache directory, one tab separated
+// record per input file and invocation:
+//   v1 <unix time> <file> <source hash> <cache hits> <cache misses>
+//   <stage>=<ms>;<stage>=<ms>;...
+// Stages outside of any file (the final compile) are logged as file `*`,
+// which also marks one invocation.
+
+// Path of the log, NULL without a cache directory.
+const char *history_path(void);
+
+// Append the stats collected by this invocation.
+bool history_append(void);
+
+// `ccomptime stats [-since=DAYS]`: percentiles per stage and per file.
+int history_main(int argc, char **argv);
+
+#endif // CCOMPTIME_HISTORY_H
@@ -0,0 +1,64 @@
+#include "intern.h"
+#include "nob.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHUNK_SIZE (64 * 1024)
+
+// Names live in fixed chunks that never move, so the map can borrow them.
+static const char *copy_name(Interner *in, Slice name) {
+  size_t len = (size_t)name.len;
+  if (len > CHUNK_SIZE / 4) {
+    char *own = malloc(len);
+    assert(own);
+    nob_da_append(&in->chunks, own);
+    memcpy(own, name.start, len);
+    return own;
+  }
+  if (in->chunk_left < len) {
+    char *chunk = malloc(CHUNK_SIZE);
+    assert(chunk);
+    nob_da_append(&in->chunks, chunk);
+    in->chunk_left = CHUNK_SIZE;
+  }
+  char *dst = in->chunks.items[in->chunks.count - 1] + CHUNK_SIZE -
+              in->chunk_left;
+  memcpy(dst, name.start, len);
+  in->chunk_left -= len;
+  return dst;
+}
+
+void interner_init(Interner *in) { *in = (Interner){0}; }
+
+void interner_free(Interner *in) {
+  nob_da_foreach(char *, chunk, &in->chunks) { free(*chunk); }
+  free(in->chunks.items);
+  slice_map_free(&in->ids);
+  *in = (Interner){0};
+}
+
+IdentId intern(Interner *in, Slice name) {
+  SliceMapEntry *entry = slice_map_entry(&in->ids, name);
+  if (entry->val)
+    return (IdentId)(uintptr_t)entry->val;
+
+  // re-point the key at our copy, the caller's bytes may go away
+  Slice own = {copy_name(in, name), name.len};
+  IdentId id = ++in->last_id;
+  entry->key = own;
+  entry->val = (void *)(uintptr_t)id;
+  return id;
+}
+
+IdentId interner_find(const Interner *in, Slice name) {
+  return (IdentId)(uintptr_t)slice_map_get(&in->ids, name);
+}
+
+void ident_set_add(IdentSet *set, IdentId id) {
+  size_t word = id / 64;
+  while (set->count <= word)
+    nob_da_append(set, 0);
+  set->items[word] |= (uint64_t)1 << (id % 64);
+}
@@ -0,0 +1,48 @@
+#ifndef CCOMPTIME_INTERN_H
+#define CCOMPTIME_INTERN_H
+
+#include "slice_map.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Per-file identifier interner: every distinct identifier gets a small
+// integer once, so macro lookups and dependency membership become bitset
+// tests. Names are copied, so ids stay valid across the passes that reparse
+// rewritten sources.
+
+typedef uint32_t IdentId;
+
+// 0 is never a valid id.
+#define IDENT_NONE ((IdentId)0)
+
+typedef struct {
+  SliceMap ids;    // name -> id
+  IdentId last_id; // ids are handed out in order from 1
+  struct {
+    char **items;
+    size_t count, capacity;
+  } chunks;
+  size_t chunk_left;
+} Interner;
+
+void interner_init(Interner *in);
+void interner_free(Interner *in);
+IdentId intern(Interner *in, Slice name);
+// IDENT_NONE when `name` was never interned.
+IdentId interner_find(const Interner *in, Slice name);
+
+typedef struct {
+  uint64_t *items;
+  size_t count, capacity;
+} IdentSet;
+
+void ident_set_add(IdentSet *set, IdentId id);
+
+static inline bool ident_set_has(const IdentSet *set, IdentId id) {
+  size_t word = id / 64;
+  return word < set->count && (set->items[word] >> (id % 64) & 1);
+}
+
+#endif // CCOMPTIME_INTERN_H
@@ -1,275 +1,332 @@
 #include "macro_expansion.h"
+#include "stats.h"
 
 #include <assert.h>
+#include <ctype.h>
 #include <stdlib.h>
 #include <string.h>
 
 typedef struct {
-  TSNode node;
-  String_View with;
-} Macro_Replacement;
-
-typedef struct {
-  Macro_Replacement *items;
-  size_t count, capacity;
-} Macro_Replacements;
+  SourceEdits replacements;
+} MacroExpansionCtx;
 
+// An argument of a macro use, bound to a parameter.
 typedef struct {
-  TSNode node;
-  Nob_String_View with;
-} NodeReplacement;
+  String_View raw;      // as written, for `#param`
+  String_View expanded; // with the macro uses in it expanded
+} MacroArg;
 
 typedef struct {
-  NodeReplacement *items;
-  size_t count, capacity;
-} NodeReplacements;
-
+  const MacroDefinition *def;
+  const MacroArg *args; // one per parameter
+} MacroBindings;
+
+// Expands a macro use together with the uses nested in its arguments and its
+// body, in one walk: they are expanded while being substituted. Each
+// (definition, arguments) pair is expanded once; uses that repeat it copy
+// the memoized text.
 typedef struct {
-  NodeReplacements replacements;
-} MacroExpansionCtx;
-
-static void expand_macro_node(TSNode node, const char *src, Strings *arg_names,
-                              Strings *arg_values,
-                              Macro_Replacements *replacements);
+  MacroTable *macros;
+  SliceMap memo; // definition and arguments -> String_View *
+  // being expanded: a macro is not expanded again inside itself
+  struct {
+    const MacroDefinition **items;
+    size_t count, capacity;
+  } active;
+  bool blocked; // an expansion was left out because its macro was active
+  String_Builder key;
+} MacroExpander;
+
+static void expand_node(MacroExpander *ex, TSNode node, const char *src,
+                        const MacroBindings *b, bool expand_uses,
+                        String_Builder *out);
+
+void macros_put(MacroTable *macros, Slice name, MacroDefinition *def) {
+  IdentId id = intern(macros->idents, name);
+  while (macros->count <= id)
+    nob_da_append(macros, NULL);
+  // a redefinition: expansions already copied what they needed of the old one
+  MacroDefinition *old = macros->items[id];
+  if (old && old != def)
+    ts_tree_delete(old->body_tree);
+  macros->items[id] = def;
+}
 
-void macros_put(HashMap *macros, const char *key, int key_len,
-                MacroDefinition *def) {
-  hashmap_put2(macros, (char *)key, key_len, def);
+void macros_free(MacroTable *macros) {
+  for (size_t i = 0; i < macros->count; i++) {
+    if (macros->items[i])
+      ts_tree_delete(macros->items[i]->body_tree);
+  }
+  free(macros->items);
+  macros->items = NULL;
+  macros->count = macros->capacity = 0;
 }
 
-MacroDefinition *macros_get(HashMap *macros, const char *key, int key_len) {
-  return (MacroDefinition *)hashmap_get2(macros, (char *)key, key_len);
+// Identifiers that were never interned cannot name a macro, so lookups do
+// not grow the interner.
+MacroDefinition *macros_get(MacroTable *macros, Slice name) {
+  IdentId id = interner_find(macros->idents, name);
+  return id < macros->count ? macros->items[id] : NULL;
 }
 
-static void expand_macro_tree(MacroDefinition *macro_def, Strings arg_values,
-                              String_Builder *out_sb) {
-  assert(macro_def != NULL);
+static const MacroArg *bound_arg(const MacroBindings *b, Slice name) {
+  if (!b)
+    return NULL;
+  for (size_t i = 0; i < b->def->arg_names.count; i++) {
+    String_View arg_name = b->def->arg_names.items[i];
+    if ((size_t)name.len == arg_name.count &&
+        memcmp(name.start, arg_name.data, arg_name.count) == 0)
+      return &b->args[i];
+  }
+  return NULL;
+}
 
-  nob_log(VERBOSE, "------- Expand macro tree with %zu values & %zu args ---- ",
-          arg_values.count, macro_def->arg_names.count);
+static String_View expand_text(MacroExpander *ex, TSNode node, const char *src,
+                               const MacroBindings *b, bool expand_uses) {
+  if (!b && !expand_uses)
+    return ts_node_to_str_view(node, src);
+  String_Builder text = {0};
+  expand_node(ex, node, src, b, expand_uses, &text);
+  char *copy = arena_alloc(ex->macros->arena, text.count);
+  if (text.count)
+    memcpy(copy, text.items, text.count);
+  free(text.items);
+  return nob_sv_from_parts(copy, text.count);
+}
 
-  for (size_t i = 0; i < macro_def->arg_names.count; i++) {
-    String_View arg_name = macro_def->arg_names.items[i];
-    String_View arg_value = arg_values.items[i];
-    nob_log(VERBOSE, "  Arg %zu: %.*s -> %.*s", i, (int)arg_name.count,
-            arg_name.data, (int)arg_value.count, arg_value.data);
+static bool is_active(const MacroExpander *ex, const MacroDefinition *def) {
+  for (size_t i = 0; i < ex->active.count; i++) {
+    if (ex->active.items[i] == def)
+      return true;
   }
+  return false;
+}
 
-  for (size_t i = 0; i < arg_values.count; i++) {
-    String_View arg_value = arg_values.items[i];
-    nob_log(VERBOSE, "  Value %zu: %.*s", i, (int)arg_value.count,
-            arg_value.data);
+static String_View expand_macro(MacroExpander *ex, const MacroDefinition *def,
+                                const MacroArg *args) {
+  ex->key.count = 0;
+  nob_sb_append_buf(&ex->key, &def, sizeof(def));
+  for (size_t i = 0; i < def->arg_names.count; i++) {
+    nob_sb_append_buf(&ex->key, args[i].raw.data, args[i].raw.count);
+    nob_da_append(&ex->key, '\0');
+    nob_sb_append_buf(&ex->key, args[i].expanded.data,
+                      args[i].expanded.count);
+    nob_da_append(&ex->key, '\0');
   }
-
-  assert(macro_def->arg_names.count == arg_values.count);
-
-  debug_tree(macro_def->body_tree, macro_def->body_src, 4);
-  nob_log(VERBOSE, "^^^^^^^ Expand macro tree with %zu args ^^^^^^^",
-          arg_values.count);
-
-  TSNode root = ts_tree_root_node(macro_def->body_tree);
-  Slice root_range = ts_node_range(root, macro_def->body_src);
-
-  Macro_Replacements replacements = {0};
-
-  expand_macro_node(root, macro_def->body_src, &macro_def->arg_names,
-                    &arg_values, &replacements);
-
-  nob_log(VERBOSE, "========= Macro expansion replacements: %zu",
-          replacements.count);
-
-  assert(root_range.start == macro_def->body_src);
-
-  char *cursor = (char *)macro_def->body_src;
-  // if (replacements.count != arg_values.count) {
-  //   nob_log(ERROR, "Macro expansion failed: %zu replacements != %zu args",
-  //           replacements.count, arg_values.count);
-  // }
-  // assert(replacements.count == arg_values.count);
-
-  nob_da_foreach(Macro_Replacement, it, &replacements) {
-    Slice r = ts_node_range(it->node, macro_def->body_src);
-    assert(r.start >= cursor);
-
-    nob_sb_append_buf(out_sb, cursor, r.start - cursor);
-    nob_sb_append_buf(out_sb, it->with.data, it->with.count);
-    cursor = (char *)r.start + r.len;
+  String_View *memo =
+      slice_map_get(&ex->memo, (Slice){ex->key.items, (int)ex->key.count});
+  if (memo) {
+    STATS_ADD(macro_memo_hits, 1);
+    return *memo;
   }
-
-  nob_sb_append_buf(out_sb, cursor, root_range.start + root_range.len - cursor);
-  nob_log(VERBOSE, ">> Expanded as %.*s", (int)out_sb->count, out_sb->items);
+  // the key buffer is reused by the expansions nested in this one
+  Slice key = {arena_alloc(ex->macros->arena, ex->key.count),
+               (int)ex->key.count};
+  memcpy((char *)key.start, ex->key.items, ex->key.count);
+
+  for (size_t i = 0; i < def->arg_names.count; i++) {
+    nob_log(VERBOSE, "  Arg %zu: %.*s -> %.*s", i,
+            (int)def->arg_names.items[i].count, def->arg_names.items[i].data,
+            (int)args[i].expanded.count, args[i].expanded.data);
+  }
+  debug_tree(def->body_tree, def->body_src, 4);
+
+  bool blocked = ex->blocked;
+  ex->blocked = false;
+  nob_da_append(&ex->active, def);
+  String_View *result = arena_alloc(ex->macros->arena, sizeof(*result));
+  *result = expand_text(ex, ts_tree_root_node(def->body_tree), def->body_src,
+                        &(MacroBindings){def, args}, true);
+  ex->active.count--;
+  // what a guard left out depends on where the use is, so it is not reused
+  if (!ex->blocked)
+    slice_map_put(&ex->memo, key, result);
+  ex->blocked = ex->blocked || blocked;
+
+  nob_log(VERBOSE, ">> Expanded as %.*s", (int)result->count, result->data);
+  return *result;
 }
 
-static void expand_macro_node(TSNode node, const char *src, Strings *arg_names,
-                              Strings *arg_values,
-                              Macro_Replacements *replacements) {
-
-  assert(arg_names->count == arg_values->count);
-  switch (ts_node_symbol(node)) {
-  case sym_preproc_directive: {
-    for (size_t i = 0; i < arg_names->count; i++) {
-      String_View arg_name = arg_names->items[i];
-
-      Slice node_range = {
-          .start = ts_node_range(node, src).start + 1,
-          .len = ts_node_range(node, src).len - 1,
-      };
+// Expand `node` if it is a use of a comptime macro: a call, or an object-like
+// macro in place of a type.
+static bool try_expand_use(MacroExpander *ex, TSNode node, const char *src,
+                           const MacroBindings *b, String_Builder *out) {
+  TSSymbol sym = ts_node_symbol(node);
+  TSNode name_node = node;
+  if (sym == sym_call_expression) {
+    name_node = ts_node_child(node, 0);
+    if (ts_node_symbol(name_node) != sym_identifier)
+      return false;
+  } else if (sym != alias_sym_type_identifier) {
+    return false;
+  }
 
-      nob_log(VERBOSE, "~> %.*s", node_range.len, node_range.start);
+  Slice name = ts_node_range(name_node, src);
+  if (bound_arg(b, name))
+    return false;
+  MacroDefinition *def = macros_get(ex->macros, name);
+  // like the preprocessor, leave a function-like macro name that is not called
+  if (!def || (def->function_like && sym != sym_call_expression))
+    return false;
+  if (is_active(ex, def)) {
+    ex->blocked = true;
+    return false;
+  }
+  nob_log(VERBOSE, ORANGE("=> expanding macro def :: %.*s\n"), name.len,
+          name.start);
+
+  MacroArg *args = NULL;
+  size_t count = 0;
+  if (sym == sym_call_expression && def->function_like) {
+    TSNode argument_list = ts_node_child(node, 1);
+    assert(ts_node_symbol(argument_list) == sym_argument_list);
+    // at most one value per child, punctuation included
+    uint32_t child_count = ts_node_child_count(argument_list);
+    size_t given = 0;
+    for (uint32_t i = 0; i < child_count; i++) {
+      TSSymbol arg_sym = ts_node_symbol(ts_node_child(argument_list, i));
+      if (arg_sym != anon_sym_LPAREN && arg_sym != anon_sym_COMMA &&
+          arg_sym != anon_sym_RPAREN)
+        given++;
+    }
+    // left for the compiler to report along with the line it is on
+    if (given != def->arg_names.count) {
+      nob_log(ERROR, "macro '%.*s' called with %zu arguments, expected %zu",
+              name.len, name.start, given, def->arg_names.count);
+      return false;
+    }
 
-      if ((size_t)node_range.len != arg_name.count)
+    args = arena_alloc(ex->macros->arena, given * sizeof(*args));
+    for (uint32_t i = 0; i < child_count; i++) {
+      TSNode arg = ts_node_child(argument_list, i);
+      TSSymbol arg_sym = ts_node_symbol(arg);
+      if (arg_sym == anon_sym_LPAREN || arg_sym == anon_sym_COMMA ||
+          arg_sym == anon_sym_RPAREN)
         continue;
-
-      assert(src && "src should be non null");
-
-      if (memcmp(node_range.start, arg_name.data, arg_name.count) == 0) {
-
-        String_View arg_value = arg_values->items[i];
-        String_Builder stringified_value = {0};
-        nob_sb_appendf(&stringified_value, "\"%.*s\"", (int)arg_value.count,
-                       arg_value.data);
-
-        Macro_Replacement repl = {.node = node,
-                                  .with =
-                                      sv_from_parts(stringified_value.items,
-                                                    stringified_value.count)};
-        nob_da_append(replacements, repl);
-      }
+      args[count++] = (MacroArg){
+          .raw = expand_text(ex, arg, src, b, false),
+          .expanded = expand_text(ex, arg, src, b, true),
+      };
     }
-    break;
   }
-  case sym_identifier: {
-
-    for (size_t i = 0; i < arg_names->count; i++) {
-      String_View arg_name = arg_names->items[i];
 
-      if ((size_t)ts_node_range(node, src).len != arg_name.count)
-        continue;
-
-      assert(src && "src should be non null");
-
-      if (memcmp(ts_node_range(node, src).start, arg_name.data,
-                 arg_name.count) == 0) {
+  String_View expansion = expand_macro(ex, def, args);
+  nob_sb_append_buf(out, expansion.data, expansion.count);
+  return true;
+}
 
-        String_View arg_value = arg_values->items[i];
-        Macro_Replacement repl = {.node = node, .with = arg_value};
-        nob_da_append(replacements, repl);
-      }
-    }
-    break;
+// Append the text of `node` with the parameters bound by `b` substituted
+// and, with `expand_uses`, the macro uses in it expanded.
+static void expand_node(MacroExpander *ex, TSNode node, const char *src,
+                        const MacroBindings *b, bool expand_uses,
+                        String_Builder *out) {
+  Slice range = ts_node_range(node, src);
+  TSSymbol sym = ts_node_symbol(node);
+  const MacroArg *arg;
+  if (sym == sym_identifier && (arg = bound_arg(b, range))) {
+    nob_sb_append_buf(out, arg->expanded.data, arg->expanded.count);
+    return;
   }
-  default:
-    break;
+  if (sym == sym_preproc_directive &&
+      (arg = bound_arg(b, (Slice){range.start + 1, range.len - 1}))) {
+    nob_sb_appendf(out, "\"%.*s\"", (int)arg->raw.count, arg->raw.data);
+    return;
   }
+  if (expand_uses && try_expand_use(ex, node, src, b, out))
+    return;
 
+  const char *cursor = range.start;
   uint32_t n = ts_node_child_count(node);
   for (uint32_t i = 0; i < n; i++) {
-    expand_macro_node(ts_node_child(node, i), src, arg_names, arg_values,
-                      replacements);
+    TSNode child = ts_node_child(node, i);
+    Slice child_range = ts_node_range(child, src);
+    if (child_range.start > cursor)
+      nob_sb_append_buf(out, cursor, (size_t)(child_range.start - cursor));
+    expand_node(ex, child, src, b, expand_uses, out);
+    cursor = child_range.start + child_range.len;
   }
+  if (range.start + range.len > cursor)
+    nob_sb_append_buf(out, cursor, (size_t)(range.start + range.len - cursor));
 }
 
-static bool node_has_comptime_identifier(TSNode node, const char *src) {
-  if (ts_node_symbol(node) == sym_identifier) {
+// A use of another comptime macro counts too: it is expanded along with the
+// body.
+static bool node_has_comptime_identifier(MacroTable *macros, TSNode node,
+                                         const char *src) {
+  TSSymbol sym = ts_node_symbol(node);
+  if (sym == sym_identifier || sym == alias_sym_type_identifier) {
     return ts_node_is_comptime_kw(node, src) ||
-           ts_node_is_comptimetype_kw(node, src);
+           ts_node_is_comptimetype_kw(node, src) ||
+           macros_get(macros, ts_node_range(node, src));
   }
 
   uint32_t n = ts_node_child_count(node);
   for (uint32_t i = 0; i < n; i++) {
-    if (node_has_comptime_identifier(ts_node_child(node, i), src)) {
+    if (node_has_comptime_identifier(macros, ts_node_child(node, i), src)) {
       return true;
     }
   }
   return false;
 }
 
-static bool has_comptime_identifier(TSTree *tree, const char *src) {
+static bool has_comptime_identifier(MacroTable *macros, TSTree *tree,
+                                    const char *src) {
   assert(tree != NULL);
-  return node_has_comptime_identifier(ts_tree_root_node(tree), src);
+  return node_has_comptime_identifier(macros, ts_tree_root_node(tree), src);
 }
 
-static int try_expand_macro_call_expression(TSNode node,
-                                            MacroDefinitionHashMap *macros,
-                                            const char *src,
-                                            String_Builder *expanded) {
-  assert(ts_node_symbol(node) == sym_call_expression);
-
-  TSNode identifier = ts_node_child(node, 0);
-  if (ts_node_symbol(identifier) != sym_identifier)
-    return 0;
-
-  Slice id_range = ts_node_range(identifier, src);
-
-  MacroDefinition *macro_def = macros_get(macros, id_range.start, id_range.len);
-  if (!macro_def)
-    return 0;
-
-  TSNode argument_list = ts_node_child(node, 1);
-  assert(ts_node_symbol(argument_list) == sym_argument_list);
-
-  nob_log(VERBOSE, ORANGE("=> expanding macro def :: %.*s\n"),
-          ts_node_range(macro_def->identifier, src).len,
-          ts_node_range(macro_def->identifier, src).start);
-
-  if (macro_def->arg_names.count > 0) {
-    Strings arg_values = strings_new(ts_node_child_count(argument_list));
-
-    for (uint32_t i = 0; i < ts_node_child_count(argument_list); i++) {
-      TSNode arg = ts_node_child(argument_list, i);
-      TSSymbol arg_sym = ts_node_symbol(arg);
-
-      if (arg_sym == anon_sym_LPAREN || arg_sym == anon_sym_COMMA ||
-          arg_sym == anon_sym_RPAREN) {
-        continue;
-      }
-
-      strings_append(&arg_values, ts_node_to_str_view(arg, src));
+static bool mentions_macro(MacroTable *macros, Slice s) {
+  const char *p = s.start, *end = s.start + s.len;
+  while (p < end) {
+    if (!isalpha((unsigned char)*p) && *p != '_') {
+      p++;
+      continue;
     }
-    expand_macro_tree(macro_def, arg_values, expanded);
-  } else {
-    nob_log(VERBOSE, "  [MACRO CALL: %.*s]", id_range.len, id_range.start);
-    expand_macro_tree(macro_def, (Strings){0}, expanded);
+    const char *ident = p;
+    while (p < end && (isalnum((unsigned char)*p) || *p == '_'))
+      p++;
+    if (macros_get(macros, (Slice){.start = ident, .len = (int)(p - ident)}))
+      return true;
   }
-
-  nob_log(VERBOSE, "Macro expansion result: %.*s", (int)expanded->count,
-          expanded->items);
-
-  return 1;
+  return false;
 }
 
-static int try_expand_type_identifier_expression(TSNode node,
-                                                 MacroDefinitionHashMap *macros,
-                                                 const char *src,
-                                                 String_Builder *expanded) {
-
-  assert(ts_node_symbol(node) == alias_sym_type_identifier);
-  Slice id_range = ts_node_range(node, src);
-  MacroDefinition *macro_def = macros_get(macros, id_range.start, id_range.len);
-  if (!macro_def)
-    return 0;
-
-  expand_macro_tree(macro_def, (Strings){0}, expanded);
+static void log_irrelevant_macro(Slice name) {
+  nob_log(VERBOSE,
+          RED("'%.*s' macro has been proven irrelevant because it does not "
+              "contain the `_Comptime` keyword"),
+          name.len, name.start);
+}
 
-  return 1;
+// Byte-level prefilter, so most bodies are never parsed: a relevant one
+// mentions `_Comptime` (which `_ComptimeType` starts with too) or a comptime
+// macro, or redefines one. Mentions in literals, comments and longer names get
+// past it and are weeded out once parsed.
+static bool macro_may_be_relevant(MacroTable *macros, TSNode macro_identifier,
+                                  TSNode macro_body, const char *src) {
+  Slice name = ts_node_range(macro_identifier, src);
+  Slice body = ts_node_range(macro_body, src);
+  if (slice_contains(body, "_Comptime") || macros_get(macros, name) ||
+      mentions_macro(macros, body))
+    return true;
+  log_irrelevant_macro(name);
+  return false;
 }
 
 static bool put_macro_def_if_comptime_relevant(
-    TSParser *parser, MacroDefinitionHashMap *const macros,
+    TSParser *parser, MacroTable *const macros,
     TSNode macro_identifier, TSNode macro_body, MacroDefinition *macro_def,
     const char *src) {
+  STATS_ADD(macro_bodies_parsed, 1);
   Slice macro_body_range = ts_node_range(macro_body, src);
   TSTree *tree = ts_parser_parse_string(parser, NULL, macro_body_range.start,
                                         (uint32_t)macro_body_range.len);
 
   Slice macro_identifier_range = ts_node_range(macro_identifier, src);
-  if (!has_comptime_identifier(tree, ts_node_range(macro_body, src).start) &&
-      !hashmap_get2(macros, (char *)ts_node_range(macro_identifier, src).start,
-                    ts_node_range(macro_identifier, src).len)) {
-    nob_log(VERBOSE,
-            RED("'%.*s' macro has been proven irrelevant because it does not "
-                "contain the `_Comptime` keyword"),
-            macro_identifier_range.len, macro_identifier_range.start);
+  if (!has_comptime_identifier(macros, tree,
+                               ts_node_range(macro_body, src).start) &&
+      !macros_get(macros, macro_identifier_range)) {
+    log_irrelevant_macro(macro_identifier_range);
     ts_tree_delete(tree);
     return false;
   } else {
@@ -279,19 +336,18 @@ static bool put_macro_def_if_comptime_relevant(
             macro_identifier_range.len, macro_identifier_range.start);
   }
   if (!macro_def)
-    macro_def = calloc(1, sizeof(MacroDefinition));
+    macro_def = arena_calloc(macros->arena, 1, sizeof(MacroDefinition));
 
   macro_def->identifier = macro_identifier;
   macro_def->body_tree = tree;
   macro_def->body_src = ts_node_range(macro_body, src).start;
 
-  macros_put(macros, ts_node_range(macro_def->identifier, src).start,
-             ts_node_range(macro_def->identifier, src).len, macro_def);
+  macros_put(macros, macro_identifier_range, macro_def);
   return true;
 }
 
 static bool parse_preproc_def(TSParser *parser,
-                              MacroDefinitionHashMap *const macros, TSNode node,
+                              MacroTable *const macros, TSNode node,
                               const char *src) {
   assert(ts_node_symbol(node) == sym_preproc_def);
 
@@ -305,12 +361,14 @@ static bool parse_preproc_def(TSParser *parser,
     return false;
 
   assert(ts_node_symbol(body) == sym_preproc_arg);
+  if (!macro_may_be_relevant(macros, macro_identifier, body, src))
+    return false;
   return put_macro_def_if_comptime_relevant(parser, macros, macro_identifier,
                                             body, NULL, src);
 }
 
 static bool parse_preproc_function_def(TSParser *parser,
-                                       MacroDefinitionHashMap *const macros,
+                                       MacroTable *const macros,
                                        TSNode node, const char *src) {
   assert(ts_node_symbol(node) == sym_preproc_function_def);
 
@@ -325,8 +383,18 @@ static bool parse_preproc_function_def(TSParser *parser,
 
   assert(ts_node_symbol(preproc_params) == sym_preproc_params);
 
-  MacroDefinition *macro = calloc(1, sizeof(MacroDefinition));
+  TSNode body = ts_node_child(node, 3);
+  assert(ts_node_symbol(body) == sym_preproc_arg);
+  if (!macro_may_be_relevant(macros, macro_identifier, body, src))
+    return false;
+
+  MacroDefinition *macro =
+      arena_calloc(macros->arena, 1, sizeof(MacroDefinition));
   uint32_t param_count = ts_node_child_count(preproc_params);
+  macro->arg_names.items =
+      arena_alloc(macros->arena, param_count * sizeof(String_View));
+  macro->arg_names.capacity = param_count;
+  macro->function_like = true;
   for (uint32_t i = 0; i < param_count; i++) {
     TSNode param = ts_node_child(preproc_params, i);
     if (ts_node_symbol(param) != sym_identifier)
@@ -336,126 +404,101 @@ static bool parse_preproc_function_def(TSParser *parser,
     uint32_t end = ts_node_end_byte(param);
     nob_log(VERBOSE, "Param %u: %.*s", i, (int)(end - start), src + start);
 
-    nob_da_append(&macro->arg_names, ts_node_to_str_view(param, src));
+    macro->arg_names.items[macro->arg_names.count++] =
+        ts_node_to_str_view(param, src);
   }
   nob_log(VERBOSE, "got in total of %zu args\n", macro->arg_names.count);
 
-  TSNode body = ts_node_child(node, 3);
-  assert(ts_node_symbol(body) == sym_preproc_arg);
-
   return put_macro_def_if_comptime_relevant(parser, macros, macro_identifier,
                                             body, macro, src);
 }
 
-static TSTree *apply_node_replacements_to_tree(
-    TSParser *parser, NodeReplacements *replacements, TSTree *tree,
-    const char *tree_src, size_t tree_src_len, String_Builder *out_source) {
-  char *cursor = (char *)tree_src;
-
-  if (replacements->count == 0) {
-    nob_log(WARNING, YELLOW("No replacements performed for tree"));
-    out_source->items = (char *)tree_src;
-    out_source->count = tree_src_len;
-    return tree;
-  }
-
-  nob_da_foreach(NodeReplacement, repl, replacements) {
-    TSNode node = repl->node;
-    Nob_String_View with = repl->with;
-
-    Slice r = ts_node_range(node, tree_src);
-
-    assert(cursor <= r.start && "cursor is ahead of slice");
-
-    ssize_t offset = r.start - cursor;
-
-    if (offset) {
-      nob_sb_append_buf(out_source, cursor, offset);
-    }
-    if (with.count) {
-      nob_sb_append_buf(out_source, with.data, with.count);
-    }
-
-    cursor = (char *)r.start + r.len;
-  }
-  ssize_t _offset = tree_src + tree_src_len - cursor;
-  assert(_offset >= 0);
-  nob_sb_append_buf(out_source, cursor, _offset);
-
-  ts_tree_delete(tree);
-
-  const char *tree_source = out_source->items;
-  TSTree *clean_tree =
-      ts_parser_parse_string(parser, NULL, tree_source, out_source->count);
-
-  return clean_tree;
-}
-
-static void on_macro_expansion_cb(TSNode node, String_Builder *expanded,
+static void on_macro_expansion_cb(Slice range, String_Builder *expanded,
                                   void *ctx) {
   MacroExpansionCtx *macro_ctx = ctx;
 
   nob_da_append(&macro_ctx->replacements,
-                ((NodeReplacement){.node = node,
-                                   .with = nob_sv_from_parts(
-                                       expanded->items, expanded->count)}));
+                ((SourceEdit){.range = range,
+                              .with = nob_sv_from_parts(expanded->items,
+                                                        expanded->count)}));
 
   nob_log(VERBOSE, "Macro was expanded to %.*s", (int)expanded->count,
           expanded->items);
 }
 
 static void expand_macros_tree_node(
-    TSParser *parser, TSNode node, MacroDefinitionHashMap *macros,
-    const char *src,
-    void (*on_macro_expansion)(TSNode node, String_Builder *expanded,
+    TSParser *parser, TSNode node, MacroExpander *ex, const char *src,
+    void (*on_macro_expansion)(Slice range, String_Builder *expanded,
                                void *ctx),
     void *on_macro_expansion_ctx) {
+  STATS_VISIT(StatsPass_ExpandMacros);
 
   TSSymbol sym = ts_node_symbol(node);
 
   if (sym == sym_preproc_function_def) {
-    bool success = parse_preproc_function_def(parser, macros, node, src);
+    STATS_ADD(macros_parsed, 1);
+    bool success = parse_preproc_function_def(parser, ex->macros, node, src);
     nob_log(VERBOSE, "Parsed preproc function def: %d", success);
+    // a definition can change what any expansion comes to
+    if (success)
+      slice_map_clear(&ex->memo);
     return;
   }
 
   if (sym == sym_preproc_def) {
-    bool success = parse_preproc_def(parser, macros, node, src);
+    STATS_ADD(macros_parsed, 1);
+    bool success = parse_preproc_def(parser, ex->macros, node, src);
     nob_log(VERBOSE, "Parsed preproc def: %d", success);
+    if (success)
+      slice_map_clear(&ex->memo);
     return;
   }
 
+  // the uses nested in an expanded one are part of its expansion
   String_Builder expanded = {0};
-  int result = 0;
-  if (sym == sym_call_expression) {
-    result = try_expand_macro_call_expression(node, macros, src, &expanded);
-
-  } else if (sym == alias_sym_type_identifier) {
-    result =
-        try_expand_type_identifier_expression(node, macros, src, &expanded);
-  }
-
-  if (result) {
-    on_macro_expansion(node, &expanded, on_macro_expansion_ctx);
+  if (try_expand_use(ex, node, src, NULL, &expanded)) {
+    STATS_ADD(macros_expanded, 1);
+    on_macro_expansion(ts_node_range(node, src), &expanded,
+                       on_macro_expansion_ctx);
     nob_log(VERBOSE, MAGENTA("%.*s -> %.*s"), (int)ts_node_range(node, src).len,
             ts_node_range(node, src).start, (int)expanded.count,
             expanded.items);
+    return;
   }
 
   uint32_t n = ts_node_child_count(node);
   for (uint32_t i = 0; i < n; i++) {
-    expand_macros_tree_node(parser, ts_node_child(node, i), macros, src,
+    expand_macros_tree_node(parser, ts_node_child(node, i), ex, src,
                             on_macro_expansion, on_macro_expansion_ctx);
   }
 }
 
-TSTree *cct_expand_macros(TSParser *parser, TSTree *tree,
-                          MacroDefinitionHashMap *macros, const char *tree_src,
-                          size_t tree_len, String_Builder *out_source) {
-
+// Macros are only kept when their body uses `_Comptime`, so a chunk without
+// it has nothing to define, and nothing to expand before one is defined.
+void cct_expand_macros(TSParser *parser, Chunks *chunks, MacroTable *macros,
+                       const char *src, size_t len,
+                       String_Builder *out_source) {
   MacroExpansionCtx ctx = {.replacements = {0}};
-  expand_macros_tree_node(parser, ts_tree_root_node(tree), macros, tree_src,
-                          on_macro_expansion_cb, &ctx);
-  return apply_node_replacements_to_tree(parser, &ctx.replacements, tree,
-                                         tree_src, tree_len, out_source);
+  MacroExpander ex = {.macros = macros};
+  nob_da_foreach(Chunk, chunk, chunks) {
+    if (macros->count == 0 && !chunk_mentions(chunk, src, "_Comptime", 9)) {
+      STATS_ADD(chunks_skipped, 1);
+      continue;
+    }
+    expand_macros_tree_node(parser, ts_tree_root_node(chunk->tree), &ex,
+                            src + chunk->offset, on_macro_expansion_cb, &ctx);
+  }
+  slice_map_free(&ex.memo);
+  free(ex.active.items);
+  free(ex.key.items);
+
+  if (ctx.replacements.count == 0)
+    nob_log(WARNING, YELLOW("No replacements performed for tree"));
+  chunks_apply_edits(parser, chunks, src, len, &ctx.replacements, out_source);
+
+  // the expansions are copied into out_source by now
+  nob_da_foreach(SourceEdit, repl, &ctx.replacements) {
+    free((char *)repl->with.data);
+  }
+  free(ctx.replacements.items);
 }
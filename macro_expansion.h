@@ -3,8 +3,13 @@
 
 #include "comptime_common.h"
 
-TSTree *cct_expand_macros(TSParser *parser, TSTree *tree,
-                          MacroDefinitionHashMap *macros, const char *tree_src,
-                          size_t tree_len, String_Builder *out_source);
+// Expand the comptime macros of every chunk; the chunks end up in
+// `out_source`, which borrows `src` when nothing was expanded.
+void cct_expand_macros(TSParser *parser, Chunks *chunks, MacroTable *macros,
+                       const char *src, size_t len,
+                       String_Builder *out_source);
+
+// Delete the body trees; the definitions themselves live in the arena.
+void macros_free(MacroTable *macros);
 
 #endif // CCOMPTIME_MACRO_EXPANSION_H
@@ -2,9 +2,20 @@
 #include "nob.h"
 #undef NOB_IMPLEMENTATION
 
+#include "arena.h"
+#include "cache.h"
 #include "comptime_common.h"
+#include "depfile.h"
+#include "history.h"
 #include "macro_expansion.h"
+#include "mapped_file.h"
+#include "profile.h"
+#include "queries.h"
+#include "runner_units.h"
+#include "stats.h"
+#include "trace.h"
 #include "tree_passes.h"
+#include "tree_shaking.h"
 
 #include "cli.c"
 
@@ -12,35 +23,21 @@
 #include "tree_sitter_c_api.h"
 
 #include <assert.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 extern const TSLanguage *tree_sitter_c(void);
 
 static int comptimetype_placeholder_for_stmt(const WalkContext *ctx,
                                              size_t stmt_index) {
-  for (size_t i = 0; i < ctx->comptimetype_stmt_indices.count; i++) {
-    if (ctx->comptimetype_stmt_indices.items[i] == (int)stmt_index) {
-      return (int)i;
-    }
-  }
-  return -1;
-}
-
-static int compare_slice_start(const void *lhs, const void *rhs) {
-  const Slice *a = lhs;
-  const Slice *b = rhs;
-  if (a->start < b->start)
-    return -1;
-  if (a->start > b->start)
-    return 1;
-  if (a->len < b->len)
-    return -1;
-  if (a->len > b->len)
-    return 1;
-  return 0;
+  assert(stmt_index < ctx->comptime_stmt_placeholder.count);
+  return ctx->comptime_stmt_placeholder.items[stmt_index];
 }
 
 static void build_runner_snippets(WalkContext *ctx,
@@ -51,6 +48,9 @@ static void build_runner_snippets(WalkContext *ctx,
   for (size_t i = 0; i < ctx->comptime_stmts.count; i++) {
     Slice stmt = ctx->comptime_stmts.items[i];
     int placeholder_index = comptimetype_placeholder_for_stmt(ctx, i);
+    int group = i < ctx->comptime_stmt_group.count
+                    ? ctx->comptime_stmt_group.items[i]
+                    : -1;
 
     nob_sb_appendf(runner_definitions, "\n__Comptime_Statement_Fn(%d, %.*s)\n",
                    comptime_count, stmt.len, stmt.start);
@@ -58,14 +58,14 @@ static void build_runner_snippets(WalkContext *ctx,
     if (placeholder_index >= 0) {
       nob_sb_appendf(
           runner_main,
-          "__Comptime_Register_Type_Exec(%d, %d); // execute comptime "
+          "__Comptime_Register_Type_Exec(%d, %d, %d); // execute comptime "
           "statement #%d\n",
-          comptime_count, placeholder_index, comptime_count);
+          comptime_count, placeholder_index, group, comptime_count);
     } else {
       nob_sb_appendf(runner_main,
-                     "__Comptime_Register_Main_Exec(%d); // execute comptime "
-                     "statement #%d\n",
-                     comptime_count, comptime_count);
+                     "__Comptime_Register_Main_Exec(%d, %d); // execute "
+                     "comptime statement #%d\n",
+                     comptime_count, group, comptime_count);
     }
 
     comptime_count++;
@@ -76,7 +76,10 @@ static void build_runner_snippets(WalkContext *ctx,
 
 static void build_compile_base_command(Nob_Cmd *out, CliArgs *parsed_argv) {
   nob_cmd_append(out, Parsed_Argv_compiler_name(parsed_argv));
-  cmd_append_arg_indeces(parsed_argv, &parsed_argv->flags, out);
+  cmd_append_runner_flags(parsed_argv, out);
+#ifndef _WIN32
+  nob_cmd_append(out, "-pthread");
+#endif
 
   if (!(parsed_argv->cct_flags & CliComptimeFlag_Debug)) {
     nob_cmd_append(out, "-w");
@@ -86,45 +89,31 @@ static void build_compile_base_command(Nob_Cmd *out, CliArgs *parsed_argv) {
   }
 }
 
-static void build_comptime_safe_source(WalkContext *ctx,
-                                       const char *processed_source, size_t len,
-                                       String_Builder *out) {
-  const char *cursor = processed_source;
-
-  const char *DEF = "\n#define _COMPILING\n";
-  nob_sb_append_buf(out, DEF, strlen(DEF));
-
-  if (ctx->to_be_removed.count > 0) {
-    qsort(ctx->to_be_removed.items, ctx->to_be_removed.count, sizeof(Slice),
-          compare_slice_start);
-
-    nob_da_foreach(Slice, it, &ctx->to_be_removed) {
-      if (cursor > it->start)
-        continue;
-
-      assert(cursor < it->start && "cursor is ahead of comptime slice");
-
-      ssize_t offset = it->start - cursor;
-      assert(offset >= 0);
-
-      if (offset > 0) {
-        nob_sb_append_buf(out, cursor, (size_t)offset);
-      }
-
-      cursor = it->start + it->len;
-    }
-  }
-
-  ssize_t tail = processed_source + len - cursor;
-  assert(tail >= 0);
-  nob_sb_append_buf(out, cursor, (size_t)tail);
+// The runtime records the files and environment variables the blocks read
+// (and the calls it cannot track) by wrapping the libc functions at link
+// time, which needs a linker that supports `--wrap`.
+#if defined(_WIN32) || defined(__APPLE__)
+#define RUNNER_RECORDS_READS 0
+#else
+#define RUNNER_RECORDS_READS 1
+#endif
+
+static void cmd_append_runner_link_flags(Nob_Cmd *out) {
+#if RUNNER_RECORDS_READS
+  nob_cmd_append(out, "-Wl,--wrap=fopen,--wrap=freopen,--wrap=open",
+                 "-Wl,--wrap=getenv,--wrap=time,--wrap=popen,--wrap=system,"
+                 "--wrap=opendir");
+#ifdef __GLIBC__
+  nob_cmd_append(out, "-Wl,--wrap=fopen64,--wrap=freopen64,--wrap=open64");
+#endif
+#else
+  (void)out;
+#endif
 }
 
-static void build_header_prelude(WalkContext *ctx) {
-  sb_appendf(&ctx->out_h, "/*// @generated - ccomptime™ v0.0.1 - %lu \\*/\n",
-             time(NULL));
+static void build_header_prelude(String_Builder *out) {
   sb_appendf(
-      &ctx->out_h,
+      out,
       "#pragma once\n"
       "#ifdef _Comptime\n"
       "#undef _Comptime\n"
@@ -140,107 +129,828 @@ static void build_header_prelude(WalkContext *ctx) {
       "#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, "
       "n)(__VA_ARGS__)\n"
       "#endif\n");
-  sb_appendf(&ctx->out_h, "/* ---- */// the end. ///* ---- */\n");
+  sb_appendf(out, "/* ---- */// the end. ///* ---- */\n");
 }
 
-static void write_final_wrapper(const Context *ctx) {
-  String_Builder final_source = {0};
-  const char *header_basename = path_basename(ctx->gen_header_path);
-  const char *input_basename = path_basename(ctx->input_path);
+typedef struct {
+  String_Builder *program;
+  String_Builder *interface;
+  String_Builder *definitions;
+  String_Builder *main;
+} RunnerSources;
+
+#ifdef _WIN32
+#define RUNNER_EXE_SUFFIX ".exe"
+#else
+#define RUNNER_EXE_SUFFIX ""
+#endif
+
+static const char *runner_template_path(void) {
+  return nob_temp_sprintf(
+      "%s/runner.templ.c",
+      nob_temp_dir_name(nob_temp_running_executable_path()));
+}
 
-  sb_appendf(&final_source, "#include \"%s\"\n", header_basename);
-  sb_appendf(&final_source, "#include \"%s\"\n", input_basename);
+static bool runner_cache_enabled(const Context *ctx) {
+  return !(ctx->parsed_argv->cct_flags & CliComptimeFlag_NoCache) &&
+         cache_dir() != NULL;
+}
 
-  nob_write_entire_file(ctx->final_out_path, final_source.items,
-                        final_source.count);
+// Compile one unit of runner.templ.c into an object file. With the cache
+// enabled the object is looked up by `key` and only rebuilt when it is
+// missing or one of the headers it was built from changed.
+static const char *compile_runner_unit(Context *ctx, const Nob_Cmd *base,
+                                       CacheKey key, const char *unit,
+                                       const Nob_Cmd *defines,
+                                       const char *errors_path) {
+  key = cache_key_cstr(key, unit);
+  bool cached = runner_cache_enabled(ctx);
+
+  const char *object_path =
+      cached ? cache_entry_path(key, ".o")
+             : nob_temp_sprintf("%sc-runner-%s.o", ctx->input_path, unit);
+  const char *manifest_path = nob_temp_sprintf("%s.deps", object_path);
+
+  if (cached && nob_file_exists(object_path) == 1 &&
+      cache_manifest_valid(manifest_path)) {
+    nob_log(INFO, "Runner %s unit: cache hit %s", unit, object_path);
+    STATS_ADD(cache_hits, 1);
+    return object_path;
+  }
+  if (cached)
+    STATS_ADD(cache_misses, 1);
+
+  const char *out_path = cached ? cache_temp_path(object_path) : object_path;
+  const char *depfile_path = nob_temp_sprintf("%s.d", out_path);
+
+  Nob_Cmd cmd = {0};
+  nob_da_append_many(&cmd, base->items, base->count);
+  nob_cmd_append(&cmd, "-c", runner_template_path(),
+                 nob_temp_sprintf("-D_COMPTIME_UNIT_%s", unit));
+  nob_da_append_many(&cmd, defines->items, defines->count);
+  nob_cmd_append(&cmd, "-o", out_path);
+  if (cached)
+    nob_cmd_append(&cmd, "-MD", "-MF", depfile_path); // system headers too
+
+  trace_begin(nob_temp_sprintf("compile %s unit", unit));
+  bool ok = nob_cmd_run(&cmd, .stderr_path = errors_path);
+  trace_end();
+  nob_cmd_free(cmd);
+  if (!ok)
+    return NULL;
+
+  if (cached) {
+    // the generated sources are covered by `key` already, and of the
+    // generated header the runner only sees the prelude
+    Nob_File_Paths generated = {0};
+    nob_da_append(&generated, ctx->comptime_safe_path);
+    nob_da_append(&generated, ctx->runner_iface_path);
+    nob_da_append(&generated, ctx->runner_defs_path);
+    nob_da_append(&generated, ctx->runner_main_path);
+    nob_da_append(&generated, ctx->gen_header_path);
+
+    const char *manifest_temp = cache_temp_path(manifest_path);
+    if (cache_manifest_from_depfile(depfile_path, manifest_temp,
+                                    &generated))
+      cache_publish(manifest_temp, manifest_path);
+    nob_delete_file(depfile_path);
+    da_free(generated);
+    if (!cache_publish(out_path, object_path))
+      return NULL;
+  }
 
-  sb_free(final_source);
+  nob_log(INFO, "Runner %s unit: compiled %s", unit, object_path);
+  return object_path;
 }
 
-static void run_file(Context *ctx) {
-  size_t mark = nob_temp_save();
+static void build_runner_monolithic(Context *ctx, const Nob_Cmd *base) {
+  Nob_Cmd cmd = {0};
+  nob_da_append_many(&cmd, base->items, base->count);
+  nob_cmd_append(&cmd, runner_template_path(), "-o", ctx->runner_exepath);
+  cmd_append_runner_link_flags(&cmd);
+  const char *program_path =
+      ctx->program_shaken ? ctx->comptime_full_path : ctx->comptime_safe_path;
+  nob_cmd_append(
+      &cmd, temp_sprintf("-D_INPUT_PROGRAM_PATH=\"%s\"", program_path),
+      temp_sprintf("-D_INPUT_COMPTIME_DEFS_PATH=\"%s\"", ctx->runner_defs_path),
+      temp_sprintf("-D_INPUT_COMPTIME_MAIN_PATH=\"%s\"",
+                   ctx->runner_main_path));
 
-  TSParser *parser = ts_parser_new();
-  ts_parser_set_language(parser, tree_sitter_c());
+  trace_begin("compile runner");
+  if (!nob_cmd_run(&cmd))
+    fatal("Failed to compile comptime runner");
+  trace_end();
+}
 
-  TSTree *raw_tree = ts_parser_parse_string(
-      parser, NULL, ctx->raw_source->items, ctx->raw_source->count);
+// The runner is linked from the runtime, the comptime-safe program and the
+// comptime blocks, each compiled (and cached) separately so an edit to one of
+// them does not recompile the others. The linked executable is cached as well,
+// so when none of the sources changed (e.g. only a file read by a block did)
+// we go straight to running it. Should the split build fail (e.g. the
+// declarations-only interface is not enough for some construct, or a block
+// needs something the tree shaking could not see it name) we fall back to
+// compiling the whole, unshaken program as a single translation unit.
+static void build_runner(Context *ctx, RunnerSources *sources) {
+  Nob_Cmd base = {0};
+  build_compile_base_command(&base, ctx->parsed_argv);
+
+  String_Builder template = {0};
+  if (!nob_read_entire_file(runner_template_path(), &template))
+    fatal("Could not read runner template %s", runner_template_path());
+
+  CacheKey base_key = cache_key_compiler(CACHE_KEY_INIT, base.items[0]);
+  nob_da_foreach(const char *, arg, &base) {
+    base_key = cache_key_cstr(base_key, *arg);
+  }
+  base_key = cache_key_bytes(base_key, template.items, template.count);
+  sb_free(template);
 
-  debug_tree(raw_tree, ctx->raw_source->items, 0);
+  CacheKey input_key = cache_key_cstr(base_key, ctx->input_path);
 
-  String_Builder pp_source = {0};
-  MacroDefinitionHashMap macros = {0};
+  // Keyed on tokens, so comments and formatting do not invalidate anything,
+  // and (with tree shaking) edits to code no block can reach do not either.
+  CacheKey program_key = cache_key_tokens(input_key, sources->program->items,
+                                          sources->program->count);
 
-  TSTree *pp_tree =
-      cct_expand_macros(parser, raw_tree, &macros, ctx->raw_source->items,
-                        ctx->raw_source->count, &pp_source);
+  CacheKey blocks_key = cache_key_tokens(input_key, sources->interface->items,
+                                         sources->interface->count);
+  blocks_key = cache_key_tokens(blocks_key, sources->definitions->items,
+                                sources->definitions->count);
+  blocks_key = cache_key_tokens(blocks_key, sources->main->items,
+                                sources->main->count);
 
-  String_Builder processed_source = {0};
-  WalkContext walk_ctx = {0};
-  TSTree *clean_tree = cct_correct_comptimetype_nodes(
-      parser, pp_tree, pp_source.items, pp_source.count, &walk_ctx,
-      &processed_source);
+  const char *errors_path =
+      nob_temp_sprintf("%sc-runner-errors.txt", ctx->input_path);
+
+  Nob_Cmd program_defines = {0};
+  nob_cmd_append(
+      &program_defines,
+      temp_sprintf("-D_INPUT_PROGRAM_PATH=\"%s\"", ctx->comptime_safe_path));
+
+  Nob_Cmd blocks_defines = {0};
+  nob_cmd_append(
+      &blocks_defines,
+      temp_sprintf("-D_INPUT_PROGRAM_INTERFACE_PATH=\"%s\"",
+                   ctx->runner_iface_path),
+      temp_sprintf("-D_INPUT_COMPTIME_DEFS_PATH=\"%s\"", ctx->runner_defs_path),
+      temp_sprintf("-D_INPUT_COMPTIME_MAIN_PATH=\"%s\"",
+                   ctx->runner_main_path));
+
+  bool cached = runner_cache_enabled(ctx);
+  CacheKey exe_key = CACHE_KEY_INIT;
+  const char *exe_path = NULL;
+  const char *exe_manifest_path = NULL;
+  if (cached) {
+    exe_key = cache_key_cstr(input_key, "EXE");
+    exe_key = cache_key_bytes(exe_key, &program_key, sizeof(program_key));
+    exe_key = cache_key_bytes(exe_key, &blocks_key, sizeof(blocks_key));
+    exe_path = cache_entry_path(exe_key, RUNNER_EXE_SUFFIX);
+    exe_manifest_path = nob_temp_sprintf("%s.deps", exe_path);
+
+    if (nob_file_exists(exe_path) == 1 &&
+        cache_manifest_valid(exe_manifest_path)) {
+      nob_log(INFO, "Runner executable: cache hit %s", exe_path);
+      STATS_ADD(cache_hits, 1);
+      ctx->runner_exepath = arena_strdup(ctx->arena, exe_path);
+      ctx->runner_is_cached = true;
+      ctx->runner_key = exe_key;
+      nob_cmd_free(program_defines);
+      nob_cmd_free(blocks_defines);
+      nob_cmd_free(base);
+      return;
+    }
+  }
 
-  cct_collect_comptime_statements(&walk_ctx, clean_tree,
-                                  processed_source.items);
+  if (cached)
+    STATS_ADD(cache_misses, 1);
+
+  Nob_Cmd no_defines = {0};
+  const char *objects[] = {
+      compile_runner_unit(ctx, &base, base_key, "RUNTIME", &no_defines,
+                          errors_path),
+      compile_runner_unit(ctx, &base, program_key, "PROGRAM", &program_defines,
+                          errors_path),
+      compile_runner_unit(ctx, &base, blocks_key, "BLOCKS", &blocks_defines,
+                          errors_path),
+  };
+
+  bool split_ok = objects[0] && objects[1] && objects[2];
+  if (split_ok) {
+    const char *link_path =
+        cached ? cache_temp_path(exe_path) : ctx->runner_exepath;
+
+    Nob_Cmd link = {0};
+    nob_da_append_many(&link, base.items, base.count);
+    nob_da_append_many(&link, objects, NOB_ARRAY_LEN(objects));
+    nob_cmd_append(&link, "-o", link_path);
+    cmd_append_runner_link_flags(&link);
+    trace_begin("link runner");
+    split_ok = nob_cmd_run(&link, .stderr_path = errors_path);
+    trace_end();
+    nob_cmd_free(link);
+
+    if (split_ok && cached) {
+      const char *manifests[NOB_ARRAY_LEN(objects)];
+      for (size_t i = 0; i < NOB_ARRAY_LEN(objects); i++) {
+        manifests[i] = nob_temp_sprintf("%s.deps", objects[i]);
+      }
+      const char *manifest_temp = cache_temp_path(exe_manifest_path);
+      if (cache_manifest_merge(manifests, NOB_ARRAY_LEN(manifests),
+                               manifest_temp) &&
+          cache_publish(manifest_temp, exe_manifest_path) &&
+          cache_publish(link_path, exe_path)) {
+        ctx->runner_exepath = arena_strdup(ctx->arena, exe_path);
+        ctx->runner_is_cached = true;
+        ctx->runner_key = exe_key;
+      } else {
+        split_ok = false;
+      }
+    }
+  }
 
-  String_Builder runner_definitions = {0};
-  String_Builder runner_main = {0};
-  build_runner_snippets(&walk_ctx, &runner_definitions, &runner_main);
+  if (!cached) {
+    for (size_t i = 0; i < NOB_ARRAY_LEN(objects); i++) {
+      if (objects[i])
+        nob_delete_file(objects[i]);
+    }
+  }
 
-  String_Builder comptime_safe_source = {0};
-  build_comptime_safe_source(&walk_ctx, processed_source.items,
-                             processed_source.count, &comptime_safe_source);
+  if (!split_ok) {
+    nob_log(WARNING, "Split runner build failed, retrying as a single "
+                     "translation unit");
+    build_runner_monolithic(ctx, &base);
+  }
+  nob_delete_file(errors_path);
 
-  build_header_prelude(&walk_ctx);
+  nob_cmd_free(program_defines);
+  nob_cmd_free(blocks_defines);
+  nob_cmd_free(base);
+}
 
-  nob_write_entire_file(ctx->comptime_safe_path, comptime_safe_source.items,
-                        comptime_safe_source.count);
+// Read the `<block> <kind> <name>` lines the runner recorded (leaky): the
+// files the blocks read go to `reads`, the environment variables they looked
+// up to `env`, and `untracked` is set when one called something whose result
+// cannot be recorded. `env` and `untracked` may be NULL.
+static bool runner_read_inputs(const char *list_path, Nob_File_Paths *reads,
+                               Nob_File_Paths *env, bool *untracked) {
+  String_Builder list = {0};
+  if (!nob_read_entire_file(list_path, &list))
+    return false;
+  sb_append_null(&list);
+
+  char *line = list.items;
+  while (*line) {
+    char *newline = strchr(line, '\n');
+    if (!newline)
+      break;
+    *newline = '\0';
+
+    char *kind = strchr(line, ' ');
+    if (kind && kind[1] && kind[2] == ' ') {
+      int block_len = (int)(kind - line);
+      const char *name = kind + 3;
+      switch (kind[1]) {
+      case 'r':
+        nob_log(VERBOSE, "Comptime block %.*s reads %s", block_len, line, name);
+        da_append(reads, strdup(name));
+        break;
+      case 'e':
+        nob_log(VERBOSE, "Comptime block %.*s reads environment variable %s",
+                block_len, line, name);
+        if (env)
+          da_append(env, strdup(name));
+        break;
+      case 'x':
+        nob_log(VERBOSE, "Comptime block %.*s calls %s", block_len, line,
+                name);
+        if (untracked)
+          *untracked = true;
+        break;
+      }
+    }
 
-  nob_write_entire_file(ctx->runner_defs_path, runner_definitions.items,
-                        runner_definitions.count);
+    line = newline + 1;
+  }
 
-  nob_write_entire_file(ctx->runner_main_path, runner_main.items,
-                        runner_main.count);
+  sb_free(list);
+  return true;
+}
 
-  nob_write_entire_file(ctx->gen_header_path, walk_ctx.out_h.items,
-                        walk_ctx.out_h.count);
+static void replay_file(const char *path, FILE *stream) {
+  String_Builder sb = {0};
+  if (nob_read_entire_file(path, &sb)) {
+    fwrite(sb.items, 1, sb.count, stream);
+    fflush(stream);
+  }
+  sb_free(sb);
+}
 
-  Nob_Cmd build_cmd = {0};
-  build_compile_base_command(&build_cmd, ctx->parsed_argv);
+// The results of a runner whose blocks called something untracked are not
+// cached.
+static bool runner_results_cacheable(const Context *ctx) {
+  Nob_File_Paths reads = {0};
+  bool untracked = false;
+  bool ok = runner_read_inputs(ctx->runner_inputs_path, &reads, NULL,
+                               &untracked);
+  nob_da_foreach(const char *, it, &reads) { free((char *)*it); }
+  da_free(reads);
+  if (ok && untracked)
+    nob_log(INFO, "Comptime results: not cached, a block called a function "
+                  "whose result cannot be tracked");
+  return ok && !untracked;
+}
 
-  nob_cmd_append(
-      &build_cmd,
-      nob_temp_sprintf("%s/runner.templ.c",
-                       nob_temp_dir_name(nob_temp_running_executable_path())));
+static bool cache_results(const Context *ctx, const char *header_path,
+                          const char *list_path, const char *inputs_path) {
+  const char *list_temp = cache_temp_path(list_path);
+  bool ok = nob_copy_file(ctx->runner_inputs_path, list_temp) &&
+            cache_publish(list_temp, list_path);
+
+  String_Builder header = {0};
+  ok = ok && nob_read_entire_file(ctx->runner_header_path, &header);
+  const char *header_temp = cache_temp_path(header_path);
+  ok = ok && nob_write_entire_file(header_temp, header.items, header.count) &&
+       cache_publish(header_temp, header_path);
+  sb_free(header);
+
+  Nob_File_Paths reads = {0}, env = {0};
+  const char *inputs_temp = cache_temp_path(inputs_path);
+  ok = ok && runner_read_inputs(ctx->runner_inputs_path, &reads, &env, NULL) &&
+       cache_manifest_from_inputs(&reads, &env, inputs_temp) &&
+       cache_publish(inputs_temp, inputs_path);
+  nob_da_foreach(const char *, it, &reads) { free((char *)*it); }
+  nob_da_foreach(const char *, it, &env) { free((char *)*it); }
+  da_free(reads);
+  da_free(env);
+  return ok;
+}
 
-  nob_cmd_append(&build_cmd, "-o", ctx->runner_exepath);
-  nob_cmd_append(
-      &build_cmd,
-      temp_sprintf("-D_INPUT_PROGRAM_PATH=\"%s\"", ctx->comptime_safe_path),
-      temp_sprintf("-D_INPUT_COMPTIME_DEFS_PATH=\"%s\"", ctx->runner_defs_path),
-      temp_sprintf("-D_INPUT_COMPTIME_MAIN_PATH=\"%s\"", ctx->runner_main_path),
-      temp_sprintf("-D_OUTPUT_HEADERS_PATH=\"%s\"", ctx->gen_header_path));
+// Runs the comptime blocks. With a cached runner its results (the generated
+// header and whatever the blocks printed) are cached as well, keyed on the
+// runner and the working directory relative input paths resolve against, and
+// replayed for as long as every file and environment variable the blocks read
+// is unchanged. The inputs are recorded per block but the results are cached
+// for the runner as a whole, so any change reruns every block. Blocks are
+// assumed to depend on nothing else, so where the reads are not recorded, or
+// a block asked for the time, ran a command or listed a directory, the
+// results are not cached.
+static void run_runner(Context *ctx) {
+  bool cached = ctx->runner_is_cached && RUNNER_RECORDS_READS;
+  bool measuring = ctx->profiles != NULL;
+  bool profiling = ctx->parsed_argv->comptime_profile != NULL;
+
+  const char *header_path = NULL, *stdout_path = NULL, *stderr_path = NULL;
+  const char *list_path = NULL, *inputs_path = NULL;
+  if (cached) {
+    CacheKey key = cache_key_cstr(ctx->runner_key, "RESULTS");
+    key = cache_key_cstr(key, nob_get_current_dir_temp());
+    header_path = cache_entry_path(key, ".h");
+    stdout_path = cache_entry_path(key, ".out");
+    stderr_path = cache_entry_path(key, ".err");
+    list_path = cache_entry_path(key, ".list");
+    inputs_path = cache_entry_path(key, ".inputs");
+
+    // cached results have no costs to report, profiling runs the blocks
+    String_Builder header = {0};
+    if (!profiling && nob_file_exists(inputs_path) == 1 &&
+        cache_manifest_valid(inputs_path) &&
+        nob_read_entire_file(header_path, &header) &&
+        nob_copy_file(list_path, ctx->runner_inputs_path)) {
+      nob_log(INFO, "Comptime results: cache hit %s", header_path);
+      STATS_ADD(cache_hits, 1);
+      nob_write_entire_file(ctx->runner_header_path, header.items,
+                            header.count);
+      replay_file(stdout_path, stdout);
+      replay_file(stderr_path, stderr);
+      sb_free(header);
+      return;
+    }
+    sb_free(header);
+    STATS_ADD(cache_misses, 1);
+  }
 
-  if (!nob_cmd_run(&build_cmd))
-    fatal("Failed to compile comptime runner");
+  Nob_Cmd cmd = {0};
+  nob_log(INFO, "Running runner %s", ctx->runner_exepath);
+  nob_cmd_append(&cmd, ctx->runner_exepath, ctx->runner_header_path,
+                 ctx->runner_inputs_path,
+                 nob_temp_sprintf("%d", ctx->parsed_argv->comptime_jobs),
+                 ctx->parsed_argv->cct_flags & CliComptimeFlag_Fork ? "fork"
+                                                                   : "thread",
+                 measuring ? ctx->runner_profile_path : "");
+
+  trace_begin("runner exec");
+  bool ok;
+  if (cached) {
+    const char *stdout_temp = cache_temp_path(stdout_path);
+    const char *stderr_temp = cache_temp_path(stderr_path);
+    ok = nob_cmd_run(&cmd, .stdout_path = stdout_temp,
+                     .stderr_path = stderr_temp);
+    replay_file(stdout_temp, stdout);
+    replay_file(stderr_temp, stderr);
+
+    if (ok && runner_results_cacheable(ctx) &&
+        cache_publish(stdout_temp, stdout_path) &&
+        cache_publish(stderr_temp, stderr_path) &&
+        cache_results(ctx, header_path, list_path, inputs_path)) {
+      nob_log(INFO, "Comptime results: cached %s", header_path);
+    } else {
+      nob_delete_file(stdout_temp);
+      nob_delete_file(stderr_temp);
+    }
+  } else {
+    ok = nob_cmd_run(&cmd);
+  }
+  nob_cmd_free(cmd);
+  trace_end();
 
-  ts_tree_delete(clean_tree);
-  ts_parser_delete(parser);
+  if (!ok) {
+    nob_log(ERROR, "failed to run runner %s", ctx->runner_exepath);
+    exit(1);
+  }
+
+  if (measuring)
+    profile_read_runner(ctx->runner_profile_path, ctx->profiles,
+                        ctx->profile_first);
+}
+
+// The header is stamped with a hash of its content rather than a time, and
+// only written when that content changed, so its mtime (and everything that
+// depends on it) is left alone by a rebuild that generates the same code.
+// The runner results are hidden from the runner build itself, which must only
+// see the prelude.
+static void write_generated_header(const Context *ctx, const char *results,
+                                   size_t results_len) {
+  String_Builder body = {0};
+  build_header_prelude(&body);
+  sb_append_cstr(&body, "#ifndef _COMPILING\n");
+  sb_append_buf(&body, results, results_len);
+  sb_append_cstr(&body, "#endif // _COMPILING\n");
+
+  String_Builder header = {0};
+  sb_appendf(&header, "/*// @generated - ccomptime™ v0.0.1 - %016" PRIx64
+                      " \\*/\n",
+             cache_key_bytes(CACHE_KEY_INIT, body.items, body.count));
+  sb_append_buf(&header, body.items, body.count);
+  STATS_SET(header_bytes, header.count);
+
+  String_Builder existing = {0};
+  if (nob_file_exists(ctx->gen_header_path) == 1 &&
+      nob_read_entire_file(ctx->gen_header_path, &existing) &&
+      existing.count == header.count &&
+      memcmp(existing.items, header.items, header.count) == 0) {
+    nob_log(INFO, "Generated header %s is unchanged", ctx->gen_header_path);
+  } else if (!nob_write_entire_file(ctx->gen_header_path, header.items,
+                                    header.count)) {
+    fatal("Could not write generated header %s", ctx->gen_header_path);
+  }
 
-  // TODO: this is bad structure, bad ownership
-  sb_free(pp_source);
-  sb_free(processed_source);
+  sb_free(existing);
+  sb_free(header);
+  sb_free(body);
+}
+
+static void write_runner_results_header(const Context *ctx) {
+  String_Builder results = {0};
+  if (!nob_read_entire_file(ctx->runner_header_path, &results))
+    fatal("Could not read runner output %s", ctx->runner_header_path);
+  write_generated_header(ctx, results.items, results.count);
+  sb_free(results);
+}
+
+typedef struct {
+  const char *input_arg;
+  const char *final_path;
+  const char *header_path;
+  const char *inputs_list_path;
+} ProcessedInput;
+
+typedef struct {
+  ProcessedInput *items;
+  size_t count;
+  size_t capacity;
+} ProcessedInputs;
+
+static const char *strip_extension_temp(const char *path) {
+  const char *dot = strrchr(path, '.');
+  const char *slash = strrchr(path, '/');
+  if (!dot || (slash && dot < slash))
+    return path;
+  return nob_temp_sprintf("%.*s", (int)(dot - path), path);
+}
 
-  sb_free(runner_definitions);
-  sb_free(runner_main);
-  sb_free(comptime_safe_source);
-  sb_free(walk_ctx.out_h);
+// Left alone the compiler would name the depfile (and its target) after our
+// generated wrapper, so give it the names the user's own command would have
+// produced: after the object for `-c -o`, after the input otherwise.
+static void prepare_depfile(CliArgs *pa, CliDepfile *depfile,
+                            const ProcessedInputs *inputs, Nob_Cmd *final,
+                            Arena *session) {
+  if (!depfile->enabled || depfile->path)
+    return;
+  if (inputs->count != 1) {
+    nob_log(WARNING, "-MD with several inputs needs -MF, comptime inputs will "
+                     "be missing from the depfiles");
+    return;
+  }
+
+  const char *input_stem =
+      strip_extension_temp(path_basename(inputs->items[0].input_arg));
+  const char *output = pa->output_files.count > 1
+                           ? pa->argv[pa->output_files.items[1]]
+                           : NULL;
+  bool object_output = output && cli_has_flag(pa, "-c");
+
+  depfile->path =
+      arena_sprintf(session, "%s.d",
+                    object_output ? strip_extension_temp(output) : input_stem);
+  nob_cmd_append(final, "-MF", depfile->path);
+  if (!depfile->has_target) {
+    nob_cmd_append(final, "-MT",
+                   object_output ? output
+                                 : nob_temp_sprintf("%s.o", input_stem));
+  }
+}
+
+// Point the depfile at the original inputs instead of the wrappers (which are
+// deleted) and add everything the comptime blocks read plus the generated
+// headers, so the outer build reruns ccomptime when any of them changes.
+static void finish_depfile(const CliDepfile *depfile,
+                           const ProcessedInputs *inputs) {
+  if (!depfile->enabled || !depfile->path)
+    return;
+
+  DepfileRenames renames = {0};
+  Nob_File_Paths extra = {0};
+  nob_da_foreach(ProcessedInput, it, inputs) {
+    da_append(&renames, ((DepfileRename){it->final_path, it->input_arg}));
+    runner_read_inputs(it->inputs_list_path, &extra, NULL, NULL);
+    da_append(&extra, strdup(it->header_path));
+  }
+
+  if (!depfile_patch(depfile->path, &renames, &extra, depfile->phony))
+    nob_log(ERROR, "failed to add comptime inputs to depfile %s",
+            depfile->path);
+
+  nob_da_foreach(const char *, it, &extra) { free((char *)*it); }
+  da_free(extra);
+  da_free(renames);
+}
+
+static void write_final_wrapper(const Context *ctx) {
+  String_Builder final_source = {0};
+  const char *header_basename = path_basename(ctx->gen_header_path);
+  const char *input_basename = path_basename(ctx->input_path);
+
+  sb_appendf(&final_source, "#include \"%s\"\n", header_basename);
+  sb_appendf(&final_source, "#include \"%s\"\n", input_basename);
+
+  nob_write_entire_file(ctx->final_out_path, final_source.items,
+                        final_source.count);
+
+  sb_free(final_source);
+}
+
+// One front-end thread. Its parser is reused for every input it takes and
+// allocates from `trees`, which recycles what the parser frees; `scratch`
+// holds the macro definitions of the current input. The chunks of a large
+// input are parsed on `parse_threads` threads, this one included.
+typedef struct {
+  TSParser *parser;
+  Arena trees;
+  Arena scratch;
+  int parse_threads;
+} FrontEnd;
+
+static void front_end_init(FrontEnd *fe, int parse_threads) {
+  *fe = (FrontEnd){.parse_threads = parse_threads};
+  arena_use_for_tree_sitter(&fe->trees);
+  fe->parser = ts_parser_new();
+  ts_parser_set_language(fe->parser, tree_sitter_c());
+}
+
+static void front_end_free(FrontEnd *fe) {
+  ts_parser_delete(fe->parser);
+  arena_use_for_tree_sitter(NULL);
+  arena_free(&fe->trees);
+  arena_free(&fe->scratch);
+}
 
+// Parse and rewrite one input and write its runner sources. Runs on a
+// front-end thread, so it touches nothing shared but the (locked) trace and
+// its own stats entry, and stays away from the nob temp buffer.
+static void run_front_end(FrontEnd *fe, Context *ctx) {
+  TSParser *parser = fe->parser;
+
+  trace_begin("parse");
+  Chunks chunks = {.threads = fe->parse_threads};
+  chunks_split(ctx->source->data, ctx->source->size, CHUNK_TARGET_SIZE,
+               &chunks);
+  chunks_parse(parser, ctx->source->data, &chunks);
+  STATS_SET(chunks, chunks.count);
+  trace_end();
+
+  String_Builder pp_source = {0};
+  Interner idents;
+  interner_init(&idents);
+  MacroTable macros = {.idents = &idents, .arena = &fe->scratch};
+
+  trace_begin("cct_expand_macros");
+  cct_expand_macros(parser, &chunks, &macros, ctx->source->data,
+                    ctx->source->size, &pp_source);
+  trace_end();
+
+  String_Builder processed_source = {0};
+  WalkContext walk_ctx = {.idents = &idents, .arena = &fe->scratch};
+  trace_begin("cct_correct_comptimetype_nodes");
+  cct_correct_comptimetype_nodes(parser, &chunks, pp_source.items,
+                                 pp_source.count, &walk_ctx,
+                                 &processed_source);
+  trace_end();
+
+  trace_begin("cct_collect_comptime_statements");
+  cct_collect_comptime_statements(&walk_ctx, &chunks, processed_source.items);
+  trace_end();
+
+  trace_begin("cct_tree_shake");
+  cct_index_top_level(&walk_ctx, &chunks, processed_source.items);
+  if (!(ctx->parsed_argv->cct_flags & CliComptimeFlag_NoTreeShake))
+    cct_tree_shake(&walk_ctx);
+  if (ctx->parsed_argv->comptime_jobs > 1 ||
+      (ctx->parsed_argv->cct_flags & CliComptimeFlag_Fork))
+    cct_classify_blocks(&walk_ctx);
+  trace_end();
+  if (ctx->profiles)
+    profile_locate_blocks(&walk_ctx, processed_source.items, pp_source.items,
+                          ctx->input_arg, &ctx->located);
+
+  STATS_SET(blocks, walk_ctx.comptime_stmts.count);
+  STATS_SET(placeholders, walk_ctx.comptimetype_stmts.count);
+
+  trace_begin("build runner sources");
+  build_runner_snippets(&walk_ctx, &ctx->runner_definitions,
+                        &ctx->runner_main);
+  cct_build_program_unit(&walk_ctx, processed_source.items,
+                         processed_source.count, true, &ctx->runner_program);
+  // what the single translation unit fallback compiles, should the shaking
+  // have removed something a block needs after all
+  ctx->program_shaken = walk_ctx.shaken.count > 0;
+  if (ctx->program_shaken)
+    cct_build_program_unit(&walk_ctx, processed_source.items,
+                           processed_source.count, false,
+                           &ctx->runner_program_full);
+  cct_build_interface_unit(&walk_ctx, processed_source.items,
+                           processed_source.count, &ctx->runner_interface);
+  trace_end();
+
+  trace_begin("write runner sources");
+  nob_write_entire_file(ctx->comptime_safe_path, ctx->runner_program.items,
+                        ctx->runner_program.count);
+  if (ctx->program_shaken)
+    nob_write_entire_file(ctx->comptime_full_path,
+                          ctx->runner_program_full.items,
+                          ctx->runner_program_full.count);
+
+  nob_write_entire_file(ctx->runner_iface_path, ctx->runner_interface.items,
+                        ctx->runner_interface.count);
+
+  nob_write_entire_file(ctx->runner_defs_path, ctx->runner_definitions.items,
+                        ctx->runner_definitions.count);
+
+  nob_write_entire_file(ctx->runner_main_path, ctx->runner_main.items,
+                        ctx->runner_main.count);
+
+  // the program includes the generated header, it has to exist (with at
+  // least the prelude) before the runner is built
+  if (nob_file_exists(ctx->gen_header_path) != 1)
+    write_generated_header(ctx, "", 0);
+  nob_write_entire_file(ctx->runner_header_path, "", 0);
+  trace_end();
+
+  chunks_free(&chunks);
+  macros_free(&macros);
+  interner_free(&idents);
+  walk_context_free(&walk_ctx);
+  arena_reset(&fe->scratch);
+
+  // a pass with nothing to rewrite borrows its input
+  if (processed_source.items != pp_source.items)
+    sb_free(processed_source);
+  if (pp_source.items != ctx->source->data)
+    sb_free(pp_source);
+}
+
+static void front_end_input(FrontEnd *fe, Context *ctx) {
+  trace_set_track(TRACE_PID_CCOMPTIME, ctx->track, ctx->input_arg);
+  stats_resume_file(ctx->stats_index);
+  STATS_SET(source_bytes, ctx->source->size);
+  STATS_SET(source_hash, cache_key_bytes(CACHE_KEY_INIT, ctx->source->data,
+                                         ctx->source->size));
+  trace_begin(ctx->input_arg);
+  run_front_end(fe, ctx);
+  trace_end();
+  stats_end_file();
+}
+
+// Inputs are taken in order by the front-end threads; the main thread runs
+// the back end of each as soon as its front end is done, so compiling one
+// runner overlaps with parsing the next inputs.
+typedef struct {
+  Context *inputs;
+  size_t count;
+  size_t next; // first input no thread has taken
+  bool *done;
+  int parse_threads; // per front-end thread
+#ifndef _WIN32
+  pthread_mutex_t lock;
+  pthread_cond_t finished;
+#endif
+} FrontEndQueue;
+
+#ifndef _WIN32
+static void *front_end_thread(void *arg) {
+  FrontEndQueue *queue = arg;
+  FrontEnd fe;
+  front_end_init(&fe, queue->parse_threads);
+  for (;;) {
+    pthread_mutex_lock(&queue->lock);
+    size_t i = queue->next++;
+    pthread_mutex_unlock(&queue->lock);
+    if (i >= queue->count)
+      break;
+
+    front_end_input(&fe, &queue->inputs[i]);
+
+    pthread_mutex_lock(&queue->lock);
+    queue->done[i] = true;
+    pthread_cond_broadcast(&queue->finished);
+    pthread_mutex_unlock(&queue->lock);
+  }
+  front_end_free(&fe);
+  return NULL;
+}
+#endif
+
+// One thread per core, no more than there are inputs.
+static size_t front_end_threads(size_t inputs) {
+#ifdef _WIN32
+  (void)inputs;
+  return 1;
+#else
+  size_t cores = (size_t)nob_nprocs();
+  return cores < inputs ? cores : inputs;
+#endif
+}
+
+// The cores left over by the front-end threads parse chunks.
+static int parse_threads(size_t front_end_threads) {
+#ifdef _WIN32
+  (void)front_end_threads;
+  return 1;
+#else
+  if (front_end_threads == 0)
+    return 1;
+  int per_thread = nob_nprocs() / (int)front_end_threads;
+  return per_thread > 1 ? per_thread : 1;
+#endif
+}
+
+static void wait_front_end(FrontEndQueue *queue, size_t i) {
+#ifndef _WIN32
+  pthread_mutex_lock(&queue->lock);
+  while (!queue->done[i])
+    pthread_cond_wait(&queue->finished, &queue->lock);
+  pthread_mutex_unlock(&queue->lock);
+#else
+  (void)queue;
+  (void)i;
+#endif
+}
+
+// Builds (or finds in the cache) the runner of an input whose front end is
+// done.
+static void run_back_end(Context *ctx) {
+  size_t mark = nob_temp_save();
+  RunnerSources sources = {
+      .program = &ctx->runner_program,
+      .interface = &ctx->runner_interface,
+      .definitions = &ctx->runner_definitions,
+      .main = &ctx->runner_main,
+  };
+  trace_begin("build_runner");
+  build_runner(ctx, &sources);
+  trace_end();
+
+  sb_free(ctx->runner_program);
+  sb_free(ctx->runner_program_full);
+  sb_free(ctx->runner_interface);
+  sb_free(ctx->runner_definitions);
+  sb_free(ctx->runner_main);
   nob_temp_rewind(mark);
 }
 
 int main(int argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "stats") == 0)
+    return history_main(argc, argv);
+
   CliArgs parsed_argv = {0};
   if (cli(argc, argv, &parsed_argv) != 0) {
     return 1;
@@ -253,57 +963,152 @@ int main(int argc, char **argv) {
     const char **items;
     size_t count, capacity;
   } files_to_remove = {0};
+  ProcessedInputs processed = {0};
+  BlockProfiles profiles = {0};
+  Arena session = {0};
+  Arena file_arena = {0};
+
+  // the stats also feed the build history in the cache directory
+  bool record_history =
+      !(parsed_argv.cct_flags & CliComptimeFlag_NoCache) && cache_dir();
+  if (parsed_argv.comptime_stats || record_history)
+    stats_start();
+  if (parsed_argv.comptime_trace) {
+    trace_start(parsed_argv.comptime_trace);
+    trace_process_name(TRACE_PID_CCOMPTIME, "ccomptime");
+  }
 
-  nob_da_foreach(int, index, &parsed_argv.input_files) {
-    nob_log(INFO, "Processing input file %s", argv[*index]);
-
-    const char *input_filename = argv[*index];
-
-    String_Builder absolute_input_filename = {0};
-    sb_appendf(&absolute_input_filename, "%s/%s", nob_get_current_dir_temp(),
-               input_filename);
-    nob_sb_append_null(&absolute_input_filename);
+  // everything of an input the back end and the final compile use lives in
+  // `session`, front-end results in its Context
+  size_t input_count = parsed_argv.input_files.count;
+  Context *inputs = calloc(input_count, sizeof(*inputs));
+  MappedFile *sources = calloc(input_count, sizeof(*sources));
+  const char *cwd = arena_strdup(&session, nob_get_current_dir_temp());
+  for (size_t i = 0; i < input_count; i++) {
+    const char *input_filename = argv[parsed_argv.input_files.items[i]];
+    nob_log(INFO, "Processing input file %s", input_filename);
+
+    Context *ctx = &inputs[i];
+    ctx->input_path = arena_sprintf(&session, "%s/%s", cwd, input_filename);
+    ctx->input_arg = input_filename;
+    if (parsed_argv.comptime_profile || parsed_argv.comptime_trace)
+      ctx->profiles = &profiles;
+    ctx->parsed_argv = &parsed_argv;
+    ctx->source = &sources[i];
+    ctx->track = (int)i + 1;
+    ctx->stats_index = stats_add_file(input_filename);
+    ctx->arena = &file_arena;
+    ctx->session = &session;
+
+    Context_fill_paths(ctx, ctx->input_path);
 
-    String_Builder raw_source = {0};
-    String_Builder preprocessed_source = {0};
-    Context ctx = {0};
-    ctx.input_path = absolute_input_filename.items;
-    ctx.parsed_argv = &parsed_argv;
-    ctx.raw_source = &raw_source;
-    ctx.preprocessed_source = &preprocessed_source;
+    nob_log(VERBOSE, "Processing %s source as SourceCode [%s]",
+            ctx->input_path, cwd);
+    if (!mapped_file_open(ctx->input_path, &sources[i]))
+      return 1;
+  }
 
-    Context_fill_paths(&ctx, absolute_input_filename.items);
+  FrontEndQueue queue = {
+      .inputs = inputs,
+      .count = input_count,
+      .done = calloc(input_count, sizeof(bool)),
+  };
+  size_t threads = front_end_threads(input_count);
+  queue.parse_threads = parse_threads(threads);
+  // installs the tree-sitter hooks before any thread uses tree-sitter
+  arena_use_for_tree_sitter(NULL);
+  queries_compile();
+  FrontEnd inline_fe = {0};
+#ifndef _WIN32
+  pthread_t *workers = calloc(threads, sizeof(pthread_t));
+  if (threads > 1) {
+    nob_log(INFO, "Running the front end on %zu threads", threads);
+    pthread_mutex_init(&queue.lock, NULL);
+    pthread_cond_init(&queue.finished, NULL);
+    for (size_t t = 0; t < threads; t++)
+      pthread_create(&workers[t], NULL, front_end_thread, &queue);
+  } else
+#endif
+  {
+    front_end_init(&inline_fe, queue.parse_threads);
+  }
 
-    nob_log(VERBOSE, "Processing %s source as SourceCode [%s]",
-            absolute_input_filename.items, nob_get_current_dir_temp());
-    nob_read_entire_file(absolute_input_filename.items, ctx.raw_source);
-
-    run_file(&ctx);
-
-    // sb_free(raw_source);
-    // sb_free(preprocessed_source);
-
-    Nob_Cmd cmd = {0};
-    nob_log(INFO, "Running runner %s", ctx.runner_exepath);
-    // printf("=== Compile time logs ===\n");
-    // nob_cmd_append(&cmd, nob_temp_sprintf("./%s", ctx.runner_exepath));
-    nob_cmd_append(&cmd, nob_temp_sprintf("%s", ctx.runner_exepath));
-    if (!nob_cmd_run(&cmd)) {
-      nob_log(ERROR, "failed to run runner %s", ctx.runner_exepath);
-      exit(1);
+  for (size_t i = 0; i < input_count; i++) {
+    Context *ctx = &inputs[i];
+    if (threads > 1)
+      wait_front_end(&queue, i);
+    else
+      front_end_input(&inline_fe, ctx);
+
+    // the back end only has to fit one input in the temp buffer
+    size_t temp_mark = nob_temp_save();
+    trace_set_track(TRACE_PID_CCOMPTIME, ctx->track, ctx->input_arg);
+    stats_resume_file(ctx->stats_index);
+    trace_begin(ctx->input_arg);
+    if (ctx->profiles) {
+      ctx->profile_first = profiles.count;
+      da_append_many(&profiles, ctx->located.items, ctx->located.count);
+      da_free(ctx->located);
     }
-    fflush(stdout);
-    // printf("=== end === \n");
+    run_back_end(ctx);
 
-    write_final_wrapper(&ctx);
-    parsed_argv.argv[*index] = (char *)ctx.final_out_path;
+    run_runner(ctx);
+    fflush(stdout);
+    trace_begin("write generated header");
+    write_runner_results_header(ctx);
+    write_final_wrapper(ctx);
+    trace_end();
+    trace_end();
+    stats_end_file();
+    trace_runner_blocks(TRACE_PID_CCOMPTIME + ctx->track, ctx->input_arg,
+                        profiles.items + ctx->profile_first,
+                        profiles.count - ctx->profile_first);
+    da_append(&processed, ((ProcessedInput){
+                              .input_arg = ctx->input_arg,
+                              .final_path = ctx->final_out_path,
+                              .header_path = ctx->gen_header_path,
+                              .inputs_list_path = ctx->runner_inputs_path,
+                          }));
+    parsed_argv.argv[parsed_argv.input_files.items[i]] =
+        (char *)ctx->final_out_path;
+
+    da_append(&files_to_remove, ctx->runner_main_path);
+    da_append(&files_to_remove, ctx->runner_defs_path);
+    da_append(&files_to_remove, ctx->comptime_safe_path);
+    if (ctx->program_shaken)
+      da_append(&files_to_remove, ctx->comptime_full_path);
+    da_append(&files_to_remove, ctx->runner_iface_path);
+    da_append(&files_to_remove, ctx->runner_inputs_path);
+    da_append(&files_to_remove, ctx->runner_header_path);
+    if (ctx->profiles)
+      da_append(&files_to_remove, ctx->runner_profile_path);
+    if (!ctx->runner_is_cached)
+      da_append(&files_to_remove, ctx->runner_exepath);
+    da_append(&files_to_remove, ctx->final_out_path);
+
+    mapped_file_close(&sources[i]);
+    arena_reset(&file_arena);
+    nob_temp_rewind(temp_mark);
+  }
 
-    da_append(&files_to_remove, ctx.runner_main_path);
-    da_append(&files_to_remove, ctx.runner_defs_path);
-    da_append(&files_to_remove, ctx.comptime_safe_path);
-    da_append(&files_to_remove, ctx.runner_exepath);
-    da_append(&files_to_remove, ctx.final_out_path);
+#ifndef _WIN32
+  if (threads > 1) {
+    for (size_t t = 0; t < threads; t++)
+      pthread_join(workers[t], NULL);
+    pthread_mutex_destroy(&queue.lock);
+    pthread_cond_destroy(&queue.finished);
+  } else
+#endif
+  {
+    front_end_free(&inline_fe);
   }
+#ifndef _WIN32
+  free(workers);
+#endif
+  free(queue.done);
+  free(sources);
+  free(inputs);
+  arena_free(&file_arena);
 
   Nob_Cmd final = {0};
   nob_cmd_append(&final, Parsed_Argv_compiler_name(&parsed_argv));
@@ -311,13 +1116,37 @@ int main(int argc, char **argv) {
   cmd_append_arg_indeces(&parsed_argv, &parsed_argv.output_files, &final);
   cmd_append_arg_indeces(&parsed_argv, &parsed_argv.flags, &final);
 
-  if (!cmd_run(&final)) {
+  CliDepfile depfile = cli_depfile(&parsed_argv);
+  prepare_depfile(&parsed_argv, &depfile, &processed, &final, &session);
+
+  trace_set_track(TRACE_PID_CCOMPTIME, 0, "final compile");
+  trace_begin("final compile");
+  bool final_ok = cmd_run(&final);
+  trace_end();
+  if (!final_ok) {
     nob_log(ERROR, "failed to compile final output");
     return 1;
   } else {
     nob_log(INFO, "Successfully compiled final output");
   }
 
+  finish_depfile(&depfile, &processed);
+
+  if (parsed_argv.comptime_profile) {
+    if (*parsed_argv.comptime_profile == '\0')
+      profile_print_report(&profiles, stderr);
+    else if (!profile_write_json(&profiles, parsed_argv.comptime_profile))
+      nob_log(ERROR, "Could not write profile %s",
+              parsed_argv.comptime_profile);
+  }
+  if (parsed_argv.comptime_stats &&
+      !stats_write_json(parsed_argv.comptime_stats))
+    nob_log(ERROR, "Could not write stats %s", parsed_argv.comptime_stats);
+  if (record_history)
+    history_append();
+  if (!trace_finish())
+    nob_log(ERROR, "Could not write trace %s", parsed_argv.comptime_trace);
+
   nob_log(INFO, "Cleaning up %zu intermediate files", files_to_remove.count);
   nob_da_foreach(const char *, f, &files_to_remove) {
     if (!(parsed_argv.cct_flags & CliComptimeFlag_KeepInter)) {
@@ -327,5 +1156,11 @@ int main(int argc, char **argv) {
       nob_log(INFO, "Keeping intermediate file %s", *f);
     }
   }
+
+  nob_cmd_free(final);
+  free(files_to_remove.items);
+  free(processed.items);
+  queries_free();
+  arena_free(&session);
   return 0;
 }
@@ -0,0 +1,64 @@
+#include "mapped_file.h"
+#include "nob.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static bool read_into_buffer(const char *path, MappedFile *out) {
+  String_Builder sb = {0};
+  if (!nob_read_entire_file(path, &sb))
+    return false;
+  out->buffer = sb.items;
+  if (sb.items)
+    out->data = sb.items;
+  out->size = sb.count;
+  return true;
+}
+
+bool mapped_file_open(const char *path, MappedFile *out) {
+  *out = (MappedFile){.data = ""};
+#ifdef _WIN32
+  return read_into_buffer(path, out);
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    nob_log(ERROR, "Could not open file %s: %s", path, strerror(errno));
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode)) {
+    close(fd);
+    return read_into_buffer(path, out);
+  }
+  if (st.st_size == 0) { // mmap rejects empty ranges
+    close(fd);
+    return true;
+  }
+
+  void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    return read_into_buffer(path, out);
+  // the parser and the rewrite passes walk it front to back
+  madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+  *out = (MappedFile){.data = data, .size = (size_t)st.st_size, .mapped = true};
+  return true;
+#endif
+}
+
+void mapped_file_close(MappedFile *file) {
+#ifndef _WIN32
+  if (file->mapped)
+    munmap((void *)file->data, file->size);
+#endif
+  free(file->buffer);
+  *file = (MappedFile){0};
+}
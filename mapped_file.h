@@ -0,0 +1,21 @@
+#ifndef CCOMPTIME_MAPPED_FILE_H
+#define CCOMPTIME_MAPPED_FILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Read-only view of a whole input file. Regular files are mmap'ed, so a large
+// source is paged in by the parser instead of copied to the heap first;
+// anything else (pipes, /dev/stdin, Windows) is read into a buffer. The bytes
+// are not NUL-terminated and must not be written.
+typedef struct {
+  const char *data;
+  size_t size;
+  bool mapped;
+  char *buffer; // the copy when it could not be mapped
+} MappedFile;
+
+bool mapped_file_open(const char *path, MappedFile *out);
+void mapped_file_close(MappedFile *file);
+
+#endif // CCOMPTIME_MAPPED_FILE_H
@@ -10,9 +10,12 @@
 #define APP_OUT BUILD_DIR "ccomptime"
 #define APP_SRCS                                                               \
   (const char *[]) {                                                           \
-    "main.c", "comptime_common.c", "macro_expansion.c", "tree_passes.c"        \
+    "main.c", "comptime_common.c", "macro_expansion.c", "tree_passes.c",       \
+        "tree_shaking.c", "runner_units.c", "cache.c", "depfile.c",            \
+        "profile.c", "trace.c", "stats.c", "history.c", "slice_map.c",         \
+        "intern.c", "arena.c", "mapped_file.c", "chunks.c", "queries.c"        \
   }
-#define APP_SRCS_COUNT 4
+#define APP_SRCS_COUNT 18
 
 static bool build_tree_sitter_runtime(void) {
   // build/libtree-sitter.a <= lib/src/lib.c
@@ -96,6 +99,9 @@ static bool link_app(const char *extra_cflags, int debug) {
     nob_cmd_append(&cmd, app_srcs[i]);
   }
   nob_cmd_append(&cmd, LIB_RT_A, LIB_GRAMMAR_A);
+#ifndef _WIN32
+  nob_cmd_append(&cmd, "-pthread"); // front-end threads
+#endif
 
   return nob_cmd_run(&cmd);
 }
@@ -108,6 +114,7 @@ int main(int argc, char **argv) {
   NOB_GO_REBUILD_URSELF_PLUS(argc, argv, "nob.c");
 
   int test = 0;
+  int bench = 0;
   int debug = 0;
 
   for (int i = 1; i < argc; i++) {
@@ -115,6 +122,10 @@ int main(int argc, char **argv) {
       test = 1;
     }
 
+    if (strcmp(argv[1], "bench") == 0) {
+      bench = 1;
+    }
+
     if (strcmp(argv[1], "debug") == 0) {
       debug = 1;
     }
@@ -185,5 +196,23 @@ int main(int argc, char **argv) {
     }
     cmd_run(&cmd);
   }
+
+  if (bench) {
+    nob_log(INFO, "Compiling benchmark runner");
+    Nob_Cmd cmd = {0};
+    nob_cc(&cmd);
+    nob_cc_flags(&cmd);
+    nob_cmd_append(&cmd, "-O3", "bench/bench.c", "-o", BUILD_DIR "bench");
+    if (!cmd_run(&cmd))
+      return 1;
+
+    nob_log(INFO, "Running benchmarks");
+    nob_cmd_append(&cmd, BUILD_DIR "bench");
+    for (int i = 1; i < argc; ++i) {
+      nob_cmd_append(&cmd, argv[i]);
+    }
+    if (!cmd_run(&cmd))
+      return 1;
+  }
   return 0;
 }
@@ -0,0 +1,144 @@
+#include "profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define PROFILE_LABEL_MAX 48
+
+static const char *block_label(Slice block) {
+  String_Builder label = {0};
+  bool space = false;
+  for (int i = 0; i < block.len && label.count < PROFILE_LABEL_MAX; i++) {
+    char c = block.start[i];
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+      space = label.count > 0;
+      continue;
+    }
+    if (space)
+      da_append(&label, ' ');
+    space = false;
+    da_append(&label, c);
+  }
+  if (label.count >= PROFILE_LABEL_MAX)
+    sb_append_cstr(&label, "...");
+  sb_append_null(&label);
+  return label.items;
+}
+
+typedef struct {
+  const char *cursor;
+  int line;
+} LineCursor;
+
+// blocks are collected in source order, keep counting from the last one
+static int line_of(LineCursor *lc, const char *src, const char *at) {
+  if (at < lc->cursor || !lc->cursor) {
+    lc->line = 1;
+    lc->cursor = src;
+  }
+  for (; lc->cursor < at; lc->cursor++) {
+    lc->line += *lc->cursor == '\n';
+  }
+  return lc->line;
+}
+
+void profile_locate_blocks(const WalkContext *ctx, const char *src,
+                           const char *typed_src, const char *file,
+                           BlockProfiles *out) {
+  LineCursor blocks = {0}, types = {0};
+  for (size_t i = 0; i < ctx->comptime_stmts.count; i++) {
+    Slice block = ctx->comptime_stmts.items[i];
+    // _ComptimeType blocks still point into the source before correction
+    bool typed = ctx->comptime_stmt_placeholder.items[i] >= 0;
+    int line = typed ? line_of(&types, typed_src, block.start)
+                     : line_of(&blocks, src, block.start);
+    da_append(out, ((BlockProfile){
+                       .file = file,
+                       .line = line,
+                       .label = block_label(block),
+                       .index = (int)i,
+                   }));
+  }
+}
+
+bool profile_read_runner(const char *path, BlockProfiles *blocks,
+                         size_t first) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    nob_log(ERROR, "Could not open runner profile %s", path);
+    return false;
+  }
+
+  int index;
+  long long wall_ns, cpu_ns;
+  long rss_kb;
+  size_t inline_bytes, toplevel_bytes;
+  long long start_ns;
+  int lane;
+  while (fscanf(f, "%d %lld %lld %ld %zu %zu %lld %d", &index, &wall_ns,
+                &cpu_ns, &rss_kb, &inline_bytes, &toplevel_bytes, &start_ns,
+                &lane) == 8) {
+    if (index < 0 || first + (size_t)index >= blocks->count)
+      continue;
+    BlockProfile *block = &blocks->items[first + index];
+    block->wall_ms = wall_ns / 1e6;
+    block->cpu_ms = cpu_ns / 1e6;
+    block->peak_rss_kb = rss_kb;
+    block->inline_bytes = inline_bytes;
+    block->toplevel_bytes = toplevel_bytes;
+    block->start_ns = start_ns;
+    block->lane = lane;
+  }
+  fclose(f);
+  return true;
+}
+
+static int compare_wall_desc(const void *a, const void *b) {
+  const BlockProfile *x = *(const BlockProfile *const *)a;
+  const BlockProfile *y = *(const BlockProfile *const *)b;
+  return (x->wall_ms < y->wall_ms) - (x->wall_ms > y->wall_ms);
+}
+
+void profile_print_report(const BlockProfiles *blocks, FILE *stream) {
+  const BlockProfile **sorted = malloc(blocks->count * sizeof(*sorted));
+  NOB_ASSERT(sorted != NULL);
+  double total_ms = 0;
+  for (size_t i = 0; i < blocks->count; i++) {
+    sorted[i] = &blocks->items[i];
+    total_ms += blocks->items[i].wall_ms;
+  }
+  qsort(sorted, blocks->count, sizeof(*sorted), compare_wall_desc);
+
+  fprintf(stream, "comptime profile: %zu blocks, %.2f ms\n", blocks->count,
+          total_ms);
+  fprintf(stream, "%10s %10s %10s %10s %10s  %s\n", "wall ms", "cpu ms",
+          "rss KiB", "inline B", "toplevel B", "block");
+  for (size_t i = 0; i < blocks->count; i++) {
+    const BlockProfile *b = sorted[i];
+    fprintf(stream, "%10.2f %10.2f %10ld %10zu %10zu  %s:%d %s\n", b->wall_ms,
+            b->cpu_ms, b->peak_rss_kb, b->inline_bytes, b->toplevel_bytes,
+            b->file, b->line, b->label);
+  }
+  free(sorted);
+}
+
+bool profile_write_json(const BlockProfiles *blocks, const char *path) {
+  String_Builder out = {0};
+  sb_append_cstr(&out, "[\n");
+  for (size_t i = 0; i < blocks->count; i++) {
+    const BlockProfile *b = &blocks->items[i];
+    sb_append_cstr(&out, "  {\"file\": ");
+    sb_append_json_string(&out, b->file);
+    sb_appendf(&out, ", \"line\": %d, \"block\": ", b->line);
+    sb_append_json_string(&out, b->label);
+    sb_appendf(&out,
+               ", \"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"peak_rss_kb\": %ld, "
+               "\"inline_bytes\": %zu, \"toplevel_bytes\": %zu}%s\n",
+               b->wall_ms, b->cpu_ms, b->peak_rss_kb, b->inline_bytes,
+               b->toplevel_bytes, i + 1 < blocks->count ? "," : "");
+  }
+  sb_append_cstr(&out, "]\n");
+  bool ok = nob_write_entire_file(path, out.items, out.count);
+  sb_free(out);
+  return ok;
+}
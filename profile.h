@@ -0,0 +1,45 @@
+#ifndef CCOMPTIME_PROFILE_H
+#define CCOMPTIME_PROFILE_H
+
+#include "comptime_common.h"
+
+#include <stdio.h>
+
+// Cost of one comptime block, as measured by the runner.
+typedef struct {
+  const char *file;
+  int line;
+  const char *label; // the start of the block, whitespace collapsed
+  int index;         // statement index within the runner
+  double wall_ms;
+  double cpu_ms;     // including parallel_for chunks run on the pool
+  long peak_rss_kb;  // growth of the runner's peak RSS while the block ran
+  size_t inline_bytes;
+  size_t toplevel_bytes;
+  long long start_ns; // CLOCK_MONOTONIC
+  int lane;           // runner thread or forked child the block ran on
+} BlockProfile;
+
+typedef struct {
+  BlockProfile *items;
+  size_t count;
+  size_t capacity;
+} BlockProfiles;
+
+// Append an entry with source location for every comptime block of `ctx`.
+// `typed_src` is the source the _ComptimeType placeholders were cut from.
+void profile_locate_blocks(const WalkContext *ctx, const char *src,
+                           const char *typed_src, const char *file,
+                           BlockProfiles *out);
+
+// Fill in the measurements the runner wrote to `path` for the blocks from
+// `first` on (the entries of the file it ran).
+bool profile_read_runner(const char *path, BlockProfiles *blocks,
+                         size_t first);
+
+// Print the blocks, most expensive first.
+void profile_print_report(const BlockProfiles *blocks, FILE *stream);
+
+bool profile_write_json(const BlockProfiles *blocks, const char *path);
+
+#endif // CCOMPTIME_PROFILE_H
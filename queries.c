@@ -0,0 +1,156 @@
+#include "queries.h"
+#include "ansi.h"
+#include "utils.h"
+
+#include <string.h>
+
+extern const TSLanguage *tree_sitter_c(void);
+
+static const char *sources[Query__Count] = {
+    // an `ERROR` only yields the keyword, the caller recovers the span
+    [Query_ComptimeTypeForms] =
+        "(call_expression"
+        "  function: (identifier) @keyword"
+        "  (#eq? @keyword \"_ComptimeType\")) @form\n"
+        "(macro_type_specifier"
+        "  name: (identifier) @keyword"
+        "  (#eq? @keyword \"_ComptimeType\")) @form\n"
+        "(type_descriptor"
+        "  . (type_identifier) @keyword"
+        "  (#eq? @keyword \"_ComptimeType\")) @form\n"
+        "(ERROR"
+        "  (identifier) @error_keyword"
+        "  (#eq? @error_keyword \"_ComptimeType\"))\n",
+    [Query_ComptimeUses] =
+        "((identifier) @comptime (#eq? @comptime \"_Comptime\"))\n"
+        "((identifier) @uncorrected (#eq? @uncorrected \"_ComptimeType\"))\n"
+        "((type_identifier) @placeholder"
+        "  (#prefix? @placeholder \"_COMPTIMETYPE_\"))\n",
+};
+
+static TSQuery *queries[Query__Count];
+
+typedef enum {
+  Predicate_Eq,
+  Predicate_Prefix,
+} PredicateKind;
+
+static bool predicate_kind(const TSQuery *query, const TSQueryPredicateStep *op,
+                           PredicateKind *kind) {
+  uint32_t len;
+  const char *name = ts_query_string_value_for_id(query, op->value_id, &len);
+  if (len == 3 && memcmp(name, "eq?", 3) == 0) {
+    *kind = Predicate_Eq;
+    return true;
+  }
+  if (len == 7 && memcmp(name, "prefix?", 7) == 0) {
+    *kind = Predicate_Prefix;
+    return true;
+  }
+  return false;
+}
+
+// Every predicate has to read `(#op? @capture "string")`.
+static void check_predicates(QueryId id) {
+  const TSQuery *query = queries[id];
+  for (uint32_t p = 0; p < ts_query_pattern_count(query); p++) {
+    uint32_t count;
+    const TSQueryPredicateStep *steps =
+        ts_query_predicates_for_pattern(query, p, &count);
+    for (uint32_t i = 0; i < count; i += 4) {
+      PredicateKind kind;
+      if (i + 3 >= count || steps[i].type != TSQueryPredicateStepTypeString ||
+          !predicate_kind(query, &steps[i], &kind) ||
+          steps[i + 1].type != TSQueryPredicateStepTypeCapture ||
+          steps[i + 2].type != TSQueryPredicateStepTypeString ||
+          steps[i + 3].type != TSQueryPredicateStepTypeDone)
+        fatal("Unsupported predicate in query %d, pattern %u", id, p);
+    }
+  }
+}
+
+void queries_compile(void) {
+  for (QueryId id = 0; id < Query__Count; id++) {
+    uint32_t error_offset;
+    TSQueryError error;
+    queries[id] = ts_query_new(tree_sitter_c(), sources[id],
+                               (uint32_t)strlen(sources[id]), &error_offset,
+                               &error);
+    if (!queries[id])
+      fatal("Query %d does not compile (error %d at `%.20s`)", id, error,
+            sources[id] + error_offset);
+    check_predicates(id);
+  }
+}
+
+void queries_free(void) {
+  for (QueryId id = 0; id < Query__Count; id++) {
+    ts_query_delete(queries[id]);
+    queries[id] = NULL;
+  }
+}
+
+void query_run(QueryRun *run, QueryId id, TSNode node, const char *src,
+               uint32_t start, uint32_t end) {
+  if (!run->cursor)
+    run->cursor = ts_query_cursor_new();
+  run->query = queries[id];
+  run->src = src;
+  ts_query_cursor_set_byte_range(run->cursor, start, end);
+  ts_query_cursor_exec(run->cursor, run->query, node);
+}
+
+static TSNode capture_by_id(const TSQueryMatch *match, uint32_t id) {
+  for (uint16_t i = 0; i < match->capture_count; i++) {
+    if (match->captures[i].index == id)
+      return match->captures[i].node;
+  }
+  return (TSNode){0};
+}
+
+static bool predicates_hold(const QueryRun *run, const TSQueryMatch *match) {
+  uint32_t count;
+  const TSQueryPredicateStep *steps =
+      ts_query_predicates_for_pattern(run->query, match->pattern_index, &count);
+  for (uint32_t i = 0; i < count; i += 4) {
+    PredicateKind kind = Predicate_Eq;
+    predicate_kind(run->query, &steps[i], &kind);
+    TSNode node = capture_by_id(match, steps[i + 1].value_id);
+    uint32_t want_len;
+    const char *want = ts_query_string_value_for_id(
+        run->query, steps[i + 2].value_id, &want_len);
+
+    uint32_t start = ts_node_start_byte(node);
+    uint32_t len = ts_node_end_byte(node) - start;
+    bool holds = kind == Predicate_Eq ? len == want_len : len >= want_len;
+    if (!holds || memcmp(run->src + start, want, want_len) != 0)
+      return false;
+  }
+  return true;
+}
+
+bool query_next_match(QueryRun *run, TSQueryMatch *match) {
+  while (ts_query_cursor_next_match(run->cursor, match)) {
+    if (predicates_hold(run, match))
+      return true;
+  }
+  return false;
+}
+
+TSNode query_capture(const QueryRun *run, const TSQueryMatch *match,
+                     const char *name) {
+  for (uint16_t i = 0; i < match->capture_count; i++) {
+    uint32_t len;
+    const char *capture = ts_query_capture_name_for_id(
+        run->query, match->captures[i].index, &len);
+    if (strlen(name) == len && memcmp(capture, name, len) == 0)
+      return match->captures[i].node;
+  }
+  return (TSNode){0};
+}
+
+void query_run_free(QueryRun *run) {
+  if (run->cursor)
+    ts_query_cursor_delete(run->cursor);
+  *run = (QueryRun){0};
+}
@@ -0,0 +1,45 @@
+#ifndef CCOMPTIME_QUERIES_H
+#define CCOMPTIME_QUERIES_H
+
+#ifndef TS_INCLUDE_SYMBOLS
+#define TS_INCLUDE_SYMBOLS
+#endif
+#include "tree_sitter_c_api.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The shapes of the comptime forms, as tree-sitter queries compiled once per
+// process. tree-sitter leaves predicates to its clients: the ones used here,
+// `#eq?` and `#prefix?` on a capture and a string, are evaluated by
+// query_next_match.
+
+typedef enum {
+  Query_ComptimeTypeForms, // what `_ComptimeType(...)` parses as
+  Query_ComptimeUses,      // `_Comptime` and `_COMPTIMETYPE_N` placeholders
+  Query__Count,
+} QueryId;
+
+// One query executing over a tree; the cursor is kept across runs.
+typedef struct {
+  TSQueryCursor *cursor;
+  const TSQuery *query;
+  const char *src; // what node offsets are relative to
+} QueryRun;
+
+// Compile every query. Call before other threads run queries.
+void queries_compile(void);
+void queries_free(void);
+
+// Start matching `id` against `node`, limited to matches intersecting the
+// bytes [start, end).
+void query_run(QueryRun *run, QueryId id, TSNode node, const char *src,
+               uint32_t start, uint32_t end);
+// The next match whose predicates hold.
+bool query_next_match(QueryRun *run, TSQueryMatch *match);
+// The node captured as `name` in `match`, a null node if none is.
+TSNode query_capture(const QueryRun *run, const TSQueryMatch *match,
+                     const char *name);
+void query_run_free(QueryRun *run);
+
+#endif // CCOMPTIME_QUERIES_H
@@ -3,16 +3,42 @@
 // #define _INPUT_COMPTIME_DEFS_PATH "test2.cc-runner-defs.c"
 // #define _INPUT_COMPTIME_MAIN_PATH "test2.cc-runner-main.c"
 
-#if defined(_INPUT_PROGRAM_PATH) && defined(_OUTPUT_HEADERS_PATH) &&           \
-    defined(_INPUT_COMPTIME_DEFS_PATH) && defined(_INPUT_COMPTIME_MAIN_PATH)
+// The runner is linked from three translation units so each of them can be
+// cached on its own:
+//   _COMPTIME_UNIT_RUNTIME  buffers, block execution and the entrypoint
+//   _COMPTIME_UNIT_PROGRAM  the comptime-safe user program
+//   _COMPTIME_UNIT_BLOCKS   the comptime blocks, compiled against the
+//                           declarations-only interface of the program
+// Without any unit selected everything is built as a single translation unit.
+#if !defined(_COMPTIME_UNIT_RUNTIME) && !defined(_COMPTIME_UNIT_PROGRAM) &&    \
+    !defined(_COMPTIME_UNIT_BLOCKS)
+#define _COMPTIME_UNIT_RUNTIME
+#define _COMPTIME_UNIT_PROGRAM
+#define _COMPTIME_UNIT_BLOCKS
+#endif
+
+#if defined(_COMPTIME_UNIT_PROGRAM) && !defined(_INPUT_PROGRAM_PATH)
+#error "please define _INPUT_PROGRAM_PATH"
+#endif
+
+#if defined(_COMPTIME_UNIT_BLOCKS) &&                                          \
+    (!defined(_INPUT_COMPTIME_DEFS_PATH) ||                                    \
+     !defined(_INPUT_COMPTIME_MAIN_PATH) ||                                    \
+     (!defined(_COMPTIME_UNIT_PROGRAM) &&                                      \
+      !defined(_INPUT_PROGRAM_INTERFACE_PATH)))
+#error                                                                         \
+    "please define _INPUT_COMPTIME_DEFS_PATH and _INPUT_COMPTIME_MAIN_PATH (and _INPUT_PROGRAM_INTERFACE_PATH for a split build)"
+#endif
 
 #include <assert.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
-static FILE *_Comptime_FP;
+#ifndef _WIN32
+#include <fcntl.h>
+#endif
 
 #ifndef _COMPTIME_RUNTIME_H
 #define _COMPTIME_RUNTIME_H
@@ -28,9 +54,20 @@ typedef struct {
   void (*appendf)(const char *fmt, ...);
 } _Comptime_Buffer_Vtable;
 
+// Output buffer of one parallel_for chunk.
+typedef struct _ComptimeChunk {
+  _Comptime__String_Builder _sb;
+  void (*appendf)(struct _ComptimeChunk *chunk, const char *fmt, ...);
+} _ComptimeChunk;
+
+typedef void (*_ComptimeChunkFn)(long i, _ComptimeChunk *out, void *ctx);
+
 typedef struct {
   _Comptime_Buffer_Vtable Inline;
   _Comptime_Buffer_Vtable TopLevel;
+  // Calls fn(i, out, ctx) for every i in [begin, end) on the runner's worker
+  // pool. Returns what the chunks appended, in index order (free() it).
+  char *(*parallel_for)(long begin, long end, _ComptimeChunkFn fn, void *ctx);
   int _StatementIndex;
   int _PlaceholderIndex;
 } _ComptimeCtx;
@@ -59,24 +96,23 @@ int _Comptime__sb_appendf(_Comptime__String_Builder *sb, const char *fmt, ...)
   do {                                                                         \
     _Comptime__da_reserve((da), (da)->count + 1);                              \
     (da)->items[(da)->count++] = (item);                                       \
-      } while (0
+  } while (0)
 
-int _Comptime__sb_appendf(_Comptime__String_Builder *sb, const char *fmt, ...) {
-  va_list args;
+#define __Declare_Comptime_Buffer(suffix)                                      \
+  extern _Comptime__String_Builder _Comptime_Buffer_##suffix;                  \
+  void _Comptime_Buffer_appendf_##suffix(const char *fmt, ...);
 
-  va_start(args, fmt);
-  int n = vsnprintf(NULL, 0, fmt, args);
-  va_end(args);
+__Declare_Comptime_Buffer(TopLevel);
 
-  _Comptime__da_reserve(sb, sb->count + n + 1);
-  char *dest = sb->items + sb->count;
-  va_start(args, fmt);
-  vsnprintf(dest, n + 1, fmt, args);
-  va_end(args);
-
-  sb->count += n;
-  return n;
-}
+// Blocks are registered first and run afterwards. Blocks of different
+// groups share no state and may run concurrently (on threads or in forked
+// children), blocks of one group run in statement order, and group -1 runs in
+// order on the main thread. Outputs are emitted in statement order either way.
+void __Comptime_schedule(void (*fn)(_ComptimeCtx), _ComptimeCtx ctx,
+                         int group);
+void __Comptime_Register_All(void);
+char *_Comptime_parallel_for(long begin, long end, _ComptimeChunkFn fn,
+                             void *ctx);
 
 #define __Define_Comptime_Buffer(suffix)                                       \
   _Comptime__String_Builder _Comptime_Buffer_##suffix = {0};                   \
@@ -94,35 +130,829 @@ int _Comptime__sb_appendf(_Comptime__String_Builder *sb, const char *fmt, ...) {
     sb->count += n;                                                            \
   };
 
-__Define_Comptime_Buffer(TopLevel);
-
 #define __Comptime_Statement_Fn(index, ...)                                    \
   __Define_Comptime_Buffer(Inline_##index);                                    \
+  __Define_Comptime_Buffer(TopLevel_##index);                                  \
   void _Comptime_exec##index(_ComptimeCtx _ComptimeCtx) { __VA_ARGS__; }
 
 // __Comptime_Statement_Fn(0, int a = 1)
 
 // this will get called for every comptime block within the main
-#define __Comptime_Register(index, placeholder_index)                          \
-  __Comptime_wrap_exec(                                                        \
+#define __Comptime_Register(index, placeholder_index, group)                   \
+  __Comptime_schedule(                                                         \
       _Comptime_exec##index,                                                   \
-      (_ComptimeCtx){._StatementIndex = index,                                 \
-                     ._PlaceholderIndex = placeholder_index,                   \
-                     .TopLevel =                                               \
-                         (_Comptime_Buffer_Vtable){                            \
-                             ._sb = &_Comptime_Buffer_TopLevel,                \
-                             .appendf = _Comptime_Buffer_appendf_TopLevel},    \
-                     .Inline = (_Comptime_Buffer_Vtable){                      \
-                         ._sb = &_Comptime_Buffer_Inline_##index,              \
-                         .appendf = _Comptime_Buffer_appendf_Inline_##index}})
-
-#define __Comptime_Register_Main_Exec(index) __Comptime_Register(index, -1)
-
-#define __Comptime_Register_Type_Exec(index, placeholder_index)                \
-  __Comptime_Register(index, placeholder_index)
-
-void __Comptime_wrap_exec(void (*fn)(_ComptimeCtx), _ComptimeCtx ctx) {
-  fn(ctx);
+      (_ComptimeCtx){                                                          \
+          ._StatementIndex = index,                                            \
+          ._PlaceholderIndex = placeholder_index,                              \
+          .parallel_for = _Comptime_parallel_for,                              \
+          .TopLevel = (_Comptime_Buffer_Vtable){                               \
+              ._sb = &_Comptime_Buffer_TopLevel_##index,                       \
+              .appendf = _Comptime_Buffer_appendf_TopLevel_##index},           \
+          .Inline = (_Comptime_Buffer_Vtable){                                 \
+              ._sb = &_Comptime_Buffer_Inline_##index,                         \
+              .appendf = _Comptime_Buffer_appendf_Inline_##index}},            \
+      group)
+
+#define __Comptime_Register_Main_Exec(index, group)                            \
+  __Comptime_Register(index, -1, group)
+
+#define __Comptime_Register_Type_Exec(index, placeholder_index, group)         \
+  __Comptime_Register(index, placeholder_index, group)
+
+// Markers overriding the independence analysis of a block.
+#define _ComptimeParallel ((void)0)
+#define _ComptimeSequential ((void)0)
+
+#ifdef _COMPTIME_UNIT_RUNTIME
+#ifndef _WIN32
+#include <poll.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <dirent.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#define _COMPTIME_LOCK(mutex) pthread_mutex_lock(mutex)
+#define _COMPTIME_UNLOCK(mutex) pthread_mutex_unlock(mutex)
+#else
+#define _COMPTIME_LOCK(mutex) ((void)0)
+#define _COMPTIME_UNLOCK(mutex) ((void)0)
+#endif
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define _COMPTIME_THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+#define _COMPTIME_THREAD_LOCAL __declspec(thread)
+#else
+#define _COMPTIME_THREAD_LOCAL __thread
+#endif
+
+static FILE *_Comptime_FP;
+
+int _Comptime__sb_appendf(_Comptime__String_Builder *sb, const char *fmt, ...) {
+  va_list args;
+
+  va_start(args, fmt);
+  int n = vsnprintf(NULL, 0, fmt, args);
+  va_end(args);
+
+  _Comptime__da_reserve(sb, sb->count + n + 1);
+  char *dest = sb->items + sb->count;
+  va_start(args, fmt);
+  vsnprintf(dest, n + 1, fmt, args);
+  va_end(args);
+
+  sb->count += n;
+  return n;
+}
+
+__Define_Comptime_Buffer(TopLevel);
+
+// Every file a comptime block opens for reading is recorded (per block) and
+// written to the inputs list, so ccomptime can track them as dependencies.
+// So are the environment variables it looks up, and the calls whose result
+// cannot be tracked at all (the time, commands, directory listings).
+typedef enum {
+  _Comptime_Input_Read = 'r',
+  _Comptime_Input_Env = 'e',
+  _Comptime_Input_Untracked = 'x',
+} _Comptime_InputKind;
+
+typedef struct {
+  int block;
+  char kind;
+  char *name;
+} _Comptime_Input;
+
+static struct {
+  _Comptime_Input *items;
+  size_t count;
+  size_t capacity;
+} _Comptime_Inputs = {0};
+
+static _COMPTIME_THREAD_LOCAL int _Comptime_CurrentBlock = -1;
+#ifndef _WIN32
+static pthread_mutex_t _Comptime_Inputs_Lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void _Comptime_record_block_input(int block, char kind,
+                                         const char *name) {
+  if (!name)
+    return;
+  _COMPTIME_LOCK(&_Comptime_Inputs_Lock);
+  for (size_t i = 0; i < _Comptime_Inputs.count; i++) {
+    _Comptime_Input *input = &_Comptime_Inputs.items[i];
+    if (input->block == block && input->kind == kind &&
+        strcmp(input->name, name) == 0) {
+      _COMPTIME_UNLOCK(&_Comptime_Inputs_Lock);
+      return;
+    }
+  }
+  size_t len = strlen(name);
+  char *copy = malloc(len + 1);
+  assert(copy != NULL && "Buy more RAM lol");
+  memcpy(copy, name, len + 1);
+  _Comptime__da_append(&_Comptime_Inputs,
+                       ((_Comptime_Input){block, kind, copy}));
+  _COMPTIME_UNLOCK(&_Comptime_Inputs_Lock);
+}
+
+static void _Comptime_record_input(const char *path) {
+  _Comptime_record_block_input(_Comptime_CurrentBlock, _Comptime_Input_Read,
+                               path);
+}
+
+static int _Comptime_mode_reads(const char *mode) {
+  return mode && (mode[0] == 'r' || (mode[0] == 'a' && strchr(mode, '+')));
+}
+
+// The runner is linked with `--wrap` for these (see
+// cmd_append_runner_link_flags in main.c), so the calls of the program, the
+// blocks and this runtime reach the wrappers first and `__real_` names the
+// libc function. Linkers without `--wrap` (Apple's, Windows') get none.
+#if !defined(_WIN32) && !defined(__APPLE__)
+FILE *__real_fopen(const char *path, const char *mode);
+FILE *__real_freopen(const char *path, const char *mode, FILE *stream);
+int __real_open(const char *path, int flags, ...);
+char *__real_getenv(const char *name);
+time_t __real_time(time_t *t);
+FILE *__real_popen(const char *command, const char *mode);
+int __real_system(const char *command);
+DIR *__real_opendir(const char *path);
+
+static void _Comptime_record_untracked(const char *call) {
+  _Comptime_record_block_input(_Comptime_CurrentBlock,
+                               _Comptime_Input_Untracked, call);
+}
+
+char *__wrap_getenv(const char *name) {
+  _Comptime_record_block_input(_Comptime_CurrentBlock, _Comptime_Input_Env,
+                               name);
+  return __real_getenv(name);
+}
+
+time_t __wrap_time(time_t *t) {
+  _Comptime_record_untracked("time");
+  return __real_time(t);
+}
+
+FILE *__wrap_popen(const char *command, const char *mode) {
+  _Comptime_record_untracked("popen");
+  return __real_popen(command, mode);
+}
+
+int __wrap_system(const char *command) {
+  _Comptime_record_untracked("system");
+  return __real_system(command);
+}
+
+DIR *__wrap_opendir(const char *path) {
+  _Comptime_record_untracked("opendir");
+  return __real_opendir(path);
+}
+
+FILE *__wrap_fopen(const char *path, const char *mode) {
+  if (_Comptime_mode_reads(mode))
+    _Comptime_record_input(path);
+  return __real_fopen(path, mode);
+}
+
+FILE *__wrap_freopen(const char *path, const char *mode, FILE *stream) {
+  if (_Comptime_mode_reads(mode))
+    _Comptime_record_input(path);
+  return __real_freopen(path, mode, stream);
+}
+
+static mode_t _Comptime_open_mode(int flags, va_list args) {
+  return flags & O_CREAT ? (mode_t)va_arg(args, int) : 0;
+}
+
+static void _Comptime_record_open(const char *path, int flags) {
+  if ((flags & O_ACCMODE) != O_WRONLY && !(flags & O_TRUNC))
+    _Comptime_record_input(path);
+}
+
+int __wrap_open(const char *path, int flags, ...) {
+  va_list args;
+  va_start(args, flags);
+  mode_t mode = _Comptime_open_mode(flags, args);
+  va_end(args);
+  _Comptime_record_open(path, flags);
+  return __real_open(path, flags, mode);
+}
+
+// what glibc headers call instead with _FILE_OFFSET_BITS=64
+#ifdef __GLIBC__
+FILE *__real_fopen64(const char *path, const char *mode);
+FILE *__real_freopen64(const char *path, const char *mode, FILE *stream);
+int __real_open64(const char *path, int flags, ...);
+
+FILE *__wrap_fopen64(const char *path, const char *mode) {
+  if (_Comptime_mode_reads(mode))
+    _Comptime_record_input(path);
+  return __real_fopen64(path, mode);
+}
+
+FILE *__wrap_freopen64(const char *path, const char *mode, FILE *stream) {
+  if (_Comptime_mode_reads(mode))
+    _Comptime_record_input(path);
+  return __real_freopen64(path, mode, stream);
+}
+
+int __wrap_open64(const char *path, int flags, ...) {
+  va_list args;
+  va_start(args, flags);
+  mode_t mode = _Comptime_open_mode(flags, args);
+  va_end(args);
+  _Comptime_record_open(path, flags);
+  return __real_open64(path, flags, mode);
+}
+#endif // __GLIBC__
+#endif
+
+static void _Comptime_write_inputs(const char *inputs_path) {
+  FILE *fp = fopen(inputs_path, "w");
+  if (!fp) {
+    fprintf(stderr, "Failed to open %s for writing\n", inputs_path);
+    exit(EXIT_FAILURE);
+  }
+  for (size_t i = 0; i < _Comptime_Inputs.count; i++) {
+    _Comptime_Input *input = &_Comptime_Inputs.items[i];
+    fprintf(fp, "%d %c %s\n", input->block, input->kind, input->name);
+  }
+  fclose(fp);
+}
+
+// parallel_for splits its range into chunks with a buffer each. Chunks go
+// to a worker pool shared by all blocks (started on first use), the calling
+// thread works on its own loop as well, and the buffers are joined in order.
+typedef struct _Comptime_Loop {
+  _ComptimeChunkFn fn;
+  void *ctx;
+  long begin, end, chunk_size;
+  size_t chunk_count, next_chunk, done;
+  _ComptimeChunk *chunks;
+  int block;
+  long long pool_cpu_ns;
+  struct _Comptime_Loop *next;
+} _Comptime_Loop;
+
+static int _Comptime_PoolSize = 1;
+
+// Block costs for -comptime-profile. CPU time of parallel_for chunks that ran
+// on pool threads is handed back to the calling block.
+static _COMPTIME_THREAD_LOCAL long long _Comptime_PoolCpuNs = 0;
+// where a block ran: 0 for the main thread, the worker number for group
+// workers, the process id for forked children
+static _COMPTIME_THREAD_LOCAL int _Comptime_Lane = 0;
+
+#ifndef _WIN32
+static long long _Comptime_clock_ns(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static long _Comptime_peak_rss_kb(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024; // bytes there
+#else
+  return usage.ru_maxrss;
+#endif
+}
+#endif
+
+static void _Comptime_chunk_appendf(_ComptimeChunk *chunk, const char *fmt,
+                                    ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(NULL, 0, fmt, args);
+  va_end(args);
+  _Comptime__da_reserve(&chunk->_sb, chunk->_sb.count + n + 1);
+  va_start(args, fmt);
+  vsnprintf(chunk->_sb.items + chunk->_sb.count, n + 1, fmt, args);
+  va_end(args);
+  chunk->_sb.count += n;
+}
+
+static void _Comptime_run_chunk(_Comptime_Loop *loop, size_t chunk) {
+  long begin = loop->begin + (long)chunk * loop->chunk_size;
+  long end = begin + loop->chunk_size;
+  if (end > loop->end)
+    end = loop->end;
+  for (long i = begin; i < end; i++) {
+    loop->fn(i, &loop->chunks[chunk], loop->ctx);
+  }
+}
+
+#ifndef _WIN32
+static struct {
+  pthread_mutex_t lock;
+  pthread_cond_t work, finished;
+  _Comptime_Loop *loops; // loops with unclaimed chunks
+  int started;
+} _Comptime_Pool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+                    PTHREAD_COND_INITIALIZER, NULL, 0};
+
+// Claims the next chunk of `loop`, or of any pending loop when it is NULL.
+// Called with the pool locked.
+static _Comptime_Loop *_Comptime_claim_chunk(_Comptime_Loop *loop,
+                                             size_t *chunk) {
+  _Comptime_Loop **link = &_Comptime_Pool.loops;
+  while (*link && loop && *link != loop)
+    link = &(*link)->next;
+  _Comptime_Loop *claimed = *link;
+  if (!claimed)
+    return NULL;
+  *chunk = claimed->next_chunk++;
+  if (claimed->next_chunk == claimed->chunk_count)
+    *link = claimed->next;
+  return claimed;
+}
+
+static void _Comptime_finish_chunk(_Comptime_Loop *loop, size_t chunk,
+                                   int on_pool) {
+  int block = _Comptime_CurrentBlock;
+  long long cpu = _Comptime_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+  _Comptime_CurrentBlock = loop->block;
+  _Comptime_run_chunk(loop, chunk);
+  _Comptime_CurrentBlock = block;
+  cpu = _Comptime_clock_ns(CLOCK_THREAD_CPUTIME_ID) - cpu;
+
+  _COMPTIME_LOCK(&_Comptime_Pool.lock);
+  if (on_pool)
+    loop->pool_cpu_ns += cpu;
+  if (++loop->done == loop->chunk_count)
+    pthread_cond_broadcast(&_Comptime_Pool.finished);
+  _COMPTIME_UNLOCK(&_Comptime_Pool.lock);
+}
+
+static void *_Comptime_pool_worker(void *arg) {
+  (void)arg;
+  _COMPTIME_LOCK(&_Comptime_Pool.lock);
+  for (;;) {
+    size_t chunk;
+    _Comptime_Loop *loop = _Comptime_claim_chunk(NULL, &chunk);
+    if (!loop) {
+      pthread_cond_wait(&_Comptime_Pool.work, &_Comptime_Pool.lock);
+      continue;
+    }
+    _COMPTIME_UNLOCK(&_Comptime_Pool.lock);
+    _Comptime_finish_chunk(loop, chunk, 1);
+    _COMPTIME_LOCK(&_Comptime_Pool.lock);
+  }
+  return NULL;
+}
+
+// A forked child only inherits the forking thread, so it starts a pool of
+// its own if it needs one.
+static void _Comptime_pool_after_fork(void) {
+  pthread_mutex_init(&_Comptime_Pool.lock, NULL);
+  pthread_cond_init(&_Comptime_Pool.work, NULL);
+  pthread_cond_init(&_Comptime_Pool.finished, NULL);
+  _Comptime_Pool.loops = NULL;
+  _Comptime_Pool.started = 0;
+}
+
+// Called with the pool locked.
+static void _Comptime_start_pool(void) {
+  if (_Comptime_Pool.started)
+    return;
+  _Comptime_Pool.started = 1;
+  pthread_atfork(NULL, NULL, _Comptime_pool_after_fork);
+  for (int i = 1; i < _Comptime_PoolSize; i++) {
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, _Comptime_pool_worker, NULL) != 0)
+      break;
+    pthread_detach(thread);
+  }
+}
+#endif // _WIN32
+
+char *_Comptime_parallel_for(long begin, long end, _ComptimeChunkFn fn,
+                             void *ctx) {
+  _Comptime_Loop loop = {.fn = fn, .ctx = ctx, .begin = begin, .end = end,
+                         .block = _Comptime_CurrentBlock};
+  if (end > begin) {
+    long count = end - begin;
+    long chunks = (long)_Comptime_PoolSize * 4;
+    loop.chunk_size = (count + chunks - 1) / chunks;
+    loop.chunk_count =
+        (size_t)((count + loop.chunk_size - 1) / loop.chunk_size);
+  }
+  loop.chunks = calloc(loop.chunk_count + 1, sizeof(*loop.chunks));
+  assert(loop.chunks != NULL && "Buy more RAM lol");
+  for (size_t i = 0; i < loop.chunk_count; i++) {
+    loop.chunks[i].appendf = _Comptime_chunk_appendf;
+  }
+
+#ifndef _WIN32
+  if (_Comptime_PoolSize > 1 && loop.chunk_count > 1) {
+    _COMPTIME_LOCK(&_Comptime_Pool.lock);
+    _Comptime_start_pool();
+    loop.next = _Comptime_Pool.loops;
+    _Comptime_Pool.loops = &loop;
+    pthread_cond_broadcast(&_Comptime_Pool.work);
+    size_t chunk;
+    while (_Comptime_claim_chunk(&loop, &chunk)) {
+      _COMPTIME_UNLOCK(&_Comptime_Pool.lock);
+      _Comptime_finish_chunk(&loop, chunk, 0);
+      _COMPTIME_LOCK(&_Comptime_Pool.lock);
+    }
+    while (loop.done < loop.chunk_count)
+      pthread_cond_wait(&_Comptime_Pool.finished, &_Comptime_Pool.lock);
+    _COMPTIME_UNLOCK(&_Comptime_Pool.lock);
+  } else
+#endif
+  {
+    for (size_t i = 0; i < loop.chunk_count; i++) {
+      _Comptime_run_chunk(&loop, i);
+    }
+  }
+
+  _Comptime_PoolCpuNs += loop.pool_cpu_ns;
+
+  _Comptime__String_Builder out = {0};
+  _Comptime__da_reserve(&out, 1);
+  for (size_t i = 0; i < loop.chunk_count; i++) {
+    _Comptime__String_Builder *sb = &loop.chunks[i]._sb;
+    _Comptime__da_reserve(&out, out.count + sb->count + 1);
+    memcpy(out.items + out.count, sb->items, sb->count);
+    out.count += sb->count;
+    free(sb->items);
+  }
+  out.items[out.count] = '\0';
+  free(loop.chunks);
+  return out.items;
+}
+
+typedef struct {
+  void (*fn)(_ComptimeCtx);
+  _ComptimeCtx ctx;
+  int group;
+  long long start_ns, wall_ns, cpu_ns;
+  long peak_rss_kb;
+  int lane;
+} _Comptime_Job;
+
+static struct {
+  _Comptime_Job *items;
+  size_t count;
+  size_t capacity;
+} _Comptime_Jobs = {0};
+
+// distinct concurrent groups, in order of their first block
+static struct {
+  int *items;
+  size_t count;
+  size_t capacity;
+} _Comptime_Groups = {0};
+
+void __Comptime_schedule(void (*fn)(_ComptimeCtx), _ComptimeCtx ctx,
+                         int group) {
+  assert((size_t)ctx._StatementIndex == _Comptime_Jobs.count);
+  _Comptime__da_append(&_Comptime_Jobs,
+                       ((_Comptime_Job){.fn = fn, .ctx = ctx, .group = group}));
+  if (group < 0)
+    return;
+  for (size_t i = 0; i < _Comptime_Groups.count; i++) {
+    if (_Comptime_Groups.items[i] == group)
+      return;
+  }
+  _Comptime__da_append(&_Comptime_Groups, group);
+}
+
+static void _Comptime_exec(_Comptime_Job *job) {
+  _Comptime_CurrentBlock = job->ctx._StatementIndex;
+#ifndef _WIN32
+  long long wall = _Comptime_clock_ns(CLOCK_MONOTONIC);
+  long long cpu = _Comptime_clock_ns(CLOCK_THREAD_CPUTIME_ID);
+  long rss = _Comptime_peak_rss_kb();
+  _Comptime_PoolCpuNs = 0;
+#endif
+  job->fn(job->ctx);
+#ifndef _WIN32
+  job->start_ns = wall;
+  job->lane = _Comptime_Lane;
+  job->wall_ns = _Comptime_clock_ns(CLOCK_MONOTONIC) - wall;
+  job->cpu_ns = _Comptime_clock_ns(CLOCK_THREAD_CPUTIME_ID) - cpu +
+                _Comptime_PoolCpuNs;
+  job->peak_rss_kb = _Comptime_peak_rss_kb() - rss;
+#endif
+  _Comptime_CurrentBlock = -1;
+}
+
+static void _Comptime_exec_group(int group) {
+  for (size_t i = 0; i < _Comptime_Jobs.count; i++) {
+    if (_Comptime_Jobs.items[i].group == group)
+      _Comptime_exec(&_Comptime_Jobs.items[i]);
+  }
+}
+
+#ifndef _WIN32
+static pthread_mutex_t _Comptime_Groups_Lock = PTHREAD_MUTEX_INITIALIZER;
+static size_t _Comptime_NextGroup = 0;
+
+static void *_Comptime_group_worker(void *arg) {
+  _Comptime_Lane = (int)(intptr_t)arg;
+  for (;;) {
+    _COMPTIME_LOCK(&_Comptime_Groups_Lock);
+    int group = _Comptime_NextGroup < _Comptime_Groups.count
+                    ? _Comptime_Groups.items[_Comptime_NextGroup++]
+                    : -1;
+    _COMPTIME_UNLOCK(&_Comptime_Groups_Lock);
+    if (group < 0)
+      return NULL;
+    _Comptime_exec_group(group);
+  }
+}
+
+// The calling thread runs the sequential group while up to `jobs - 1`
+// workers take the concurrent groups, then it helps them out.
+static void _Comptime_run_threads(int jobs) {
+  size_t thread_count = (size_t)jobs - 1;
+  if (thread_count > _Comptime_Groups.count)
+    thread_count = _Comptime_Groups.count;
+  pthread_t *threads = malloc(thread_count * sizeof(*threads));
+  assert(threads != NULL && "Buy more RAM lol");
+
+  size_t started = 0;
+  while (started < thread_count &&
+         pthread_create(&threads[started], NULL, _Comptime_group_worker,
+                        (void *)(intptr_t)(started + 1)) == 0)
+    started++;
+
+  _Comptime_exec_group(-1);
+  _Comptime_group_worker(NULL);
+
+  for (size_t i = 0; i < started; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  free(threads);
+}
+
+// Fork mode: each concurrent group runs in a child process with a
+// copy-on-write snapshot of the program state, so blocks need not be thread
+// safe. The child sends its block outputs and recorded inputs back over a
+// pipe as length-prefixed records:
+//   [jobs] { [statement] [start ns] [wall ns] [cpu ns] [peak rss kb] [lane]
+//            [inline bytes] [top level bytes] }
+//   [inputs] { [block] [path bytes] }
+typedef struct {
+  pid_t pid;
+  int fd;
+  int group;
+  _Comptime__String_Builder data;
+} _Comptime_Child;
+
+static void _Comptime_write_all(int fd, const void *data, size_t len) {
+  const char *p = data;
+  while (len > 0) {
+    ssize_t n = write(fd, p, len);
+    if (n <= 0) {
+      perror("comptime child: write");
+      _exit(EXIT_FAILURE);
+    }
+    p += n;
+    len -= (size_t)n;
+  }
+}
+
+static void _Comptime_write_record(int fd, const void *data, size_t len) {
+  _Comptime_write_all(fd, &len, sizeof(len));
+  _Comptime_write_all(fd, data, len);
+}
+
+static void _Comptime_group_child(int group, int fd) {
+  _Comptime_Lane = (int)getpid();
+  size_t inputs_before = _Comptime_Inputs.count;
+  _Comptime_exec_group(group);
+  fflush(NULL);
+
+  size_t job_count = 0;
+  for (size_t i = 0; i < _Comptime_Jobs.count; i++) {
+    job_count += _Comptime_Jobs.items[i].group == group;
+  }
+  _Comptime_write_all(fd, &job_count, sizeof(job_count));
+  for (size_t i = 0; i < _Comptime_Jobs.count; i++) {
+    _ComptimeCtx *ctx = &_Comptime_Jobs.items[i].ctx;
+    if (_Comptime_Jobs.items[i].group != group)
+      continue;
+    _Comptime_write_all(fd, &ctx->_StatementIndex,
+                        sizeof(ctx->_StatementIndex));
+    _Comptime_Job *job = &_Comptime_Jobs.items[i];
+    _Comptime_write_all(fd, &job->start_ns, sizeof(job->start_ns));
+    _Comptime_write_all(fd, &job->wall_ns, sizeof(job->wall_ns));
+    _Comptime_write_all(fd, &job->cpu_ns, sizeof(job->cpu_ns));
+    _Comptime_write_all(fd, &job->peak_rss_kb, sizeof(job->peak_rss_kb));
+    _Comptime_write_all(fd, &job->lane, sizeof(job->lane));
+    _Comptime_write_record(fd, ctx->Inline._sb->items, ctx->Inline._sb->count);
+    _Comptime_write_record(fd, ctx->TopLevel._sb->items,
+                           ctx->TopLevel._sb->count);
+  }
+
+  size_t input_count = _Comptime_Inputs.count - inputs_before;
+  _Comptime_write_all(fd, &input_count, sizeof(input_count));
+  for (size_t i = inputs_before; i < _Comptime_Inputs.count; i++) {
+    _Comptime_Input *input = &_Comptime_Inputs.items[i];
+    _Comptime_write_all(fd, &input->block, sizeof(input->block));
+    _Comptime_write_all(fd, &input->kind, sizeof(input->kind));
+    _Comptime_write_record(fd, input->name, strlen(input->name));
+  }
+
+  close(fd);
+  _exit(EXIT_SUCCESS);
+}
+
+static const char *_Comptime_read_field(const char **cursor, const char *end,
+                                        size_t len) {
+  assert((size_t)(end - *cursor) >= len && "truncated comptime child output");
+  const char *field = *cursor;
+  *cursor += len;
+  return field;
+}
+
+static size_t _Comptime_read_size(const char **cursor, const char *end) {
+  size_t value;
+  memcpy(&value, _Comptime_read_field(cursor, end, sizeof(value)),
+         sizeof(value));
+  return value;
+}
+
+static int _Comptime_read_int(const char **cursor, const char *end) {
+  int value;
+  memcpy(&value, _Comptime_read_field(cursor, end, sizeof(value)),
+         sizeof(value));
+  return value;
+}
+
+static void _Comptime_sb_append_buf(_Comptime__String_Builder *sb,
+                                    const char *data, size_t len) {
+  _Comptime__da_reserve(sb, sb->count + len + 1);
+  memcpy(sb->items + sb->count, data, len);
+  sb->count += len;
+}
+
+static void _Comptime_apply_child_output(_Comptime_Child *child) {
+  const char *cursor = child->data.items;
+  const char *end = child->data.items + child->data.count;
+
+  size_t job_count = _Comptime_read_size(&cursor, end);
+  for (size_t i = 0; i < job_count; i++) {
+    int statement = _Comptime_read_int(&cursor, end);
+    assert(statement >= 0 && (size_t)statement < _Comptime_Jobs.count);
+    _Comptime_Job *job = &_Comptime_Jobs.items[statement];
+    _ComptimeCtx *ctx = &job->ctx;
+    memcpy(&job->start_ns,
+           _Comptime_read_field(&cursor, end, sizeof(long long)),
+           sizeof(long long));
+    memcpy(&job->wall_ns, _Comptime_read_field(&cursor, end, sizeof(long long)),
+           sizeof(long long));
+    memcpy(&job->cpu_ns, _Comptime_read_field(&cursor, end, sizeof(long long)),
+           sizeof(long long));
+    memcpy(&job->peak_rss_kb, _Comptime_read_field(&cursor, end, sizeof(long)),
+           sizeof(long));
+    job->lane = _Comptime_read_int(&cursor, end);
+
+    size_t len = _Comptime_read_size(&cursor, end);
+    _Comptime_sb_append_buf(ctx->Inline._sb,
+                            _Comptime_read_field(&cursor, end, len), len);
+    len = _Comptime_read_size(&cursor, end);
+    _Comptime_sb_append_buf(ctx->TopLevel._sb,
+                            _Comptime_read_field(&cursor, end, len), len);
+  }
+
+  size_t input_count = _Comptime_read_size(&cursor, end);
+  for (size_t i = 0; i < input_count; i++) {
+    int block = _Comptime_read_int(&cursor, end);
+    char kind = *_Comptime_read_field(&cursor, end, sizeof(kind));
+    size_t len = _Comptime_read_size(&cursor, end);
+    const char *name = _Comptime_read_field(&cursor, end, len);
+    char *copy = malloc(len + 1);
+    assert(copy != NULL && "Buy more RAM lol");
+    memcpy(copy, name, len);
+    copy[len] = '\0';
+    _Comptime_record_block_input(block, kind, copy);
+    free(copy);
+  }
+}
+
+static int _Comptime_spawn_group(_Comptime_Child *child, int group) {
+  int fds[2];
+  fflush(NULL); // or the child would print our buffered output again
+  if (pipe(fds) < 0)
+    return 0;
+  pid_t pid = fork();
+  if (pid < 0) {
+    close(fds[0]);
+    close(fds[1]);
+    return 0;
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    _Comptime_group_child(group, fds[1]);
+  }
+  close(fds[1]);
+  *child = (_Comptime_Child){.pid = pid, .fd = fds[0], .group = group};
+  return 1;
+}
+
+static void _Comptime_run_forks(int jobs) {
+  _Comptime_Child *children = calloc((size_t)jobs, sizeof(*children));
+  struct pollfd *fds = calloc((size_t)jobs, sizeof(*fds));
+  assert(children != NULL && fds != NULL && "Buy more RAM lol");
+
+  size_t next = 0, active = 0;
+  int failed = 0;
+#define _COMPTIME_SPAWN_MORE()                                                 \
+  while (next < _Comptime_Groups.count && active < (size_t)jobs) {             \
+    int group = _Comptime_Groups.items[next++];                                \
+    if (_Comptime_spawn_group(&children[active], group))                       \
+      active++;                                                                \
+    else                                                                       \
+      _Comptime_exec_group(group);                                             \
+  }
+
+  _COMPTIME_SPAWN_MORE();
+  _Comptime_exec_group(-1);
+
+  while (active > 0) {
+    for (size_t i = 0; i < active; i++) {
+      fds[i] = (struct pollfd){.fd = children[i].fd, .events = POLLIN};
+    }
+    if (poll(fds, active, -1) < 0)
+      continue;
+
+    for (size_t i = active; i-- > 0;) {
+      if (!(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+        continue;
+      _Comptime_Child *child = &children[i];
+      _Comptime__da_reserve(&child->data, child->data.count + 4096);
+      ssize_t n = read(child->fd, child->data.items + child->data.count, 4096);
+      if (n > 0) {
+        child->data.count += (size_t)n;
+        continue;
+      }
+
+      close(child->fd);
+      int status = 0;
+      waitpid(child->pid, &status, 0);
+      if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        _Comptime_apply_child_output(child);
+      } else {
+        fprintf(stderr, "comptime block group %d failed\n", child->group);
+        failed = 1;
+      }
+      free(child->data.items);
+      children[i] = children[--active];
+      fds[i] = fds[active];
+    }
+    _COMPTIME_SPAWN_MORE();
+  }
+#undef _COMPTIME_SPAWN_MORE
+
+  free(fds);
+  free(children);
+  if (failed)
+    exit(EXIT_FAILURE);
+}
+#endif // _WIN32
+
+static void _Comptime_run_jobs(int jobs, int fork_mode) {
+#ifndef _WIN32
+  if (jobs > 1 && _Comptime_Groups.count > 0) {
+    if (fork_mode)
+      _Comptime_run_forks(jobs);
+    else
+      _Comptime_run_threads(jobs);
+    return;
+  }
+#endif
+  (void)fork_mode;
+  for (size_t i = 0; i < _Comptime_Jobs.count; i++) {
+    _Comptime_exec(&_Comptime_Jobs.items[i]);
+  }
+}
+
+static void _Comptime_write_profile(const char *profile_path) {
+  FILE *f = fopen(profile_path, "w");
+  if (!f) {
+    fprintf(stderr, "Failed to open %s for writing\n", profile_path);
+    return;
+  }
+  for (size_t i = 0; i < _Comptime_Jobs.count; i++) {
+    _Comptime_Job *job = &_Comptime_Jobs.items[i];
+    fprintf(f, "%d %lld %lld %ld %zu %zu %lld %d\n", job->ctx._StatementIndex,
+            job->wall_ns, job->cpu_ns, job->peak_rss_kb,
+            job->ctx.Inline._sb->count, job->ctx.TopLevel._sb->count,
+            job->start_ns, job->lane);
+  }
+  fclose(f);
+}
+
+static void _Comptime_emit(_ComptimeCtx ctx) {
   fprintf(_Comptime_FP, "#define _COMPTIME_X%d(...) %.*s\n",
           ctx._StatementIndex, (int)ctx.Inline._sb->count,
           ctx.Inline._sb->items);
@@ -131,28 +961,49 @@ void __Comptime_wrap_exec(void (*fn)(_ComptimeCtx), _ComptimeCtx ctx) {
             ctx._PlaceholderIndex, (int)ctx.Inline._sb->count,
             ctx.Inline._sb->items);
   }
+  _Comptime__String_Builder *top_level = ctx.TopLevel._sb;
+  if (top_level->count > 0) {
+    _Comptime__da_reserve(&_Comptime_Buffer_TopLevel,
+                          _Comptime_Buffer_TopLevel.count + top_level->count);
+    memcpy(_Comptime_Buffer_TopLevel.items + _Comptime_Buffer_TopLevel.count,
+           top_level->items, top_level->count);
+    _Comptime_Buffer_TopLevel.count += top_level->count;
+  }
 }
 
-#define main _User_main // overwrite the entrypoint of the user program
-#include _INPUT_PROGRAM_PATH
-#undef main
-
-#undef _ComptimeType
-#define _ComptimeType(x) x
-
-#include _INPUT_COMPTIME_DEFS_PATH
+// usage: runner [output-header-path] [inputs-list-path] [jobs] [thread|fork]
+//               [profile-path]
+int main(int argc, char **argv) {
+#ifdef _OUTPUT_HEADERS_PATH
+  const char *output_path = argc > 1 ? argv[1] : _OUTPUT_HEADERS_PATH;
+#else
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <output-header-path>\n", argv[0]);
+    exit(EXIT_FAILURE);
+  }
+  const char *output_path = argv[1];
+#endif
+  int jobs = argc > 3 ? atoi(argv[3]) : 1;
+  int fork_mode = argc > 4 && strcmp(argv[4], "fork") == 0;
+#ifndef _WIN32
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  _Comptime_PoolSize = jobs > 1 ? jobs : cores > 1 ? (int)cores : 1;
+#endif
 
-int main(void) {
-  _Comptime_FP = fopen(_OUTPUT_HEADERS_PATH, "a");
+  _Comptime_FP = fopen(output_path, "a");
   if (!_Comptime_FP) {
-    fprintf(stderr, "Failed to open %s for writing\n", _OUTPUT_HEADERS_PATH);
+    fprintf(stderr, "Failed to open %s for writing\n", output_path);
     exit(EXIT_FAILURE);
   }
 
   fprintf(_Comptime_FP, "\n#undef _COMPTIME_X\n#define _COMPTIME_X(n,...) "
                         "CONCAT(_COMPTIME_X,n)(__VA_ARGS__)\n");
 
-#include _INPUT_COMPTIME_MAIN_PATH
+  __Comptime_Register_All();
+  _Comptime_run_jobs(jobs, fork_mode);
+  for (size_t i = 0; i < _Comptime_Jobs.count; i++) {
+    _Comptime_emit(_Comptime_Jobs.items[i].ctx);
+  }
 
   if (_Comptime_Buffer_TopLevel.count > 0) {
     fprintf(_Comptime_FP, "\n/* top level definitions */\n%.*s\n",
@@ -161,9 +1012,33 @@ int main(void) {
   }
   fflush(_Comptime_FP);
   fclose(_Comptime_FP);
+
+  if (argc > 2)
+    _Comptime_write_inputs(argv[2]);
+  if (argc > 5 && argv[5][0])
+    _Comptime_write_profile(argv[5]);
 }
+#endif // _COMPTIME_UNIT_RUNTIME
 
-#else
-#error                                                                         \
-    "please define _INPUT_PROGRAM_PATH and _OUTPUT_HEADERS_PATH and _INPUT_COMPTIME_DEFS_PATH and _INPUT_COMPTIME_MAIN_PATH "
+#ifdef _COMPTIME_UNIT_PROGRAM
+#define main _User_main // overwrite the entrypoint of the user program
+#include _INPUT_PROGRAM_PATH
+#undef main
+#endif // _COMPTIME_UNIT_PROGRAM
+
+#ifdef _COMPTIME_UNIT_BLOCKS
+#ifndef _COMPTIME_UNIT_PROGRAM
+#define main _User_main
+#include _INPUT_PROGRAM_INTERFACE_PATH
+#undef main
 #endif
+
+#undef _ComptimeType
+#define _ComptimeType(x) x
+
+#include _INPUT_COMPTIME_DEFS_PATH
+
+void __Comptime_Register_All(void) {
+#include _INPUT_COMPTIME_MAIN_PATH
+}
+#endif // _COMPTIME_UNIT_BLOCKS
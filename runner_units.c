@@ -0,0 +1,195 @@
+#include "runner_units.h"
+#include "tree_sitter_c_api.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+  Slice range;
+  const char *with;
+} Edit;
+
+typedef struct {
+  Edit *items;
+  size_t count, capacity;
+} Edits;
+
+static void edit(Edits *edits, Slice range, const char *with) {
+  nob_da_append(edits, ((Edit){.range = range, .with = with}));
+}
+
+static void edit_insert(Edits *edits, const char *at, const char *with) {
+  edit(edits, (Slice){.start = at, .len = 0}, with);
+}
+
+// Outer edits first, so whatever they cover is dropped below.
+static int compare_edit(const void *lhs, const void *rhs) {
+  const Edit *a = lhs;
+  const Edit *b = rhs;
+  if (a->range.start < b->range.start)
+    return -1;
+  if (a->range.start > b->range.start)
+    return 1;
+  return b->range.len - a->range.len;
+}
+
+static void emit_with_edits(const char *src, size_t len, Edits *edits,
+                            String_Builder *out) {
+  const char *cursor = src;
+
+  const char *DEF = "\n#define _COMPILING\n";
+  nob_sb_append_buf(out, DEF, strlen(DEF));
+
+  qsort(edits->items, edits->count, sizeof(Edit), compare_edit);
+
+  nob_da_foreach(Edit, it, edits) {
+    // Edits may nest (a removed function that also contains a comptime
+    // block), so only the part past the cursor still matters.
+    if (cursor > it->range.start) {
+      if (cursor < it->range.start + it->range.len)
+        cursor = it->range.start + it->range.len;
+      continue;
+    }
+
+    nob_sb_append_buf(out, cursor, (size_t)(it->range.start - cursor));
+    nob_sb_append_cstr(out, it->with);
+    cursor = it->range.start + it->range.len;
+  }
+
+  ssize_t tail = src + len - cursor;
+  assert(tail >= 0);
+  nob_sb_append_buf(out, cursor, (size_t)tail);
+}
+
+static void edit_removals(WalkContext *ctx, bool shake, Edits *edits) {
+  nob_da_foreach(Slice, it, &ctx->to_be_removed) { edit(edits, *it, ""); }
+  if (shake) {
+    nob_da_foreach(Slice, it, &ctx->shaken) { edit(edits, *it, ""); }
+  }
+}
+
+static bool is_declarator_field(TSNode node, uint32_t i) {
+  const char *field = ts_node_field_name_for_child(node, i);
+  return field && strcmp(field, "declarator") == 0;
+}
+
+static bool declarator_is_prototype(TSNode declarator) {
+  if (ts_node_symbol(declarator) != sym_function_declarator)
+    return false;
+  TSNode inner = ts_node_child_by_field_name(declarator, "declarator", 10);
+  return !ts_node_is_null(inner) && ts_node_symbol(inner) == sym_identifier;
+}
+
+static void strip_specifiers(Edits *edits, TSNode node, const char *src) {
+  uint32_t n = ts_node_child_count(node);
+  for (uint32_t i = 0; i < n; i++) {
+    TSNode child = ts_node_child(node, i);
+    if (ts_node_symbol(child) == sym_storage_class_specifier &&
+        (ts_node_is_keyword(child, src, "static") ||
+         ts_node_is_keyword(child, src, "inline")))
+      edit(edits, ts_node_range(child, src), "");
+  }
+}
+
+void cct_build_program_unit(WalkContext *ctx, const char *src, size_t len,
+                            bool shake, String_Builder *out) {
+  Edits edits = {0};
+  edit_removals(ctx, shake, &edits);
+
+  nob_da_foreach(TopLevelItem, item, &ctx->top_level) {
+    TSSymbol sym = ts_node_symbol(item->node);
+    if (sym == sym_function_definition ||
+        (sym == sym_declaration &&
+         !ts_declaration_is_const_object(item->node, item->src)))
+      strip_specifiers(&edits, item->node, item->src);
+  }
+
+  emit_with_edits(src, len, &edits, out);
+  free(edits.items);
+}
+
+static void interface_declaration(Edits *edits, TSNode node, const char *src) {
+  // `const` objects keep their initializer in both units (as private copies),
+  // so blocks can still take their `sizeof` or use them in constant contexts.
+  if (ts_declaration_is_const_object(node, src)) {
+    bool is_static = false;
+    uint32_t n = ts_node_child_count(node);
+    for (uint32_t i = 0; i < n; i++) {
+      TSNode child = ts_node_child(node, i);
+      if (ts_node_symbol(child) == sym_storage_class_specifier &&
+          ts_node_is_keyword(child, src, "static"))
+        is_static = true;
+    }
+    if (!is_static)
+      edit_insert(edits, ts_node_range(node, src).start, "static ");
+    return;
+  }
+
+  bool has_object = false;
+  bool has_storage_class = false;
+  uint32_t n = ts_node_child_count(node);
+  for (uint32_t i = 0; i < n; i++) {
+    TSNode child = ts_node_child(node, i);
+    if (ts_node_symbol(child) == sym_storage_class_specifier) {
+      if (ts_node_is_keyword(child, src, "static")) {
+        edit(edits, ts_node_range(child, src), "extern");
+        has_storage_class = true;
+      } else if (ts_node_is_keyword(child, src, "inline")) {
+        edit(edits, ts_node_range(child, src), "");
+      } else {
+        has_storage_class = true;
+      }
+    } else if (is_declarator_field(node, i)) {
+      if (!declarator_is_prototype(child))
+        has_object = true;
+
+      if (ts_node_symbol(child) == sym_init_declarator) {
+        // drop the `= value` part, the definition lives in the program unit
+        TSNode declarator =
+            ts_node_child_by_field_name(child, "declarator", 10);
+        const char *from = src + ts_node_end_byte(declarator);
+        const char *to = src + ts_node_end_byte(child);
+        edit(edits, (Slice){.start = from, .len = (int)(to - from)}, "");
+      }
+    }
+  }
+
+  if (has_object && !has_storage_class)
+    edit_insert(edits, ts_node_range(node, src).start, "extern ");
+}
+
+// Single-header libraries (`#define FOO_IMPLEMENTATION` before the include)
+// already emit their definitions in the program unit.
+static bool is_implementation_switch(TopLevelItem *item) {
+  if (ts_node_symbol(item->node) != sym_preproc_def || item->names.count == 0)
+    return false;
+  Slice name = item->names.items[0];
+  const char *suffix = "_IMPLEMENTATION";
+  int suffix_len = (int)strlen(suffix);
+  return name.len >= suffix_len &&
+         memcmp(name.start + name.len - suffix_len, suffix, suffix_len) == 0;
+}
+
+void cct_build_interface_unit(WalkContext *ctx, const char *src, size_t len,
+                              String_Builder *out) {
+  Edits edits = {0};
+  edit_removals(ctx, true, &edits);
+
+  nob_da_foreach(TopLevelItem, item, &ctx->top_level) {
+    TSSymbol sym = ts_node_symbol(item->node);
+    if (is_implementation_switch(item)) {
+      edit(&edits, item->range, "");
+    } else if (sym == sym_function_definition) {
+      strip_specifiers(&edits, item->node, item->src);
+      TSNode body = ts_node_child_by_field_name(item->node, "body", 4);
+      if (!ts_node_is_null(body))
+        edit(&edits, ts_node_range(body, item->src), ";");
+    } else if (sym == sym_declaration) {
+      interface_declaration(&edits, item->node, item->src);
+    }
+  }
+
+  emit_with_edits(src, len, &edits, out);
+  free(edits.items);
+}
@@ -0,0 +1,17 @@
+#ifndef CCOMPTIME_RUNNER_UNITS_H
+#define CCOMPTIME_RUNNER_UNITS_H
+
+#include "comptime_common.h"
+
+// The comptime-safe program with every top-level definition given external
+// linkage, so the separately compiled comptime blocks can link against it.
+// With `shake` the items no block reaches are left out.
+void cct_build_program_unit(WalkContext *ctx, const char *src, size_t len,
+                            bool shake, String_Builder *out);
+
+// Declarations-only view of the program unit: function bodies become
+// prototypes and object definitions become `extern` declarations.
+void cct_build_interface_unit(WalkContext *ctx, const char *src, size_t len,
+                              String_Builder *out);
+
+#endif // CCOMPTIME_RUNNER_UNITS_H
@@ -0,0 +1,222 @@
+#include "slice_map.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define GROUP_WIDTH 16
+#define CTRL_EMPTY ((uint8_t)0x80)
+#define CTRL_DELETED ((uint8_t)0xfe)
+
+// wyhash-style: fold 8 bytes at a time with a 64x64->128 multiply.
+static inline uint64_t mix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t r = (__uint128_t)a * b;
+  return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+  uint64_t ha = a >> 32, la = (uint32_t)a, hb = b >> 32, lb = (uint32_t)b;
+  uint64_t hi = ha * hb, mid = ha * lb + la * hb, lo = la * lb;
+  return (hi + (mid >> 32)) ^ (lo + (mid << 32));
+#endif
+}
+
+static inline uint64_t read64(const char *p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline uint64_t read32(const char *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// 1 to 7 bytes without a variable-length copy: two overlapping reads, or
+// the first, middle and last byte.
+static inline uint64_t read_tail(const char *p, size_t len) {
+  if (len >= 4)
+    return read32(p) << 32 | read32(p + len - 4);
+  return (uint64_t)(unsigned char)p[0] << 16 |
+         (uint64_t)(unsigned char)p[len / 2] << 8 |
+         (unsigned char)p[len - 1];
+}
+
+uint64_t slice_hash(const char *data, size_t len) {
+  uint64_t h = 0x9e3779b97f4a7c15ull ^ len;
+  while (len >= 8) {
+    h = mix(h ^ read64(data), 0xa0761d6478bd642full);
+    data += 8;
+    len -= 8;
+  }
+  if (len > 0)
+    h = mix(h ^ read_tail(data, len), 0xe7037ed1a0b428dbull);
+  return mix(h, 0x8ebc6af09c88c6e3ull);
+}
+
+// The low bits pick the group, the top 7 go into the control byte.
+static inline size_t hash_group(uint64_t hash) { return (size_t)hash; }
+static inline uint8_t hash_tag(uint64_t hash) { return (uint8_t)(hash >> 57); }
+
+// Bit i set when ctrl[i] == byte.
+static inline uint32_t group_match(const uint8_t *ctrl, uint8_t byte) {
+#if defined(__SSE2__)
+  __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+  return (uint32_t)_mm_movemask_epi8(
+      _mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte)));
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < GROUP_WIDTH; i++)
+    mask |= (uint32_t)(ctrl[i] == byte) << i;
+  return mask;
+#endif
+}
+
+static inline int lowest_bit(uint32_t mask) { return __builtin_ctz(mask); }
+
+static inline bool key_equal(const SliceMapEntry *e, Slice key, uint64_t hash) {
+  return e->hash == hash && e->key.len == key.len &&
+         memcmp(e->key.start, key.start, (size_t)key.len) == 0;
+}
+
+// Groups are aligned, so a probe never wraps inside one; the step grows by a
+// group each time (triangular numbers), which visits every group once.
+static SliceMapEntry *find(const SliceMap *map, Slice key, uint64_t hash) {
+  if (map->capacity == 0)
+    return NULL;
+  size_t mask = map->capacity - 1;
+  size_t pos = hash_group(hash) & mask & ~(size_t)(GROUP_WIDTH - 1);
+  uint8_t tag = hash_tag(hash);
+
+  for (size_t step = GROUP_WIDTH;; step += GROUP_WIDTH) {
+    const uint8_t *ctrl = map->ctrl + pos;
+    for (uint32_t m = group_match(ctrl, tag); m; m &= m - 1) {
+      SliceMapEntry *e = &map->slots[pos + lowest_bit(m)];
+      if (key_equal(e, key, hash))
+        return e;
+    }
+    if (group_match(ctrl, CTRL_EMPTY))
+      return NULL;
+    pos = (pos + step) & mask;
+  }
+}
+
+// First empty or deleted slot on the probe sequence of `hash`.
+static size_t find_free(const SliceMap *map, uint64_t hash) {
+  size_t mask = map->capacity - 1;
+  size_t pos = hash_group(hash) & mask & ~(size_t)(GROUP_WIDTH - 1);
+
+  for (size_t step = GROUP_WIDTH;; step += GROUP_WIDTH) {
+    const uint8_t *ctrl = map->ctrl + pos;
+    uint32_t m =
+        group_match(ctrl, CTRL_EMPTY) | group_match(ctrl, CTRL_DELETED);
+    if (m)
+      return pos + lowest_bit(m);
+    pos = (pos + step) & mask;
+  }
+}
+
+static size_t max_load(size_t capacity) { return capacity - capacity / 8; }
+
+static void resize(SliceMap *map, size_t capacity) {
+  SliceMap next = {
+      .ctrl = malloc(capacity),
+      .slots = malloc(capacity * sizeof(SliceMapEntry)),
+      .capacity = capacity,
+      .count = map->count,
+      .growth_left = max_load(capacity) - map->count,
+  };
+  assert(next.ctrl && next.slots);
+  memset(next.ctrl, CTRL_EMPTY, capacity);
+
+  for (size_t i = 0; i < map->capacity; i++) {
+    if (map->ctrl[i] & 0x80)
+      continue;
+    SliceMapEntry *e = &map->slots[i];
+    size_t slot = find_free(&next, e->hash);
+    next.ctrl[slot] = hash_tag(e->hash);
+    next.slots[slot] = *e;
+  }
+
+  free(map->ctrl);
+  free(map->slots);
+  *map = next;
+}
+
+void *slice_map_get(const SliceMap *map, Slice key) {
+  SliceMapEntry *e = find(map, key, slice_hash(key.start, (size_t)key.len));
+  return e ? e->val : NULL;
+}
+
+SliceMapEntry *slice_map_entry(SliceMap *map, Slice key) {
+  uint64_t hash = slice_hash(key.start, (size_t)key.len);
+  SliceMapEntry *e = find(map, key, hash);
+  if (e)
+    return e;
+
+  if (map->capacity == 0) {
+    resize(map, GROUP_WIDTH);
+  } else if (map->growth_left == 0) {
+    // mostly tombstones in the way: rehash at the same size
+    bool full = map->count + 1 > max_load(map->capacity) / 2;
+    resize(map, full ? map->capacity * 2 : map->capacity);
+  }
+
+  size_t slot = find_free(map, hash);
+  if (map->ctrl[slot] == CTRL_EMPTY)
+    map->growth_left--;
+  map->ctrl[slot] = hash_tag(hash);
+  map->slots[slot] = (SliceMapEntry){.key = key, .hash = hash};
+  map->count++;
+  return &map->slots[slot];
+}
+
+void slice_map_put(SliceMap *map, Slice key, void *val) {
+  slice_map_entry(map, key)->val = val;
+}
+
+bool slice_map_delete(SliceMap *map, Slice key) {
+  SliceMapEntry *e = find(map, key, slice_hash(key.start, (size_t)key.len));
+  if (!e)
+    return false;
+
+  size_t slot = (size_t)(e - map->slots);
+  size_t group = slot & ~(size_t)(GROUP_WIDTH - 1);
+  // A group with an empty slot ends every probe reaching it, so nothing was
+  // ever placed past it on this slot's account and the slot can be reused
+  // outright; otherwise leave a tombstone.
+  if (group_match(map->ctrl + group, CTRL_EMPTY)) {
+    map->ctrl[slot] = CTRL_EMPTY;
+    map->growth_left++;
+  } else {
+    map->ctrl[slot] = CTRL_DELETED;
+  }
+  map->count--;
+  return true;
+}
+
+void slice_map_clear(SliceMap *map) {
+  if (map->capacity == 0)
+    return;
+  memset(map->ctrl, CTRL_EMPTY, map->capacity);
+  map->count = 0;
+  map->growth_left = max_load(map->capacity);
+}
+
+void slice_map_free(SliceMap *map) {
+  free(map->ctrl);
+  free(map->slots);
+  *map = (SliceMap){0};
+}
+
+SliceMapEntry *slice_map_next(const SliceMap *map, size_t *it) {
+  for (; *it < map->capacity; (*it)++) {
+    if (!(map->ctrl[*it] & 0x80))
+      return &map->slots[(*it)++];
+  }
+  return NULL;
+}
@@ -0,0 +1,47 @@
+#ifndef CCOMPTIME_SLICE_MAP_H
+#define CCOMPTIME_SLICE_MAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  const char *start;
+  int len;
+} Slice;
+
+// Open-addressing hash table keyed on borrowed `Slice`s (the bytes must
+// outlive the map). Swiss-table layout: one control byte per slot holding 7
+// bits of the hash, probed a group of 16 at a time, and the full hash stored
+// with every entry so mismatches rarely reach memcmp. A zeroed map is empty.
+
+typedef struct {
+  Slice key;
+  uint64_t hash;
+  void *val;
+} SliceMapEntry;
+
+typedef struct {
+  uint8_t *ctrl;
+  SliceMapEntry *slots;
+  size_t capacity; // power of two, at least one group
+  size_t count;
+  size_t growth_left; // empty slots that may still be taken before growing
+} SliceMap;
+
+uint64_t slice_hash(const char *data, size_t len);
+
+void *slice_map_get(const SliceMap *map, Slice key);
+// The entry of `key`, inserted with a NULL value if absent. Valid until the
+// next insertion.
+SliceMapEntry *slice_map_entry(SliceMap *map, Slice key);
+void slice_map_put(SliceMap *map, Slice key, void *val);
+bool slice_map_delete(SliceMap *map, Slice key);
+void slice_map_clear(SliceMap *map);
+void slice_map_free(SliceMap *map);
+
+// Visit the entries in slot order:
+//   for (size_t it = 0; (e = slice_map_next(&map, &it));) ...
+SliceMapEntry *slice_map_next(const SliceMap *map, size_t *it);
+
+#endif // CCOMPTIME_SLICE_MAP_H
@@ -0,0 +1,130 @@
+#include "stats.h"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+_Thread_local FileStats *stats_current = NULL;
+
+static struct {
+  bool enabled;
+  struct {
+    FileStats *items;
+    size_t count;
+    size_t capacity;
+  } files;
+  StatsStages stages;
+} stats = {0};
+
+static const char *stats_pass_names[StatsPass__Count] = {
+    [StatsPass_ExpandMacros] = "cct_expand_macros",
+    [StatsPass_CorrectComptimeType] = "cct_correct_comptimetype_nodes",
+    [StatsPass_CollectStatements] = "cct_collect_comptime_statements",
+    [StatsPass_IndexTopLevel] = "cct_index_top_level",
+    [StatsPass_ClassifyBlocks] = "cct_classify_blocks",
+};
+
+void stats_start(void) { stats.enabled = true; }
+
+bool stats_enabled(void) { return stats.enabled; }
+
+void stats_begin_file(const char *file) {
+  stats_resume_file(stats_add_file(file));
+}
+
+size_t stats_add_file(const char *file) {
+  if (!stats.enabled)
+    return 0;
+  da_append(&stats.files, ((FileStats){.file = file}));
+  return stats.files.count - 1;
+}
+
+void stats_resume_file(size_t index) {
+  if (!stats.enabled)
+    return;
+  // later appends may move it, but none happen before stats_end_file()
+  stats_current = &stats.files.items[index];
+}
+
+void stats_end_file(void) {
+  if (!stats_current)
+    return;
+#ifndef _WIN32
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  stats_current->peak_rss_kb = usage.ru_maxrss;
+  getrusage(RUSAGE_CHILDREN, &usage);
+  stats_current->children_peak_rss_kb = usage.ru_maxrss;
+#ifdef __APPLE__
+  stats_current->peak_rss_kb /= 1024; // bytes there
+  stats_current->children_peak_rss_kb /= 1024;
+#endif
+#endif
+  stats_current = NULL;
+}
+
+void stats_record_stage(const char *name, long long ns) {
+  if (!stats.enabled)
+    return;
+  StatsStages *stages = stats_current ? &stats_current->stages : &stats.stages;
+  da_append(stages, ((StatsStage){.name = strdup(name), .ms = ns / 1e6}));
+}
+
+const FileStats *stats_files(size_t *count) {
+  *count = stats.files.count;
+  return stats.files.items;
+}
+
+const StatsStages *stats_global_stages(void) { return &stats.stages; }
+
+static void append_stages(String_Builder *out, const StatsStages *stages) {
+  sb_append_cstr(out, "[");
+  for (size_t i = 0; i < stages->count; i++) {
+    sb_append_cstr(out, i > 0 ? ", {\"name\": " : "{\"name\": ");
+    sb_append_json_string(out, stages->items[i].name);
+    sb_appendf(out, ", \"ms\": %.3f}", stages->items[i].ms);
+  }
+  sb_append_cstr(out, "]");
+}
+
+bool stats_write_json(const char *path) {
+  String_Builder out = {0};
+  sb_append_cstr(&out, "{\"files\": [");
+  for (size_t i = 0; i < stats.files.count; i++) {
+    const FileStats *f = &stats.files.items[i];
+    sb_append_cstr(&out, i > 0 ? ",\n  {\"file\": " : "\n  {\"file\": ");
+    sb_append_json_string(&out, f->file);
+    sb_appendf(&out,
+               ", \"source_bytes\": %zu, \"chunks\": %zu, "
+               "\"chunks_skipped\": %zu, \"nodes_visited\": {",
+               f->source_bytes, f->chunks, f->chunks_skipped);
+    for (int pass = 0; pass < StatsPass__Count; pass++) {
+      sb_appendf(&out, "%s\"%s\": %zu", pass > 0 ? ", " : "",
+                 stats_pass_names[pass], f->nodes_visited[pass]);
+    }
+    sb_appendf(&out,
+               "}, \"macros_parsed\": %zu, \"macro_bodies_parsed\": %zu, "
+               "\"macros_expanded\": %zu, \"macro_memo_hits\": %zu, "
+               "\"blocks\": %zu, \"placeholders\": %zu, "
+               "\"header_bytes\": %zu, \"cache_hits\": %zu, "
+               "\"cache_misses\": %zu, \"peak_rss_kb\": %ld, "
+               "\"children_peak_rss_kb\": %ld, \"stages\": ",
+               f->macros_parsed, f->macro_bodies_parsed, f->macros_expanded,
+               f->macro_memo_hits, f->blocks, f->placeholders, f->header_bytes,
+               f->cache_hits, f->cache_misses, f->peak_rss_kb,
+               f->children_peak_rss_kb);
+    append_stages(&out, &f->stages);
+    sb_append_cstr(&out, "}");
+  }
+  sb_append_cstr(&out, "\n], \"stages\": ");
+  append_stages(&out, &stats.stages);
+  sb_append_cstr(&out, "}\n");
+
+  bool ok = true;
+  if (*path == '\0')
+    fwrite(out.items, 1, out.count, stderr);
+  else
+    ok = nob_write_entire_file(path, out.items, out.count);
+  sb_free(out);
+  return ok;
+}
@@ -0,0 +1,91 @@
+#ifndef CCOMPTIME_STATS_H
+#define CCOMPTIME_STATS_H
+
+#include "comptime_common.h"
+
+#include <stdint.h>
+
+// Pipeline statistics for -comptime-stats=json, one entry per input file.
+// The passes bump counters of the current file through the macros below,
+// which do nothing unless stats are being collected.
+
+typedef enum {
+  StatsPass_ExpandMacros,
+  StatsPass_CorrectComptimeType,
+  StatsPass_CollectStatements,
+  StatsPass_IndexTopLevel,
+  StatsPass_ClassifyBlocks,
+  StatsPass__Count,
+} StatsPass;
+
+typedef struct {
+  const char *name;
+  double ms;
+} StatsStage;
+
+typedef struct {
+  StatsStage *items;
+  size_t count;
+  size_t capacity;
+} StatsStages;
+
+typedef struct {
+  const char *file;
+  uint64_t source_hash;
+  size_t source_bytes;
+  size_t chunks;
+  size_t chunks_skipped; // chunks a pass did not need to walk
+  size_t nodes_visited[StatsPass__Count];
+  size_t macros_parsed;
+  size_t macro_bodies_parsed; // definitions the prefilter let through
+  size_t macros_expanded;
+  size_t macro_memo_hits; // expansions copied from an identical earlier one
+  size_t blocks;
+  size_t placeholders;
+  size_t header_bytes;
+  size_t cache_hits;
+  size_t cache_misses;
+  long peak_rss_kb;          // ccomptime itself, so far
+  long children_peak_rss_kb; // largest compiler or runner process so far
+  StatsStages stages;        // in the order they finished
+} FileStats;
+
+// Per thread, so front-end workers count into their own file.
+extern _Thread_local FileStats *stats_current;
+
+#define STATS_ADD(field, n)                                                    \
+  do {                                                                         \
+    if (stats_current)                                                         \
+      stats_current->field += (n);                                             \
+  } while (0)
+
+#define STATS_SET(field, value)                                                \
+  do {                                                                         \
+    if (stats_current)                                                         \
+      stats_current->field = (value);                                          \
+  } while (0)
+
+#define STATS_VISIT(pass) STATS_ADD(nodes_visited[pass], 1)
+
+void stats_start(void);
+bool stats_enabled(void);
+
+// Make `file` the current file, stats_end_file() stops counting.
+void stats_begin_file(const char *file);
+void stats_end_file(void);
+// Add `file` without making it current and return its index. Files have to
+// be added before other threads resume any of them.
+size_t stats_add_file(const char *file);
+// Make the file at `index` current on this thread.
+void stats_resume_file(size_t index);
+
+// Stages outside of any file (e.g. the final compile) are kept separately.
+void stats_record_stage(const char *name, long long ns);
+
+const FileStats *stats_files(size_t *count);
+const StatsStages *stats_global_stages(void);
+
+// Write all stats as JSON to `path`, or to stderr when it is empty.
+bool stats_write_json(const char *path);
+
+#endif // CCOMPTIME_STATS_H
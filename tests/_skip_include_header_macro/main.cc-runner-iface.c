@@ -0,0 +1,9 @@
+
+#define _COMPILING
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+#include "lib.h"
+
+
@@ -0,0 +1,5 @@
+
+__Comptime_Statement_Fn(0, _ComptimeType(_ComptimeCtx.Inline.appendf("%s", _ComptimeCtx.InferType())))
+
+__Comptime_Statement_Fn(1, _ComptimeType(                                                               \
+      _ComptimeCtx.Inline.appendf("const %s", _ComptimeCtx.InferType())))
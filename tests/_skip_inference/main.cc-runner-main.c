@@ -0,0 +1,2 @@
+__Comptime_Register_Type_Exec(0, 0, -1); // execute comptime statement #0
+__Comptime_Register_Type_Exec(1, 1, -1); // execute comptime statement #1
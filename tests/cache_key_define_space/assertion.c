@@ -0,0 +1,43 @@
+#include "../test.h"
+
+// Compiles `source` as flip.c (always the same path, so only the source can
+// tell the cache entries apart) and returns what the program printed.
+static char *compile_and_run(const char *source) {
+  nob_write_entire_file(r("flip.c"), source, strlen(source));
+
+  Nob_Cmd cmd = {0};
+  nob_cmd_append(&cmd, CCOMPTIME_BIN, "clang", r("flip.c"), "-o", r("flip"));
+  nob_cmd_run(&cmd);
+  nob_cmd_append(&cmd, r("flip"));
+  nob_cmd_run(&cmd, .stdout_path = r("flip-stdout.txt"));
+
+  Nob_String_Builder out = {0};
+  nob_read_entire_file(r("flip-stdout.txt"), &out);
+  nob_sb_append_null(&out);
+  return out.items;
+}
+
+static char *replace_first(const char *text, const char *from, const char *to) {
+  const char *hit = strstr(text, from);
+  if (!hit)
+    return strdup(text);
+  return strdup(temp_sprintf("%.*s%s%s", (int)(hit - text), text, to,
+                             hit + strlen(from)));
+}
+
+test({
+  assert_log_includes(exec_stdout.items, "EXPANDED=[3]",
+                      "Expected the function-like macro to be expanded");
+
+  Nob_String_Builder main_source = {0};
+  nob_read_entire_file(r("main.c"), &main_source);
+  nob_sb_append_null(&main_source);
+  char *source = replace_first(main_source.items, "main.c.h", "flip.c.h");
+  char *spaced = replace_first(source, "#define E(x)", "#define E (x)");
+
+  // same tokens, but `E` becomes an object-like macro
+  compile_and_run(source);
+  assert_log_includes(compile_and_run(spaced), "EXPANDED=[(x) 3(x)]",
+                      "Expected a space before ( in #define to change the "
+                      "cache key");
+})
@@ -0,0 +1,16 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+#define E(x) 3
+#define STR_(...) #__VA_ARGS__
+#define STR(...) STR_(__VA_ARGS__)
+
+int main(void) {
+  _Comptime({
+    _ComptimeCtx.TopLevel.appendf("#define EXPANDED \"%s\"\n", STR(E(x)));
+  });
+  printf("EXPANDED=[%s]\n", EXPANDED);
+  return 0;
+}
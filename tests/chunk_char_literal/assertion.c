@@ -0,0 +1,73 @@
+#include "../test.h"
+
+// Writes big.c: a chain of small functions filling most of the first 64 KiB
+// chunk, then one function long enough to cross into the second whose
+// `u8'}'` must not be taken for a digit separator and the closing brace.
+// Returns the value its block computes.
+static int write_big_source(void) {
+  String_Builder sb = {0};
+  sb_append_cstr(&sb, "#include <stdio.h>\n"
+                      "#include \"../../ccomptime.h\"\n"
+                      "#include \"big.c.h\"\n\n"
+                      "static int filler0(void) { return 0; }\n");
+  int n = 1;
+  for (; sb.count < 60000; n++)
+    sb_appendf(&sb, "static int filler%d(void) { return 1 + filler%d(); }\n",
+               n, n - 1);
+
+  sb_append_cstr(&sb, "static int braces(void) {\n  int c = 0;\n");
+  for (int i = 0; i < 800; i++)
+    sb_append_cstr(&sb, "  c += 1;\n");
+  sb_appendf(&sb,
+             "  c += u8'}';\n"
+             "  c -= '}';\n"
+             "  return c + filler%d();\n"
+             "}\n\n"
+             "int main(void) {\n"
+             "  _Comptime({\n"
+             "    _ComptimeCtx.TopLevel.appendf(\"#define FROM_BLOCK %%d\\n\",\n"
+             "                                  braces());\n"
+             "  });\n"
+             "  printf(\"BLOCK=%%d\\n\", FROM_BLOCK);\n"
+             "  return 0;\n"
+             "}\n",
+             n - 1);
+  nob_write_entire_file(r("big.c"), sb.items, sb.count);
+  sb_free(sb);
+  return 800 + n - 1;
+}
+
+test({
+  assert_log_includes(exec_stdout.items, "BRACE=}",
+                      "Expected the character constant to be kept");
+
+  int expected = write_big_source();
+  Nob_Cmd cmd = {0};
+  nob_cmd_append(&cmd, CCOMPTIME_BIN, "clang", "-std=c2x", r("big.c"), "-o",
+                 r("big"), "-comptime-no-cache",
+                 temp_sprintf("-comptime-stats=json:%s", r("big-stats.json")));
+  nob_cmd_run(&cmd);
+  nob_cmd_append(&cmd, r("big"));
+  nob_cmd_run(&cmd, .stdout_path = r("big-stdout.txt"));
+
+  Nob_String_Builder big_stats = {0};
+  Nob_String_Builder big_stdout = {0};
+  nob_read_entire_file(r("big-stats.json"), &big_stats);
+  nob_read_entire_file(r("big-stdout.txt"), &big_stdout);
+  nob_sb_append_null(&big_stats);
+  nob_sb_append_null(&big_stdout);
+
+  assert_log_includes(big_stdout.items, temp_sprintf("BLOCK=%d", expected),
+                      "Expected the block to run in a chunked source");
+  assert_log_includes(big_stats.items, "\"chunks\": 2",
+                      "Expected the source to be parsed in two chunks");
+  // a cut inside braces() leaves the split runner an invalid interface, and
+  // the runner is built again as one translation unit
+  da_append(&results,
+            ((TestResult){
+                .success = strstr(big_stats.items, "\"compile runner\"") ==
+                           NULL,
+                .message = __FILE__,
+                .error = "Expected no chunk cut inside a function body",
+            }));
+})
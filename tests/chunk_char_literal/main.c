@@ -0,0 +1,20 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+static int closing_brace(void) {
+#if __STDC_VERSION__ > 201710L
+  return u8'}';
+#else
+  return '}';
+#endif
+}
+
+int main(void) {
+  _Comptime({
+    _ComptimeCtx.TopLevel.appendf("#define BRACE '%c'\n", closing_brace());
+  });
+  printf("BRACE=%c\n", BRACE);
+  return 0;
+}
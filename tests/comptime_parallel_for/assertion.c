@@ -0,0 +1,8 @@
+#include "../test.h"
+
+test({
+  assert_log_includes(exec_stdout.items, "Primes below 10000: 1229",
+                      "Expected every index to be visited once");
+  assert_log_includes(exec_stdout.items, "Ordered: 1",
+                      "Expected chunk outputs in index order");
+})
@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+static int is_prime(long n) {
+  if (n < 2)
+    return 0;
+  for (long d = 2; d * d <= n; d++) {
+    if (n % d == 0)
+      return 0;
+  }
+  return 1;
+}
+
+void emit_prime_flag(long i, _ComptimeChunk *out, void *ctx) {
+  (void)ctx;
+  out->appendf(out, "%d,", is_prime(i));
+}
+
+int main(void) {
+  _Comptime({
+    char *flags = _ComptimeCtx.parallel_for(0, 10000, emit_prime_flag, NULL);
+    _ComptimeCtx.TopLevel.appendf("static const char prime_flags[] = {%s};\n",
+                                  flags);
+    free(flags);
+  });
+
+  int count = 0;
+  for (size_t i = 0; i < sizeof(prime_flags); i++) {
+    count += prime_flags[i];
+  }
+  printf("Primes below 10000: %d\n", count);
+  printf("Ordered: %d\n", prime_flags[9973] && !prime_flags[9999]);
+  return 0;
+}
@@ -0,0 +1,32 @@
+/*// @generated - ccomptime™ v0.0.1 - c21fac9dcdccd860 \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 
+
+/* top level definitions */
+static void debug_log(const char* msg) { (void)msg; }
+#define DEBUG_ENABLED 0
+#define PLATFORM_BITS 64
+static const char* platform_name = "64-bit";
+static int compute_value(int x) {
+  return x * 2; // Optimized for high threshold
+}
+
+#endif // _COMPILING
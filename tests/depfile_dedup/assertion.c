@@ -0,0 +1,42 @@
+#include "../test.h"
+
+// Number of prerequisites naming `name`, whichever directory they are in.
+static int count_prerequisites(const char *depfile, const char *name) {
+  int count = 0;
+  size_t len = strlen(name);
+  for (const char *p = strstr(depfile, name); p; p = strstr(p + 1, name)) {
+    bool starts = p == depfile || p[-1] == '/' || p[-1] == ' ';
+    bool ends = p[len] == ' ' || p[len] == '\n' || p[len] == '\0';
+    if (starts && ends)
+      count++;
+  }
+  return count;
+}
+
+static void assert_prerequisite_once(TestResults *results, const char *depfile,
+                                     const char *name) {
+  da_append(results, ((TestResult){
+                         .success = count_prerequisites(depfile, name) == 1,
+                         .message = __FILE__,
+                         .error = temp_sprintf(
+                             "Expected %s in the depfile exactly once", name),
+                     }));
+}
+
+test({
+  assert_log_includes(exec_stdout.items, "VALUE=7",
+                      "Expected the value read at comptime");
+
+  Nob_Cmd cmd = {0};
+  nob_cmd_append(&cmd, CCOMPTIME_BIN, "clang", r("main.c"), "-c", "-o",
+                 r("main.o"), "-MD", "-MF", r("main.d"));
+  nob_cmd_run(&cmd);
+  Nob_String_Builder depfile = {0};
+  nob_read_entire_file(r("main.d"), &depfile);
+  nob_sb_append_null(&depfile);
+
+  assert_prerequisite_once(&results, depfile.items, "main.c");
+  assert_prerequisite_once(&results, depfile.items, "main.c.h");
+  assert_prerequisite_once(&results, depfile.items, "value.txt");
+  assert_prerequisite_once(&results, depfile.items, "stdio.h");
+})
@@ -0,0 +1,25 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+int main(void) {
+  _Comptime({
+    int value = 0;
+    // the same file, once relative and once absolute
+    FILE *f = fopen("tests/depfile_dedup/value.txt", "r");
+    if (f) {
+      fscanf(f, "%d", &value);
+      fclose(f);
+    }
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/value.txt",
+             realpath("tests/depfile_dedup", NULL));
+    f = fopen(path, "r");
+    if (f)
+      fclose(f);
+    _ComptimeCtx.TopLevel.appendf("#define VALUE %d\n", value);
+  });
+  printf("VALUE=%d\n", VALUE);
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include "../test.h"
+
+// Builds and runs `name`.c and returns what it printed.
+static char *compile_and_run(const char *name) {
+  const char *exe = r(name);
+  nob_delete_file(exe);
+
+  Nob_Cmd cmd = {0};
+  nob_cmd_append(&cmd, CCOMPTIME_BIN, "clang", r(temp_sprintf("%s.c", name)),
+                 "-o", exe);
+  nob_cmd_run(&cmd);
+  nob_cmd_append(&cmd, exe);
+  nob_cmd_run(&cmd, .stdout_path = r("out"));
+
+  Nob_String_Builder out = {0};
+  nob_read_entire_file(r("out"), &out);
+  nob_sb_append_null(&out);
+  return out.items;
+}
+
+static size_t count_lines(const char *path) {
+  Nob_String_Builder sb = {0};
+  nob_read_entire_file(path, &sb);
+  size_t lines = 0;
+  for (size_t i = 0; i < sb.count; i++) {
+    lines += sb.items[i] == '\n';
+  }
+  nob_sb_free(sb);
+  return lines;
+}
+
+test({
+  setenv("CCT_TEST_FOOX", "one", 1);
+  assert_log_includes(compile_and_run("main"), "FOOX=one",
+                      "Expected the environment variable to be read");
+  setenv("CCT_TEST_FOOX", "two", 1);
+  assert_log_includes(compile_and_run("main"), "FOOX=two",
+                      "Expected a changed environment variable to miss the "
+                      "results cache");
+  unsetenv("CCT_TEST_FOOX");
+
+  nob_delete_file(r("ran.txt"));
+  compile_and_run("untracked");
+  compile_and_run("untracked");
+  da_append(&results,
+            ((TestResult){.success = count_lines(r("ran.txt")) == 2,
+                          .message = __FILE__,
+                          .error = "Expected a block running a command to "
+                                   "run on every build"}));
+})
@@ -0,0 +1,15 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+int main(void) {
+  _Comptime({
+    const char *value = getenv("CCT_TEST_FOOX");
+    _ComptimeCtx.TopLevel.appendf("#define FOOX \"%s\"\n",
+                                  value ? value : "unset");
+  });
+  printf("FOOX=%s\n", FOOX);
+  return 0;
+}
@@ -0,0 +1,15 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../ccomptime.h"
+#include "untracked.c.h"
+
+// Runs a command every time it is built, so its results must not be cached.
+int main(void) {
+  _Comptime({
+    int status = system("echo ran >> tests/env_results_cache/ran.txt");
+    _ComptimeCtx.TopLevel.appendf("#define STATUS %d\n", status);
+  });
+  printf("STATUS=%d\n", STATUS);
+  return 0;
+}
@@ -0,0 +1,9 @@
+
+#define _COMPILING
+#include <stdio.h>
+#include <string.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+
@@ -0,0 +1,27 @@
+#include "../test.h"
+
+#define BAD_SOURCE                                                             \
+  "#include <stdio.h>\n"                                                       \
+  "#include \"../../ccomptime.h\"\n"                                           \
+  "#include \"bad.c.h\"\n"                                                     \
+  "#define SQUARE(x) _Comptime(_ComptimeCtx.Inline.appendf(\"%d\", (x) * "     \
+  "(x)))\n"                                                                    \
+  "int main(void) { printf(\"%d\\n\", SQUARE(2, 3)); }\n"
+
+test({
+  assert_log_includes(exec_stdout.items, "NINE=9",
+                      "Expected a bare function-like macro name to be left "
+                      "alone");
+
+  nob_write_entire_file(r("bad.c"), BAD_SOURCE, strlen(BAD_SOURCE));
+
+  Nob_Cmd cmd = {0};
+  nob_cmd_append(&cmd, CCOMPTIME_BIN, "clang", r("bad.c"), "-o", r("bad"));
+  nob_cmd_run(&cmd, .stderr_path = r("bad-stderr.txt"));
+  Nob_String_Builder bad_stderr = {0};
+  nob_read_entire_file(r("bad-stderr.txt"), &bad_stderr);
+  nob_sb_append_null(&bad_stderr);
+  assert_log_includes(bad_stderr.items,
+                      "macro 'SQUARE' called with 2 arguments, expected 1",
+                      "Expected a wrong argument count to be reported");
+})
@@ -0,0 +1,14 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+// Not followed by `(`, the name is the typedef and not the macro.
+typedef int SQUARE;
+#define SQUARE(x) _Comptime(_ComptimeCtx.Inline.appendf("%d", (x) * (x)))
+
+int main(void) {
+  SQUARE nine = SQUARE(3);
+  printf("NINE=%d\n", nine);
+  return 0;
+}
@@ -0,0 +1,43 @@
+/*// @generated - ccomptime™ v0.0.1 - 3cfafefc8c337b24 \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 
+#define _COMPTIME_X1(...) 10
+
+/* top level definitions */
+static int add_numbers(int a, int b) {
+  return a + b;
+}
+
+static int multiply_numbers(int a, int b) {
+  return a * b;
+}
+
+static const int precomputed_sum = 25;
+static const int precomputed_product = 42;
+typedef struct {
+  int sum_field;
+  int product_field;
+  int combined;
+} ComputedData;
+
+static const ComputedData data = {25, 42, 67};
+
+#endif // _COMPILING
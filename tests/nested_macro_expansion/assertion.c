@@ -0,0 +1,6 @@
+#include "../test.h"
+
+test({
+  assert_log_includes(exec_stdout.items, "TOTAL=34",
+                      "Expected nested macro uses to expand in one pass");
+})
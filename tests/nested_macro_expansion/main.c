@@ -0,0 +1,15 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+#define SQUARE(x) _Comptime(_ComptimeCtx.Inline.appendf("(%s) * (%s)", #x, #x))
+#define TWICE(x) SQUARE(x) + SQUARE(x)
+#define SUM(a, b) TWICE(a) + TWICE(b)
+
+int main(void) {
+  int n = 2;
+  int total = SUM(n, 3) + TWICE(n);
+  printf("TOTAL=%d\n", total);
+  return total == 8 + 18 + 8 ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+/*// @generated - ccomptime™ v0.0.1 - 2e7fab9298504d65 \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) Result_5051382451057340483
+#define _COMPTIMETYPE_0 Result_5051382451057340483
+#define _COMPTIME_X1(...) Result_5051382451057340483
+#define _COMPTIMETYPE_1 Result_5051382451057340483
+#define _COMPTIME_X2(...) Result_17102643896089995330
+#define _COMPTIMETYPE_2 Result_17102643896089995330
+#define _COMPTIME_X3(...) Result_17102643896089995330
+#define _COMPTIMETYPE_3 Result_17102643896089995330
+#define _COMPTIME_X4(...) 
+
+/* top level definitions */
+typedef struct { int ok; union { int value; char* error; };} Result_5051382451057340483;
+typedef struct { int ok; union { char* value; char* error; };} Result_17102643896089995330;
+
+#endif // _COMPILING
@@ -0,0 +1,43 @@
+/*// @generated - ccomptime™ v0.0.1 - 90bc44f5d6b6c82f \*/
+#pragma once
+#ifdef _Comptime
+#undef _Comptime
+#endif
+#ifdef _COMPILING
+#define _Comptime(...) /* stripped comptime */
+#define _ComptimeType(x) /* stripped comptime type */ 
+#else
+#define _CONCAT_(x, y) x##y
+#define CONCAT(x, y) _CONCAT_(x, y)
+#define _Comptime(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _ComptimeType(...) _COMPTIME_X(__COUNTER__, __VA_ARGS__)
+#define _COMPTIME_X(n, ...) CONCAT(_PLACEHOLDER_COMPTIME_X, n)(__VA_ARGS__)
+#endif
+/* ---- */// the end. ///* ---- */
+#ifndef _COMPILING
+
+#undef _COMPTIME_X
+#define _COMPTIME_X(n,...) CONCAT(_COMPTIME_X,n)(__VA_ARGS__)
+#define _COMPTIME_X0(...) 
+
+/* top level definitions */
+typedef enum {
+  ERR_SUCCESS = 0,
+  ERR_INVALID_INPUT = 1,
+  ERR_FILE_NOT_FOUND = 2,
+  ERR_PERMISSION_DENIED = 3,
+  ERR_TIMEOUT = 4,
+} ErrorCode;
+
+static const char* error_code_to_string(ErrorCode code) {
+  switch(code) {
+    case ERR_SUCCESS: return "ERR_SUCCESS";
+    case ERR_INVALID_INPUT: return "ERR_INVALID_INPUT";
+    case ERR_FILE_NOT_FOUND: return "ERR_FILE_NOT_FOUND";
+    case ERR_PERMISSION_DENIED: return "ERR_PERMISSION_DENIED";
+    case ERR_TIMEOUT: return "ERR_TIMEOUT";
+    default: return "UNKNOWN";
+  }
+}
+
+#endif // _COMPILING
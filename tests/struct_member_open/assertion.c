@@ -0,0 +1,17 @@
+#include "../test.h"
+
+test({
+  assert_log_includes(exec_stdout.items, "DATA=42 RUN=8",
+                      "Expected members named open to be left alone");
+
+  // the read through the function pointer is still recorded
+  Nob_Cmd cmd = {0};
+  nob_cmd_append(&cmd, CCOMPTIME_BIN, "clang", r("main.c"), "-c", "-o",
+                 r("main.o"), "-MD", "-MF", r("main.d"));
+  nob_cmd_run(&cmd);
+  Nob_String_Builder depfile = {0};
+  nob_read_entire_file(r("main.d"), &depfile);
+  nob_sb_append_null(&depfile);
+  assert_log_includes(depfile.items, "data.txt",
+                      "Expected the file read by the block in the depfile");
+})
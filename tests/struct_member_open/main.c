@@ -0,0 +1,31 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+// Members and calls named like the libc functions the runner tracks.
+struct vt {
+  FILE *(*fopen)(const char *path, const char *mode);
+  int (*open)(int x);
+};
+
+static int twice(int x) { return 2 * x; }
+
+static int run(const struct vt *ops, int x) { return ops->open(x); }
+
+int main(void) {
+  struct vt ops = {.fopen = fopen, .open = twice};
+  _Comptime({
+    struct vt ops = {.fopen = fopen, .open = twice};
+    int value = 0;
+    FILE *f = ops.fopen("tests/struct_member_open/data.txt", "r");
+    if (f) {
+      fscanf(f, "%d", &value);
+      fclose(f);
+    }
+    _ComptimeCtx.TopLevel.appendf("#define DATA_VALUE %d\n",
+                                  run(&ops, value));
+  });
+  printf("DATA=%d RUN=%d\n", DATA_VALUE, run(&ops, 4));
+  return 0;
+}
@@ -0,0 +1,6 @@
+#include "../test.h"
+
+test({
+  assert_log_includes(exec_stdout.items, "V=42 W=43",
+                      "Expected a prototyped but unused function to be shaken");
+})
@@ -0,0 +1,24 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "main.c.h"
+
+int used_helper(int x);
+int unused_helper(int x);
+
+int used_helper(int x) { return x * 2; }
+
+// Only the program calls it, so neither it nor its prototype may reach the
+// comptime runner.
+int unused_helper(int x) {
+#ifdef _COMPILING
+#error "unused_helper reached the comptime runner"
+#endif
+  return x + 1;
+}
+
+int main(void) {
+  int v = _Comptime(_ComptimeCtx.Inline.appendf("%d", used_helper(21)));
+  printf("V=%d W=%d\n", v, unused_helper(v));
+  return 0;
+}
@@ -0,0 +1,22 @@
+#include "../test.h"
+
+test({
+  assert_log_includes(exec_stdout.items, "A=7 B=8",
+                      "Expected functions named by pasting tokens to be kept");
+
+  // only named in a macro of an included header: the shaken runner does not
+  // link, the unshaken fallback does
+  if (nob_file_exists(r("header_macro")) == 1)
+    nob_delete_file(r("header_macro"));
+  Nob_Cmd cmd = {0};
+  nob_cmd_append(&cmd, CCOMPTIME_BIN, "clang", r("header_macro.c"), "-o",
+                 r("header_macro"));
+  nob_cmd_run(&cmd);
+  nob_cmd_append(&cmd, r("header_macro"));
+  nob_cmd_run(&cmd, .stdout_path = r("header_macro-stdout.txt"));
+  Nob_String_Builder out = {0};
+  nob_read_entire_file(r("header_macro-stdout.txt"), &out);
+  nob_sb_append_null(&out);
+  assert_log_includes(out.items, "B=8",
+                      "Expected functions named by header macros to be kept");
+})
@@ -0,0 +1,14 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "header_macro.c.h"
+#include "helpers.h"
+
+static int helper_b(void) { return 8; }
+static int unused(void) { return 9; }
+
+int main(void) {
+  int b = _Comptime(_ComptimeCtx.Inline.appendf("%d", CALL_B()));
+  printf("B=%d\n", b);
+  return 0;
+}
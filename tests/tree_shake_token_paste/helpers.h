@@ -0,0 +1,2 @@
+// Names a function of the including file the tree shaking cannot see.
+#define CALL_B() helper_b()
@@ -0,0 +1,17 @@
+#include <stdio.h>
+
+#include "../../ccomptime.h"
+#include "helpers.h"
+#include "main.c.h"
+
+static int helper_a(void) { return 7; }
+static int helper_b(void) { return 8; }
+
+#define CALL(x) helper_##x()
+
+int main(void) {
+  int a = _Comptime(_ComptimeCtx.Inline.appendf("%d", CALL(a)));
+  int b = _Comptime(_ComptimeCtx.Inline.appendf("%d", CALL_B()));
+  printf("A=%d B=%d\n", a, b);
+  return 0;
+}
@@ -0,0 +1,154 @@
+#include "trace.h"
+#include "stats.h"
+
+#include <time.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+#define TRACE_LOCK() pthread_mutex_lock(&trace_lock)
+#define TRACE_UNLOCK() pthread_mutex_unlock(&trace_lock)
+#else
+#define TRACE_LOCK()
+#define TRACE_UNLOCK()
+#endif
+
+typedef struct {
+  const char *name;
+  long long start_ns;
+} TraceStage;
+
+// Events are shared by the front-end workers and appended under the lock.
+static struct {
+  const char *path;
+  String_Builder events;
+} trace = {0};
+
+// Each thread has its current track and open stages, which are also timed
+// for -comptime-stats when not tracing.
+static _Thread_local struct {
+  int pid, tid;
+  struct {
+    TraceStage *items;
+    size_t count;
+    size_t capacity;
+  } open;
+} track = {0};
+
+void trace_start(const char *path) { trace.path = path; }
+
+bool trace_enabled(void) { return trace.path != NULL; }
+
+long long trace_now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void event_begin(const char *ph, int pid, int tid) {
+  sb_appendf(&trace.events, "%s\n  {\"ph\": \"%s\", \"pid\": %d, \"tid\": %d",
+             trace.events.count > 0 ? "," : "", ph, pid, tid);
+}
+
+static void metadata(const char *kind, int pid, int tid, const char *name) {
+  TRACE_LOCK();
+  event_begin("M", pid, tid);
+  sb_appendf(&trace.events, ", \"name\": \"%s\", \"args\": {\"name\": ", kind);
+  sb_append_json_string(&trace.events, name);
+  sb_append_cstr(&trace.events, "}}");
+  TRACE_UNLOCK();
+}
+
+void trace_process_name(int pid, const char *name) {
+  if (trace_enabled())
+    metadata("process_name", pid, 0, name);
+}
+
+void trace_set_track(int pid, int tid, const char *name) {
+  if (!trace_enabled())
+    return;
+  track.pid = pid;
+  track.tid = tid;
+  metadata("thread_name", pid, tid, name);
+}
+
+// timestamps are in microseconds
+void trace_begin(const char *name) {
+  if (!trace_enabled() && !stats_enabled())
+    return;
+  long long now = trace_now_ns();
+  da_append(&track.open, ((TraceStage){name, now}));
+  if (!trace_enabled())
+    return;
+  TRACE_LOCK();
+  event_begin("B", track.pid, track.tid);
+  sb_appendf(&trace.events, ", \"ts\": %.3f, \"name\": ", now / 1e3);
+  sb_append_json_string(&trace.events, name);
+  da_append(&trace.events, '}');
+  TRACE_UNLOCK();
+}
+
+void trace_end(void) {
+  if (track.open.count == 0)
+    return;
+  long long now = trace_now_ns();
+  TraceStage stage = track.open.items[--track.open.count];
+  stats_record_stage(stage.name, now - stage.start_ns);
+  if (!trace_enabled())
+    return;
+  TRACE_LOCK();
+  event_begin("E", track.pid, track.tid);
+  sb_appendf(&trace.events, ", \"ts\": %.3f}", now / 1e3);
+  TRACE_UNLOCK();
+}
+
+void trace_complete(int pid, int tid, const char *name, long long start_ns,
+                    long long dur_ns) {
+  if (!trace_enabled())
+    return;
+  TRACE_LOCK();
+  event_begin("X", pid, tid);
+  sb_appendf(&trace.events, ", \"ts\": %.3f, \"dur\": %.3f, \"name\": ",
+             start_ns / 1e3, dur_ns / 1e3);
+  sb_append_json_string(&trace.events, name);
+  da_append(&trace.events, '}');
+  TRACE_UNLOCK();
+}
+
+void trace_runner_blocks(int pid, const char *file,
+                         const BlockProfile *blocks, size_t count) {
+  if (!trace_enabled())
+    return;
+  trace_process_name(pid, temp_sprintf("runner %s", file));
+  for (size_t i = 0; i < count; i++) {
+    const BlockProfile *block = &blocks[i];
+    if (block->start_ns == 0)
+      continue; // results came from the cache, nothing ran
+    bool named = false;
+    for (size_t j = 0; j < i && !named; j++) {
+      named = blocks[j].lane == block->lane;
+    }
+    if (!named)
+      metadata("thread_name", pid, block->lane,
+               block->lane == 0 ? "main"
+                                : temp_sprintf("lane %d", block->lane));
+    trace_complete(pid, block->lane,
+                   temp_sprintf("%s:%d %s", block->file, block->line,
+                                block->label),
+                   block->start_ns, (long long)(block->wall_ms * 1e6));
+  }
+}
+
+bool trace_finish(void) {
+  if (!trace_enabled())
+    return true;
+  String_Builder out = {0};
+  sb_append_cstr(&out, "{\"traceEvents\": [");
+  sb_append_buf(&out, trace.events.items, trace.events.count);
+  sb_append_cstr(&out, "\n], \"displayTimeUnit\": \"ms\"}\n");
+  bool ok = nob_write_entire_file(trace.path, out.items, out.count);
+  if (ok)
+    nob_log(INFO, "Wrote trace %s", trace.path);
+  sb_free(out);
+  return ok;
+}
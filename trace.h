@@ -0,0 +1,38 @@
+#ifndef CCOMPTIME_TRACE_H
+#define CCOMPTIME_TRACE_H
+
+#include "comptime_common.h"
+#include "profile.h"
+
+// Chrome trace-event output (-comptime-trace=<file>), loadable in
+// chrome://tracing or Perfetto. ccomptime itself is one process with a track
+// per input file, the runner of each file gets a process of its own with a
+// track per thread or forked child. All calls are no-ops unless tracing (or,
+// for the stage timers, collecting stats).
+
+#define TRACE_PID_CCOMPTIME 1
+
+void trace_start(const char *path);
+bool trace_enabled(void);
+long long trace_now_ns(void);
+
+// Name the track of `pid`/`tid` and make it current for trace_begin/end on
+// the calling thread.
+void trace_set_track(int pid, int tid, const char *name);
+void trace_process_name(int pid, const char *name);
+
+// Nested stages on the current track, their durations go to the stats too.
+void trace_begin(const char *name);
+void trace_end(void);
+
+// A stage with known start and duration, e.g. measured by the runner.
+void trace_complete(int pid, int tid, const char *name, long long start_ns,
+                    long long dur_ns);
+
+// Add a runner process for `file` with the blocks it ran.
+void trace_runner_blocks(int pid, const char *file,
+                         const BlockProfile *blocks, size_t count);
+
+bool trace_finish(void);
+
+#endif // CCOMPTIME_TRACE_H
@@ -1,3 +1,5 @@
+#include "queries.h"
+#include "stats.h"
 #include "tree_passes.h"
 #include "tree_sitter_c_api.h"
 
@@ -6,10 +8,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-#ifndef ts_builtin_sym_error
-#define ts_builtin_sym_error ((TSSymbol)-1)
-#endif
-
 typedef struct {
   Slice *items;
   size_t count, capacity;
@@ -20,12 +18,6 @@ typedef struct {
 static bool try_append_error_comptime_type(OutReplacements *out_replacements,
                                            TSNode node, const char *src,
                                            size_t len) {
-  TSNode parent = ts_node_parent(node);
-  if (ts_node_is_null(parent) ||
-      ts_node_symbol(parent) != ts_builtin_sym_error) {
-    return false;
-  }
-
   Slice id_range = ts_node_range(node, src);
   const char *cursor = id_range.start + id_range.len;
   const char *end = src + len;
@@ -109,94 +101,180 @@ static bool try_append_error_comptime_type(OutReplacements *out_replacements,
   return false;
 }
 
-// Walk the syntax tree and collect slices that correspond to
-// `_ComptimeType(...)` invocations irrespective of how tree-sitter represented
-// them.
-static void correct_tree(OutReplacements *out_replacements, TSNode node,
-                         const char *src, size_t len) {
-  assert(src);
-  if (ts_node_symbol(node) == sym_call_expression) {
-    if (ts_node_symbol(ts_node_child(node, 0)) == sym_identifier &&
-        ts_node_is_comptimetype_kw(ts_node_child(node, 0), src)) {
-      nob_da_append(out_replacements, ts_node_range(node, src));
-    }
-  } else if (ts_node_symbol(node) == sym_macro_type_specifier) {
-    if (ts_node_symbol(ts_node_child(node, 0)) == sym_identifier &&
-        ts_node_is_comptimetype_kw(ts_node_child(node, 0), src)) {
-      nob_da_append(out_replacements, ts_node_range(node, src));
-    }
-  } else if (ts_node_symbol(node) == sym_type_descriptor &&
-             ts_node_is_comptimetype_kw(ts_node_child(node, 0), src)) {
-    nob_da_append(out_replacements, ts_node_range(node, src));
-  } else if (ts_node_symbol(node) == sym_identifier &&
-             ts_node_is_comptimetype_kw(node, src)) {
-    if (try_append_error_comptime_type(out_replacements, node, src, len)) {
-      nob_log(INFO, RED("Found ComptimeType within error\n!"));
-      // Replacement recorded via error recovery path.
+// Outer spans first, so the ones nested in them can be skipped.
+static int compare_corrections(const void *a, const void *b) {
+  const Slice *x = a, *y = b;
+  if (x->start != y->start)
+    return x->start < y->start ? -1 : 1;
+  return y->len - x->len;
+}
+
+// The leaf at a mention, its parent and the nearest enclosing node of each
+// kind a comptime use is attributed to.
+typedef struct {
+  TSNode leaf, parent;
+  TSNode function_definition;
+  TSNode declaration;
+  TSNode type_definition;
+  TSNode preproc_def;
+  TSNode call_expression;
+} MentionPath;
+
+// Walks the tree of a chunk to the leaves at mentions asked for in source
+// order. The cursor only moves forward, so the walk takes time linear in the
+// tree however many mentions there are; asking for the parents instead would
+// have tree-sitter descend from the root for each.
+typedef struct {
+  TSTreeCursor cursor;
+  struct {
+    TSNode *items;
+    size_t count, capacity;
+  } path; // from the root to the cursor
+} MentionWalk;
+
+static void mention_walk_init(MentionWalk *walk, TSNode root) {
+  walk->cursor = ts_tree_cursor_new(root);
+  walk->path.count = 0;
+  nob_da_append(&walk->path, root);
+}
+
+static void mention_walk_free(MentionWalk *walk) {
+  ts_tree_cursor_delete(&walk->cursor);
+  free(walk->path.items);
+}
+
+// Move to the leaf at the byte `at`. Each keyword is a direct child of the
+// form it belongs to, so queries run from the parent of the leaf.
+static MentionPath mention_walk_to(MentionWalk *walk, uint32_t at) {
+  TSTreeCursor *cursor = &walk->cursor;
+  while (ts_node_end_byte(ts_tree_cursor_current_node(cursor)) <= at) {
+    if (walk->path.count > 1 && ts_tree_cursor_goto_next_sibling(cursor)) {
+      walk->path.items[walk->path.count - 1] =
+          ts_tree_cursor_current_node(cursor);
+    } else if (walk->path.count > 1 && ts_tree_cursor_goto_parent(cursor)) {
+      walk->path.count--;
+    } else {
+      break;
     }
   }
-
-  uint32_t n = ts_node_child_count(node);
-  for (uint32_t i = 0; i < n; i++) {
-    correct_tree(out_replacements, ts_node_child(node, i), src, len);
+  while (ts_tree_cursor_goto_first_child_for_byte(cursor, at) >= 0)
+    nob_da_append(&walk->path, ts_tree_cursor_current_node(cursor));
+
+  size_t count = walk->path.count;
+  MentionPath path = {.leaf = walk->path.items[count - 1]};
+  if (count > 1)
+    path.parent = walk->path.items[count - 2];
+  for (size_t i = count; i-- > 0;) {
+    TSNode node = walk->path.items[i];
+    TSNode *slot = NULL;
+    switch (ts_node_symbol(node)) {
+    case sym_function_definition:
+      slot = &path.function_definition;
+      break;
+    case sym_declaration:
+      slot = &path.declaration;
+      break;
+    case sym_type_definition:
+      slot = &path.type_definition;
+      break;
+    case sym_preproc_def:
+      slot = &path.preproc_def;
+      break;
+    case sym_call_expression:
+      slot = &path.call_expression;
+      break;
+    default:
+      break;
+    }
+    if (slot && ts_node_is_null(*slot))
+      *slot = node;
   }
+  return path;
 }
 
 // Rewrite `_ComptimeType` occurrences to placeholders while remembering their
 // source slices for later evaluation.
-TSTree *cct_correct_comptimetype_nodes(TSParser *parser, TSTree *tree,
-                                       const char *src, size_t len,
-                                       WalkContext *ctx,
-                                       String_Builder *out_source) {
+void cct_correct_comptimetype_nodes(TSParser *parser, Chunks *chunks,
+                                    const char *src, size_t len,
+                                    WalkContext *ctx,
+                                    String_Builder *out_source) {
   OutReplacements corrections = {0};
-  nob_log(NOB_VERBOSE, "=== Pre correction tree ===");
-  debug_tree(tree, src, 0);
-  nob_log(NOB_VERBOSE, "=== === ===");
-  correct_tree(&corrections, ts_tree_root_node(tree), src, len);
+  QueryRun run = {0};
+  nob_da_foreach(Chunk, chunk, chunks) {
+    uint32_t at = 0;
+    if (!chunk_find(chunk, src, "_ComptimeType", 13, &at)) {
+      STATS_ADD(chunks_skipped, 1);
+      continue;
+    }
+    const char *chunk_src = src + chunk->offset;
+    nob_log(NOB_VERBOSE, "=== Pre correction tree ===");
+    debug_tree(chunk->tree, chunk_src, 0);
+    nob_log(NOB_VERBOSE, "=== === ===");
+
+    MentionWalk walk = {0};
+    mention_walk_init(&walk, ts_tree_root_node(chunk->tree));
+    for (; chunk_find(chunk, src, "_ComptimeType", 13, &at); at += 13) {
+      MentionPath path = mention_walk_to(&walk, at);
+      if (ts_node_is_null(path.parent))
+        continue;
+      query_run(&run, Query_ComptimeTypeForms, path.parent, chunk_src, at,
+                at + 13);
+      TSQueryMatch match;
+      while (query_next_match(&run, &match)) {
+        STATS_VISIT(StatsPass_CorrectComptimeType);
+        TSNode form = query_capture(&run, &match, "form");
+        if (!ts_node_is_null(form)) {
+          nob_da_append(&corrections, ts_node_range(form, chunk_src));
+        } else if (try_append_error_comptime_type(
+                       &corrections,
+                       query_capture(&run, &match, "error_keyword"),
+                       chunk_src, chunk->len)) {
+          nob_log(INFO, RED("Found ComptimeType within error\n!"));
+        }
+      }
+    }
+    mention_walk_free(&walk);
+  }
+  query_run_free(&run);
 
   nob_log(VERBOSE, "Gathered %zu corrections", corrections.count);
+  if (corrections.count > 1)
+    qsort(corrections.items, corrections.count, sizeof(*corrections.items),
+          compare_corrections);
 
-  char *cursor = (char *)src;
+  SourceEdits edits = {0};
+  const char *cursor = src;
   int comptimetype_counter = 0;
 
-  if (corrections.count > 0) {
-    nob_da_foreach(Slice, replacement, &corrections) {
-      Slice r = *replacement;
-      assert(cursor <= r.start && "cursor is ahead of comptime slice");
-
-      size_t offset = (size_t)(r.start - cursor);
-
-      nob_log(VERBOSE, BOLD("[%zu] Correcting _ComptimeType: ") "%.*s", offset,
-              r.len, r.start);
-      assert(ctx->comptimetype_stmts.count == (size_t)comptimetype_counter);
-      da_append(&ctx->comptimetype_stmts, r);
-      da_append(&ctx->comptimetype_stmt_indices, -1);
-
-      nob_log(
-          INFO,
-          BOLD("Replacing _ComptimeType with placeholder: ") "%.*s -> "
-                                                             "_COMPTIMETYPE_%d",
-          r.len, r.start, comptimetype_counter);
-
-      nob_log(VERBOSE, "Appending %zu bytes until comptimetype", offset);
-      if (offset > 0) {
-        nob_sb_append_buf(out_source, cursor, offset);
-      }
+  nob_da_foreach(Slice, replacement, &corrections) {
+    Slice r = *replacement;
+    // `_ComptimeType(_ComptimeType(...))`, or a span also recovered from an
+    // `ERROR` node: the enclosing placeholder already evaluates it.
+    if (r.start < cursor)
+      continue;
 
-      nob_sb_appendf(out_source, "_COMPTIMETYPE_%d", comptimetype_counter++);
-      cursor = (char *)r.start + r.len;
-    }
+    nob_log(VERBOSE, BOLD("[%zu] Correcting _ComptimeType: ") "%.*s",
+            (size_t)(r.start - src), r.len, r.start);
+    assert(ctx->comptimetype_stmts.count == (size_t)comptimetype_counter);
+    da_append(&ctx->comptimetype_stmts, r);
+    da_append(&ctx->comptimetype_stmt_indices, -1);
+
+    nob_log(
+        INFO,
+        BOLD("Replacing _ComptimeType with placeholder: ") "%.*s -> "
+                                                           "_COMPTIMETYPE_%d",
+        r.len, r.start, comptimetype_counter);
+
+    const char *placeholder =
+        arena_sprintf(ctx->arena, "_COMPTIMETYPE_%d", comptimetype_counter++);
+    da_append(&edits, ((SourceEdit){r, sv_from_cstr(placeholder)}));
+    cursor = r.start + r.len;
   }
 
-  ssize_t tail = (const char *)src + len - cursor;
-  assert(tail >= 0);
-  nob_sb_append_buf(out_source, cursor, (size_t)tail);
-
-  ts_tree_delete(tree);
-
-  TSTree *clean_tree = ts_parser_parse_string(parser, NULL, out_source->items,
-                                              out_source->count);
-  return clean_tree;
+  // nothing to rewrite: the source is borrowed and the trees stay valid
+  chunks_apply_edits(parser, chunks, src, len, &edits, out_source);
+  free(edits.items);
+  free(corrections.items);
 }
 
 typedef struct {
@@ -259,125 +337,110 @@ static Slice parse_comptime_call_expr2(TSNode call_expression_root,
   return (Slice){.start = start, .len = (int)(end - start + 1)};
 }
 
-// First pass: mark declarations and functions that depend on comptime blocks.
-static void register_comptime_dependencies(WalkContext *const ctx,
-                                           LocalWalkContext local, TSNode node,
-                                           const char *src, unsigned depth) {
-  TSSymbol sym = ts_node_symbol(node);
+typedef enum {
+  ComptimeUse_Block,       // `_Comptime`
+  ComptimeUse_Placeholder, // `_COMPTIMETYPE_N`
+  ComptimeUse_Uncorrected, // `_ComptimeType`, which no longer should be there
+} ComptimeUseKind;
 
-  switch (sym) {
-  case sym_function_definition:
-    local.function_definition_root = &node;
-    break;
-  case sym_declaration:
-    local.decleration_root = &node;
-    break;
-  case sym_type_definition:
-    local.type_definition_root = &node;
-    break;
-  case sym_preproc_def:
-    local.preproc_def_root = &node;
-    break;
-  case sym_macro_type_specifier:
-    local.macro_type_specifier_root = &node;
-    break;
-  case sym_call_expression:
-    local.call_expression_root = &node;
-    break;
-  default:
-    break;
+typedef struct {
+  TSNode node;
+  ComptimeUseKind kind;
+  MentionPath path;
+} ComptimeUse;
+
+typedef struct {
+  ComptimeUse *items;
+  size_t count, capacity;
+} ComptimeUses;
+
+// First pass: record a `_Comptime` block or `_COMPTIMETYPE_N` placeholder,
+// and mark the declaration or function it makes comptime dependent.
+static void register_comptime_use(WalkContext *const ctx, const char *src,
+                                  const ComptimeUse *use) {
+  TSNode node = use->node;
+  if (use->kind == ComptimeUse_Uncorrected) {
+    debug_tree_node(node, src, 0);
+    assert(0 && "_ComptimeType should be corrected before walking");
+    return;
   }
 
-  Slice r = {0};
-  if (sym == sym_identifier && ts_node_is_comptime_kw(node, src)) {
-    if (!local.call_expression_root && local.preproc_def_root &&
-        local.child_idx == 1)
-      fatal("Redefining `_Comptime` macro is not supported");
-    if (!local.call_expression_root)
+  const MentionPath *local = &use->path;
+  Slice r;
+  int placeholder = -1;
+  if (use->kind == ComptimeUse_Block) {
+    if (ts_node_is_null(local->call_expression)) {
+      if (!ts_node_is_null(local->preproc_def) &&
+          ts_node_eq(ts_node_child(local->parent, 1), node))
+        fatal("Redefining `_Comptime` macro is not supported");
       fatal("Invalid use of _Comptime");
+    }
 
-    r = parse_comptime_call_expr2(*local.call_expression_root, src);
+    r = parse_comptime_call_expr2(local->call_expression, src);
     nob_log(VERBOSE, BOLD("Parsed _Comptime call : ") "%.*s", r.len, r.start);
-  } else if (sym == sym_identifier && ts_node_is_comptimetype_kw(node, src)) {
-    debug_tree_node(node, src, (int)depth);
-    assert(0 && "_ComptimeType should be corrected before walking");
-  } else if (sym == alias_sym_type_identifier) {
-    Slice type_id = ts_node_range(node, src);
-    if (slice_begins_with(type_id, "_COMPTIMETYPE_")) {
-      Slice out = slice_strip_prefix(type_id, "_COMPTIMETYPE_");
-      int index = atoi(out.start);
-      nob_log(VERBOSE, "Found comptimetype placeholder %d", index);
-      assert((size_t)index < ctx->comptimetype_stmts.count);
-      assert((size_t)index < ctx->comptimetype_stmt_indices.count);
-      assert(ctx->comptimetype_stmt_indices.items[index] == -1);
-      ctx->comptimetype_stmt_indices.items[index] =
-          (int)ctx->comptime_stmts.count;
-      r = ctx->comptimetype_stmts.items[index];
-    }
+  } else {
+    Slice out = slice_strip_prefix(ts_node_range(node, src), "_COMPTIMETYPE_");
+    int index = atoi(out.start);
+    nob_log(VERBOSE, "Found comptimetype placeholder %d", index);
+    assert((size_t)index < ctx->comptimetype_stmts.count);
+    assert((size_t)index < ctx->comptimetype_stmt_indices.count);
+    assert(ctx->comptimetype_stmt_indices.items[index] == -1);
+    ctx->comptimetype_stmt_indices.items[index] =
+        (int)ctx->comptime_stmts.count;
+    placeholder = index;
+    r = ctx->comptimetype_stmts.items[index];
   }
 
-  if (r.start) {
-    if (local.function_definition_root) {
-      assert(ts_node_symbol(ts_node_child(*local.function_definition_root,
-                                          1)) == sym_function_declarator);
-      assert(ts_node_symbol(ts_node_child(
-                 ts_node_child(*local.function_definition_root, 1), 0)) ==
-             sym_identifier);
-      TSNode func_identifier =
-          ts_node_child(ts_node_child(*local.function_definition_root, 1), 0);
-      Slice func_name = ts_node_range(func_identifier, src);
-
-      nob_log(VERBOSE, ORANGE("function %.*s is comptime dependent"),
-              ts_node_range(func_identifier, src).len,
-              ts_node_range(func_identifier, src).start);
-
-      hashmap_put2(&ctx->comptime_dependencies, (char *)func_name.start,
-                   func_name.len, (void *)1);
-
-    } else if (local.decleration_root) {
-      nob_log(VERBOSE, ORANGE("Stripping top level declaration with comptime"));
-      assert(ts_node_symbol(ts_node_child(*local.decleration_root, 1)) ==
-             sym_init_declarator);
-      assert(ts_node_symbol(
-                 ts_node_child(ts_node_child(*local.decleration_root, 1), 0)) ==
-             sym_identifier);
-
-      TSNode var_identifier =
-          ts_node_child(ts_node_child(*local.decleration_root, 1), 0);
-      Slice var_name = ts_node_range(var_identifier, src);
-
-      nob_log(VERBOSE, ORANGE("declaration %.*s is comptime dependent"),
-              ts_node_range(var_identifier, src).len,
-              ts_node_range(var_identifier, src).start);
-
-      hashmap_put2(&ctx->comptime_dependencies, (char *)var_name.start,
-                   var_name.len, (void *)1);
-
-    } else if (local.type_definition_root) {
-      nob_log(VERBOSE, ORANGE("Stripping type definition with comptime"));
-      TSNode type_name_node =
-          find_type_definition_identifier(*local.type_definition_root, src);
-      if (!ts_node_is_null(type_name_node)) {
-        Slice type_name = ts_node_range(type_name_node, src);
-        nob_log(VERBOSE, ORANGE("type %.*s is comptime dependent"),
-                type_name.len, type_name.start);
-        hashmap_put2(&ctx->comptime_dependencies, (char *)type_name.start,
-                     type_name.len, (void *)1);
-      }
-
-    } else {
-      nob_log(VERBOSE, ORANGE("Stripping top level comptime block"));
+  if (!ts_node_is_null(local->function_definition)) {
+    assert(ts_node_symbol(ts_node_child(local->function_definition, 1)) ==
+           sym_function_declarator);
+    assert(ts_node_symbol(ts_node_child(
+               ts_node_child(local->function_definition, 1), 0)) ==
+           sym_identifier);
+    TSNode func_identifier =
+        ts_node_child(ts_node_child(local->function_definition, 1), 0);
+    Slice func_name = ts_node_range(func_identifier, src);
+
+    nob_log(VERBOSE, ORANGE("function %.*s is comptime dependent"),
+            func_name.len, func_name.start);
+
+    ident_set_add(&ctx->comptime_dependencies,
+                  intern(ctx->idents, func_name));
+
+  } else if (!ts_node_is_null(local->declaration)) {
+    nob_log(VERBOSE, ORANGE("Stripping top level declaration with comptime"));
+    assert(ts_node_symbol(ts_node_child(local->declaration, 1)) ==
+           sym_init_declarator);
+    assert(ts_node_symbol(ts_node_child(ts_node_child(local->declaration, 1),
+                                        0)) == sym_identifier);
+
+    TSNode var_identifier =
+        ts_node_child(ts_node_child(local->declaration, 1), 0);
+    Slice var_name = ts_node_range(var_identifier, src);
+
+    nob_log(VERBOSE, ORANGE("declaration %.*s is comptime dependent"),
+            var_name.len, var_name.start);
+
+    ident_set_add(&ctx->comptime_dependencies, intern(ctx->idents, var_name));
+
+  } else if (!ts_node_is_null(local->type_definition)) {
+    nob_log(VERBOSE, ORANGE("Stripping type definition with comptime"));
+    TSNode type_name_node =
+        find_type_definition_identifier(local->type_definition, src);
+    if (!ts_node_is_null(type_name_node)) {
+      Slice type_name = ts_node_range(type_name_node, src);
+      nob_log(VERBOSE, ORANGE("type %.*s is comptime dependent"),
+              type_name.len, type_name.start);
+      ident_set_add(&ctx->comptime_dependencies,
+                    intern(ctx->idents, type_name));
     }
 
-    da_append(&ctx->comptime_stmts, r);
+  } else {
+    nob_log(VERBOSE, ORANGE("Stripping top level comptime block"));
   }
 
-  uint32_t n = ts_node_child_count(node);
-  for (uint32_t i = 0; i < n; i++) {
-    local.child_idx = (int)i;
-    register_comptime_dependencies(ctx, local, ts_node_child(node, i), src,
-                                   depth + 1);
-  }
+  da_append(&ctx->comptime_stmts, r);
+  da_append(&ctx->comptime_stmt_placeholder, placeholder);
 }
 
 // Second pass: remove the statements whose identifiers were marked as
@@ -385,6 +448,7 @@ static void register_comptime_dependencies(WalkContext *const ctx,
 static void strip_comptime_dependencies(WalkContext *const ctx,
                                         LocalWalkContext local, TSNode node,
                                         const char *src, unsigned depth) {
+  STATS_VISIT(StatsPass_CollectStatements);
   TSSymbol sym = ts_node_symbol(node);
   switch (sym) {
   case sym_function_definition:
@@ -409,10 +473,10 @@ static void strip_comptime_dependencies(WalkContext *const ctx,
     break;
   }
 
-  Slice node_slice = ts_node_range(node, src);
+  // dependent names were interned when the first pass marked them
   if ((sym == sym_identifier || sym == alias_sym_type_identifier) &&
-      hashmap_get2(&ctx->comptime_dependencies, (char *)node_slice.start,
-                   node_slice.len)) {
+      ident_set_has(&ctx->comptime_dependencies,
+                    interner_find(ctx->idents, ts_node_range(node, src)))) {
     nob_log(VERBOSE, MAGENTA("Within a comptime dependency :: !"));
 
     if (local.function_definition_root) {
@@ -451,10 +515,98 @@ static void strip_comptime_dependencies(WalkContext *const ctx,
   }
 }
 
-// Entry point: run the marking pass followed by the stripping pass on the tree.
-void cct_collect_comptime_statements(WalkContext *ctx, TSTree *tree,
+// Only chunks mentioning a dependent name can hold something to strip.
+static bool chunk_mentions_dependency(const WalkContext *ctx,
+                                      const Chunk *chunk, const char *src,
+                                      Slices *scratch) {
+  scratch->count = 0;
+  slice_collect_identifiers(
+      (Slice){.start = src + chunk->offset, .len = (int)chunk->len}, scratch);
+  nob_da_foreach(Slice, name, scratch) {
+    if (ident_set_has(&ctx->comptime_dependencies,
+                      interner_find(ctx->idents, *name)))
+      return true;
+  }
+  return false;
+}
+
+// Append the uses the uses query finds at each mention of `needle`.
+static void find_comptime_uses(QueryRun *run, const Chunk *chunk,
+                               const char *src, const char *needle,
+                               size_t len, ComptimeUses *out) {
+  MentionWalk walk = {0};
+  mention_walk_init(&walk, ts_tree_root_node(chunk->tree));
+  for (uint32_t at = 0; chunk_find(chunk, src, needle, len, &at); at += len) {
+    MentionPath path = mention_walk_to(&walk, at);
+    if (ts_node_is_null(path.parent))
+      continue;
+    query_run(run, Query_ComptimeUses, path.parent, src + chunk->offset, at,
+              at + (uint32_t)len);
+    TSQueryMatch match;
+    while (query_next_match(run, &match)) {
+      ComptimeUse use = {query_capture(run, &match, "comptime"),
+                         ComptimeUse_Block, path};
+      if (ts_node_is_null(use.node))
+        use = (ComptimeUse){query_capture(run, &match, "placeholder"),
+                            ComptimeUse_Placeholder, path};
+      if (ts_node_is_null(use.node))
+        use = (ComptimeUse){query_capture(run, &match, "uncorrected"),
+                            ComptimeUse_Uncorrected, path};
+      nob_da_append(out, use);
+    }
+  }
+  mention_walk_free(&walk);
+}
+
+// Source order, which is the order of the comptime statements.
+static int compare_uses(const void *a, const void *b) {
+  uint32_t x = ts_node_start_byte(((const ComptimeUse *)a)->node);
+  uint32_t y = ts_node_start_byte(((const ComptimeUse *)b)->node);
+  return (x > y) - (x < y);
+}
+
+// Entry point: run the marking pass followed by the stripping pass on every
+// chunk that can matter to them.
+void cct_collect_comptime_statements(WalkContext *ctx, const Chunks *chunks,
                                      const char *src) {
-  TSNode root = ts_tree_root_node(tree);
-  register_comptime_dependencies(ctx, (LocalWalkContext){0}, root, src, 0);
-  strip_comptime_dependencies(ctx, (LocalWalkContext){0}, root, src, 0);
+  QueryRun run = {0};
+  ComptimeUses uses = {0};
+  nob_da_foreach(Chunk, chunk, chunks) {
+    uses.count = 0;
+    // `_Comptime` also finds what is left of `_ComptimeType`
+    find_comptime_uses(&run, chunk, src, "_Comptime", 9, &uses);
+    find_comptime_uses(&run, chunk, src, "_COMPTIMETYPE_", 14, &uses);
+    if (uses.count == 0) {
+      STATS_ADD(chunks_skipped, 1);
+      continue;
+    }
+    if (uses.count > 1)
+      qsort(uses.items, uses.count, sizeof(*uses.items), compare_uses);
+
+    uint32_t next = 0;
+    nob_da_foreach(ComptimeUse, use, &uses) {
+      // a node spanning two mentions is found twice
+      if (use != uses.items && ts_node_start_byte(use->node) < next)
+        continue;
+      next = ts_node_end_byte(use->node);
+      STATS_VISIT(StatsPass_CollectStatements);
+      register_comptime_use(ctx, src + chunk->offset, use);
+    }
+  }
+  query_run_free(&run);
+  free(uses.items);
+  if (ctx->comptime_dependencies.count == 0)
+    return;
+
+  Slices names = {0};
+  nob_da_foreach(Chunk, chunk, chunks) {
+    if (!chunk_mentions_dependency(ctx, chunk, src, &names)) {
+      STATS_ADD(chunks_skipped, 1);
+      continue;
+    }
+    strip_comptime_dependencies(ctx, (LocalWalkContext){0},
+                                ts_tree_root_node(chunk->tree),
+                                src + chunk->offset, 0);
+  }
+  free(names.items);
 }
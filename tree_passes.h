@@ -3,12 +3,12 @@
 
 #include "comptime_common.h"
 
-TSTree *cct_correct_comptimetype_nodes(TSParser *parser, TSTree *tree,
-                                       const char *src, size_t len,
-                                       WalkContext *ctx,
-                                       String_Builder *out_source);
+void cct_correct_comptimetype_nodes(TSParser *parser, Chunks *chunks,
+                                    const char *src, size_t len,
+                                    WalkContext *ctx,
+                                    String_Builder *out_source);
 
-void cct_collect_comptime_statements(WalkContext *ctx, TSTree *tree,
+void cct_collect_comptime_statements(WalkContext *ctx, const Chunks *chunks,
                                      const char *src);
 
 #endif // CCOMPTIME_TREE_PASSES_H
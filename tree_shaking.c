@@ -0,0 +1,389 @@
+#include "stats.h"
+#include "tree_shaking.h"
+#include "tree_sitter_c_api.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+  size_t *items;
+  size_t count, capacity;
+} ItemIndices;
+
+// Follow the `declarator` chain (pointer, array, function, init, parenthesized)
+// down to the identifier that is actually being declared.
+static TSNode declarator_identifier(TSNode node) {
+  while (!ts_node_is_null(node)) {
+    TSSymbol sym = ts_node_symbol(node);
+    if (sym == sym_identifier || sym == alias_sym_type_identifier)
+      return node;
+
+    TSNode next = ts_node_child_by_field_name(node, "declarator", 10);
+    if (ts_node_is_null(next) && ts_node_named_child_count(node) > 0)
+      next = ts_node_named_child(node, 0);
+    node = next;
+  }
+  return node;
+}
+
+static bool is_prototype_declarator(TSNode declarator) {
+  if (ts_node_symbol(declarator) != sym_function_declarator)
+    return false;
+  TSNode inner = ts_node_child_by_field_name(declarator, "declarator", 10);
+  return !ts_node_is_null(inner) && ts_node_symbol(inner) == sym_identifier;
+}
+
+static bool has_child_symbol(TSNode node, TSSymbol sym) {
+  uint32_t n = ts_node_child_count(node);
+  for (uint32_t i = 0; i < n; i++) {
+    if (ts_node_symbol(ts_node_child(node, i)) == sym)
+      return true;
+  }
+  return false;
+}
+
+static void append_declared_name(TopLevelItem *item, TSNode declarator,
+                                 const char *src) {
+  TSNode id = declarator_identifier(declarator);
+  if (!ts_node_is_null(id))
+    nob_da_append(&item->names, ts_node_range(id, src));
+}
+
+// Declarations are shaken when they define storage or only declare
+// functions; `extern` objects and declarations that also define a tagged
+// type are kept as-is.
+static TopLevelKind classify_declaration(TopLevelItem *item, TSNode node,
+                                         const char *src) {
+  uint32_t n = ts_node_child_count(node);
+  bool only_prototypes = true;
+  bool is_extern = false;
+
+  for (uint32_t i = 0; i < n; i++) {
+    TSNode child = ts_node_child(node, i);
+    const char *field = ts_node_field_name_for_child(node, i);
+
+    if (ts_node_symbol(child) == sym_storage_class_specifier) {
+      Slice spec = ts_node_range(child, src);
+      if (slice_begins_with(spec, "extern"))
+        is_extern = true;
+    } else if (field && strcmp(field, "type") == 0) {
+      if (!ts_node_is_null(ts_node_child_by_field_name(child, "body", 4)))
+        return TopLevelKind_Other;
+    } else if (field && strcmp(field, "declarator") == 0) {
+      if (!is_prototype_declarator(child))
+        only_prototypes = false;
+      append_declared_name(item, child, src);
+    }
+  }
+
+  if (only_prototypes)
+    return TopLevelKind_Prototype;
+  return is_extern ? TopLevelKind_Other : TopLevelKind_Variable;
+}
+
+static void index_top_level_node(WalkContext *ctx, TSNode node,
+                                 const char *src) {
+  STATS_VISIT(StatsPass_IndexTopLevel);
+  TopLevelItem item = {.kind = TopLevelKind_Other,
+                       .node = node,
+                       .src = src,
+                       .range = ts_node_range(node, src)};
+
+  switch (ts_node_symbol(node)) {
+  case sym_preproc_if:
+  case sym_preproc_ifdef:
+  case sym_preproc_else:
+  case sym_preproc_elif:
+  case sym_preproc_elifdef: {
+    // Conditional groups are transparent: index what is inside them and leave
+    // the directives themselves untouched.
+    uint32_t n = ts_node_named_child_count(node);
+    for (uint32_t i = 0; i < n; i++) {
+      index_top_level_node(ctx, ts_node_named_child(node, i), src);
+    }
+    return;
+  }
+  case sym_function_definition:
+    if (!ts_node_has_error(node) &&
+        !has_child_symbol(node, sym_attribute_specifier)) {
+      item.kind = TopLevelKind_Function;
+      append_declared_name(
+          &item, ts_node_child_by_field_name(node, "declarator", 10), src);
+    }
+    break;
+  case sym_declaration:
+    if (!ts_node_has_error(node))
+      item.kind = classify_declaration(&item, node, src);
+    break;
+  case sym_preproc_def:
+  case sym_preproc_function_def:
+    item.kind = TopLevelKind_Macro;
+    nob_da_append(&item.names,
+                  ts_node_range(ts_node_child_by_field_name(node, "name", 4),
+                                src));
+    break;
+  default:
+    if (!ts_node_is_named(node))
+      return;
+    break;
+  }
+
+  if ((item.kind == TopLevelKind_Function ||
+       item.kind == TopLevelKind_Variable ||
+       item.kind == TopLevelKind_Prototype) &&
+      item.names.count == 0) {
+    item.kind = TopLevelKind_Other;
+  }
+
+  nob_da_append(&ctx->top_level, item);
+}
+
+// Record every top-level item of the (corrected) program together with the
+// names it declares, so later stages can reason about what the comptime
+// blocks actually need.
+void cct_index_top_level(WalkContext *ctx, const Chunks *chunks,
+                         const char *src) {
+  nob_da_foreach(Chunk, chunk, chunks) {
+    TSNode root = ts_tree_root_node(chunk->tree);
+    uint32_t n = ts_node_child_count(root);
+    for (uint32_t i = 0; i < n; i++) {
+      index_top_level_node(ctx, ts_node_child(root, i), src + chunk->offset);
+    }
+  }
+}
+
+static void reach_item(TopLevelItem *item, Slices *worklist) {
+  if (item->reachable)
+    return;
+  item->reachable = true;
+  slice_collect_identifiers(item->range, worklist);
+}
+
+// name -> ItemIndices of the functions, variables, prototypes and macros
+// declaring it
+static void index_definitions(WalkContext *ctx, SliceMap *definitions) {
+  nob_da_foreach(TopLevelItem, item, &ctx->top_level) {
+    if (item->kind == TopLevelKind_Other)
+      continue;
+
+    nob_da_foreach(Slice, name, &item->names) {
+      SliceMapEntry *entry = slice_map_entry(definitions, *name);
+      if (!entry->val)
+        entry->val = calloc(1, sizeof(ItemIndices));
+      nob_da_append((ItemIndices *)entry->val,
+                    (size_t)(item - ctx->top_level.items));
+    }
+  }
+}
+
+static void free_definitions(SliceMap *definitions) {
+  SliceMapEntry *entry;
+  for (size_t it = 0; (entry = slice_map_next(definitions, &it));) {
+    ItemIndices *indices = entry->val;
+    free(indices->items);
+    free(indices);
+  }
+  slice_map_free(definitions);
+}
+
+// Mark every function and variable definition reachable from the comptime
+// blocks (transitively through other definitions and macros), with the
+// prototypes of the reached functions, and schedule the rest for removal from
+// the comptime-safe source. A reached macro pasting tokens (`helper_##x`) can
+// name anything, so it keeps everything.
+void cct_tree_shake(WalkContext *ctx) {
+  SliceMap definitions = {0};
+  SliceMap visited = {0};
+  Slices worklist = {0};
+
+  index_definitions(ctx, &definitions);
+  nob_da_foreach(TopLevelItem, item, &ctx->top_level) {
+    if (item->kind == TopLevelKind_Other)
+      reach_item(item, &worklist);
+  }
+
+  nob_da_foreach(Slice, stmt, &ctx->comptime_stmts) {
+    slice_collect_identifiers(*stmt, &worklist);
+  }
+
+  bool pastes_tokens = false;
+  while (worklist.count > 0 && !pastes_tokens) {
+    Slice name = worklist.items[--worklist.count];
+    if (slice_map_get(&visited, name))
+      continue;
+    slice_map_put(&visited, name, (void *)1);
+
+    ItemIndices *indices = slice_map_get(&definitions, name);
+    if (!indices)
+      continue;
+
+    nob_da_foreach(size_t, index, indices) {
+      TopLevelItem *item = &ctx->top_level.items[*index];
+      reach_item(item, &worklist);
+      if (item->kind == TopLevelKind_Macro && slice_contains(item->range, "##"))
+        pastes_tokens = true;
+    }
+  }
+
+  if (pastes_tokens) {
+    nob_log(INFO, "Tree shaking kept everything: a reached macro pastes "
+                  "tokens");
+  } else {
+    nob_da_foreach(TopLevelItem, item, &ctx->top_level) {
+      if (item->reachable || item->kind == TopLevelKind_Macro)
+        continue;
+
+      nob_log(VERBOSE, GRAY("Tree shaking unreachable '%.*s'"),
+              item->names.items[0].len, item->names.items[0].start);
+      nob_da_append(&ctx->shaken, item->range);
+    }
+    nob_log(INFO, "Tree shaking removed %zu of %zu top level items",
+            ctx->shaken.count, ctx->top_level.count);
+  }
+
+  free_definitions(&definitions);
+  slice_map_free(&visited);
+  free(worklist.items);
+}
+
+static bool has_static_local(TSNode node, const char *src) {
+  STATS_VISIT(StatsPass_ClassifyBlocks);
+  if (ts_node_symbol(node) == sym_storage_class_specifier &&
+      ts_node_is_keyword(node, src, "static"))
+    return true;
+  uint32_t n = ts_node_named_child_count(node);
+  for (uint32_t i = 0; i < n; i++) {
+    if (has_static_local(ts_node_named_child(node, i), src))
+      return true;
+  }
+  return false;
+}
+
+// Shared mutable state a block could touch: non-const globals and functions
+// keeping `static` locals.
+static bool is_shared_state(TopLevelItem *item) {
+  switch (item->kind) {
+  case TopLevelKind_Variable:
+    return !ts_declaration_is_const_object(item->node, item->src);
+  case TopLevelKind_Function:
+    return has_static_local(ts_node_child_by_field_name(item->node, "body", 4),
+                            item->src);
+  default:
+    return false;
+  }
+}
+
+static bool slices_contain(Slices *slices, const char *name) {
+  size_t len = strlen(name);
+  nob_da_foreach(Slice, it, slices) {
+    if ((size_t)it->len == len && memcmp(it->start, name, len) == 0)
+      return true;
+  }
+  return false;
+}
+
+static size_t group_find(size_t *parent, size_t i) {
+  while (parent[i] != i) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+static void group_union(size_t *parent, size_t a, size_t b) {
+  a = group_find(parent, a);
+  b = group_find(parent, b);
+  if (a != b)
+    parent[a > b ? a : b] = a < b ? a : b;
+}
+
+// Partition the blocks into groups that may run concurrently with each
+// other: blocks reaching (transitively through functions and macros) the same
+// shared mutable state end up in one group and keep their relative order.
+// `_ComptimeSequential` blocks, and every group sharing state with them, form
+// the sequential group (-1), which runs in order on the main thread/process.
+// `_ComptimeParallel` gives a block a group of its own whatever it touches,
+// since library state is invisible to the analysis anyway.
+void cct_classify_blocks(WalkContext *ctx) {
+  SliceMap definitions = {0};
+  index_definitions(ctx, &definitions);
+
+  size_t block_count = ctx->comptime_stmts.count;
+  size_t sequential = block_count; // stands for the sequential group
+  size_t *parent = malloc((block_count + 1) * sizeof(*parent));
+  for (size_t i = 0; i <= block_count; i++) {
+    parent[i] = i;
+  }
+  // per top-level item: 1 + the first block touching it, 0 if none did
+  size_t *owner = calloc(ctx->top_level.count, sizeof(*owner));
+
+  for (size_t block = 0; block < block_count; block++) {
+    Slices worklist = {0};
+    slice_collect_identifiers(ctx->comptime_stmts.items[block], &worklist);
+
+    if (slices_contain(&worklist, "_ComptimeSequential")) {
+      group_union(parent, block, sequential);
+      worklist.count = 0;
+    } else if (slices_contain(&worklist, "_ComptimeParallel")) {
+      worklist.count = 0;
+    }
+
+    SliceMap visited = {0};
+    while (worklist.count > 0) {
+      Slice name = worklist.items[--worklist.count];
+      if (slice_map_get(&visited, name))
+        continue;
+      slice_map_put(&visited, name, (void *)1);
+
+      ItemIndices *indices = slice_map_get(&definitions, name);
+      if (!indices)
+        continue;
+
+      nob_da_foreach(size_t, index, indices) {
+        TopLevelItem *item = &ctx->top_level.items[*index];
+        if (is_shared_state(item)) {
+          nob_log(VERBOSE, "Comptime block #%zu touches '%.*s'", block,
+                  name.len, name.start);
+          if (owner[*index])
+            group_union(parent, block, owner[*index] - 1);
+          else
+            owner[*index] = block + 1;
+        }
+        slice_collect_identifiers(item->range, &worklist);
+      }
+    }
+    slice_map_free(&visited);
+    free(worklist.items);
+  }
+
+  // number the groups in order of their first block
+  size_t *group_of_root = malloc((block_count + 1) * sizeof(*group_of_root));
+  for (size_t i = 0; i <= block_count; i++) {
+    group_of_root[i] = SIZE_MAX;
+  }
+  int group_count = 0;
+  size_t sequential_count = 0;
+  for (size_t block = 0; block < block_count; block++) {
+    size_t root = group_find(parent, block);
+    int group = -1;
+    if (root != group_find(parent, sequential)) {
+      if (group_of_root[root] == SIZE_MAX)
+        group_of_root[root] = (size_t)group_count++;
+      group = (int)group_of_root[root];
+    } else {
+      sequential_count++;
+    }
+    nob_da_append(&ctx->comptime_stmt_group, group);
+  }
+
+  nob_log(INFO,
+          "%zu comptime blocks in %d concurrent groups, %zu sequential",
+          block_count - sequential_count, group_count, sequential_count);
+
+  free(group_of_root);
+  free(owner);
+  free(parent);
+  free_definitions(&definitions);
+}
@@ -0,0 +1,13 @@
+#ifndef CCOMPTIME_TREE_SHAKING_H
+#define CCOMPTIME_TREE_SHAKING_H
+
+#include "comptime_common.h"
+
+void cct_index_top_level(WalkContext *ctx, const Chunks *chunks,
+                         const char *src);
+
+void cct_tree_shake(WalkContext *ctx);
+
+void cct_classify_blocks(WalkContext *ctx);
+
+#endif // CCOMPTIME_TREE_SHAKING_H